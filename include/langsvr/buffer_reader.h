@@ -48,6 +48,9 @@ class BufferReader final : public Reader {
     /// @copydoc Reader::Read
     size_t Read(std::byte* out, size_t count) override;
 
+    /// @copydoc Reader::ReadSome
+    size_t ReadSome(std::byte* out, size_t count) override { return Read(out, count); }
+
   private:
     /// The data to read from
     const std::byte* data_ = nullptr;
@@ -44,6 +44,9 @@ class BufferWriter final : public Writer {
     /// @copydoc Writer::Write
     Result<SuccessType> Write(const std::byte* in, size_t count) override;
 
+    /// @copydoc Writer::WriteV
+    Result<SuccessType> WriteV(Span<ConstBuffer> buffers) override;
+
     /// @returns the buffer content as a string view
     std::string_view BufferString() const;
 
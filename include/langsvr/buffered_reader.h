@@ -0,0 +1,87 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LANGSVR_BUFFERED_READER_H_
+#define LANGSVR_BUFFERED_READER_H_
+
+#include <string_view>
+#include <vector>
+
+#include "langsvr/reader.h"
+#include "langsvr/result.h"
+
+namespace langsvr {
+
+/// BufferedReader is an implementation of the Reader interface that reads from another Reader
+/// through an owned, refillable buffer, so that small reads do not each call the underlying
+/// reader. The buffer is filled with Reader::ReadSome(), so the BufferedReader never waits for data
+/// beyond what has already been sent.
+class BufferedReader final : public Reader {
+  public:
+    /// The default size of the buffer in bytes
+    static constexpr size_t kDefaultCapacity = 16 * 1024;
+
+    /// Constructor
+    /// @param source the reader to read from. Must outlive the BufferedReader.
+    /// @param capacity the initial size of the buffer in bytes. Must be greater than 0.
+    explicit BufferedReader(Reader& source, size_t capacity = kDefaultCapacity);
+
+    /// Destructor
+    ~BufferedReader() override;
+
+    /// @copydoc Reader::Read
+    size_t Read(std::byte* out, size_t count) override;
+
+    /// @copydoc Reader::ReadSome
+    size_t ReadSome(std::byte* out, size_t count) override;
+
+    /// ReadUntil reads up to and including the next occurrence of @p delimiter, growing the buffer
+    /// if the delimiter is not found within it.
+    /// @param delimiter the byte sequence to search for. Must not be empty.
+    /// @param max_length the maximum number of bytes to read before the delimiter
+    /// @returns a view of the bytes before the delimiter, which remains valid until the next call
+    /// to a method of the BufferedReader. Returns a failure if the end of the stream is reached, or
+    /// more than @p max_length bytes are read, before the delimiter is found.
+    Result<std::string_view> ReadUntil(std::string_view delimiter, size_t max_length);
+
+  private:
+    /// Fill reads more data from the source into the end of the buffer, moving the unread data to
+    /// the front of the buffer, or growing the buffer, if there is no space at the end.
+    /// @returns the number of bytes read, which is 0 at the end of the stream.
+    size_t Fill();
+
+    /// The reader being buffered
+    Reader& source_;
+    /// The buffer. Bytes in [begin_, end_) have been read from the source, but not yet consumed.
+    std::vector<std::byte> buffer_;
+    size_t begin_ = 0;
+    size_t end_ = 0;
+};
+
+}  // namespace langsvr
+
+#endif  // LANGSVR_BUFFERED_READER_H_
@@ -0,0 +1,60 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LANGSVR_CANCELLATION_TOKEN_H_
+#define LANGSVR_CANCELLATION_TOKEN_H_
+
+#include <atomic>
+
+namespace langsvr {
+
+/// CancellationToken can be passed to a Session request handler, and is used to query whether the
+/// client has cancelled the request with a '$/cancelRequest' notification.
+/// Long-running handlers should poll IsCancelled() and return early once it returns true. The
+/// result of a cancelled request is not sent, and a 'RequestCancelled' error is sent instead.
+/// A CancellationToken must not be used after the handler it was passed to has returned.
+class CancellationToken {
+  public:
+    /// Constructor. The token is never cancelled.
+    CancellationToken() = default;
+
+    /// Constructor
+    /// @param cancelled the flag that is set when the request is cancelled
+    explicit CancellationToken(const std::atomic<bool>* cancelled) : cancelled_(cancelled) {}
+
+    /// @returns true if the request has been cancelled
+    bool IsCancelled() const {
+        return cancelled_ && cancelled_->load(std::memory_order_relaxed);
+    }
+
+  private:
+    const std::atomic<bool>* cancelled_ = nullptr;
+};
+
+}  // namespace langsvr
+
+#endif  // LANGSVR_CANCELLATION_TOKEN_H_
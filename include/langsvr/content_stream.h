@@ -29,11 +29,13 @@
 #define LANGSVR_CONTENT_STREAM_H_
 
 #include <string>
+#include <string_view>
 
 #include "langsvr/result.h"
 
 // Forward declarations
 namespace langsvr {
+class BufferedReader;
 class Reader;
 class Writer;
 }  // namespace langsvr
@@ -41,11 +43,46 @@ class Writer;
 namespace langsvr {
 
 /// ReadContent reads the next content header prefixed chunk of data from the reader @p reader
-/// @param reader the byte stream reader
+/// The header fields may be in any order, and field names are case-insensitive. Only the
+/// 'Content-Length' field is used.
+/// @param reader the byte stream reader. As @p reader is not buffered, the header is read a byte at
+/// a time.
 /// @see
 /// https://microsoft.github.io/language-server-protocol/specifications/lsp/3.17/specification/#baseProtocol
 Result<std::string> ReadContent(Reader& reader);
 
+/// ReadContent reads the next content header prefixed chunk of data from the buffered reader
+/// @p reader. The header is found and parsed within the reader's buffer, without copying.
+/// @param reader the buffered byte stream reader
+/// @see ReadContent(Reader&)
+Result<std::string> ReadContent(BufferedReader& reader);
+
+/// ReadContent reads the next content header prefixed chunk of data from the reader @p reader into
+/// @p buffer. The buffer's capacity is reused, so a buffer that is passed to each call does not
+/// need to be reallocated once it has grown to the size of the largest message.
+/// @param reader the byte stream reader
+/// @param buffer the buffer that holds the content. The previous content of the buffer is
+/// discarded.
+/// @returns a view of the content held by @p buffer, which remains valid until @p buffer is next
+/// modified.
+/// @see ReadContent(Reader&)
+Result<std::string_view> ReadContent(Reader& reader, std::string& buffer);
+
+/// ReadContent reads the next content header prefixed chunk of data from the buffered reader
+/// @p reader into @p buffer.
+/// @see ReadContent(Reader&, std::string&)
+Result<std::string_view> ReadContent(BufferedReader& reader, std::string& buffer);
+
+/// FindContent looks for a complete content header prefixed chunk of data at the start of @p data,
+/// without reading from a stream. This is used to frame messages received by a non-blocking
+/// transport, which cannot wait in ReadContent() for the rest of a partially received message.
+/// @param data the bytes received so far
+/// @param content assigned a view of the content within @p data, if a complete chunk was found
+/// @returns the length of the complete chunk, including the header, or 0 if @p data does not yet
+/// hold a complete chunk.
+/// @see ReadContent(Reader&)
+Result<size_t> FindContent(std::string_view data, std::string_view& content);
+
 /// WriteContent writes the content header prefixed chunk of data to the writer @p writer
 /// @param writer the byte stream writer
 /// @param content the content string
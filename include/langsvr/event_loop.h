@@ -0,0 +1,132 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LANGSVR_EVENT_LOOP_H_
+#define LANGSVR_EVENT_LOOP_H_
+
+#include <functional>
+#include <memory>
+#include <string_view>
+
+#include "langsvr/result.h"
+
+// Forward declarations
+namespace langsvr {
+class Session;
+}  // namespace langsvr
+
+namespace langsvr {
+
+/// EventLoop is a transport that drives one or more Sessions over file descriptors, such as
+/// stdin / stdout, pipes or sockets.
+/// Each Session is added with the file descriptor it receives messages from, and the file
+/// descriptor it sends messages to. Received bytes are framed into content header prefixed
+/// messages, which are passed to Session::Receive() on the thread calling Run().
+/// Messages sent by the Session are queued when the output file descriptor cannot accept them, and
+/// are written once it becomes writable. Sessions may send from any thread, such as the workers of
+/// the Session's Executor.
+/// EventLoop is only available on Linux.
+class EventLoop {
+  public:
+    /// Backend is an enumerator of the I/O mechanisms that can be used by an EventLoop
+    enum class Backend {
+        /// Readiness notification with epoll, and non-blocking read() and writev() calls.
+        kEpoll,
+        /// Completion based I/O with io_uring. Sockets are received with multishot receives into
+        /// buffers provided to the kernel, and the reads and writes of all the Sessions are
+        /// submitted with a single io_uring_enter() call per loop iteration.
+        kIoUring,
+    };
+
+    /// ErrorHandler is the function used to report a failure to receive a message for a Session
+    using ErrorHandler = std::function<void(Session& session, const Failure& failure)>;
+
+    /// Create constructs a new EventLoop
+    /// @param backend the preferred backend. If @p backend is Backend::kIoUring, and io_uring
+    /// support was not built (LANGSVR_ENABLE_IO_URING), or is not supported by the running
+    /// kernel, then the epoll backend is used.
+    /// @returns the EventLoop, or a failure if the loop could not be created
+    static Result<std::unique_ptr<EventLoop>> Create(Backend backend = Backend::kEpoll);
+
+    /// Destructor. Sessions that are still added to the loop can no longer send messages.
+    virtual ~EventLoop();
+
+    /// @returns the backend used by the loop
+    virtual Backend GetBackend() const = 0;
+
+    /// SetErrorHandler sets the function used to report a failure to receive a message, including
+    /// read errors and malformed content headers, which close the connection, and the failures
+    /// returned by Session::Receive().
+    /// @param handler the error handler
+    void SetErrorHandler(ErrorHandler&& handler) { error_handler_ = std::move(handler); }
+
+    /// Add adds @p session to the loop, and replaces the Session's sender with one that writes
+    /// to @p out_fd. The file descriptors are not closed by the loop, but the backend may change
+    /// their O_NONBLOCK flag.
+    /// The Session is removed from the loop once the end of stream of @p in_fd is reached.
+    /// Add must not be called concurrently with Run().
+    /// @param session the Session. Must outlive its use by the loop.
+    /// @param in_fd the file descriptor the Session receives messages from
+    /// @param out_fd the file descriptor the Session sends messages to. May equal @p in_fd for a
+    /// socket.
+    /// @returns a failure if the file descriptors could not be added to the loop
+    virtual Result<SuccessType> Add(Session& session, int in_fd, int out_fd) = 0;
+
+    /// Run dispatches messages until all the Sessions have been removed from the loop, or Stop()
+    /// is called.
+    /// @returns a failure if waiting for events fails
+    virtual Result<SuccessType> Run() = 0;
+
+    /// Stop causes Run() to return once the messages of the current events have been dispatched.
+    /// Stop may be called from any thread.
+    virtual void Stop() = 0;
+
+  protected:
+    /// Constructor
+    EventLoop();
+
+    /// Dispatch passes each complete message at the start of @p data to Session::Receive(), and
+    /// removes the dispatched messages from @p data.
+    /// @param session the Session that received @p data
+    /// @param data the received bytes that have not yet been dispatched
+    /// @returns false if @p data starts with a malformed content header, which has been reported
+    /// to the error handler
+    bool Dispatch(Session& session, std::string_view& data);
+
+    /// ReportError passes @p failure to the error handler, if one is set
+    void ReportError(Session& session, const Failure& failure);
+
+  private:
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    ErrorHandler error_handler_;
+};
+
+}  // namespace langsvr
+
+#endif  // LANGSVR_EVENT_LOOP_H_
@@ -0,0 +1,55 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LANGSVR_EXECUTOR_H_
+#define LANGSVR_EXECUTOR_H_
+
+#include <functional>
+#include <string_view>
+
+namespace langsvr {
+
+/// An interface for running tasks asynchronously
+class Executor {
+  public:
+    /// Task is a function run by the executor
+    using Task = std::function<void()>;
+
+    /// Destructor
+    virtual ~Executor();
+
+    /// Post queues @p task to be run by the executor.
+    /// Tasks posted with the same non-empty @p strand are run one at a time, in the order that they
+    /// were posted. Tasks posted with an empty @p strand may run concurrently with any other task.
+    /// @param strand the ordering key of the task, or an empty string for an unordered task
+    /// @param task the task to run
+    virtual void Post(std::string_view strand, Task&& task) = 0;
+};
+
+}  // namespace langsvr
+
+#endif  // LANGSVR_EXECUTOR_H_
@@ -0,0 +1,78 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LANGSVR_FD_READER_H_
+#define LANGSVR_FD_READER_H_
+
+#include "langsvr/reader.h"
+#include "langsvr/result.h"
+
+namespace langsvr {
+
+/// FdReader is an implementation of the Reader interface that reads from a POSIX file descriptor,
+/// such as stdin, a pipe or a socket.
+/// The file descriptor may be blocking or non-blocking. Read() and ReadSome() wait for data on a
+/// non-blocking file descriptor with poll(), and TryRead() can be used to read without blocking.
+class FdReader final : public Reader {
+  public:
+    /// Constructor
+    /// @param fd the file descriptor to read from. The FdReader does not take ownership of the
+    /// file descriptor.
+    explicit FdReader(int fd) : fd_(fd) {}
+
+    /// Destructor
+    ~FdReader() override;
+
+    /// @copydoc Reader::Read
+    size_t Read(std::byte* out, size_t count) override;
+
+    /// @copydoc Reader::ReadSome
+    size_t ReadSome(std::byte* out, size_t count) override;
+
+    /// The value returned by TryRead() when no data is available
+    static constexpr size_t kWouldBlock = ~size_t{0};
+
+    /// TryRead reads up to @p count bytes that can be read without blocking, if the file
+    /// descriptor is non-blocking.
+    /// @param out a pointer to the byte buffer that will be filled with the read data. Must be at
+    /// least @p count size.
+    /// @param count the maximum number of bytes to read. Must be greater than 0.
+    /// @returns the number of bytes read, which is 0 at the end of the stream, or kWouldBlock if no
+    /// data is available. Returns a failure describing the read error.
+    Result<size_t> TryRead(std::byte* out, size_t count);
+
+    /// @returns the file descriptor
+    int Fd() const { return fd_; }
+
+  private:
+    /// The file descriptor
+    int fd_ = -1;
+};
+
+}  // namespace langsvr
+
+#endif  // LANGSVR_FD_READER_H_
@@ -0,0 +1,79 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LANGSVR_FD_WRITER_H_
+#define LANGSVR_FD_WRITER_H_
+
+#include "langsvr/result.h"
+#include "langsvr/writer.h"
+
+namespace langsvr {
+
+/// FdWriter is an implementation of the Writer interface that writes to a POSIX file descriptor,
+/// such as stdout, a pipe or a socket. WriteV() maps to writev(), or to sendmsg() for a socket, so
+/// a gather write is a single system call when the file descriptor can accept all the data.
+/// The file descriptor may be blocking or non-blocking. Write() and WriteV() wait for a
+/// non-blocking file descriptor to become writable with poll(), and TryWriteV() can be used to
+/// write without blocking.
+/// Writing to a socket that has been closed by the peer returns a failure. Where MSG_NOSIGNAL is
+/// not supported, and when writing to a pipe that has been closed by the reader, SIGPIPE is raised,
+/// which applications should ignore if they handle disconnection.
+class FdWriter final : public Writer {
+  public:
+    /// Constructor
+    /// @param fd the file descriptor to write to. The FdWriter does not take ownership of the file
+    /// descriptor.
+    explicit FdWriter(int fd);
+
+    /// Destructor
+    ~FdWriter() override;
+
+    /// @copydoc Writer::Write
+    Result<SuccessType> Write(const std::byte* in, size_t count) override;
+
+    /// @copydoc Writer::WriteV
+    Result<SuccessType> WriteV(Span<ConstBuffer> buffers) override;
+
+    /// TryWriteV writes as many of the bytes of @p buffers as can be written with a single
+    /// system call, without blocking if the file descriptor is non-blocking.
+    /// @param buffers the buffers to write
+    /// @returns the number of bytes written, which is 0 if the file descriptor is not writable.
+    Result<size_t> TryWriteV(Span<ConstBuffer> buffers);
+
+    /// @returns the file descriptor
+    int Fd() const { return fd_; }
+
+  private:
+    /// The file descriptor
+    int fd_ = -1;
+    /// True if #fd_ is a socket, which is written with sendmsg() and MSG_NOSIGNAL
+    bool is_socket_ = false;
+};
+
+}  // namespace langsvr
+
+#endif  // LANGSVR_FD_WRITER_H_
@@ -57,6 +57,10 @@ class Builder {
     /// @returns a new Value from the JSON string
     virtual Result<const Value*> Parse(std::string_view json) = 0;
 
+    /// Reset frees all the values created by the Builder, invalidating all Value pointers returned
+    /// by the Builder. The memory held by the Builder is kept for reuse by subsequent calls.
+    virtual void Reset() = 0;
+
     /// Creates a Null JSON value
     virtual const Value* Null() = 0;
 
@@ -92,6 +96,17 @@ class Builder {
     /// @param elements the elements of the array
     virtual const Value* Array(Span<const Value*> elements) = 0;
 
+    /// Creates an array of U64 JSON values. Equivalent to calling Array() with the U64() of each
+    /// element, without creating the intermediate values.
+    /// @param values the array elements
+    virtual const Value* U64Array(Span<json::U64> values) = 0;
+
+    /// Creates a JSON value from the encoded JSON @p json. Where supported by the backend, the
+    /// value is serialized by copying @p json verbatim, instead of re-encoding the value.
+    /// @param json the encoded JSON value
+    /// @returns the new JSON value, or a failure if @p json could not be parsed
+    virtual Result<const Value*> Raw(std::string_view json) = 0;
+
     /// Member represents a single member of a JSON object
     struct Member {
         /// The member name
@@ -0,0 +1,175 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef LANGSVR_JSON_STREAM_READER_H_
+#define LANGSVR_JSON_STREAM_READER_H_
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "langsvr/json/types.h"
+#include "langsvr/result.h"
+
+namespace langsvr::json {
+
+/// StreamReader is a pull-parser that reads JSON values directly from a JSON string, without
+/// building a tree of json::Value.
+/// Values are read in document order. Arrays are read by calling BeginArray(), then NextElement()
+/// before each element. Objects are read by calling BeginObject(), then NextMember() before each
+/// member value.
+/// Arrays and objects may be nested at most kMaxDepth deep, matching the limit of jsoncpp.
+class StreamReader {
+  public:
+    /// The maximum nesting depth of arrays and objects
+    static constexpr size_t kMaxDepth = 1000;
+
+    /// Constructor
+    /// @param json the JSON string. Must outlive the StreamReader.
+    explicit StreamReader(std::string_view json);
+
+    /// Destructor
+    ~StreamReader();
+
+    /// @returns the kind of the next value, without consuming it. Numbers are reported as kI64 if
+    /// they are integers that fit in a I64, kU64 if they are larger integers, otherwise kF64.
+    Result<json::Kind> Peek();
+
+    /// Consumes the next value, which must be null
+    Result<SuccessType> Null();
+
+    /// @returns the next value, which must be a Bool
+    Result<json::Bool> Bool();
+
+    /// @returns the next value, which must be a number representable by a I64
+    Result<json::I64> I64();
+
+    /// @returns the next value, which must be a number representable by a U64
+    Result<json::U64> U64();
+
+    /// @returns the next value, which must be a number
+    Result<json::F64> F64();
+
+    /// @returns the next value, which must be a String
+    Result<json::String> String();
+
+    /// @returns the next value, which must be a String. The returned view is only valid until the
+    /// next call to a method of the StreamReader.
+    Result<std::string_view> StringView();
+
+    /// Begins reading the next value, which must be an array
+    /// @returns a failure if the array would be nested deeper than kMaxDepth
+    Result<SuccessType> BeginArray();
+
+    /// Advances to the next element of the array being read.
+    /// @returns true if there is another element to read, or false if the end of the array was
+    /// reached.
+    Result<bool> NextElement();
+
+    /// Reads the next value, which must be an array of numbers representable by a U64. Accepts the
+    /// same JSON as BeginArray(), then NextElement() and U64() for each element, but parses plain
+    /// integer elements inline.
+    /// @param out assigned the array elements
+    Result<SuccessType> U64Array(std::vector<json::U64>& out);
+
+    /// Begins reading the next value, which must be an object
+    /// @returns a failure if the object would be nested deeper than kMaxDepth
+    Result<SuccessType> BeginObject();
+
+    /// Advances to the next member of the object being read.
+    /// @param name assigned the name of the member. The name is only valid until the next call to
+    /// NextMember().
+    /// @returns true if there is another member to read, in which case the member value is the next
+    /// value. Returns false if the end of the object was reached.
+    Result<bool> NextMember(std::string_view& name);
+
+    /// Consumes the next value, including all nested values. Arrays and objects are only checked
+    /// for matching brackets and nesting depth, their elements and members are not validated.
+    Result<SuccessType> Skip();
+
+    /// @returns success if all the values of the JSON string have been consumed.
+    Result<SuccessType> End();
+
+    /// Position is the read position of the StreamReader
+    struct Position {
+        /// The byte offset in the JSON string
+        size_t offset = 0;
+        /// True if the next element or member is the first of its array or object
+        bool first = false;
+        /// The number of arrays and objects that have begun, but not ended
+        size_t depth = 0;
+    };
+
+    /// @returns the current read position, which can be restored with Restore()
+    Position Save() const { return Position{offset_, first_, depth_}; }
+
+    /// Rewinds the reader to a position returned by Save()
+    void Restore(const Position& position) {
+        offset_ = position.offset;
+        first_ = position.first;
+        depth_ = position.depth;
+    }
+
+  private:
+    /// Skips any whitespace
+    void SkipWhitespace();
+
+    /// Skips whitespace, then checks the next character is @p c
+    /// @returns true if the next character is @p c
+    bool Expect(char c);
+
+    /// Begins reading the array or object with the opening bracket @p c
+    Result<SuccessType> Begin(char c, std::string_view kind);
+
+    /// Parses the string starting at the current offset
+    /// @param scratch storage for the unescaped string, if the string contains escape sequences
+    Result<std::string_view> ParseString(std::string& scratch);
+
+    /// Parses the literal @p literal starting at the current offset
+    Result<SuccessType> ParseLiteral(std::string_view literal);
+
+    /// @returns a Failure with the message @p msg and the current offset
+    Failure Error(std::string_view msg) const;
+
+    /// @returns a Failure for reading a value of the wrong kind
+    Failure ErrIncorrectType(std::string_view wanted);
+
+    std::string_view json_;
+    size_t offset_ = 0;
+    bool first_ = false;
+    /// The number of arrays and objects that have begun, but not ended
+    size_t depth_ = 0;
+    /// Storage for string values with escape sequences
+    std::string scratch_;
+    /// Storage for member names with escape sequences
+    std::string name_scratch_;
+};
+
+}  // namespace langsvr::json
+
+#endif  // LANGSVR_JSON_STREAM_READER_H_
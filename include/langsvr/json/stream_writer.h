@@ -0,0 +1,150 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef LANGSVR_JSON_STREAM_WRITER_H_
+#define LANGSVR_JSON_STREAM_WRITER_H_
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "langsvr/json/types.h"
+#include "langsvr/span.h"
+#include "langsvr/traits.h"
+
+namespace langsvr::json {
+
+/// StreamWriter serializes JSON tokens directly to a growable string buffer, without building a
+/// tree of json::Value.
+/// Values are written in document order. Object members are written by calling Key() followed by
+/// a single value. Separating commas are inserted automatically.
+class StreamWriter {
+  public:
+    /// Constructor
+    StreamWriter();
+
+    /// Destructor
+    ~StreamWriter();
+
+    /// Writes a Null JSON value
+    void Null();
+
+    /// Writes a Bool JSON value
+    /// @param value the JSON value
+    void Bool(json::Bool value);
+
+    /// Writes a I64 JSON value
+    /// @param value the JSON value
+    void I64(json::I64 value);
+
+    /// Writes a U64 JSON value
+    /// @param value the JSON value
+    void U64(json::U64 value);
+
+    /// Writes a F64 JSON value
+    /// @param value the JSON value
+    void F64(json::F64 value);
+
+    /// Writes a String JSON value
+    /// @param value the JSON value
+    void String(std::string_view value);
+
+    /// Begins a JSON array. Values written up to the matching EndArray() are the array elements.
+    void BeginArray();
+
+    /// Ends the JSON array started with BeginArray()
+    void EndArray();
+
+    /// Writes an array of U64 JSON values. Produces the same JSON as BeginArray(), U64() for each
+    /// element, then EndArray(), but formats the elements directly into the output buffer.
+    /// @param values the array elements
+    void U64Array(Span<json::U64> values);
+
+    /// Begins a JSON object. Members written up to the matching EndObject() are the object
+    /// members.
+    void BeginObject();
+
+    /// Ends the JSON object started with BeginObject()
+    void EndObject();
+
+    /// Writes the name of an object member. Must be followed by the member value.
+    /// @param name the member name
+    void Key(std::string_view name);
+
+    /// Writes the encoded JSON value @p json verbatim.
+    /// @param json a single JSON value. The JSON is not validated.
+    void Raw(std::string_view json);
+
+    /// Writes the JSON value @p value, with the JSON kind inferred from the C++ type
+    template <typename T>
+    void Write(T&& value) {
+        using D = std::decay_t<T>;
+        static constexpr bool is_bool = std::is_same_v<D, json::Bool>;
+        static constexpr bool is_i64 = std::is_integral_v<D> && std::is_signed_v<D>;
+        static constexpr bool is_u64 = std::is_integral_v<D> && std::is_unsigned_v<D>;
+        static constexpr bool is_f64 = std::is_floating_point_v<D>;
+        static constexpr bool is_string = IsStringLike<D>;
+        static_assert(is_bool || is_i64 || is_u64 || is_f64 || is_string);
+        if constexpr (is_bool) {
+            Bool(value);
+        } else if constexpr (is_i64) {
+            I64(static_cast<json::I64>(value));
+        } else if constexpr (is_u64) {
+            U64(static_cast<json::U64>(value));
+        } else if constexpr (is_f64) {
+            F64(static_cast<json::F64>(value));
+        } else if constexpr (is_string) {
+            String(std::forward<T>(value));
+        }
+    }
+
+    /// @returns the JSON written so far
+    std::string_view Json() const { return out_; }
+
+    /// @returns the JSON written so far, leaving the writer empty
+    std::string Take();
+
+    /// Clears the written JSON, retaining the allocated buffer for reuse
+    void Reset();
+
+  private:
+    /// Writes a ',' if the next value is not the first of an array, or a member value
+    void Separator() {
+        if (need_comma_) {
+            out_.push_back(',');
+        }
+    }
+
+    std::string out_;
+    bool need_comma_ = false;
+};
+
+}  // namespace langsvr::json
+
+#endif  // LANGSVR_JSON_STREAM_WRITER_H_
@@ -30,6 +30,8 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include "langsvr/json/types.h"
@@ -67,6 +69,10 @@ class Value {
     /// @returns the current JSON value as a String
     virtual Result<json::String> String() const = 0;
 
+    /// @returns the current JSON value as a string view into the storage of the Value. The view is
+    /// valid for the lifetime of the Value.
+    virtual Result<std::string_view> StringView() const = 0;
+
     /// @returns a const Value* to the element if the JSON value is an array, the index is in
     /// bounds.
     virtual Result<const Value*> Get(size_t index) const = 0;
@@ -85,6 +91,24 @@ class Value {
     /// @returns true if the JSON value is an object and has a member with the given name
     virtual bool Has(std::string_view name) const = 0;
 
+    /// ForEachMember calls @p callback for each member of this JSON object, in order, without
+    /// allocating.
+    /// @param callback a function with the signature:
+    /// `Result<SuccessType>(std::string_view name, const Value& value)`. The name and value are
+    /// only valid for the duration of the call.
+    /// @returns a failure if the JSON value is not an object, or the first failure returned by
+    /// @p callback, which stops the iteration.
+    template <typename F>
+    Result<SuccessType> ForEachMember(F&& callback) const {
+        using Callback = std::remove_reference_t<F>;
+        auto* context = const_cast<void*>(static_cast<const void*>(&callback));
+        return VisitMembers(
+            [](void* ctx, std::string_view name, const Value& value) -> Result<SuccessType> {
+                return (*static_cast<Callback*>(ctx))(name, value);
+            },
+            context);
+    }
+
     template <typename T, typename I>
     Result<T> Get(I&& index) const {
         auto element = Get(std::forward<I>(index));
@@ -111,6 +135,16 @@ class Value {
             return element.Get()->String();
         }
     }
+
+  protected:
+    /// MemberVisitor is the type of the function called by VisitMembers()
+    using MemberVisitor = Result<SuccessType> (*)(void* context,
+                                                  std::string_view name,
+                                                  const Value& value);
+
+    /// VisitMembers calls @p visitor with @p context for each member of this JSON object.
+    /// @see ForEachMember()
+    virtual Result<SuccessType> VisitMembers(MemberVisitor visitor, void* context) const = 0;
 };
 
 }  // namespace langsvr::json
@@ -34,6 +34,7 @@
 #include <utility>
 #include <vector>
 
+#include "langsvr/json/stream_reader.h"
 #include "langsvr/json/value.h"
 #include "langsvr/lsp/primitives.h"
 #include "langsvr/one_of.h"
@@ -52,10 +53,126 @@ template <typename V>
 Result<SuccessType> Decode(const json::Value& v, std::unordered_map<std::string, V>& out);
 template <typename... TYPES>
 Result<SuccessType> Decode(const json::Value& v, OneOf<TYPES...>& out);
+template <typename T>
+Result<SuccessType> Decode(json::StreamReader& r, Optional<T>& out);
+template <typename T>
+Result<SuccessType> Decode(json::StreamReader& r, std::vector<T>& out);
+template <typename... TYPES>
+Result<SuccessType> Decode(json::StreamReader& r, std::tuple<TYPES...>& out);
+template <typename V>
+Result<SuccessType> Decode(json::StreamReader& r, std::unordered_map<std::string, V>& out);
+template <typename... TYPES>
+Result<SuccessType> Decode(json::StreamReader& r, OneOf<TYPES...>& out);
+template <typename T>
+bool Matches(const json::Value& v, const Optional<T>*);
+template <typename T>
+bool Matches(const json::Value& v, const std::vector<T>*);
+template <typename... TYPES>
+bool Matches(const json::Value& v, const std::tuple<TYPES...>*);
+template <typename V>
+bool Matches(const json::Value& v, const std::unordered_map<std::string, V>*);
+template <typename... TYPES>
+bool Matches(const json::Value& v, const OneOf<TYPES...>*);
+template <typename T>
+bool Matches(json::StreamReader& r, const Optional<T>*);
+template <typename T>
+bool Matches(json::StreamReader& r, const std::vector<T>*);
+template <typename... TYPES>
+bool Matches(json::StreamReader& r, const std::tuple<TYPES...>*);
+template <typename V>
+bool Matches(json::StreamReader& r, const std::unordered_map<std::string, V>*);
+template <typename... TYPES>
+bool Matches(json::StreamReader& r, const OneOf<TYPES...>*);
 }  // namespace langsvr::lsp
 
 namespace langsvr::lsp {
 
+////////////////////////////////////////////////////////////////////////////////
+// json::Value discriminators
+//
+// Matches(v, static_cast<const T*>(nullptr)) is a cheap test of whether v could be decoded as a T.
+// It inspects the JSON kind, the presence of required members and the 'kind' literals, but not
+// the member values. A false result means that Decode() would fail, so the OneOf decoders use
+// Matches() to pick the alternative to decode, instead of trial-decoding each alternative.
+////////////////////////////////////////////////////////////////////////////////
+
+bool Matches(const json::Value& v, const Null*);
+bool Matches(const json::Value& v, const Boolean*);
+bool Matches(const json::Value& v, const Integer*);
+bool Matches(const json::Value& v, const Uinteger*);
+bool Matches(const json::Value& v, const Decimal*);
+bool Matches(const json::Value& v, const String*);
+
+template <typename T>
+bool Matches(const json::Value& v, const Optional<T>*) {
+    return Matches(v, static_cast<const T*>(nullptr));
+}
+
+template <typename T>
+bool Matches(const json::Value& v, const std::vector<T>*) {
+    return v.Kind() == json::Kind::kArray;
+}
+
+template <typename... TYPES>
+bool Matches(const json::Value& v, const std::tuple<TYPES...>*) {
+    return v.Kind() == json::Kind::kArray && v.Count() == sizeof...(TYPES);
+}
+
+template <typename V>
+bool Matches(const json::Value& v, const std::unordered_map<std::string, V>*) {
+    return v.Kind() == json::Kind::kObject;
+}
+
+template <typename... TYPES>
+bool Matches(const json::Value& v, const OneOf<TYPES...>*) {
+    return (Matches(v, static_cast<const TYPES*>(nullptr)) || ...);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// json::StreamReader discriminators
+//
+// The json::StreamReader overloads of Matches() do not consume the value.
+////////////////////////////////////////////////////////////////////////////////
+
+bool Matches(json::StreamReader& r, const Null*);
+bool Matches(json::StreamReader& r, const Boolean*);
+bool Matches(json::StreamReader& r, const Integer*);
+bool Matches(json::StreamReader& r, const Uinteger*);
+bool Matches(json::StreamReader& r, const Decimal*);
+bool Matches(json::StreamReader& r, const String*);
+
+template <typename T>
+bool Matches(json::StreamReader& r, const Optional<T>*) {
+    return Matches(r, static_cast<const T*>(nullptr));
+}
+
+template <typename T>
+bool Matches(json::StreamReader& r, const std::vector<T>*) {
+    auto kind = r.Peek();
+    return kind == Success && kind.Get() == json::Kind::kArray;
+}
+
+template <typename... TYPES>
+bool Matches(json::StreamReader& r, const std::tuple<TYPES...>*) {
+    auto kind = r.Peek();
+    return kind == Success && kind.Get() == json::Kind::kArray;
+}
+
+template <typename V>
+bool Matches(json::StreamReader& r, const std::unordered_map<std::string, V>*) {
+    auto kind = r.Peek();
+    return kind == Success && kind.Get() == json::Kind::kObject;
+}
+
+template <typename... TYPES>
+bool Matches(json::StreamReader& r, const OneOf<TYPES...>*) {
+    return (Matches(r, static_cast<const TYPES*>(nullptr)) || ...);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// json::Value decoders
+////////////////////////////////////////////////////////////////////////////////
+
 Result<SuccessType> Decode(const json::Value& v, Null& out);
 Result<SuccessType> Decode(const json::Value& v, Boolean& out);
 Result<SuccessType> Decode(const json::Value& v, Integer& out);
@@ -65,7 +182,12 @@ Result<SuccessType> Decode(const json::Value& v, String& out);
 
 template <typename T>
 Result<SuccessType> Decode(const json::Value& v, Optional<T>& out) {
-    return Decode(v, *out);
+    T val;
+    if (auto res = Decode(v, val); res != Success) {
+        return res.Failure();
+    }
+    out = std::move(val);
+    return Success;
 }
 
 template <typename T>
@@ -123,32 +245,152 @@ Result<SuccessType> Decode(const json::Value& v, std::unordered_map<std::string,
     if (v.Kind() != json::Kind::kObject) {
         return Failure{"JSON value is not an object"};
     }
-    auto names = v.MemberNames();
-    if (names != Success) {
-        return names.Failure();
+    out.reserve(v.Count());
+    return v.ForEachMember([&](std::string_view name, const json::Value& element) {
+        return Decode(element, out[std::string(name)]);
+    });
+}
+
+template <typename... TYPES>
+Result<SuccessType> Decode(const json::Value& v, OneOf<TYPES...>& out) {
+    auto try_type = [&](auto* p) {
+        using T = std::remove_pointer_t<decltype(p)>;
+        if (!Matches(v, p)) {
+            return false;
+        }
+        T val;
+        if (auto res = Decode(v, val); res == Success) {
+            out = std::move(val);
+            return true;
+        }
+        return false;
+    };
+
+    bool ok = (try_type(static_cast<TYPES*>(nullptr)) || ...);
+    if (ok) {
+        return Success;
+    }
+
+    return Failure{"no types matched the OneOf"};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// json::StreamReader decoders
+////////////////////////////////////////////////////////////////////////////////
+
+Result<SuccessType> Decode(json::StreamReader& r, Null& out);
+Result<SuccessType> Decode(json::StreamReader& r, Boolean& out);
+Result<SuccessType> Decode(json::StreamReader& r, Integer& out);
+Result<SuccessType> Decode(json::StreamReader& r, Uinteger& out);
+Result<SuccessType> Decode(json::StreamReader& r, Decimal& out);
+Result<SuccessType> Decode(json::StreamReader& r, String& out);
+
+/// Decodes an array of Uinteger, such as SemanticTokens::data, without decoding each element
+/// separately.
+Result<SuccessType> Decode(json::StreamReader& r, std::vector<Uinteger>& out);
+
+template <typename T>
+Result<SuccessType> Decode(json::StreamReader& r, Optional<T>& out) {
+    T val;
+    if (auto res = Decode(r, val); res != Success) {
+        return res.Failure();
     }
-    out.reserve(names->size());
-    for (auto& name : names.Get()) {
-        auto element = v.Get(name);
-        if (element != Success) {
-            return element.Failure();
+    out = std::move(val);
+    return Success;
+}
+
+template <typename T>
+Result<SuccessType> Decode(json::StreamReader& r, std::vector<T>& out) {
+    if (auto res = r.BeginArray(); res != Success) {
+        return res.Failure();
+    }
+    out.clear();
+    while (true) {
+        auto next = r.NextElement();
+        if (next != Success) {
+            return next.Failure();
+        }
+        if (!next.Get()) {
+            return Success;
         }
-        if (auto res = Decode(*element.Get(), out[name]); res != Success) {
+        if (auto res = Decode(r, out.emplace_back()); res != Success) {
             return res.Failure();
         }
     }
+}
+
+template <typename... TYPES>
+Result<SuccessType> Decode(json::StreamReader& r, std::tuple<TYPES...>& out) {
+    if (auto res = r.BeginArray(); res != Success) {
+        return res.Failure();
+    }
+
+    std::string error;
+    auto decode = [&](auto& el) {
+        auto next = r.NextElement();
+        if (next != Success) {
+            error = std::move(next.Failure().reason);
+            return false;
+        }
+        if (!next.Get()) {
+            error = "JSON array does not match tuple length";
+            return false;
+        }
+        if (auto res = Decode(r, el); res != Success) {
+            error = std::move(res.Failure().reason);
+            return false;
+        }
+        return true;
+    };
+    std::apply([&](auto&... elements) { (decode(elements) && ...); }, out);
+    if (!error.empty()) {
+        return Failure{std::move(error)};
+    }
+    auto next = r.NextElement();
+    if (next != Success) {
+        return next.Failure();
+    }
+    if (next.Get()) {
+        return Failure{"JSON array does not match tuple length"};
+    }
     return Success;
 }
 
+template <typename V>
+Result<SuccessType> Decode(json::StreamReader& r, std::unordered_map<std::string, V>& out) {
+    if (auto res = r.BeginObject(); res != Success) {
+        return res.Failure();
+    }
+    while (true) {
+        std::string_view name;
+        auto next = r.NextMember(name);
+        if (next != Success) {
+            return next.Failure();
+        }
+        if (!next.Get()) {
+            return Success;
+        }
+        // Note: name is invalidated by the next read, so must be copied before decoding the value.
+        if (auto res = Decode(r, out[std::string(name)]); res != Success) {
+            return res.Failure();
+        }
+    }
+}
+
 template <typename... TYPES>
-Result<SuccessType> Decode(const json::Value& v, OneOf<TYPES...>& out) {
+Result<SuccessType> Decode(json::StreamReader& r, OneOf<TYPES...>& out) {
+    auto start = r.Save();
     auto try_type = [&](auto* p) {
         using T = std::remove_pointer_t<decltype(p)>;
+        if (!Matches(r, p)) {
+            return false;
+        }
         T val;
-        if (auto res = Decode(v, val); res == Success) {
+        if (auto res = Decode(r, val); res == Success) {
             out = std::move(val);
             return true;
         }
+        r.Restore(start);
         return false;
     };
 
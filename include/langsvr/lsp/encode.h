@@ -28,13 +28,20 @@
 #ifndef LANGSVR_LSP_ENCODE_H_
 #define LANGSVR_LSP_ENCODE_H_
 
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <typeindex>
+#include <typeinfo>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "langsvr/json/builder.h"
+#include "langsvr/json/stream_writer.h"
 #include "langsvr/lsp/primitives.h"
 #include "langsvr/one_of.h"
 #include "langsvr/optional.h"
@@ -52,6 +59,16 @@ template <typename V>
 Result<const json::Value*> Encode(const std::unordered_map<std::string, V>& in, json::Builder& b);
 template <typename... TYPES>
 Result<const json::Value*> Encode(const OneOf<TYPES...>& in, json::Builder& b);
+template <typename T>
+Result<SuccessType> Encode(const Optional<T>& in, json::StreamWriter& w);
+template <typename T>
+Result<SuccessType> Encode(const std::vector<T>& in, json::StreamWriter& w);
+template <typename... TYPES>
+Result<SuccessType> Encode(const std::tuple<TYPES...>& in, json::StreamWriter& w);
+template <typename V>
+Result<SuccessType> Encode(const std::unordered_map<std::string, V>& in, json::StreamWriter& w);
+template <typename... TYPES>
+Result<SuccessType> Encode(const OneOf<TYPES...>& in, json::StreamWriter& w);
 }  // namespace langsvr::lsp
 
 namespace langsvr::lsp {
@@ -63,6 +80,10 @@ Result<const json::Value*> Encode(Uinteger in, json::Builder& b);
 Result<const json::Value*> Encode(Decimal in, json::Builder& b);
 Result<const json::Value*> Encode(const String& in, json::Builder& b);
 
+/// Encodes an array of Uinteger, such as SemanticTokens::data, without encoding each element
+/// separately.
+Result<const json::Value*> Encode(const std::vector<Uinteger>& in, json::Builder& b);
+
 template <typename T>
 Result<const json::Value*> Encode(const Optional<T>& in, json::Builder& b) {
     return Encode(*in, b);
@@ -122,6 +143,176 @@ Result<const json::Value*> Encode(const OneOf<TYPES...>& in, json::Builder& b) {
     return in.Visit([&](const auto& v) { return Encode(v, b); });
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Streaming encoders
+// These write the JSON directly to a json::StreamWriter, without building json::Values.
+// On failure, the StreamWriter may hold a partially written value.
+////////////////////////////////////////////////////////////////////////////////
+
+Result<SuccessType> Encode(Null in, json::StreamWriter& w);
+Result<SuccessType> Encode(Boolean in, json::StreamWriter& w);
+Result<SuccessType> Encode(Integer in, json::StreamWriter& w);
+Result<SuccessType> Encode(Uinteger in, json::StreamWriter& w);
+Result<SuccessType> Encode(Decimal in, json::StreamWriter& w);
+Result<SuccessType> Encode(const String& in, json::StreamWriter& w);
+
+/// Encodes an array of Uinteger, such as SemanticTokens::data, without encoding each element
+/// separately.
+Result<SuccessType> Encode(const std::vector<Uinteger>& in, json::StreamWriter& w);
+
+template <typename T>
+Result<SuccessType> Encode(const Optional<T>& in, json::StreamWriter& w) {
+    return Encode(*in, w);
+}
+
+template <typename T>
+Result<SuccessType> Encode(const std::vector<T>& in, json::StreamWriter& w) {
+    w.BeginArray();
+    for (auto& element : in) {
+        if (auto res = Encode(element, w); res != Success) {
+            return res.Failure();
+        }
+    }
+    w.EndArray();
+    return Success;
+}
+
+template <typename... TYPES>
+Result<SuccessType> Encode(const std::tuple<TYPES...>& in, json::StreamWriter& w) {
+    std::string error;
+    auto encode = [&](auto& el) {
+        if (auto res = Encode(el, w); res != Success) {
+            error = std::move(res.Failure().reason);
+            return false;
+        }
+        return true;
+    };
+    w.BeginArray();
+    std::apply([&](auto&... elements) { (encode(elements) && ...); }, in);
+    if (!error.empty()) {
+        return Failure{std::move(error)};
+    }
+    w.EndArray();
+    return Success;
+}
+
+template <typename V>
+Result<SuccessType> Encode(const std::unordered_map<std::string, V>& in, json::StreamWriter& w) {
+    w.BeginObject();
+    for (auto& it : in) {
+        w.Key(it.first);
+        if (auto res = Encode(it.second, w); res != Success) {
+            return res.Failure();
+        }
+    }
+    w.EndObject();
+    return Success;
+}
+
+template <typename... TYPES>
+Result<SuccessType> Encode(const OneOf<TYPES...>& in, json::StreamWriter& w) {
+    return in.Visit([&](const auto& v) { return Encode(v, w); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Pre-encoded values
+////////////////////////////////////////////////////////////////////////////////
+
+/// Encoded holds the JSON encoding of a value of type T, which is written verbatim by Encode().
+/// A Session request handler may return an Encoded of the request's result type, instead of the
+/// result value.
+/// @see EncodeCache
+template <typename T>
+struct Encoded {
+    /// The encoded JSON. Must remain valid until the Encoded has been encoded.
+    std::string_view json;
+    /// The optional owner of the string viewed by json. Set by EncodeCache, so that an Encoded
+    /// remains valid after its cache entry has been erased.
+    std::shared_ptr<const std::string> owner;
+};
+
+template <typename T>
+Result<const json::Value*> Encode(const Encoded<T>& in, json::Builder& b) {
+    return b.Raw(in.json);
+}
+
+template <typename T>
+Result<SuccessType> Encode(const Encoded<T>& in, json::StreamWriter& w) {
+    w.Raw(in.json);
+    return Success;
+}
+
+/// EncodeCache holds the JSON encodings of values, so that large values which rarely change, such
+/// as server capabilities or static completion lists, are not re-encoded each time they are sent.
+/// Encodings are cached per value type, so values of different types may use the same key.
+/// EncodeCache is thread-safe, so may be shared by request handlers running on an Executor.
+class EncodeCache {
+  public:
+    /// Key identifies a cached encoding of a value type. The key is chosen by the caller, and must
+    /// uniquely identify the encoded value of the type, for example with a hash or version number
+    /// of the value.
+    using Key = uint64_t;
+
+    /// @returns the cached encoding for @p key and the type T. If the cache has no encoding for
+    /// @p key and T, then @p value is encoded and added to the cache. The returned Encoded shares
+    /// ownership of the encoding, so remains valid if the entry is erased, or the cache is cleared
+    /// or destructed.
+    template <typename T>
+    Result<Encoded<T>> Get(Key key, const T& value) {
+        const std::type_index type{typeid(T)};
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto& entries = entries_[type];
+            if (auto it = entries.find(key); it != entries.end()) {
+                return Encoded<T>{*it->second, it->second};
+            }
+        }
+
+        // The value is encoded without holding the lock. If another thread adds an encoding for
+        // the same key in the meantime, then that encoding is used.
+        json::StreamWriter w;
+        if (auto res = Encode(value, w); res != Success) {
+            return res.Failure();
+        }
+        auto encoded = std::make_shared<const std::string>(w.Take());
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_[type].emplace(key, std::move(encoded)).first;
+        return Encoded<T>{*it->second, it->second};
+    }
+
+    /// Removes the encodings with the key @p key, of all types, from the cache
+    void Erase(Key key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& it : entries_) {
+            it.second.erase(key);
+        }
+    }
+
+    /// Removes all encodings from the cache
+    void Clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+    }
+
+    /// @returns the number of encodings held by the cache
+    size_t Count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t count = 0;
+        for (auto& it : entries_) {
+            count += it.second.size();
+        }
+        return count;
+    }
+
+  private:
+    /// Guards entries_
+    mutable std::mutex mutex_;
+    /// The encodings, keyed by value type, then by Key
+    std::unordered_map<std::type_index,
+                       std::unordered_map<Key, std::shared_ptr<const std::string>>>
+        entries_;
+};
+
 }  // namespace langsvr::lsp
 
 #endif  // LANGSVR_LSP_ENCODE_H_
@@ -695,7 +695,11 @@ enum class SemanticTokenTypes {
 };
 
 Result<SuccessType> Decode(const json::Value& v, SemanticTokenTypes& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokenTypes& out);
+bool Matches(const json::Value& v, const SemanticTokenTypes*);
+bool Matches(json::StreamReader& r, const SemanticTokenTypes*);
 Result<const json::Value*> Encode(SemanticTokenTypes in, json::Builder& b);
+Result<SuccessType> Encode(SemanticTokenTypes in, json::StreamWriter& w);
 
 /// A set of predefined token modifiers. This set is not fixed an clients can specify additional
 /// token types via the corresponding client capabilities.
@@ -734,7 +738,11 @@ enum class SemanticTokenModifiers {
 };
 
 Result<SuccessType> Decode(const json::Value& v, SemanticTokenModifiers& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokenModifiers& out);
+bool Matches(const json::Value& v, const SemanticTokenModifiers*);
+bool Matches(json::StreamReader& r, const SemanticTokenModifiers*);
 Result<const json::Value*> Encode(SemanticTokenModifiers in, json::Builder& b);
+Result<SuccessType> Encode(SemanticTokenModifiers in, json::StreamWriter& w);
 
 /// The document diagnostic report kinds.
 ///
@@ -748,7 +756,11 @@ enum class DocumentDiagnosticReportKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, DocumentDiagnosticReportKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentDiagnosticReportKind& out);
+bool Matches(const json::Value& v, const DocumentDiagnosticReportKind*);
+bool Matches(json::StreamReader& r, const DocumentDiagnosticReportKind*);
 Result<const json::Value*> Encode(DocumentDiagnosticReportKind in, json::Builder& b);
+Result<SuccessType> Encode(DocumentDiagnosticReportKind in, json::StreamWriter& w);
 
 /// Predefined error codes.
 enum class ErrorCodes {
@@ -776,7 +788,11 @@ enum class ErrorCodes {
 };
 
 Result<SuccessType> Decode(const json::Value& v, ErrorCodes& out);
+Result<SuccessType> Decode(json::StreamReader& r, ErrorCodes& out);
+bool Matches(const json::Value& v, const ErrorCodes*);
+bool Matches(json::StreamReader& r, const ErrorCodes*);
 Result<const json::Value*> Encode(ErrorCodes in, json::Builder& b);
+Result<SuccessType> Encode(ErrorCodes in, json::StreamWriter& w);
 
 /// No documentation available
 enum class LSPErrorCodes {
@@ -805,7 +821,11 @@ enum class LSPErrorCodes {
 };
 
 Result<SuccessType> Decode(const json::Value& v, LSPErrorCodes& out);
+Result<SuccessType> Decode(json::StreamReader& r, LSPErrorCodes& out);
+bool Matches(const json::Value& v, const LSPErrorCodes*);
+bool Matches(json::StreamReader& r, const LSPErrorCodes*);
 Result<const json::Value*> Encode(LSPErrorCodes in, json::Builder& b);
+Result<SuccessType> Encode(LSPErrorCodes in, json::StreamWriter& w);
 
 /// A set of predefined range kinds.
 enum class FoldingRangeKind {
@@ -820,7 +840,11 @@ enum class FoldingRangeKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, FoldingRangeKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, FoldingRangeKind& out);
+bool Matches(const json::Value& v, const FoldingRangeKind*);
+bool Matches(json::StreamReader& r, const FoldingRangeKind*);
 Result<const json::Value*> Encode(FoldingRangeKind in, json::Builder& b);
+Result<SuccessType> Encode(FoldingRangeKind in, json::StreamWriter& w);
 
 /// A symbol kind.
 enum class SymbolKind {
@@ -904,7 +928,11 @@ enum class SymbolKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, SymbolKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, SymbolKind& out);
+bool Matches(const json::Value& v, const SymbolKind*);
+bool Matches(json::StreamReader& r, const SymbolKind*);
 Result<const json::Value*> Encode(SymbolKind in, json::Builder& b);
+Result<SuccessType> Encode(SymbolKind in, json::StreamWriter& w);
 
 /// Symbol tags are extra annotations that tweak the rendering of a symbol.
 ///
@@ -915,7 +943,11 @@ enum class SymbolTag {
 };
 
 Result<SuccessType> Decode(const json::Value& v, SymbolTag& out);
+Result<SuccessType> Decode(json::StreamReader& r, SymbolTag& out);
+bool Matches(const json::Value& v, const SymbolTag*);
+bool Matches(json::StreamReader& r, const SymbolTag*);
 Result<const json::Value*> Encode(SymbolTag in, json::Builder& b);
+Result<SuccessType> Encode(SymbolTag in, json::StreamWriter& w);
 
 /// Moniker uniqueness level to define scope of the moniker.
 ///
@@ -938,7 +970,11 @@ enum class UniquenessLevel {
 };
 
 Result<SuccessType> Decode(const json::Value& v, UniquenessLevel& out);
+Result<SuccessType> Decode(json::StreamReader& r, UniquenessLevel& out);
+bool Matches(const json::Value& v, const UniquenessLevel*);
+bool Matches(json::StreamReader& r, const UniquenessLevel*);
 Result<const json::Value*> Encode(UniquenessLevel in, json::Builder& b);
+Result<SuccessType> Encode(UniquenessLevel in, json::StreamWriter& w);
 
 /// The moniker kind.
 ///
@@ -956,7 +992,11 @@ enum class MonikerKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, MonikerKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, MonikerKind& out);
+bool Matches(const json::Value& v, const MonikerKind*);
+bool Matches(json::StreamReader& r, const MonikerKind*);
 Result<const json::Value*> Encode(MonikerKind in, json::Builder& b);
+Result<SuccessType> Encode(MonikerKind in, json::StreamWriter& w);
 
 /// Inlay hint kinds.
 ///
@@ -970,7 +1010,11 @@ enum class InlayHintKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, InlayHintKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlayHintKind& out);
+bool Matches(const json::Value& v, const InlayHintKind*);
+bool Matches(json::StreamReader& r, const InlayHintKind*);
 Result<const json::Value*> Encode(InlayHintKind in, json::Builder& b);
+Result<SuccessType> Encode(InlayHintKind in, json::StreamWriter& w);
 
 /// The message type
 enum class MessageType {
@@ -993,7 +1037,11 @@ enum class MessageType {
 };
 
 Result<SuccessType> Decode(const json::Value& v, MessageType& out);
+Result<SuccessType> Decode(json::StreamReader& r, MessageType& out);
+bool Matches(const json::Value& v, const MessageType*);
+bool Matches(json::StreamReader& r, const MessageType*);
 Result<const json::Value*> Encode(MessageType in, json::Builder& b);
+Result<SuccessType> Encode(MessageType in, json::StreamWriter& w);
 
 /// Defines how the host (editor) should sync document changes to the language server.
 enum class TextDocumentSyncKind {
@@ -1009,7 +1057,11 @@ enum class TextDocumentSyncKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, TextDocumentSyncKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentSyncKind& out);
+bool Matches(const json::Value& v, const TextDocumentSyncKind*);
+bool Matches(json::StreamReader& r, const TextDocumentSyncKind*);
 Result<const json::Value*> Encode(TextDocumentSyncKind in, json::Builder& b);
+Result<SuccessType> Encode(TextDocumentSyncKind in, json::StreamWriter& w);
 
 /// Represents reasons why a text document is saved.
 enum class TextDocumentSaveReason {
@@ -1025,7 +1077,11 @@ enum class TextDocumentSaveReason {
 };
 
 Result<SuccessType> Decode(const json::Value& v, TextDocumentSaveReason& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentSaveReason& out);
+bool Matches(const json::Value& v, const TextDocumentSaveReason*);
+bool Matches(json::StreamReader& r, const TextDocumentSaveReason*);
 Result<const json::Value*> Encode(TextDocumentSaveReason in, json::Builder& b);
+Result<SuccessType> Encode(TextDocumentSaveReason in, json::StreamWriter& w);
 
 /// The kind of a completion entry.
 enum class CompletionItemKind {
@@ -1106,7 +1162,11 @@ enum class CompletionItemKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, CompletionItemKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionItemKind& out);
+bool Matches(const json::Value& v, const CompletionItemKind*);
+bool Matches(json::StreamReader& r, const CompletionItemKind*);
 Result<const json::Value*> Encode(CompletionItemKind in, json::Builder& b);
+Result<SuccessType> Encode(CompletionItemKind in, json::StreamWriter& w);
 
 /// Completion item tags are extra annotations that tweak the rendering of a completion item.
 ///
@@ -1117,7 +1177,11 @@ enum class CompletionItemTag {
 };
 
 Result<SuccessType> Decode(const json::Value& v, CompletionItemTag& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionItemTag& out);
+bool Matches(const json::Value& v, const CompletionItemTag*);
+bool Matches(json::StreamReader& r, const CompletionItemTag*);
 Result<const json::Value*> Encode(CompletionItemTag in, json::Builder& b);
+Result<SuccessType> Encode(CompletionItemTag in, json::StreamWriter& w);
 
 /// Defines whether the insert text in a completion item should be interpreted as plain text or a
 /// snippet.
@@ -1134,7 +1198,11 @@ enum class InsertTextFormat {
 };
 
 Result<SuccessType> Decode(const json::Value& v, InsertTextFormat& out);
+Result<SuccessType> Decode(json::StreamReader& r, InsertTextFormat& out);
+bool Matches(const json::Value& v, const InsertTextFormat*);
+bool Matches(json::StreamReader& r, const InsertTextFormat*);
 Result<const json::Value*> Encode(InsertTextFormat in, json::Builder& b);
+Result<SuccessType> Encode(InsertTextFormat in, json::StreamWriter& w);
 
 /// How whitespace and indentation is handled during completion item insertion.
 ///
@@ -1153,7 +1221,11 @@ enum class InsertTextMode {
 };
 
 Result<SuccessType> Decode(const json::Value& v, InsertTextMode& out);
+Result<SuccessType> Decode(json::StreamReader& r, InsertTextMode& out);
+bool Matches(const json::Value& v, const InsertTextMode*);
+bool Matches(json::StreamReader& r, const InsertTextMode*);
 Result<const json::Value*> Encode(InsertTextMode in, json::Builder& b);
+Result<SuccessType> Encode(InsertTextMode in, json::StreamWriter& w);
 
 /// A document highlight kind.
 enum class DocumentHighlightKind {
@@ -1168,7 +1240,11 @@ enum class DocumentHighlightKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, DocumentHighlightKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentHighlightKind& out);
+bool Matches(const json::Value& v, const DocumentHighlightKind*);
+bool Matches(json::StreamReader& r, const DocumentHighlightKind*);
 Result<const json::Value*> Encode(DocumentHighlightKind in, json::Builder& b);
+Result<SuccessType> Encode(DocumentHighlightKind in, json::StreamWriter& w);
 
 /// A set of predefined code action kinds
 enum class CodeActionKind {
@@ -1209,7 +1285,11 @@ enum class CodeActionKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, CodeActionKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeActionKind& out);
+bool Matches(const json::Value& v, const CodeActionKind*);
+bool Matches(json::StreamReader& r, const CodeActionKind*);
 Result<const json::Value*> Encode(CodeActionKind in, json::Builder& b);
+Result<SuccessType> Encode(CodeActionKind in, json::StreamWriter& w);
 
 /// No documentation available
 enum class TraceValues {
@@ -1224,7 +1304,11 @@ enum class TraceValues {
 };
 
 Result<SuccessType> Decode(const json::Value& v, TraceValues& out);
+Result<SuccessType> Decode(json::StreamReader& r, TraceValues& out);
+bool Matches(const json::Value& v, const TraceValues*);
+bool Matches(json::StreamReader& r, const TraceValues*);
 Result<const json::Value*> Encode(TraceValues in, json::Builder& b);
+Result<SuccessType> Encode(TraceValues in, json::StreamWriter& w);
 
 /// Describes the content type that a client supports in various result literals like `Hover`,
 /// `ParameterInfo` or `CompletionItem`. Please note that `MarkupKinds` must not start with a `$`.
@@ -1238,7 +1322,11 @@ enum class MarkupKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, MarkupKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, MarkupKind& out);
+bool Matches(const json::Value& v, const MarkupKind*);
+bool Matches(json::StreamReader& r, const MarkupKind*);
 Result<const json::Value*> Encode(MarkupKind in, json::Builder& b);
+Result<SuccessType> Encode(MarkupKind in, json::StreamWriter& w);
 
 /// Describes how an InlineCompletionItemProvider inline completion provider was triggered.
 ///
@@ -1254,7 +1342,11 @@ enum class InlineCompletionTriggerKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, InlineCompletionTriggerKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineCompletionTriggerKind& out);
+bool Matches(const json::Value& v, const InlineCompletionTriggerKind*);
+bool Matches(json::StreamReader& r, const InlineCompletionTriggerKind*);
 Result<const json::Value*> Encode(InlineCompletionTriggerKind in, json::Builder& b);
+Result<SuccessType> Encode(InlineCompletionTriggerKind in, json::StreamWriter& w);
 
 /// A set of predefined position encoding kinds.
 ///
@@ -1274,7 +1366,11 @@ enum class PositionEncodingKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, PositionEncodingKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, PositionEncodingKind& out);
+bool Matches(const json::Value& v, const PositionEncodingKind*);
+bool Matches(json::StreamReader& r, const PositionEncodingKind*);
 Result<const json::Value*> Encode(PositionEncodingKind in, json::Builder& b);
+Result<SuccessType> Encode(PositionEncodingKind in, json::StreamWriter& w);
 
 /// The file event type
 enum class FileChangeType {
@@ -1289,7 +1385,11 @@ enum class FileChangeType {
 };
 
 Result<SuccessType> Decode(const json::Value& v, FileChangeType& out);
+Result<SuccessType> Decode(json::StreamReader& r, FileChangeType& out);
+bool Matches(const json::Value& v, const FileChangeType*);
+bool Matches(json::StreamReader& r, const FileChangeType*);
 Result<const json::Value*> Encode(FileChangeType in, json::Builder& b);
+Result<SuccessType> Encode(FileChangeType in, json::StreamWriter& w);
 
 /// No documentation available
 enum class WatchKind {
@@ -1304,7 +1404,11 @@ enum class WatchKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, WatchKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, WatchKind& out);
+bool Matches(const json::Value& v, const WatchKind*);
+bool Matches(json::StreamReader& r, const WatchKind*);
 Result<const json::Value*> Encode(WatchKind in, json::Builder& b);
+Result<SuccessType> Encode(WatchKind in, json::StreamWriter& w);
 
 /// The diagnostic's severity.
 enum class DiagnosticSeverity {
@@ -1322,7 +1426,11 @@ enum class DiagnosticSeverity {
 };
 
 Result<SuccessType> Decode(const json::Value& v, DiagnosticSeverity& out);
+Result<SuccessType> Decode(json::StreamReader& r, DiagnosticSeverity& out);
+bool Matches(const json::Value& v, const DiagnosticSeverity*);
+bool Matches(json::StreamReader& r, const DiagnosticSeverity*);
 Result<const json::Value*> Encode(DiagnosticSeverity in, json::Builder& b);
+Result<SuccessType> Encode(DiagnosticSeverity in, json::StreamWriter& w);
 
 /// The diagnostic tags.
 ///
@@ -1338,7 +1446,11 @@ enum class DiagnosticTag {
 };
 
 Result<SuccessType> Decode(const json::Value& v, DiagnosticTag& out);
+Result<SuccessType> Decode(json::StreamReader& r, DiagnosticTag& out);
+bool Matches(const json::Value& v, const DiagnosticTag*);
+bool Matches(json::StreamReader& r, const DiagnosticTag*);
 Result<const json::Value*> Encode(DiagnosticTag in, json::Builder& b);
+Result<SuccessType> Encode(DiagnosticTag in, json::StreamWriter& w);
 
 /// How a completion was triggered
 enum class CompletionTriggerKind {
@@ -1355,7 +1467,11 @@ enum class CompletionTriggerKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, CompletionTriggerKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionTriggerKind& out);
+bool Matches(const json::Value& v, const CompletionTriggerKind*);
+bool Matches(json::StreamReader& r, const CompletionTriggerKind*);
 Result<const json::Value*> Encode(CompletionTriggerKind in, json::Builder& b);
+Result<SuccessType> Encode(CompletionTriggerKind in, json::StreamWriter& w);
 
 /// How a signature help was triggered.
 ///
@@ -1372,7 +1488,11 @@ enum class SignatureHelpTriggerKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, SignatureHelpTriggerKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, SignatureHelpTriggerKind& out);
+bool Matches(const json::Value& v, const SignatureHelpTriggerKind*);
+bool Matches(json::StreamReader& r, const SignatureHelpTriggerKind*);
 Result<const json::Value*> Encode(SignatureHelpTriggerKind in, json::Builder& b);
+Result<SuccessType> Encode(SignatureHelpTriggerKind in, json::StreamWriter& w);
 
 /// The reason why code actions were requested.
 ///
@@ -1387,7 +1507,11 @@ enum class CodeActionTriggerKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, CodeActionTriggerKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeActionTriggerKind& out);
+bool Matches(const json::Value& v, const CodeActionTriggerKind*);
+bool Matches(json::StreamReader& r, const CodeActionTriggerKind*);
 Result<const json::Value*> Encode(CodeActionTriggerKind in, json::Builder& b);
+Result<SuccessType> Encode(CodeActionTriggerKind in, json::StreamWriter& w);
 
 /// A pattern kind describing if a glob pattern matches a file a folder or both.
 ///
@@ -1401,7 +1525,11 @@ enum class FileOperationPatternKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, FileOperationPatternKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, FileOperationPatternKind& out);
+bool Matches(const json::Value& v, const FileOperationPatternKind*);
+bool Matches(json::StreamReader& r, const FileOperationPatternKind*);
 Result<const json::Value*> Encode(FileOperationPatternKind in, json::Builder& b);
+Result<SuccessType> Encode(FileOperationPatternKind in, json::StreamWriter& w);
 
 /// A notebook cell kind.
 ///
@@ -1415,7 +1543,11 @@ enum class NotebookCellKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, NotebookCellKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookCellKind& out);
+bool Matches(const json::Value& v, const NotebookCellKind*);
+bool Matches(json::StreamReader& r, const NotebookCellKind*);
 Result<const json::Value*> Encode(NotebookCellKind in, json::Builder& b);
+Result<SuccessType> Encode(NotebookCellKind in, json::StreamWriter& w);
 
 /// No documentation available
 enum class ResourceOperationKind {
@@ -1430,7 +1562,11 @@ enum class ResourceOperationKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, ResourceOperationKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, ResourceOperationKind& out);
+bool Matches(const json::Value& v, const ResourceOperationKind*);
+bool Matches(json::StreamReader& r, const ResourceOperationKind*);
 Result<const json::Value*> Encode(ResourceOperationKind in, json::Builder& b);
+Result<SuccessType> Encode(ResourceOperationKind in, json::StreamWriter& w);
 
 /// No documentation available
 enum class FailureHandlingKind {
@@ -1453,7 +1589,11 @@ enum class FailureHandlingKind {
 };
 
 Result<SuccessType> Decode(const json::Value& v, FailureHandlingKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, FailureHandlingKind& out);
+bool Matches(const json::Value& v, const FailureHandlingKind*);
+bool Matches(json::StreamReader& r, const FailureHandlingKind*);
 Result<const json::Value*> Encode(FailureHandlingKind in, json::Builder& b);
+Result<SuccessType> Encode(FailureHandlingKind in, json::StreamWriter& w);
 
 /// No documentation available
 enum class PrepareSupportDefaultBehavior {
@@ -1463,7 +1603,11 @@ enum class PrepareSupportDefaultBehavior {
 };
 
 Result<SuccessType> Decode(const json::Value& v, PrepareSupportDefaultBehavior& out);
+Result<SuccessType> Decode(json::StreamReader& r, PrepareSupportDefaultBehavior& out);
+bool Matches(const json::Value& v, const PrepareSupportDefaultBehavior*);
+bool Matches(json::StreamReader& r, const PrepareSupportDefaultBehavior*);
 Result<const json::Value*> Encode(PrepareSupportDefaultBehavior in, json::Builder& b);
+Result<SuccessType> Encode(PrepareSupportDefaultBehavior in, json::StreamWriter& w);
 
 /// No documentation available
 enum class TokenFormat {
@@ -1472,7 +1616,11 @@ enum class TokenFormat {
 };
 
 Result<SuccessType> Decode(const json::Value& v, TokenFormat& out);
+Result<SuccessType> Decode(json::StreamReader& r, TokenFormat& out);
+bool Matches(const json::Value& v, const TokenFormat*);
+bool Matches(json::StreamReader& r, const TokenFormat*);
 Result<const json::Value*> Encode(TokenFormat in, json::Builder& b);
+Result<SuccessType> Encode(TokenFormat in, json::StreamWriter& w);
 
 ////////////////////////////////////////////////////////////////////////////////
 // Structures
@@ -1483,6 +1631,7 @@ struct TextDocumentIdentifier {
     /// The text document's uri.
     DocumentUri uri{};
 };
+void EnableInlineStorage(InlineStorageTag<TextDocumentIdentifier>);
 
 /// Position in a text document expressed as zero-based line and character offset. Prior to 3.17 the
 /// offsets were always based on a UTF-16 string representation. So a string of the form `a𐐀b` the
@@ -1517,6 +1666,7 @@ struct Position {
     /// the line length it defaults back to the line length.
     Uinteger character{};
 };
+void EnableInlineStorage(InlineStorageTag<Position>);
 
 /// A parameter literal used in requests to pass a text document and a position inside that
 /// document.
@@ -1527,9 +1677,11 @@ struct TextDocumentPositionParams {
     /// The position inside the text document.
     lsp::Position position{};
 };
+void EnableInlineStorage(InlineStorageTag<TextDocumentPositionParams>);
 
 /// No documentation available
 struct ImplementationParams : lsp::TextDocumentPositionParams {};
+void EnableInlineStorage(InlineStorageTag<ImplementationParams>);
 
 /// A range in a text document expressed as (zero-based) start and end positions. If you want to
 /// specify a range that contains a line including the line ending character(s) then use an end
@@ -1542,6 +1694,7 @@ struct Range {
     /// The range's end position.
     lsp::Position end{};
 };
+void EnableInlineStorage(InlineStorageTag<Range>);
 
 /// Represents a location inside a resource, such as a line inside a text file.
 struct Location {
@@ -1551,6 +1704,7 @@ struct Location {
     /// No documentation available
     lsp::Range range{};
 };
+void EnableInlineStorage(InlineStorageTag<Location>);
 
 /// General text document registration options.
 struct TextDocumentRegistrationOptions {
@@ -1558,23 +1712,29 @@ struct TextDocumentRegistrationOptions {
     /// selector provided on the client side will be used.
     OneOf<lsp::DocumentSelector, Null> document_selector{};
 };
+void EnableInlineStorage(InlineStorageTag<TextDocumentRegistrationOptions>);
 
 /// No documentation available
 struct ImplementationOptions {};
+void EnableInlineStorage(InlineStorageTag<ImplementationOptions>);
 
 /// No documentation available
 struct ImplementationRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                            lsp::ImplementationOptions {};
+void EnableInlineStorage(InlineStorageTag<ImplementationRegistrationOptions>);
 
 /// No documentation available
 struct TypeDefinitionParams : lsp::TextDocumentPositionParams {};
+void EnableInlineStorage(InlineStorageTag<TypeDefinitionParams>);
 
 /// No documentation available
 struct TypeDefinitionOptions {};
+void EnableInlineStorage(InlineStorageTag<TypeDefinitionOptions>);
 
 /// No documentation available
 struct TypeDefinitionRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                            lsp::TypeDefinitionOptions {};
+void EnableInlineStorage(InlineStorageTag<TypeDefinitionRegistrationOptions>);
 
 /// A workspace folder inside a client.
 struct WorkspaceFolder {
@@ -1585,6 +1745,7 @@ struct WorkspaceFolder {
     /// interface.
     String name{};
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceFolder>);
 
 /// The workspace folder change event.
 struct WorkspaceFoldersChangeEvent {
@@ -1594,12 +1755,14 @@ struct WorkspaceFoldersChangeEvent {
     /// The array of the removed workspace folders
     std::vector<lsp::WorkspaceFolder> removed{};
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceFoldersChangeEvent>);
 
 /// The parameters of a `workspace/didChangeWorkspaceFolders` notification.
 struct DidChangeWorkspaceFoldersParams {
     /// The actual workspace folder change event.
     lsp::WorkspaceFoldersChangeEvent event{};
 };
+void EnableInlineStorage(InlineStorageTag<DidChangeWorkspaceFoldersParams>);
 
 /// No documentation available
 struct ConfigurationItem {
@@ -1609,18 +1772,21 @@ struct ConfigurationItem {
     /// The configuration section asked for.
     Optional<String> section;
 };
+void EnableInlineStorage(InlineStorageTag<ConfigurationItem>);
 
 /// The parameters of a configuration request.
 struct ConfigurationParams {
     /// No documentation available
     std::vector<lsp::ConfigurationItem> items{};
 };
+void EnableInlineStorage(InlineStorageTag<ConfigurationParams>);
 
 /// Parameters for a DocumentColorRequest.
 struct DocumentColorParams {
     /// The text document.
     lsp::TextDocumentIdentifier text_document{};
 };
+void EnableInlineStorage(InlineStorageTag<DocumentColorParams>);
 
 /// Represents a color in RGBA space.
 struct Color {
@@ -1636,6 +1802,7 @@ struct Color {
     /// The alpha component of this color in the range [0-1].
     Decimal alpha{};
 };
+void EnableInlineStorage(InlineStorageTag<Color>);
 
 /// Represents a color range from a document.
 struct ColorInformation {
@@ -1645,13 +1812,16 @@ struct ColorInformation {
     /// The actual color value for this color range.
     lsp::Color color{};
 };
+void EnableInlineStorage(InlineStorageTag<ColorInformation>);
 
 /// No documentation available
 struct DocumentColorOptions {};
+void EnableInlineStorage(InlineStorageTag<DocumentColorOptions>);
 
 /// No documentation available
 struct DocumentColorRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                           lsp::DocumentColorOptions {};
+void EnableInlineStorage(InlineStorageTag<DocumentColorRegistrationOptions>);
 
 /// Parameters for a ColorPresentationRequest.
 struct ColorPresentationParams {
@@ -1664,6 +1834,7 @@ struct ColorPresentationParams {
     /// The range where the color would be inserted. Serves as a context.
     lsp::Range range{};
 };
+void EnableInlineStorage(InlineStorageTag<ColorPresentationParams>);
 
 /// A text edit applicable to a text document.
 struct TextEdit {
@@ -1674,6 +1845,7 @@ struct TextEdit {
     /// The string to be inserted. For delete operations use an empty string.
     String new_text{};
 };
+void EnableInlineStorage(InlineStorageTag<TextEdit>);
 
 /// No documentation available
 struct ColorPresentation {
@@ -1690,18 +1862,21 @@ struct ColorPresentation {
     /// with themselves.
     Optional<std::vector<lsp::TextEdit>> additional_text_edits;
 };
+void EnableInlineStorage(InlineStorageTag<ColorPresentation>);
 
 /// No documentation available
 struct WorkDoneProgressOptions {
     /// No documentation available
     Optional<Boolean> work_done_progress;
 };
+void EnableInlineStorage(InlineStorageTag<WorkDoneProgressOptions>);
 
 /// Parameters for a FoldingRangeRequest.
 struct FoldingRangeParams {
     /// The text document.
     lsp::TextDocumentIdentifier text_document{};
 };
+void EnableInlineStorage(InlineStorageTag<FoldingRangeParams>);
 
 /// Represents a folding range. To be valid, start and end line must be bigger than zero and smaller
 /// than the number of lines in the document. Clients are free to ignore invalid ranges.
@@ -1735,23 +1910,29 @@ struct FoldingRange {
     /// @since 3.17.0
     Optional<String> collapsed_text;
 };
+void EnableInlineStorage(InlineStorageTag<FoldingRange>);
 
 /// No documentation available
 struct FoldingRangeOptions {};
+void EnableInlineStorage(InlineStorageTag<FoldingRangeOptions>);
 
 /// No documentation available
 struct FoldingRangeRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                          lsp::FoldingRangeOptions {};
+void EnableInlineStorage(InlineStorageTag<FoldingRangeRegistrationOptions>);
 
 /// No documentation available
 struct DeclarationParams : lsp::TextDocumentPositionParams {};
+void EnableInlineStorage(InlineStorageTag<DeclarationParams>);
 
 /// No documentation available
 struct DeclarationOptions {};
+void EnableInlineStorage(InlineStorageTag<DeclarationOptions>);
 
 /// No documentation available
 struct DeclarationRegistrationOptions : lsp::DeclarationOptions,
                                         lsp::TextDocumentRegistrationOptions {};
+void EnableInlineStorage(InlineStorageTag<DeclarationRegistrationOptions>);
 
 /// A parameter literal used in selection range requests.
 struct SelectionRangeParams {
@@ -1761,6 +1942,7 @@ struct SelectionRangeParams {
     /// The positions inside the text document.
     std::vector<lsp::Position> positions{};
 };
+void EnableInlineStorage(InlineStorageTag<SelectionRangeParams>);
 
 /// A selection range represents a part of a selection hierarchy. A selection range may have a
 /// parent selection range that contains it.
@@ -1775,27 +1957,32 @@ struct SelectionRange {
 
 /// No documentation available
 struct SelectionRangeOptions {};
+void EnableInlineStorage(InlineStorageTag<SelectionRangeOptions>);
 
 /// No documentation available
 struct SelectionRangeRegistrationOptions : lsp::SelectionRangeOptions,
                                            lsp::TextDocumentRegistrationOptions {};
+void EnableInlineStorage(InlineStorageTag<SelectionRangeRegistrationOptions>);
 
 /// No documentation available
 struct WorkDoneProgressCreateParams {
     /// The token to be used to report progress.
     lsp::ProgressToken token{};
 };
+void EnableInlineStorage(InlineStorageTag<WorkDoneProgressCreateParams>);
 
 /// No documentation available
 struct WorkDoneProgressCancelParams {
     /// The token to be used to report progress.
     lsp::ProgressToken token{};
 };
+void EnableInlineStorage(InlineStorageTag<WorkDoneProgressCancelParams>);
 
 /// The parameter of a `textDocument/prepareCallHierarchy` request.
 ///
 /// @since 3.16.0
 struct CallHierarchyPrepareParams : lsp::TextDocumentPositionParams {};
+void EnableInlineStorage(InlineStorageTag<CallHierarchyPrepareParams>);
 
 /// Represents programming constructs like functions or constructors in the context of call
 /// hierarchy.
@@ -1829,17 +2016,20 @@ struct CallHierarchyItem {
     /// outgoing calls requests.
     Optional<lsp::LSPAny> data;
 };
+void EnableInlineStorage(InlineStorageTag<CallHierarchyItem>);
 
 /// Call hierarchy options used during static registration.
 ///
 /// @since 3.16.0
 struct CallHierarchyOptions {};
+void EnableInlineStorage(InlineStorageTag<CallHierarchyOptions>);
 
 /// Call hierarchy options used during static or dynamic registration.
 ///
 /// @since 3.16.0
 struct CallHierarchyRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                           lsp::CallHierarchyOptions {};
+void EnableInlineStorage(InlineStorageTag<CallHierarchyRegistrationOptions>);
 
 /// The parameter of a `callHierarchy/incomingCalls` request.
 ///
@@ -1848,6 +2038,7 @@ struct CallHierarchyIncomingCallsParams {
     /// No documentation available
     lsp::CallHierarchyItem item{};
 };
+void EnableInlineStorage(InlineStorageTag<CallHierarchyIncomingCallsParams>);
 
 /// Represents an incoming call, e.g. a caller of a method or constructor.
 ///
@@ -1860,6 +2051,7 @@ struct CallHierarchyIncomingCall {
     /// CallHierarchyIncomingCall.from `this.from`.
     std::vector<lsp::Range> from_ranges{};
 };
+void EnableInlineStorage(InlineStorageTag<CallHierarchyIncomingCall>);
 
 /// The parameter of a `callHierarchy/outgoingCalls` request.
 ///
@@ -1868,6 +2060,7 @@ struct CallHierarchyOutgoingCallsParams {
     /// No documentation available
     lsp::CallHierarchyItem item{};
 };
+void EnableInlineStorage(InlineStorageTag<CallHierarchyOutgoingCallsParams>);
 
 /// Represents an outgoing call, e.g. calling a getter from a method or a method from a constructor
 /// etc.
@@ -1882,12 +2075,14 @@ struct CallHierarchyOutgoingCall {
     /// `provideCallHierarchyOutgoingCalls` and not CallHierarchyOutgoingCall.to `this.to`.
     std::vector<lsp::Range> from_ranges{};
 };
+void EnableInlineStorage(InlineStorageTag<CallHierarchyOutgoingCall>);
 
 /// @since 3.16.0
 struct SemanticTokensParams {
     /// The text document.
     lsp::TextDocumentIdentifier text_document{};
 };
+void EnableInlineStorage(InlineStorageTag<SemanticTokensParams>);
 
 /// @since 3.16.0
 struct SemanticTokens {
@@ -1899,12 +2094,14 @@ struct SemanticTokens {
     /// The actual tokens.
     std::vector<Uinteger> data{};
 };
+void EnableInlineStorage(InlineStorageTag<SemanticTokens>);
 
 /// @since 3.16.0
 struct SemanticTokensPartialResult {
     /// No documentation available
     std::vector<Uinteger> data{};
 };
+void EnableInlineStorage(InlineStorageTag<SemanticTokensPartialResult>);
 
 /// @since 3.16.0
 struct SemanticTokensLegend {
@@ -1914,6 +2111,7 @@ struct SemanticTokensLegend {
     /// The token modifiers a server uses.
     std::vector<String> token_modifiers{};
 };
+void EnableInlineStorage(InlineStorageTag<SemanticTokensLegend>);
 
 /// Semantic tokens options to support deltas for full documents
 ///
@@ -1924,11 +2122,13 @@ struct SemanticTokensFullDelta {
     /// The server supports deltas for full documents.
     Optional<Boolean> delta;
 };
+void EnableInlineStorage(InlineStorageTag<SemanticTokensFullDelta>);
 
 /// @since 3.16.0
 struct SemanticTokensOptions {
     /// No documentation available
     struct Range {};
+void EnableInlineStorage(InlineStorageTag<SemanticTokensOptions>);
 
     /// The legend used by the server
     lsp::SemanticTokensLegend legend{};
@@ -1943,6 +2143,7 @@ struct SemanticTokensOptions {
 /// @since 3.16.0
 struct SemanticTokensRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                            lsp::SemanticTokensOptions {};
+void EnableInlineStorage(InlineStorageTag<SemanticTokensRegistrationOptions>);
 
 /// @since 3.16.0
 struct SemanticTokensDeltaParams {
@@ -1953,6 +2154,7 @@ struct SemanticTokensDeltaParams {
     /// delta response depending on what was received last.
     String previous_result_id{};
 };
+void EnableInlineStorage(InlineStorageTag<SemanticTokensDeltaParams>);
 
 /// @since 3.16.0
 struct SemanticTokensEdit {
@@ -1965,6 +2167,7 @@ struct SemanticTokensEdit {
     /// The elements to insert.
     Optional<std::vector<Uinteger>> data;
 };
+void EnableInlineStorage(InlineStorageTag<SemanticTokensEdit>);
 
 /// @since 3.16.0
 struct SemanticTokensDelta {
@@ -1974,12 +2177,14 @@ struct SemanticTokensDelta {
     /// The semantic token edits to transform a previous result into a new result.
     std::vector<lsp::SemanticTokensEdit> edits{};
 };
+void EnableInlineStorage(InlineStorageTag<SemanticTokensDelta>);
 
 /// @since 3.16.0
 struct SemanticTokensDeltaPartialResult {
     /// No documentation available
     std::vector<lsp::SemanticTokensEdit> edits{};
 };
+void EnableInlineStorage(InlineStorageTag<SemanticTokensDeltaPartialResult>);
 
 /// @since 3.16.0
 struct SemanticTokensRangeParams {
@@ -1989,6 +2194,7 @@ struct SemanticTokensRangeParams {
     /// The range the semantic tokens are requested for.
     lsp::Range range{};
 };
+void EnableInlineStorage(InlineStorageTag<SemanticTokensRangeParams>);
 
 /// Params to show a resource in the UI.
 ///
@@ -2009,6 +2215,7 @@ struct ShowDocumentParams {
     /// property if an external program is started or the file is not a text file.
     Optional<lsp::Range> selection;
 };
+void EnableInlineStorage(InlineStorageTag<ShowDocumentParams>);
 
 /// The result of a showDocument request.
 ///
@@ -2017,9 +2224,11 @@ struct ShowDocumentResult {
     /// A boolean indicating if the show was successful.
     Boolean success{};
 };
+void EnableInlineStorage(InlineStorageTag<ShowDocumentResult>);
 
 /// No documentation available
 struct LinkedEditingRangeParams : lsp::TextDocumentPositionParams {};
+void EnableInlineStorage(InlineStorageTag<LinkedEditingRangeParams>);
 
 /// The result of a linked editing range request.
 ///
@@ -2033,13 +2242,16 @@ struct LinkedEditingRanges {
     /// ranges. If no pattern is provided, the client configuration's word pattern will be used.
     Optional<String> word_pattern;
 };
+void EnableInlineStorage(InlineStorageTag<LinkedEditingRanges>);
 
 /// No documentation available
 struct LinkedEditingRangeOptions {};
+void EnableInlineStorage(InlineStorageTag<LinkedEditingRangeOptions>);
 
 /// No documentation available
 struct LinkedEditingRangeRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                                lsp::LinkedEditingRangeOptions {};
+void EnableInlineStorage(InlineStorageTag<LinkedEditingRangeRegistrationOptions>);
 
 /// Represents information on a file/folder create.
 ///
@@ -2048,6 +2260,7 @@ struct FileCreate {
     /// A file:// URI for the location of the file/folder being created.
     String uri{};
 };
+void EnableInlineStorage(InlineStorageTag<FileCreate>);
 
 /// The parameters sent in notifications/requests for user-initiated creation of files.
 ///
@@ -2056,6 +2269,7 @@ struct CreateFilesParams {
     /// An array of all files/folders created in this operation.
     std::vector<lsp::FileCreate> files{};
 };
+void EnableInlineStorage(InlineStorageTag<CreateFilesParams>);
 
 /// A generic resource operation.
 struct ResourceOperation {
@@ -2067,6 +2281,7 @@ struct ResourceOperation {
     /// @since 3.16.0
     Optional<lsp::ChangeAnnotationIdentifier> annotation_id;
 };
+void EnableInlineStorage(InlineStorageTag<ResourceOperation>);
 
 /// Delete file options
 struct DeleteFileOptions {
@@ -2076,6 +2291,7 @@ struct DeleteFileOptions {
     /// Ignore the operation if the file doesn't exist.
     Optional<Boolean> ignore_if_not_exists;
 };
+void EnableInlineStorage(InlineStorageTag<DeleteFileOptions>);
 
 /// Delete file operation
 struct DeleteFile : lsp::ResourceOperation {
@@ -2088,6 +2304,7 @@ struct DeleteFile : lsp::ResourceOperation {
     /// Delete options.
     Optional<lsp::DeleteFileOptions> options;
 };
+void EnableInlineStorage(InlineStorageTag<DeleteFile>);
 
 /// Rename file options
 struct RenameFileOptions {
@@ -2097,6 +2314,7 @@ struct RenameFileOptions {
     /// Ignores if target exists.
     Optional<Boolean> ignore_if_exists;
 };
+void EnableInlineStorage(InlineStorageTag<RenameFileOptions>);
 
 /// Rename file operation
 struct RenameFile : lsp::ResourceOperation {
@@ -2112,6 +2330,7 @@ struct RenameFile : lsp::ResourceOperation {
     /// Rename options.
     Optional<lsp::RenameFileOptions> options;
 };
+void EnableInlineStorage(InlineStorageTag<RenameFile>);
 
 /// Options to create a file.
 struct CreateFileOptions {
@@ -2121,6 +2340,7 @@ struct CreateFileOptions {
     /// Ignore if exists.
     Optional<Boolean> ignore_if_exists;
 };
+void EnableInlineStorage(InlineStorageTag<CreateFileOptions>);
 
 /// Create file operation.
 struct CreateFile : lsp::ResourceOperation {
@@ -2133,6 +2353,7 @@ struct CreateFile : lsp::ResourceOperation {
     /// Additional options
     Optional<lsp::CreateFileOptions> options;
 };
+void EnableInlineStorage(InlineStorageTag<CreateFile>);
 
 /// A text document identifier to optionally denote a specific version of a text document.
 struct OptionalVersionedTextDocumentIdentifier : lsp::TextDocumentIdentifier {
@@ -2142,6 +2363,7 @@ struct OptionalVersionedTextDocumentIdentifier : lsp::TextDocumentIdentifier {
     /// unknown and the content on disk is the truth (as specified with document content ownership).
     OneOf<Integer, Null> version{};
 };
+void EnableInlineStorage(InlineStorageTag<OptionalVersionedTextDocumentIdentifier>);
 
 /// A special text edit with an additional change annotation.
 ///
@@ -2150,6 +2372,7 @@ struct AnnotatedTextEdit : lsp::TextEdit {
     /// The actual identifier of the change annotation
     lsp::ChangeAnnotationIdentifier annotation_id{};
 };
+void EnableInlineStorage(InlineStorageTag<AnnotatedTextEdit>);
 
 /// Describes textual changes on a text document. A TextDocumentEdit describes all changes on a
 /// document version Si and after they are applied move the document to version Si+1. So the creator
@@ -2164,6 +2387,7 @@ struct TextDocumentEdit {
     /// @since 3.16.0 - support for AnnotatedTextEdit. This is guarded using a client capability.
     std::vector<OneOf<lsp::TextEdit, lsp::AnnotatedTextEdit>> edits{};
 };
+void EnableInlineStorage(InlineStorageTag<TextDocumentEdit>);
 
 /// Additional information that describes document changes.
 ///
@@ -2179,6 +2403,7 @@ struct ChangeAnnotation {
     /// A human-readable string which is rendered less prominent in the user interface.
     Optional<String> description;
 };
+void EnableInlineStorage(InlineStorageTag<ChangeAnnotation>);
 
 /// A workspace edit represents changes to many resources managed in the workspace. The edit should
 /// either provide `changes` or `documentChanges`. If documentChanges are present they are preferred
@@ -2214,6 +2439,7 @@ struct WorkspaceEdit {
     Optional<std::unordered_map<lsp::ChangeAnnotationIdentifier, lsp::ChangeAnnotation>>
         change_annotations;
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceEdit>);
 
 /// Matching options for the file operation pattern.
 ///
@@ -2222,6 +2448,7 @@ struct FileOperationPatternOptions {
     /// The pattern should be matched ignoring casing.
     Optional<Boolean> ignore_case;
 };
+void EnableInlineStorage(InlineStorageTag<FileOperationPatternOptions>);
 
 /// A pattern to describe in which file operation requests or notifications the server is interested
 /// in receiving.
@@ -2244,6 +2471,7 @@ struct FileOperationPattern {
     /// Additional options used during matching.
     Optional<lsp::FileOperationPatternOptions> options;
 };
+void EnableInlineStorage(InlineStorageTag<FileOperationPattern>);
 
 /// A filter to describe in which file operation requests or notifications the server is interested
 /// in receiving.
@@ -2256,6 +2484,7 @@ struct FileOperationFilter {
     /// The actual file operation pattern.
     lsp::FileOperationPattern pattern{};
 };
+void EnableInlineStorage(InlineStorageTag<FileOperationFilter>);
 
 /// The options to register for file operations.
 ///
@@ -2264,6 +2493,7 @@ struct FileOperationRegistrationOptions {
     /// The actual filters.
     std::vector<lsp::FileOperationFilter> filters{};
 };
+void EnableInlineStorage(InlineStorageTag<FileOperationRegistrationOptions>);
 
 /// Represents information on a file/folder rename.
 ///
@@ -2275,6 +2505,7 @@ struct FileRename {
     /// A file:// URI for the new location of the file/folder being renamed.
     String new_uri{};
 };
+void EnableInlineStorage(InlineStorageTag<FileRename>);
 
 /// The parameters sent in notifications/requests for user-initiated renames of files.
 ///
@@ -2284,6 +2515,7 @@ struct RenameFilesParams {
     /// folder will be included, and not its children.
     std::vector<lsp::FileRename> files{};
 };
+void EnableInlineStorage(InlineStorageTag<RenameFilesParams>);
 
 /// Represents information on a file/folder delete.
 ///
@@ -2292,6 +2524,7 @@ struct FileDelete {
     /// A file:// URI for the location of the file/folder being deleted.
     String uri{};
 };
+void EnableInlineStorage(InlineStorageTag<FileDelete>);
 
 /// The parameters sent in notifications/requests for user-initiated deletes of files.
 ///
@@ -2300,9 +2533,11 @@ struct DeleteFilesParams {
     /// An array of all files/folders deleted in this operation.
     std::vector<lsp::FileDelete> files{};
 };
+void EnableInlineStorage(InlineStorageTag<DeleteFilesParams>);
 
 /// No documentation available
 struct MonikerParams : lsp::TextDocumentPositionParams {};
+void EnableInlineStorage(InlineStorageTag<MonikerParams>);
 
 /// Moniker definition to match LSIF 0.5 moniker definition.
 ///
@@ -2321,17 +2556,21 @@ struct Moniker {
     /// The moniker kind if known.
     Optional<lsp::MonikerKind> kind;
 };
+void EnableInlineStorage(InlineStorageTag<Moniker>);
 
 /// No documentation available
 struct MonikerOptions {};
+void EnableInlineStorage(InlineStorageTag<MonikerOptions>);
 
 /// No documentation available
 struct MonikerRegistrationOptions : lsp::TextDocumentRegistrationOptions, lsp::MonikerOptions {};
+void EnableInlineStorage(InlineStorageTag<MonikerRegistrationOptions>);
 
 /// The parameter of a `textDocument/prepareTypeHierarchy` request.
 ///
 /// @since 3.17.0
 struct TypeHierarchyPrepareParams : lsp::TextDocumentPositionParams {};
+void EnableInlineStorage(InlineStorageTag<TypeHierarchyPrepareParams>);
 
 /// @since 3.17.0
 struct TypeHierarchyItem {
@@ -2363,17 +2602,20 @@ struct TypeHierarchyItem {
     /// helping improve the performance on resolving supertypes and subtypes.
     Optional<lsp::LSPAny> data;
 };
+void EnableInlineStorage(InlineStorageTag<TypeHierarchyItem>);
 
 /// Type hierarchy options used during static registration.
 ///
 /// @since 3.17.0
 struct TypeHierarchyOptions {};
+void EnableInlineStorage(InlineStorageTag<TypeHierarchyOptions>);
 
 /// Type hierarchy options used during static or dynamic registration.
 ///
 /// @since 3.17.0
 struct TypeHierarchyRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                           lsp::TypeHierarchyOptions {};
+void EnableInlineStorage(InlineStorageTag<TypeHierarchyRegistrationOptions>);
 
 /// The parameter of a `typeHierarchy/supertypes` request.
 ///
@@ -2382,6 +2624,7 @@ struct TypeHierarchySupertypesParams {
     /// No documentation available
     lsp::TypeHierarchyItem item{};
 };
+void EnableInlineStorage(InlineStorageTag<TypeHierarchySupertypesParams>);
 
 /// The parameter of a `typeHierarchy/subtypes` request.
 ///
@@ -2390,6 +2633,7 @@ struct TypeHierarchySubtypesParams {
     /// No documentation available
     lsp::TypeHierarchyItem item{};
 };
+void EnableInlineStorage(InlineStorageTag<TypeHierarchySubtypesParams>);
 
 /// @since 3.17.0
 struct InlineValueContext {
@@ -2400,6 +2644,7 @@ struct InlineValueContext {
     /// denotes the line where the inline values are shown.
     lsp::Range stopped_location{};
 };
+void EnableInlineStorage(InlineStorageTag<InlineValueContext>);
 
 /// A parameter literal used in inline value requests.
 ///
@@ -2414,17 +2659,20 @@ struct InlineValueParams {
     /// Additional information about the context in which inline values were requested.
     lsp::InlineValueContext context{};
 };
+void EnableInlineStorage(InlineStorageTag<InlineValueParams>);
 
 /// Inline value options used during static registration.
 ///
 /// @since 3.17.0
 struct InlineValueOptions {};
+void EnableInlineStorage(InlineStorageTag<InlineValueOptions>);
 
 /// Inline value options used during static or dynamic registration.
 ///
 /// @since 3.17.0
 struct InlineValueRegistrationOptions : lsp::InlineValueOptions,
                                         lsp::TextDocumentRegistrationOptions {};
+void EnableInlineStorage(InlineStorageTag<InlineValueRegistrationOptions>);
 
 /// A parameter literal used in inlay hint requests.
 ///
@@ -2436,6 +2684,7 @@ struct InlayHintParams {
     /// The document range for which inlay hints should be computed.
     lsp::Range range{};
 };
+void EnableInlineStorage(InlineStorageTag<InlayHintParams>);
 
 /// A `MarkupContent` literal represents a string value which content is interpreted base on its
 /// kind flag. Currently the protocol supports `plaintext` and `markdown` as markup kinds. If the
@@ -2453,6 +2702,7 @@ struct MarkupContent {
     /// The content itself
     String value{};
 };
+void EnableInlineStorage(InlineStorageTag<MarkupContent>);
 
 /// Represents a reference to a command. Provides a title which will be used to represent a command
 /// in the UI and, optionally, an array of arguments which will be passed to the command handler
@@ -2467,6 +2717,7 @@ struct Command {
     /// Arguments that the command handler should be invoked with.
     Optional<std::vector<lsp::LSPAny>> arguments;
 };
+void EnableInlineStorage(InlineStorageTag<Command>);
 
 /// An inlay hint label part allows for interactive and composite labels of inlay hints.
 ///
@@ -2494,6 +2745,7 @@ struct InlayHintLabelPart {
     /// request.
     Optional<lsp::Command> command;
 };
+void EnableInlineStorage(InlineStorageTag<InlayHintLabelPart>);
 
 /// Inlay hint information.
 ///
@@ -2532,6 +2784,7 @@ struct InlayHint {
     /// a `inlayHint/resolve` request.
     Optional<lsp::LSPAny> data;
 };
+void EnableInlineStorage(InlineStorageTag<InlayHint>);
 
 /// Inlay hint options used during static registration.
 ///
@@ -2540,12 +2793,14 @@ struct InlayHintOptions {
     /// The server provides support to resolve additional information for an inlay hint item.
     Optional<Boolean> resolve_provider;
 };
+void EnableInlineStorage(InlineStorageTag<InlayHintOptions>);
 
 /// Inlay hint options used during static or dynamic registration.
 ///
 /// @since 3.17.0
 struct InlayHintRegistrationOptions : lsp::InlayHintOptions,
                                       lsp::TextDocumentRegistrationOptions {};
+void EnableInlineStorage(InlineStorageTag<InlayHintRegistrationOptions>);
 
 /// Parameters of the document diagnostic request.
 ///
@@ -2560,6 +2815,7 @@ struct DocumentDiagnosticParams {
     /// The result id of a previous response if provided.
     Optional<String> previous_result_id;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentDiagnosticParams>);
 
 /// A diagnostic report indicating that the last returned report is still accurate.
 ///
@@ -2571,6 +2827,7 @@ struct UnchangedDocumentDiagnosticReport {
     /// A result id which will be sent on the next diagnostic request for the same document.
     String result_id{};
 };
+void EnableInlineStorage(InlineStorageTag<UnchangedDocumentDiagnosticReport>);
 
 /// Structure to capture a description for an error code.
 ///
@@ -2579,6 +2836,7 @@ struct CodeDescription {
     /// An URI to open with more information about the diagnostic error.
     Uri href{};
 };
+void EnableInlineStorage(InlineStorageTag<CodeDescription>);
 
 /// Represents a related message and source code location for a diagnostic. This should be used to
 /// point to code locations that cause or related to a diagnostics, e.g when duplicating a symbol in
@@ -2590,6 +2848,7 @@ struct DiagnosticRelatedInformation {
     /// The message of this related diagnostic information.
     String message{};
 };
+void EnableInlineStorage(InlineStorageTag<DiagnosticRelatedInformation>);
 
 /// Represents a diagnostic, such as a compiler error or warning. Diagnostic objects are only valid
 /// in the scope of a resource.
@@ -2632,6 +2891,7 @@ struct Diagnostic {
     /// @since 3.16.0
     Optional<lsp::LSPAny> data;
 };
+void EnableInlineStorage(InlineStorageTag<Diagnostic>);
 
 /// A diagnostic report with a full set of problems.
 ///
@@ -2647,6 +2907,7 @@ struct FullDocumentDiagnosticReport {
     /// The actual items.
     std::vector<lsp::Diagnostic> items{};
 };
+void EnableInlineStorage(InlineStorageTag<FullDocumentDiagnosticReport>);
 
 /// A partial result for a document diagnostic report.
 ///
@@ -2658,6 +2919,7 @@ struct DocumentDiagnosticReportPartialResult {
         OneOf<lsp::FullDocumentDiagnosticReport, lsp::UnchangedDocumentDiagnosticReport>>
         related_documents{};
 };
+void EnableInlineStorage(InlineStorageTag<DocumentDiagnosticReportPartialResult>);
 
 /// Cancellation data returned from a diagnostic request.
 ///
@@ -2666,6 +2928,7 @@ struct DiagnosticServerCancellationData {
     /// No documentation available
     Boolean retrigger_request{};
 };
+void EnableInlineStorage(InlineStorageTag<DiagnosticServerCancellationData>);
 
 /// Diagnostic options.
 ///
@@ -2682,12 +2945,14 @@ struct DiagnosticOptions {
     /// The server provides support for workspace diagnostics as well.
     Boolean workspace_diagnostics{};
 };
+void EnableInlineStorage(InlineStorageTag<DiagnosticOptions>);
 
 /// Diagnostic registration options.
 ///
 /// @since 3.17.0
 struct DiagnosticRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                        lsp::DiagnosticOptions {};
+void EnableInlineStorage(InlineStorageTag<DiagnosticRegistrationOptions>);
 
 /// A previous result id in a workspace pull request.
 ///
@@ -2699,6 +2964,7 @@ struct PreviousResultId {
     /// The value of the previous result id.
     String value{};
 };
+void EnableInlineStorage(InlineStorageTag<PreviousResultId>);
 
 /// Parameters of the workspace diagnostic request.
 ///
@@ -2710,6 +2976,7 @@ struct WorkspaceDiagnosticParams {
     /// The currently known diagnostic reports with their previous result ids.
     std::vector<lsp::PreviousResultId> previous_result_ids{};
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceDiagnosticParams>);
 
 /// A workspace diagnostic report.
 ///
@@ -2718,6 +2985,7 @@ struct WorkspaceDiagnosticReport {
     /// No documentation available
     std::vector<lsp::WorkspaceDocumentDiagnosticReport> items{};
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceDiagnosticReport>);
 
 /// A partial result for a workspace diagnostic report.
 ///
@@ -2726,6 +2994,7 @@ struct WorkspaceDiagnosticReportPartialResult {
     /// No documentation available
     std::vector<lsp::WorkspaceDocumentDiagnosticReport> items{};
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceDiagnosticReportPartialResult>);
 
 /// No documentation available
 struct ExecutionSummary {
@@ -2736,6 +3005,7 @@ struct ExecutionSummary {
     /// Whether the execution was successful or not if known by the client.
     Optional<Boolean> success;
 };
+void EnableInlineStorage(InlineStorageTag<ExecutionSummary>);
 
 /// A notebook cell. A cell's document URI must be unique across ALL notebook cells and can
 /// therefore be used to uniquely identify a notebook cell or the cell's text document.
@@ -2755,6 +3025,7 @@ struct NotebookCell {
     /// Additional execution summary information if supported by the client.
     Optional<lsp::ExecutionSummary> execution_summary;
 };
+void EnableInlineStorage(InlineStorageTag<NotebookCell>);
 
 /// A notebook document.
 ///
@@ -2777,6 +3048,7 @@ struct NotebookDocument {
     /// The cells of a notebook.
     std::vector<lsp::NotebookCell> cells{};
 };
+void EnableInlineStorage(InlineStorageTag<NotebookDocument>);
 
 /// An item to transfer a text document from the client to the server.
 struct TextDocumentItem {
@@ -2793,6 +3065,7 @@ struct TextDocumentItem {
     /// The content of the opened text document.
     String text{};
 };
+void EnableInlineStorage(InlineStorageTag<TextDocumentItem>);
 
 /// The params sent in an open notebook document notification.
 ///
@@ -2804,6 +3077,7 @@ struct DidOpenNotebookDocumentParams {
     /// The text documents that represent the content of a notebook cell.
     std::vector<lsp::TextDocumentItem> cell_text_documents{};
 };
+void EnableInlineStorage(InlineStorageTag<DidOpenNotebookDocumentParams>);
 
 /// A versioned notebook document identifier.
 ///
@@ -2815,6 +3089,7 @@ struct VersionedNotebookDocumentIdentifier {
     /// The notebook document's uri.
     Uri uri{};
 };
+void EnableInlineStorage(InlineStorageTag<VersionedNotebookDocumentIdentifier>);
 
 /// A change describing how to move a `NotebookCell` array from state S to S'.
 ///
@@ -2829,6 +3104,7 @@ struct NotebookCellArrayChange {
     /// The new cells, if any
     Optional<std::vector<lsp::NotebookCell>> cells;
 };
+void EnableInlineStorage(InlineStorageTag<NotebookCellArrayChange>);
 
 /// Structural changes to cells in a notebook document.
 ///
@@ -2845,12 +3121,14 @@ struct NotebookDocumentCellChangeStructure {
     /// Additional closed cell text documents.
     Optional<std::vector<lsp::TextDocumentIdentifier>> did_close;
 };
+void EnableInlineStorage(InlineStorageTag<NotebookDocumentCellChangeStructure>);
 
 /// A text document identifier to denote a specific version of a text document.
 struct VersionedTextDocumentIdentifier : lsp::TextDocumentIdentifier {
     /// The version number of this document.
     Integer version{};
 };
+void EnableInlineStorage(InlineStorageTag<VersionedTextDocumentIdentifier>);
 
 /// Content changes to a cell in a notebook document.
 ///
@@ -2864,6 +3142,7 @@ struct NotebookDocumentCellContentChanges {
     /// No documentation available
     std::vector<lsp::TextDocumentContentChangeEvent> changes{};
 };
+void EnableInlineStorage(InlineStorageTag<NotebookDocumentCellContentChanges>);
 
 /// Cell changes to a notebook document.
 ///
@@ -2880,6 +3159,7 @@ struct NotebookDocumentCellChanges {
     /// Changes to the text content of notebook cells.
     Optional<std::vector<lsp::NotebookDocumentCellContentChanges>> text_content;
 };
+void EnableInlineStorage(InlineStorageTag<NotebookDocumentCellChanges>);
 
 /// A change event for a notebook document.
 ///
@@ -2891,6 +3171,7 @@ struct NotebookDocumentChangeEvent {
     /// Changes to cells
     Optional<lsp::NotebookDocumentCellChanges> cells;
 };
+void EnableInlineStorage(InlineStorageTag<NotebookDocumentChangeEvent>);
 
 /// The params sent in a change notebook document notification.
 ///
@@ -2911,6 +3192,7 @@ struct DidChangeNotebookDocumentParams {
     /// receive them.
     lsp::NotebookDocumentChangeEvent change{};
 };
+void EnableInlineStorage(InlineStorageTag<DidChangeNotebookDocumentParams>);
 
 /// A literal to identify a notebook document in the client.
 ///
@@ -2919,6 +3201,7 @@ struct NotebookDocumentIdentifier {
     /// The notebook document's uri.
     Uri uri{};
 };
+void EnableInlineStorage(InlineStorageTag<NotebookDocumentIdentifier>);
 
 /// The params sent in a save notebook document notification.
 ///
@@ -2927,6 +3210,7 @@ struct DidSaveNotebookDocumentParams {
     /// The notebook document that got saved.
     lsp::NotebookDocumentIdentifier notebook_document{};
 };
+void EnableInlineStorage(InlineStorageTag<DidSaveNotebookDocumentParams>);
 
 /// The params sent in a close notebook document notification.
 ///
@@ -2938,6 +3222,7 @@ struct DidCloseNotebookDocumentParams {
     /// The text documents that represent the content of a notebook cell that got closed.
     std::vector<lsp::TextDocumentIdentifier> cell_text_documents{};
 };
+void EnableInlineStorage(InlineStorageTag<DidCloseNotebookDocumentParams>);
 
 /// Describes the currently selected completion item.
 ///
@@ -2951,6 +3236,7 @@ struct SelectedCompletionInfo {
     /// The text the range will be replaced with if this completion is accepted.
     String text{};
 };
+void EnableInlineStorage(InlineStorageTag<SelectedCompletionInfo>);
 
 /// Provides information about the context in which an inline completion was requested.
 ///
@@ -2965,6 +3251,7 @@ struct InlineCompletionContext {
     /// visible.
     Optional<lsp::SelectedCompletionInfo> selected_completion_info;
 };
+void EnableInlineStorage(InlineStorageTag<InlineCompletionContext>);
 
 /// A parameter literal used in inline completion requests.
 ///
@@ -2975,6 +3262,7 @@ struct InlineCompletionParams : lsp::TextDocumentPositionParams {
     /// Additional information about the context in which inline completions were requested.
     lsp::InlineCompletionContext context{};
 };
+void EnableInlineStorage(InlineStorageTag<InlineCompletionParams>);
 
 /// A string value used as a snippet is a template which allows to insert text and to control the
 /// editor cursor when insertion happens. A snippet can define tab stops and placeholders with `$1`,
@@ -2991,6 +3279,7 @@ struct StringValue {
     /// The snippet string.
     String value{};
 };
+void EnableInlineStorage(InlineStorageTag<StringValue>);
 
 /// An inline completion item represents a text snippet that is proposed inline to complete text
 /// that is being typed.
@@ -3012,6 +3301,7 @@ struct InlineCompletionItem {
     /// An optional Command that is executed *after* inserting this completion.
     Optional<lsp::Command> command;
 };
+void EnableInlineStorage(InlineStorageTag<InlineCompletionItem>);
 
 /// Represents a collection of InlineCompletionItem inline completion items to be presented in the
 /// editor.
@@ -3023,6 +3313,7 @@ struct InlineCompletionList {
     /// The inline completion items
     std::vector<lsp::InlineCompletionItem> items{};
 };
+void EnableInlineStorage(InlineStorageTag<InlineCompletionList>);
 
 /// Inline completion options used during static registration.
 ///
@@ -3030,6 +3321,7 @@ struct InlineCompletionList {
 ///
 /// Proposed in:
 struct InlineCompletionOptions {};
+void EnableInlineStorage(InlineStorageTag<InlineCompletionOptions>);
 
 /// Inline completion options used during static or dynamic registration.
 ///
@@ -3038,6 +3330,7 @@ struct InlineCompletionOptions {};
 /// Proposed in:
 struct InlineCompletionRegistrationOptions : lsp::InlineCompletionOptions,
                                              lsp::TextDocumentRegistrationOptions {};
+void EnableInlineStorage(InlineStorageTag<InlineCompletionRegistrationOptions>);
 
 /// General parameters to register for a notification or to register a provider.
 struct Registration {
@@ -3050,12 +3343,14 @@ struct Registration {
     /// Options necessary for the registration.
     Optional<lsp::LSPAny> register_options;
 };
+void EnableInlineStorage(InlineStorageTag<Registration>);
 
 /// No documentation available
 struct RegistrationParams {
     /// No documentation available
     std::vector<lsp::Registration> registrations{};
 };
+void EnableInlineStorage(InlineStorageTag<RegistrationParams>);
 
 /// General parameters to unregister a request or notification.
 struct Unregistration {
@@ -3066,12 +3361,14 @@ struct Unregistration {
     /// The method to unregister for.
     String method{};
 };
+void EnableInlineStorage(InlineStorageTag<Unregistration>);
 
 /// No documentation available
 struct UnregistrationParams {
     /// No documentation available
     std::vector<lsp::Unregistration> unregisterations{};
 };
+void EnableInlineStorage(InlineStorageTag<UnregistrationParams>);
 
 /// Information about the client
 ///
@@ -3087,6 +3384,7 @@ struct ClientInfo {
     /// The client's version as defined by the client.
     Optional<String> version;
 };
+void EnableInlineStorage(InlineStorageTag<ClientInfo>);
 
 /// @since 3.18.0
 ///
@@ -3096,6 +3394,7 @@ struct ChangeAnnotationsSupportOptions {
     /// labelled with "Changes in Strings" would be a tree node.
     Optional<Boolean> groups_on_label;
 };
+void EnableInlineStorage(InlineStorageTag<ChangeAnnotationsSupportOptions>);
 
 /// No documentation available
 struct WorkspaceEditClientCapabilities {
@@ -3126,12 +3425,14 @@ struct WorkspaceEditClientCapabilities {
     /// @since 3.16.0
     Optional<lsp::ChangeAnnotationsSupportOptions> change_annotation_support;
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceEditClientCapabilities>);
 
 /// No documentation available
 struct DidChangeConfigurationClientCapabilities {
     /// Did change configuration notification supports dynamic registration.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<DidChangeConfigurationClientCapabilities>);
 
 /// No documentation available
 struct DidChangeWatchedFilesClientCapabilities {
@@ -3144,6 +3445,7 @@ struct DidChangeWatchedFilesClientCapabilities {
     /// @since 3.17.0
     Optional<Boolean> relative_pattern_support;
 };
+void EnableInlineStorage(InlineStorageTag<DidChangeWatchedFilesClientCapabilities>);
 
 /// @since 3.18.0
 ///
@@ -3155,6 +3457,7 @@ struct ClientSymbolKindOptions {
     /// kinds from `File` to `Array` as defined in the initial version of the protocol.
     Optional<std::vector<lsp::SymbolKind>> value_set;
 };
+void EnableInlineStorage(InlineStorageTag<ClientSymbolKindOptions>);
 
 /// @since 3.18.0
 ///
@@ -3163,6 +3466,7 @@ struct ClientSymbolTagOptions {
     /// The tags supported by the client.
     std::vector<lsp::SymbolTag> value_set{};
 };
+void EnableInlineStorage(InlineStorageTag<ClientSymbolTagOptions>);
 
 /// @since 3.18.0
 ///
@@ -3171,6 +3475,7 @@ struct ClientSymbolResolveOptions {
     /// The properties that a client can resolve lazily. Usually `location.range`
     std::vector<String> properties{};
 };
+void EnableInlineStorage(InlineStorageTag<ClientSymbolResolveOptions>);
 
 /// Client capabilities for a WorkspaceSymbolRequest.
 struct WorkspaceSymbolClientCapabilities {
@@ -3192,12 +3497,14 @@ struct WorkspaceSymbolClientCapabilities {
     /// @since 3.17.0
     Optional<lsp::ClientSymbolResolveOptions> resolve_support;
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceSymbolClientCapabilities>);
 
 /// The client capabilities of a ExecuteCommandRequest.
 struct ExecuteCommandClientCapabilities {
     /// Execute command supports dynamic registration.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<ExecuteCommandClientCapabilities>);
 
 /// @since 3.16.0
 struct SemanticTokensWorkspaceClientCapabilities {
@@ -3207,6 +3514,7 @@ struct SemanticTokensWorkspaceClientCapabilities {
     /// where a server for example detects a project wide change that requires such a calculation.
     Optional<Boolean> refresh_support;
 };
+void EnableInlineStorage(InlineStorageTag<SemanticTokensWorkspaceClientCapabilities>);
 
 /// @since 3.16.0
 struct CodeLensWorkspaceClientCapabilities {
@@ -3216,6 +3524,7 @@ struct CodeLensWorkspaceClientCapabilities {
     /// server for example detect a project wide change that requires such a calculation.
     Optional<Boolean> refresh_support;
 };
+void EnableInlineStorage(InlineStorageTag<CodeLensWorkspaceClientCapabilities>);
 
 /// Capabilities relating to events from file operations by the user in the client. These events do
 /// not come from the file system, they come from user operations like renaming a file in the UI.
@@ -3243,6 +3552,7 @@ struct FileOperationClientCapabilities {
     /// The client has support for sending willDeleteFiles requests.
     Optional<Boolean> will_delete;
 };
+void EnableInlineStorage(InlineStorageTag<FileOperationClientCapabilities>);
 
 /// Client workspace capabilities specific to inline values.
 ///
@@ -3254,6 +3564,7 @@ struct InlineValueWorkspaceClientCapabilities {
     /// where a server for example detects a project wide change that requires such a calculation.
     Optional<Boolean> refresh_support;
 };
+void EnableInlineStorage(InlineStorageTag<InlineValueWorkspaceClientCapabilities>);
 
 /// Client workspace capabilities specific to inlay hints.
 ///
@@ -3265,6 +3576,7 @@ struct InlayHintWorkspaceClientCapabilities {
     /// server for example detects a project wide change that requires such a calculation.
     Optional<Boolean> refresh_support;
 };
+void EnableInlineStorage(InlineStorageTag<InlayHintWorkspaceClientCapabilities>);
 
 /// Workspace client capabilities specific to diagnostic pull requests.
 ///
@@ -3277,6 +3589,7 @@ struct DiagnosticWorkspaceClientCapabilities {
     /// calculation.
     Optional<Boolean> refresh_support;
 };
+void EnableInlineStorage(InlineStorageTag<DiagnosticWorkspaceClientCapabilities>);
 
 /// Client workspace capabilities specific to folding ranges
 ///
@@ -3294,6 +3607,7 @@ struct FoldingRangeWorkspaceClientCapabilities {
     /// Proposed in:
     Optional<Boolean> refresh_support;
 };
+void EnableInlineStorage(InlineStorageTag<FoldingRangeWorkspaceClientCapabilities>);
 
 /// Workspace specific client capabilities.
 struct WorkspaceClientCapabilities {
@@ -3362,6 +3676,7 @@ struct WorkspaceClientCapabilities {
     /// Proposed in:
     Optional<lsp::FoldingRangeWorkspaceClientCapabilities> folding_range;
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceClientCapabilities>);
 
 /// No documentation available
 struct TextDocumentSyncClientCapabilities {
@@ -3378,6 +3693,7 @@ struct TextDocumentSyncClientCapabilities {
     /// The client supports did save notifications.
     Optional<Boolean> did_save;
 };
+void EnableInlineStorage(InlineStorageTag<TextDocumentSyncClientCapabilities>);
 
 /// @since 3.18.0
 ///
@@ -3386,6 +3702,7 @@ struct CompletionItemTagOptions {
     /// The tags supported by the client.
     std::vector<lsp::CompletionItemTag> value_set{};
 };
+void EnableInlineStorage(InlineStorageTag<CompletionItemTagOptions>);
 
 /// @since 3.18.0
 ///
@@ -3394,6 +3711,7 @@ struct ClientCompletionItemResolveOptions {
     /// The properties that a client can resolve lazily.
     std::vector<String> properties{};
 };
+void EnableInlineStorage(InlineStorageTag<ClientCompletionItemResolveOptions>);
 
 /// @since 3.18.0
 ///
@@ -3402,6 +3720,7 @@ struct ClientCompletionItemInsertTextModeOptions {
     /// No documentation available
     std::vector<lsp::InsertTextMode> value_set{};
 };
+void EnableInlineStorage(InlineStorageTag<ClientCompletionItemInsertTextModeOptions>);
 
 /// @since 3.18.0
 ///
@@ -3458,6 +3777,7 @@ struct ClientCompletionItemOptions {
     /// @since 3.17.0
     Optional<Boolean> label_details_support;
 };
+void EnableInlineStorage(InlineStorageTag<ClientCompletionItemOptions>);
 
 /// @since 3.18.0
 ///
@@ -3470,6 +3790,7 @@ struct ClientCompletionItemOptionsKind {
     /// protocol.
     Optional<std::vector<lsp::CompletionItemKind>> value_set;
 };
+void EnableInlineStorage(InlineStorageTag<ClientCompletionItemOptionsKind>);
 
 /// The client supports the following `CompletionList` specific capabilities.
 ///
@@ -3482,6 +3803,7 @@ struct CompletionListCapabilities {
     /// @since 3.17.0
     Optional<std::vector<String>> item_defaults;
 };
+void EnableInlineStorage(InlineStorageTag<CompletionListCapabilities>);
 
 /// Completion client capabilities
 struct CompletionClientCapabilities {
@@ -3509,6 +3831,7 @@ struct CompletionClientCapabilities {
     /// @since 3.17.0
     Optional<lsp::CompletionListCapabilities> completion_list;
 };
+void EnableInlineStorage(InlineStorageTag<CompletionClientCapabilities>);
 
 /// No documentation available
 struct HoverClientCapabilities {
@@ -3519,6 +3842,7 @@ struct HoverClientCapabilities {
     /// the preferred format of the client.
     Optional<std::vector<lsp::MarkupKind>> content_format;
 };
+void EnableInlineStorage(InlineStorageTag<HoverClientCapabilities>);
 
 /// @since 3.18.0
 ///
@@ -3529,6 +3853,7 @@ struct ClientSignatureParameterInformationOptions {
     /// @since 3.14.0
     Optional<Boolean> label_offset_support;
 };
+void EnableInlineStorage(InlineStorageTag<ClientSignatureParameterInformationOptions>);
 
 /// @since 3.18.0
 ///
@@ -3546,6 +3871,7 @@ struct ClientSignatureInformationOptions {
     /// @since 3.16.0
     Optional<Boolean> active_parameter_support;
 };
+void EnableInlineStorage(InlineStorageTag<ClientSignatureInformationOptions>);
 
 /// Client Capabilities for a SignatureHelpRequest.
 struct SignatureHelpClientCapabilities {
@@ -3562,6 +3888,7 @@ struct SignatureHelpClientCapabilities {
     /// @since 3.15.0
     Optional<Boolean> context_support;
 };
+void EnableInlineStorage(InlineStorageTag<SignatureHelpClientCapabilities>);
 
 /// @since 3.14.0
 struct DeclarationClientCapabilities {
@@ -3573,6 +3900,7 @@ struct DeclarationClientCapabilities {
     /// The client supports additional metadata in the form of declaration links.
     Optional<Boolean> link_support;
 };
+void EnableInlineStorage(InlineStorageTag<DeclarationClientCapabilities>);
 
 /// Client Capabilities for a DefinitionRequest.
 struct DefinitionClientCapabilities {
@@ -3584,6 +3912,7 @@ struct DefinitionClientCapabilities {
     /// @since 3.14.0
     Optional<Boolean> link_support;
 };
+void EnableInlineStorage(InlineStorageTag<DefinitionClientCapabilities>);
 
 /// Since 3.6.0
 struct TypeDefinitionClientCapabilities {
@@ -3595,6 +3924,7 @@ struct TypeDefinitionClientCapabilities {
     /// The client supports additional metadata in the form of definition links. Since 3.14.0
     Optional<Boolean> link_support;
 };
+void EnableInlineStorage(InlineStorageTag<TypeDefinitionClientCapabilities>);
 
 /// @since 3.6.0
 struct ImplementationClientCapabilities {
@@ -3608,18 +3938,21 @@ struct ImplementationClientCapabilities {
     /// @since 3.14.0
     Optional<Boolean> link_support;
 };
+void EnableInlineStorage(InlineStorageTag<ImplementationClientCapabilities>);
 
 /// Client Capabilities for a ReferencesRequest.
 struct ReferenceClientCapabilities {
     /// Whether references supports dynamic registration.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<ReferenceClientCapabilities>);
 
 /// Client Capabilities for a DocumentHighlightRequest.
 struct DocumentHighlightClientCapabilities {
     /// Whether document highlight supports dynamic registration.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentHighlightClientCapabilities>);
 
 /// Client Capabilities for a DocumentSymbolRequest.
 struct DocumentSymbolClientCapabilities {
@@ -3645,6 +3978,7 @@ struct DocumentSymbolClientCapabilities {
     /// @since 3.16.0
     Optional<Boolean> label_support;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentSymbolClientCapabilities>);
 
 /// @since 3.18.0
 ///
@@ -3655,6 +3989,7 @@ struct ClientCodeActionKindOptions {
     /// value when unknown.
     std::vector<lsp::CodeActionKind> value_set{};
 };
+void EnableInlineStorage(InlineStorageTag<ClientCodeActionKindOptions>);
 
 /// @since 3.18.0
 ///
@@ -3663,6 +3998,7 @@ struct ClientCodeActionLiteralOptions {
     /// The code action kind is support with the following value set.
     lsp::ClientCodeActionKindOptions code_action_kind{};
 };
+void EnableInlineStorage(InlineStorageTag<ClientCodeActionLiteralOptions>);
 
 /// @since 3.18.0
 ///
@@ -3671,6 +4007,7 @@ struct ClientCodeActionResolveOptions {
     /// The properties that a client can resolve lazily.
     std::vector<String> properties{};
 };
+void EnableInlineStorage(InlineStorageTag<ClientCodeActionResolveOptions>);
 
 /// The Client Capabilities of a CodeActionRequest.
 struct CodeActionClientCapabilities {
@@ -3713,12 +4050,14 @@ struct CodeActionClientCapabilities {
     /// @since 3.16.0
     Optional<Boolean> honors_change_annotations;
 };
+void EnableInlineStorage(InlineStorageTag<CodeActionClientCapabilities>);
 
 /// The client capabilities of a CodeLensRequest.
 struct CodeLensClientCapabilities {
     /// Whether code lens supports dynamic registration.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<CodeLensClientCapabilities>);
 
 /// The client capabilities of a DocumentLinkRequest.
 struct DocumentLinkClientCapabilities {
@@ -3730,6 +4069,7 @@ struct DocumentLinkClientCapabilities {
     /// @since 3.15.0
     Optional<Boolean> tooltip_support;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentLinkClientCapabilities>);
 
 /// No documentation available
 struct DocumentColorClientCapabilities {
@@ -3738,12 +4078,14 @@ struct DocumentColorClientCapabilities {
     /// server capability as well.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentColorClientCapabilities>);
 
 /// Client capabilities of a DocumentFormattingRequest.
 struct DocumentFormattingClientCapabilities {
     /// Whether formatting supports dynamic registration.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentFormattingClientCapabilities>);
 
 /// Client capabilities of a DocumentRangeFormattingRequest.
 struct DocumentRangeFormattingClientCapabilities {
@@ -3757,12 +4099,14 @@ struct DocumentRangeFormattingClientCapabilities {
     /// Proposed in:
     Optional<Boolean> ranges_support;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentRangeFormattingClientCapabilities>);
 
 /// Client capabilities of a DocumentOnTypeFormattingRequest.
 struct DocumentOnTypeFormattingClientCapabilities {
     /// Whether on type formatting supports dynamic registration.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentOnTypeFormattingClientCapabilities>);
 
 /// No documentation available
 struct RenameClientCapabilities {
@@ -3787,6 +4131,7 @@ struct RenameClientCapabilities {
     /// @since 3.16.0
     Optional<Boolean> honors_change_annotations;
 };
+void EnableInlineStorage(InlineStorageTag<RenameClientCapabilities>);
 
 /// @since 3.18.0
 ///
@@ -3797,6 +4142,7 @@ struct ClientFoldingRangeKindOptions {
     /// value when unknown.
     Optional<std::vector<lsp::FoldingRangeKind>> value_set;
 };
+void EnableInlineStorage(InlineStorageTag<ClientFoldingRangeKindOptions>);
 
 /// @since 3.18.0
 ///
@@ -3808,6 +4154,7 @@ struct ClientFoldingRangeOptions {
     /// @since 3.17.0
     Optional<Boolean> collapsed_text;
 };
+void EnableInlineStorage(InlineStorageTag<ClientFoldingRangeOptions>);
 
 /// No documentation available
 struct FoldingRangeClientCapabilities {
@@ -3834,6 +4181,7 @@ struct FoldingRangeClientCapabilities {
     /// @since 3.17.0
     Optional<lsp::ClientFoldingRangeOptions> folding_range;
 };
+void EnableInlineStorage(InlineStorageTag<FoldingRangeClientCapabilities>);
 
 /// No documentation available
 struct SelectionRangeClientCapabilities {
@@ -3842,6 +4190,7 @@ struct SelectionRangeClientCapabilities {
     /// value for the corresponding server capability as well.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<SelectionRangeClientCapabilities>);
 
 /// @since 3.18.0
 ///
@@ -3850,6 +4199,7 @@ struct ClientDiagnosticsTagOptions {
     /// The tags supported by the client.
     std::vector<lsp::DiagnosticTag> value_set{};
 };
+void EnableInlineStorage(InlineStorageTag<ClientDiagnosticsTagOptions>);
 
 /// The publish diagnostic client capabilities.
 struct PublishDiagnosticsClientCapabilities {
@@ -3879,6 +4229,7 @@ struct PublishDiagnosticsClientCapabilities {
     /// @since 3.16.0
     Optional<Boolean> data_support;
 };
+void EnableInlineStorage(InlineStorageTag<PublishDiagnosticsClientCapabilities>);
 
 /// @since 3.16.0
 struct CallHierarchyClientCapabilities {
@@ -3887,6 +4238,7 @@ struct CallHierarchyClientCapabilities {
     /// value for the corresponding server capability as well.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<CallHierarchyClientCapabilities>);
 
 /// @since 3.18.0
 ///
@@ -3896,6 +4248,7 @@ struct ClientSemanticTokensRequestFullDelta {
     /// provides a corresponding handler.
     Optional<Boolean> delta;
 };
+void EnableInlineStorage(InlineStorageTag<ClientSemanticTokensRequestFullDelta>);
 
 /// @since 3.18.0
 ///
@@ -3903,6 +4256,7 @@ struct ClientSemanticTokensRequestFullDelta {
 struct ClientSemanticTokensRequestOptions {
     /// No documentation available
     struct Range {};
+void EnableInlineStorage(InlineStorageTag<ClientSemanticTokensRequestOptions>);
 
     /// The client will send the `textDocument/semanticTokens/range` request if the server provides
     /// a corresponding handler.
@@ -3958,6 +4312,7 @@ struct SemanticTokensClientCapabilities {
     /// @since 3.17.0
     Optional<Boolean> augments_syntax_tokens;
 };
+void EnableInlineStorage(InlineStorageTag<SemanticTokensClientCapabilities>);
 
 /// Client capabilities for the linked editing range request.
 ///
@@ -3968,6 +4323,7 @@ struct LinkedEditingRangeClientCapabilities {
     /// value for the corresponding server capability as well.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<LinkedEditingRangeClientCapabilities>);
 
 /// Client capabilities specific to the moniker request.
 ///
@@ -3978,6 +4334,7 @@ struct MonikerClientCapabilities {
     /// well.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<MonikerClientCapabilities>);
 
 /// @since 3.17.0
 struct TypeHierarchyClientCapabilities {
@@ -3986,6 +4343,7 @@ struct TypeHierarchyClientCapabilities {
     /// value for the corresponding server capability as well.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<TypeHierarchyClientCapabilities>);
 
 /// Client capabilities specific to inline values.
 ///
@@ -3994,6 +4352,7 @@ struct InlineValueClientCapabilities {
     /// Whether implementation supports dynamic registration for inline value providers.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<InlineValueClientCapabilities>);
 
 /// @since 3.18.0
 ///
@@ -4002,6 +4361,7 @@ struct ClientInlayHintResolveOptions {
     /// The properties that a client can resolve lazily.
     std::vector<String> properties{};
 };
+void EnableInlineStorage(InlineStorageTag<ClientInlayHintResolveOptions>);
 
 /// Inlay hint client capabilities.
 ///
@@ -4013,6 +4373,7 @@ struct InlayHintClientCapabilities {
     /// Indicates which properties a client can resolve lazily on an inlay hint.
     Optional<lsp::ClientInlayHintResolveOptions> resolve_support;
 };
+void EnableInlineStorage(InlineStorageTag<InlayHintClientCapabilities>);
 
 /// Client capabilities specific to diagnostic pull requests.
 ///
@@ -4026,6 +4387,7 @@ struct DiagnosticClientCapabilities {
     /// Whether the clients supports related documents for document diagnostic pulls.
     Optional<Boolean> related_document_support;
 };
+void EnableInlineStorage(InlineStorageTag<DiagnosticClientCapabilities>);
 
 /// Client capabilities specific to inline completions.
 ///
@@ -4036,6 +4398,7 @@ struct InlineCompletionClientCapabilities {
     /// Whether implementation supports dynamic registration for inline completion providers.
     Optional<Boolean> dynamic_registration;
 };
+void EnableInlineStorage(InlineStorageTag<InlineCompletionClientCapabilities>);
 
 /// Text document specific client capabilities.
 struct TextDocumentClientCapabilities {
@@ -4165,6 +4528,7 @@ struct TextDocumentClientCapabilities {
     /// Proposed in:
     Optional<lsp::InlineCompletionClientCapabilities> inline_completion;
 };
+void EnableInlineStorage(InlineStorageTag<TextDocumentClientCapabilities>);
 
 /// Notebook specific client capabilities.
 ///
@@ -4178,6 +4542,7 @@ struct NotebookDocumentSyncClientCapabilities {
     /// The client supports sending execution summary data per cell.
     Optional<Boolean> execution_summary_support;
 };
+void EnableInlineStorage(InlineStorageTag<NotebookDocumentSyncClientCapabilities>);
 
 /// Capabilities specific to the notebook document support.
 ///
@@ -4188,6 +4553,7 @@ struct NotebookDocumentClientCapabilities {
     /// @since 3.17.0
     lsp::NotebookDocumentSyncClientCapabilities synchronization{};
 };
+void EnableInlineStorage(InlineStorageTag<NotebookDocumentClientCapabilities>);
 
 /// @since 3.18.0
 ///
@@ -4197,12 +4563,14 @@ struct ClientShowMessageActionItemOptions {
     /// server in the request's response.
     Optional<Boolean> additional_properties_support;
 };
+void EnableInlineStorage(InlineStorageTag<ClientShowMessageActionItemOptions>);
 
 /// Show message request client capabilities
 struct ShowMessageRequestClientCapabilities {
     /// Capabilities specific to the `MessageActionItem` type.
     Optional<lsp::ClientShowMessageActionItemOptions> message_action_item;
 };
+void EnableInlineStorage(InlineStorageTag<ShowMessageRequestClientCapabilities>);
 
 /// Client capabilities for the showDocument request.
 ///
@@ -4211,6 +4579,7 @@ struct ShowDocumentClientCapabilities {
     /// The client has support for the showDocument request.
     Boolean support{};
 };
+void EnableInlineStorage(InlineStorageTag<ShowDocumentClientCapabilities>);
 
 /// No documentation available
 struct WindowClientCapabilities {
@@ -4232,6 +4601,7 @@ struct WindowClientCapabilities {
     /// @since 3.16.0
     Optional<lsp::ShowDocumentClientCapabilities> show_document;
 };
+void EnableInlineStorage(InlineStorageTag<WindowClientCapabilities>);
 
 /// @since 3.18.0
 ///
@@ -4244,6 +4614,7 @@ struct StaleRequestSupportOptions {
     /// with error code `ContentModified`
     std::vector<String> retry_on_content_modified{};
 };
+void EnableInlineStorage(InlineStorageTag<StaleRequestSupportOptions>);
 
 /// Client capabilities specific to regular expressions.
 ///
@@ -4255,6 +4626,7 @@ struct RegularExpressionsClientCapabilities {
     /// The engine's version.
     Optional<String> version;
 };
+void EnableInlineStorage(InlineStorageTag<RegularExpressionsClientCapabilities>);
 
 /// Client capabilities specific to the used markdown parser.
 ///
@@ -4271,6 +4643,7 @@ struct MarkdownClientCapabilities {
     /// @since 3.17.0
     Optional<std::vector<String>> allowed_tags;
 };
+void EnableInlineStorage(InlineStorageTag<MarkdownClientCapabilities>);
 
 /// General client capabilities.
 ///
@@ -4304,6 +4677,7 @@ struct GeneralClientCapabilities {
     /// @since 3.17.0
     Optional<std::vector<lsp::PositionEncodingKind>> position_encodings;
 };
+void EnableInlineStorage(InlineStorageTag<GeneralClientCapabilities>);
 
 /// Defines the capabilities provided by the client.
 struct ClientCapabilities {
@@ -4329,6 +4703,7 @@ struct ClientCapabilities {
     /// Experimental client capabilities.
     Optional<lsp::LSPAny> experimental;
 };
+void EnableInlineStorage(InlineStorageTag<ClientCapabilities>);
 
 /// The initialize parameters
 struct InitializeParamsBase {
@@ -4369,6 +4744,7 @@ struct InitializeParamsBase {
     /// The initial trace setting. If omitted trace is disabled ('off').
     Optional<lsp::TraceValues> trace;
 };
+void EnableInlineStorage(InlineStorageTag<InitializeParamsBase>);
 
 /// No documentation available
 struct WorkspaceFoldersInitializeParams {
@@ -4379,15 +4755,18 @@ struct WorkspaceFoldersInitializeParams {
     /// @since 3.6.0
     Optional<OneOf<std::vector<lsp::WorkspaceFolder>, Null>> workspace_folders;
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceFoldersInitializeParams>);
 
 /// No documentation available
 struct InitializeParams : lsp::InitializeParamsBase, lsp::WorkspaceFoldersInitializeParams {};
+void EnableInlineStorage(InlineStorageTag<InitializeParams>);
 
 /// Save options.
 struct SaveOptions {
     /// The client is supposed to include the content on save.
     Optional<Boolean> include_text;
 };
+void EnableInlineStorage(InlineStorageTag<SaveOptions>);
 
 /// No documentation available
 struct TextDocumentSyncOptions {
@@ -4412,6 +4791,7 @@ struct TextDocumentSyncOptions {
     /// be sent.
     Optional<OneOf<Boolean, lsp::SaveOptions>> save;
 };
+void EnableInlineStorage(InlineStorageTag<TextDocumentSyncOptions>);
 
 /// @since 3.18.0
 ///
@@ -4420,6 +4800,7 @@ struct NotebookCellLanguage {
     /// No documentation available
     String language{};
 };
+void EnableInlineStorage(InlineStorageTag<NotebookCellLanguage>);
 
 /// @since 3.18.0
 ///
@@ -4432,6 +4813,7 @@ struct NotebookDocumentFilterWithCells {
     /// The cells of the matching notebook to be synced.
     std::vector<lsp::NotebookCellLanguage> cells{};
 };
+void EnableInlineStorage(InlineStorageTag<NotebookDocumentFilterWithCells>);
 
 /// @since 3.18.0
 ///
@@ -4444,6 +4826,7 @@ struct NotebookDocumentFilterWithNotebook {
     /// The cells of the matching notebook to be synced.
     Optional<std::vector<lsp::NotebookCellLanguage>> cells;
 };
+void EnableInlineStorage(InlineStorageTag<NotebookDocumentFilterWithNotebook>);
 
 /// Options specific to a notebook plus its cells to be synced to the server. If a selector provides
 /// a notebook document filter but no cell selector all cells of a matching notebook document will
@@ -4461,11 +4844,13 @@ struct NotebookDocumentSyncOptions {
     /// === `notebook`.
     Optional<Boolean> save;
 };
+void EnableInlineStorage(InlineStorageTag<NotebookDocumentSyncOptions>);
 
 /// Registration options specific to a notebook.
 ///
 /// @since 3.17.0
 struct NotebookDocumentSyncRegistrationOptions : lsp::NotebookDocumentSyncOptions {};
+void EnableInlineStorage(InlineStorageTag<NotebookDocumentSyncRegistrationOptions>);
 
 /// @since 3.18.0
 ///
@@ -4477,6 +4862,7 @@ struct ServerCompletionItemOptions {
     /// @since 3.17.0
     Optional<Boolean> label_details_support;
 };
+void EnableInlineStorage(InlineStorageTag<ServerCompletionItemOptions>);
 
 /// Completion options.
 struct CompletionOptions {
@@ -4506,9 +4892,11 @@ struct CompletionOptions {
     /// @since 3.17.0
     Optional<lsp::ServerCompletionItemOptions> completion_item;
 };
+void EnableInlineStorage(InlineStorageTag<CompletionOptions>);
 
 /// Hover options.
 struct HoverOptions {};
+void EnableInlineStorage(InlineStorageTag<HoverOptions>);
 
 /// Server Capabilities for a SignatureHelpRequest.
 struct SignatureHelpOptions {
@@ -4522,15 +4910,19 @@ struct SignatureHelpOptions {
     /// @since 3.15.0
     Optional<std::vector<String>> retrigger_characters;
 };
+void EnableInlineStorage(InlineStorageTag<SignatureHelpOptions>);
 
 /// Server Capabilities for a DefinitionRequest.
 struct DefinitionOptions {};
+void EnableInlineStorage(InlineStorageTag<DefinitionOptions>);
 
 /// Reference options.
 struct ReferenceOptions {};
+void EnableInlineStorage(InlineStorageTag<ReferenceOptions>);
 
 /// Provider options for a DocumentHighlightRequest.
 struct DocumentHighlightOptions {};
+void EnableInlineStorage(InlineStorageTag<DocumentHighlightOptions>);
 
 /// Provider options for a DocumentSymbolRequest.
 struct DocumentSymbolOptions {
@@ -4540,6 +4932,7 @@ struct DocumentSymbolOptions {
     /// @since 3.16.0
     Optional<String> label;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentSymbolOptions>);
 
 /// Provider options for a CodeActionRequest.
 struct CodeActionOptions {
@@ -4552,18 +4945,21 @@ struct CodeActionOptions {
     /// @since 3.16.0
     Optional<Boolean> resolve_provider;
 };
+void EnableInlineStorage(InlineStorageTag<CodeActionOptions>);
 
 /// Code Lens provider options of a CodeLensRequest.
 struct CodeLensOptions {
     /// Code lens has a resolve provider as well.
     Optional<Boolean> resolve_provider;
 };
+void EnableInlineStorage(InlineStorageTag<CodeLensOptions>);
 
 /// Provider options for a DocumentLinkRequest.
 struct DocumentLinkOptions {
     /// Document links have a resolve provider as well.
     Optional<Boolean> resolve_provider;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentLinkOptions>);
 
 /// Server capabilities for a WorkspaceSymbolRequest.
 struct WorkspaceSymbolOptions {
@@ -4572,9 +4968,11 @@ struct WorkspaceSymbolOptions {
     /// @since 3.17.0
     Optional<Boolean> resolve_provider;
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceSymbolOptions>);
 
 /// Provider options for a DocumentFormattingRequest.
 struct DocumentFormattingOptions {};
+void EnableInlineStorage(InlineStorageTag<DocumentFormattingOptions>);
 
 /// Provider options for a DocumentRangeFormattingRequest.
 struct DocumentRangeFormattingOptions {
@@ -4585,6 +4983,7 @@ struct DocumentRangeFormattingOptions {
     /// Proposed in:
     Optional<Boolean> ranges_support;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentRangeFormattingOptions>);
 
 /// Provider options for a DocumentOnTypeFormattingRequest.
 struct DocumentOnTypeFormattingOptions {
@@ -4594,6 +4993,7 @@ struct DocumentOnTypeFormattingOptions {
     /// More trigger characters.
     Optional<std::vector<String>> more_trigger_character;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentOnTypeFormattingOptions>);
 
 /// Provider options for a RenameRequest.
 struct RenameOptions {
@@ -4602,12 +5002,14 @@ struct RenameOptions {
     /// @since version 3.12.0
     Optional<Boolean> prepare_provider;
 };
+void EnableInlineStorage(InlineStorageTag<RenameOptions>);
 
 /// The server capabilities of a ExecuteCommandRequest.
 struct ExecuteCommandOptions {
     /// The commands to be executed on the server
     std::vector<String> commands{};
 };
+void EnableInlineStorage(InlineStorageTag<ExecuteCommandOptions>);
 
 /// No documentation available
 struct WorkspaceFoldersServerCapabilities {
@@ -4620,6 +5022,7 @@ struct WorkspaceFoldersServerCapabilities {
     /// `client/unregisterCapability` request.
     Optional<OneOf<String, Boolean>> change_notifications;
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceFoldersServerCapabilities>);
 
 /// Options for notifications/requests for user operations on files.
 ///
@@ -4643,6 +5046,7 @@ struct FileOperationOptions {
     /// The server is interested in receiving willDeleteFiles file requests.
     Optional<lsp::FileOperationRegistrationOptions> will_delete;
 };
+void EnableInlineStorage(InlineStorageTag<FileOperationOptions>);
 
 /// Defines workspace specific capabilities of the server.
 ///
@@ -4660,6 +5064,7 @@ struct WorkspaceOptions {
     /// @since 3.16.0
     Optional<lsp::FileOperationOptions> file_operations;
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceOptions>);
 
 /// Defines the capabilities provided by a language server.
 struct ServerCapabilities {
@@ -4816,6 +5221,7 @@ struct ServerCapabilities {
     /// Experimental server capabilities.
     Optional<lsp::LSPAny> experimental;
 };
+void EnableInlineStorage(InlineStorageTag<ServerCapabilities>);
 
 /// Information about the server
 ///
@@ -4831,6 +5237,7 @@ struct ServerInfo {
     /// The server's version as defined by the server.
     Optional<String> version;
 };
+void EnableInlineStorage(InlineStorageTag<ServerInfo>);
 
 /// The result returned from an initialize request.
 struct InitializeResult {
@@ -4842,6 +5249,7 @@ struct InitializeResult {
     /// @since 3.15.0
     Optional<lsp::ServerInfo> server_info;
 };
+void EnableInlineStorage(InlineStorageTag<InitializeResult>);
 
 /// The data type of the ResponseError if the initialize request fails.
 struct InitializeError {
@@ -4850,21 +5258,25 @@ struct InitializeError {
     /// selected retry the initialize method is sent again.
     Boolean retry{};
 };
+void EnableInlineStorage(InlineStorageTag<InitializeError>);
 
 /// No documentation available
 struct InitializedParams {};
+void EnableInlineStorage(InlineStorageTag<InitializedParams>);
 
 /// The parameters of a change configuration notification.
 struct DidChangeConfigurationParams {
     /// The actual changed settings
     lsp::LSPAny settings{};
 };
+void EnableInlineStorage(InlineStorageTag<DidChangeConfigurationParams>);
 
 /// No documentation available
 struct DidChangeConfigurationRegistrationOptions {
     /// No documentation available
     Optional<OneOf<String, std::vector<String>>> section;
 };
+void EnableInlineStorage(InlineStorageTag<DidChangeConfigurationRegistrationOptions>);
 
 /// The parameters of a notification message.
 struct ShowMessageParams {
@@ -4874,12 +5286,14 @@ struct ShowMessageParams {
     /// The actual message.
     String message{};
 };
+void EnableInlineStorage(InlineStorageTag<ShowMessageParams>);
 
 /// No documentation available
 struct MessageActionItem {
     /// A short title like 'Retry', 'Open Log' etc.
     String title{};
 };
+void EnableInlineStorage(InlineStorageTag<MessageActionItem>);
 
 /// No documentation available
 struct ShowMessageRequestParams {
@@ -4892,6 +5306,7 @@ struct ShowMessageRequestParams {
     /// The message action items to present.
     Optional<std::vector<lsp::MessageActionItem>> actions;
 };
+void EnableInlineStorage(InlineStorageTag<ShowMessageRequestParams>);
 
 /// The log message parameters.
 struct LogMessageParams {
@@ -4901,12 +5316,14 @@ struct LogMessageParams {
     /// The actual message.
     String message{};
 };
+void EnableInlineStorage(InlineStorageTag<LogMessageParams>);
 
 /// The parameters sent in an open text document notification
 struct DidOpenTextDocumentParams {
     /// The document that was opened.
     lsp::TextDocumentItem text_document{};
 };
+void EnableInlineStorage(InlineStorageTag<DidOpenTextDocumentParams>);
 
 /// The change text document notification's parameters.
 struct DidChangeTextDocumentParams {
@@ -4924,18 +5341,21 @@ struct DidChangeTextDocumentParams {
     /// receive them.
     std::vector<lsp::TextDocumentContentChangeEvent> content_changes{};
 };
+void EnableInlineStorage(InlineStorageTag<DidChangeTextDocumentParams>);
 
 /// Describe options to be used when registered for text document change events.
 struct TextDocumentChangeRegistrationOptions : lsp::TextDocumentRegistrationOptions {
     /// How documents are synced to the server.
     lsp::TextDocumentSyncKind sync_kind{};
 };
+void EnableInlineStorage(InlineStorageTag<TextDocumentChangeRegistrationOptions>);
 
 /// The parameters sent in a close text document notification
 struct DidCloseTextDocumentParams {
     /// The document that was closed.
     lsp::TextDocumentIdentifier text_document{};
 };
+void EnableInlineStorage(InlineStorageTag<DidCloseTextDocumentParams>);
 
 /// The parameters sent in a save text document notification
 struct DidSaveTextDocumentParams {
@@ -4946,10 +5366,12 @@ struct DidSaveTextDocumentParams {
     /// was requested.
     Optional<String> text;
 };
+void EnableInlineStorage(InlineStorageTag<DidSaveTextDocumentParams>);
 
 /// Save registration options.
 struct TextDocumentSaveRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                              lsp::SaveOptions {};
+void EnableInlineStorage(InlineStorageTag<TextDocumentSaveRegistrationOptions>);
 
 /// The parameters sent in a will save text document notification.
 struct WillSaveTextDocumentParams {
@@ -4959,6 +5381,7 @@ struct WillSaveTextDocumentParams {
     /// The 'TextDocumentSaveReason'.
     lsp::TextDocumentSaveReason reason{};
 };
+void EnableInlineStorage(InlineStorageTag<WillSaveTextDocumentParams>);
 
 /// An event describing a file change.
 struct FileEvent {
@@ -4968,12 +5391,14 @@ struct FileEvent {
     /// The change type.
     lsp::FileChangeType type{};
 };
+void EnableInlineStorage(InlineStorageTag<FileEvent>);
 
 /// The watched files change notification's parameters.
 struct DidChangeWatchedFilesParams {
     /// The actual file events.
     std::vector<lsp::FileEvent> changes{};
 };
+void EnableInlineStorage(InlineStorageTag<DidChangeWatchedFilesParams>);
 
 /// No documentation available
 struct FileSystemWatcher {
@@ -4986,12 +5411,14 @@ struct FileSystemWatcher {
     /// WatchKind.Change | WatchKind.Delete which is 7.
     Optional<lsp::WatchKind> kind;
 };
+void EnableInlineStorage(InlineStorageTag<FileSystemWatcher>);
 
 /// Describe options to be used when registered for text document change events.
 struct DidChangeWatchedFilesRegistrationOptions {
     /// The watchers to register.
     std::vector<lsp::FileSystemWatcher> watchers{};
 };
+void EnableInlineStorage(InlineStorageTag<DidChangeWatchedFilesRegistrationOptions>);
 
 /// The publish diagnostic notification's parameters.
 struct PublishDiagnosticsParams {
@@ -5006,6 +5433,7 @@ struct PublishDiagnosticsParams {
     /// An array of diagnostic information items.
     std::vector<lsp::Diagnostic> diagnostics{};
 };
+void EnableInlineStorage(InlineStorageTag<PublishDiagnosticsParams>);
 
 /// Contains additional information about the context in which a completion request is triggered.
 struct CompletionContext {
@@ -5016,6 +5444,7 @@ struct CompletionContext {
     /// `triggerKind !== CompletionTriggerKind.TriggerCharacter`
     Optional<String> trigger_character;
 };
+void EnableInlineStorage(InlineStorageTag<CompletionContext>);
 
 /// Completion parameters
 struct CompletionParams : lsp::TextDocumentPositionParams {
@@ -5023,6 +5452,7 @@ struct CompletionParams : lsp::TextDocumentPositionParams {
     /// the client capability `textDocument.completion.contextSupport === true`
     Optional<lsp::CompletionContext> context;
 };
+void EnableInlineStorage(InlineStorageTag<CompletionParams>);
 
 /// Additional details for a completion item label.
 ///
@@ -5036,6 +5466,7 @@ struct CompletionItemLabelDetails {
     /// used for fully qualified names and file paths.
     Optional<String> description;
 };
+void EnableInlineStorage(InlineStorageTag<CompletionItemLabelDetails>);
 
 /// A special text edit to provide an insert and a replace operation.
 ///
@@ -5050,6 +5481,7 @@ struct InsertReplaceEdit {
     /// The range if the replace is requested.
     lsp::Range replace{};
 };
+void EnableInlineStorage(InlineStorageTag<InsertReplaceEdit>);
 
 /// A completion item represents a text snippet that is proposed to complete text that is being
 /// typed.
@@ -5164,6 +5596,7 @@ struct CompletionItem {
     /// CompletionResolveRequest.
     Optional<lsp::LSPAny> data;
 };
+void EnableInlineStorage(InlineStorageTag<CompletionItem>);
 
 /// Edit range variant that includes ranges for insert and replace operations.
 ///
@@ -5177,6 +5610,7 @@ struct EditRangeWithInsertReplace {
     /// No documentation available
     lsp::Range replace{};
 };
+void EnableInlineStorage(InlineStorageTag<EditRangeWithInsertReplace>);
 
 /// In many cases the items of an actual completion result share the same value for properties like
 /// `commitCharacters` or the range of a text edit. A completion list can therefore define item
@@ -5212,6 +5646,7 @@ struct CompletionItemDefaults {
     /// @since 3.17.0
     Optional<lsp::LSPAny> data;
 };
+void EnableInlineStorage(InlineStorageTag<CompletionItemDefaults>);
 
 /// Represents a collection of CompletionItem completion items to be presented in the editor.
 struct CompletionList {
@@ -5233,13 +5668,16 @@ struct CompletionList {
     /// The completion items.
     std::vector<lsp::CompletionItem> items{};
 };
+void EnableInlineStorage(InlineStorageTag<CompletionList>);
 
 /// Registration options for a CompletionRequest.
 struct CompletionRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                        lsp::CompletionOptions {};
+void EnableInlineStorage(InlineStorageTag<CompletionRegistrationOptions>);
 
 /// Parameters for a HoverRequest.
 struct HoverParams : lsp::TextDocumentPositionParams {};
+void EnableInlineStorage(InlineStorageTag<HoverParams>);
 
 /// The result of a hover request.
 struct Hover {
@@ -5250,9 +5688,11 @@ struct Hover {
     /// changing the background color.
     Optional<lsp::Range> range;
 };
+void EnableInlineStorage(InlineStorageTag<Hover>);
 
 /// Registration options for a HoverRequest.
 struct HoverRegistrationOptions : lsp::TextDocumentRegistrationOptions, lsp::HoverOptions {};
+void EnableInlineStorage(InlineStorageTag<HoverRegistrationOptions>);
 
 /// Represents a parameter of a callable-signature. A parameter can have a label and a doc-comment.
 struct ParameterInformation {
@@ -5267,6 +5707,7 @@ struct ParameterInformation {
     /// omitted.
     Optional<OneOf<String, lsp::MarkupContent>> documentation;
 };
+void EnableInlineStorage(InlineStorageTag<ParameterInformation>);
 
 /// Represents the signature of something callable. A signature can have a label, like a
 /// function-name, a doc-comment, and a set of parameters.
@@ -5287,6 +5728,7 @@ struct SignatureInformation {
     /// @since 3.16.0
     Optional<Uinteger> active_parameter;
 };
+void EnableInlineStorage(InlineStorageTag<SignatureInformation>);
 
 /// Signature help represents the signature of something callable. There can be multiple signature
 /// but only one active and only one active parameter.
@@ -5308,6 +5750,7 @@ struct SignatureHelp {
     /// the active signature does have any.
     Optional<Uinteger> active_parameter;
 };
+void EnableInlineStorage(InlineStorageTag<SignatureHelp>);
 
 /// Additional information about the context in which a signature help request was triggered.
 ///
@@ -5330,6 +5773,7 @@ struct SignatureHelpContext {
     /// signatures.
     Optional<lsp::SignatureHelp> active_signature_help;
 };
+void EnableInlineStorage(InlineStorageTag<SignatureHelpContext>);
 
 /// Parameters for a SignatureHelpRequest.
 struct SignatureHelpParams : lsp::TextDocumentPositionParams {
@@ -5339,36 +5783,44 @@ struct SignatureHelpParams : lsp::TextDocumentPositionParams {
     /// @since 3.15.0
     Optional<lsp::SignatureHelpContext> context;
 };
+void EnableInlineStorage(InlineStorageTag<SignatureHelpParams>);
 
 /// Registration options for a SignatureHelpRequest.
 struct SignatureHelpRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                           lsp::SignatureHelpOptions {};
+void EnableInlineStorage(InlineStorageTag<SignatureHelpRegistrationOptions>);
 
 /// Parameters for a DefinitionRequest.
 struct DefinitionParams : lsp::TextDocumentPositionParams {};
+void EnableInlineStorage(InlineStorageTag<DefinitionParams>);
 
 /// Registration options for a DefinitionRequest.
 struct DefinitionRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                        lsp::DefinitionOptions {};
+void EnableInlineStorage(InlineStorageTag<DefinitionRegistrationOptions>);
 
 /// Value-object that contains additional information when requesting references.
 struct ReferenceContext {
     /// Include the declaration of the current symbol.
     Boolean include_declaration{};
 };
+void EnableInlineStorage(InlineStorageTag<ReferenceContext>);
 
 /// Parameters for a ReferencesRequest.
 struct ReferenceParams : lsp::TextDocumentPositionParams {
     /// No documentation available
     lsp::ReferenceContext context{};
 };
+void EnableInlineStorage(InlineStorageTag<ReferenceParams>);
 
 /// Registration options for a ReferencesRequest.
 struct ReferenceRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                       lsp::ReferenceOptions {};
+void EnableInlineStorage(InlineStorageTag<ReferenceRegistrationOptions>);
 
 /// Parameters for a DocumentHighlightRequest.
 struct DocumentHighlightParams : lsp::TextDocumentPositionParams {};
+void EnableInlineStorage(InlineStorageTag<DocumentHighlightParams>);
 
 /// A document highlight is a range inside a text document which deserves special attention. Usually
 /// a document highlight is visualized by changing the background color of its range.
@@ -5379,16 +5831,19 @@ struct DocumentHighlight {
     /// The highlight kind, default is DocumentHighlightKind.Text text.
     Optional<lsp::DocumentHighlightKind> kind;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentHighlight>);
 
 /// Registration options for a DocumentHighlightRequest.
 struct DocumentHighlightRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                               lsp::DocumentHighlightOptions {};
+void EnableInlineStorage(InlineStorageTag<DocumentHighlightRegistrationOptions>);
 
 /// Parameters for a DocumentSymbolRequest.
 struct DocumentSymbolParams {
     /// The text document.
     lsp::TextDocumentIdentifier text_document{};
 };
+void EnableInlineStorage(InlineStorageTag<DocumentSymbolParams>);
 
 /// A base for all symbol information.
 struct BaseSymbolInformation {
@@ -5408,6 +5863,7 @@ struct BaseSymbolInformation {
     /// to re-infer a hierarchy for the document symbols.
     Optional<String> container_name;
 };
+void EnableInlineStorage(InlineStorageTag<BaseSymbolInformation>);
 
 /// Represents information about programming constructs like variables, classes, interfaces etc.
 struct SymbolInformation : lsp::BaseSymbolInformation {
@@ -5424,6 +5880,7 @@ struct SymbolInformation : lsp::BaseSymbolInformation {
     /// re-construct a hierarchy of the symbols.
     lsp::Location location{};
 };
+void EnableInlineStorage(InlineStorageTag<SymbolInformation>);
 
 /// Represents programming constructs like variables, classes, interfaces etc. that appear in a
 /// document. Document symbols can be hierarchical and they have two ranges: one that encloses its
@@ -5465,6 +5922,7 @@ struct DocumentSymbol {
 /// Registration options for a DocumentSymbolRequest.
 struct DocumentSymbolRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                            lsp::DocumentSymbolOptions {};
+void EnableInlineStorage(InlineStorageTag<DocumentSymbolRegistrationOptions>);
 
 /// Contains additional diagnostic information about the context in which a
 /// CodeActionProvider.provideCodeActions code action is run.
@@ -5485,6 +5943,7 @@ struct CodeActionContext {
     /// @since 3.17.0
     Optional<lsp::CodeActionTriggerKind> trigger_kind;
 };
+void EnableInlineStorage(InlineStorageTag<CodeActionContext>);
 
 /// The parameters of a CodeActionRequest.
 struct CodeActionParams {
@@ -5497,6 +5956,7 @@ struct CodeActionParams {
     /// Context carrying additional information.
     lsp::CodeActionContext context{};
 };
+void EnableInlineStorage(InlineStorageTag<CodeActionParams>);
 
 /// Captures why the code action is currently disabled.
 ///
@@ -5508,6 +5968,7 @@ struct CodeActionDisabled {
     /// in the code actions UI.
     String reason{};
 };
+void EnableInlineStorage(InlineStorageTag<CodeActionDisabled>);
 
 /// A code action represents a change that can be performed in code, e.g. to fix a problem or to
 /// refactor code. A CodeAction must set either `edit` and/or a `command`. If both are supplied, the
@@ -5557,10 +6018,12 @@ struct CodeAction {
     /// @since 3.16.0
     Optional<lsp::LSPAny> data;
 };
+void EnableInlineStorage(InlineStorageTag<CodeAction>);
 
 /// Registration options for a CodeActionRequest.
 struct CodeActionRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                        lsp::CodeActionOptions {};
+void EnableInlineStorage(InlineStorageTag<CodeActionRegistrationOptions>);
 
 /// The parameters of a WorkspaceSymbolRequest.
 struct WorkspaceSymbolParams {
@@ -5568,6 +6031,7 @@ struct WorkspaceSymbolParams {
     /// symbols.
     String query{};
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceSymbolParams>);
 
 /// Location with only uri and does not include range.
 ///
@@ -5578,6 +6042,7 @@ struct LocationUriOnly {
     /// No documentation available
     DocumentUri uri{};
 };
+void EnableInlineStorage(InlineStorageTag<LocationUriOnly>);
 
 /// A special workspace symbol that supports locations without a range. See also SymbolInformation.
 ///
@@ -5592,15 +6057,18 @@ struct WorkspaceSymbol : lsp::BaseSymbolInformation {
     /// request and a workspace symbol resolve request.
     Optional<lsp::LSPAny> data;
 };
+void EnableInlineStorage(InlineStorageTag<WorkspaceSymbol>);
 
 /// Registration options for a WorkspaceSymbolRequest.
 struct WorkspaceSymbolRegistrationOptions : lsp::WorkspaceSymbolOptions {};
+void EnableInlineStorage(InlineStorageTag<WorkspaceSymbolRegistrationOptions>);
 
 /// The parameters of a CodeLensRequest.
 struct CodeLensParams {
     /// The document to request code lens for.
     lsp::TextDocumentIdentifier text_document{};
 };
+void EnableInlineStorage(InlineStorageTag<CodeLensParams>);
 
 /// A code lens represents a Command command that should be shown along with source text, like the
 /// number of references, a way to run tests, etc. A code lens is _unresolved_ when no command is
@@ -5617,15 +6085,18 @@ struct CodeLens {
     /// CodeLensResolveRequest
     Optional<lsp::LSPAny> data;
 };
+void EnableInlineStorage(InlineStorageTag<CodeLens>);
 
 /// Registration options for a CodeLensRequest.
 struct CodeLensRegistrationOptions : lsp::TextDocumentRegistrationOptions, lsp::CodeLensOptions {};
+void EnableInlineStorage(InlineStorageTag<CodeLensRegistrationOptions>);
 
 /// The parameters of a DocumentLinkRequest.
 struct DocumentLinkParams {
     /// The document to provide document links for.
     lsp::TextDocumentIdentifier text_document{};
 };
+void EnableInlineStorage(InlineStorageTag<DocumentLinkParams>);
 
 /// A document link is a range in a text document that links to an internal or external resource,
 /// like another text document or a web site.
@@ -5648,10 +6119,12 @@ struct DocumentLink {
     /// DocumentLinkResolveRequest.
     Optional<lsp::LSPAny> data;
 };
+void EnableInlineStorage(InlineStorageTag<DocumentLink>);
 
 /// Registration options for a DocumentLinkRequest.
 struct DocumentLinkRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                          lsp::DocumentLinkOptions {};
+void EnableInlineStorage(InlineStorageTag<DocumentLinkRegistrationOptions>);
 
 /// Value-object describing what options formatting should use.
 struct FormattingOptions {
@@ -5676,6 +6149,7 @@ struct FormattingOptions {
     /// @since 3.15.0
     Optional<Boolean> trim_final_newlines;
 };
+void EnableInlineStorage(InlineStorageTag<FormattingOptions>);
 
 /// The parameters of a DocumentFormattingRequest.
 struct DocumentFormattingParams {
@@ -5685,10 +6159,12 @@ struct DocumentFormattingParams {
     /// The format options.
     lsp::FormattingOptions options{};
 };
+void EnableInlineStorage(InlineStorageTag<DocumentFormattingParams>);
 
 /// Registration options for a DocumentFormattingRequest.
 struct DocumentFormattingRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                                lsp::DocumentFormattingOptions {};
+void EnableInlineStorage(InlineStorageTag<DocumentFormattingRegistrationOptions>);
 
 /// The parameters of a DocumentRangeFormattingRequest.
 struct DocumentRangeFormattingParams {
@@ -5701,10 +6177,12 @@ struct DocumentRangeFormattingParams {
     /// The format options
     lsp::FormattingOptions options{};
 };
+void EnableInlineStorage(InlineStorageTag<DocumentRangeFormattingParams>);
 
 /// Registration options for a DocumentRangeFormattingRequest.
 struct DocumentRangeFormattingRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                                     lsp::DocumentRangeFormattingOptions {};
+void EnableInlineStorage(InlineStorageTag<DocumentRangeFormattingRegistrationOptions>);
 
 /// The parameters of a DocumentRangesFormattingRequest.
 ///
@@ -5721,6 +6199,7 @@ struct DocumentRangesFormattingParams {
     /// The format options
     lsp::FormattingOptions options{};
 };
+void EnableInlineStorage(InlineStorageTag<DocumentRangesFormattingParams>);
 
 /// The parameters of a DocumentOnTypeFormattingRequest.
 struct DocumentOnTypeFormattingParams {
@@ -5739,10 +6218,12 @@ struct DocumentOnTypeFormattingParams {
     /// The formatting options.
     lsp::FormattingOptions options{};
 };
+void EnableInlineStorage(InlineStorageTag<DocumentOnTypeFormattingParams>);
 
 /// Registration options for a DocumentOnTypeFormattingRequest.
 struct DocumentOnTypeFormattingRegistrationOptions : lsp::TextDocumentRegistrationOptions,
                                                      lsp::DocumentOnTypeFormattingOptions {};
+void EnableInlineStorage(InlineStorageTag<DocumentOnTypeFormattingRegistrationOptions>);
 
 /// The parameters of a RenameRequest.
 struct RenameParams {
@@ -5756,12 +6237,15 @@ struct RenameParams {
     /// ResponseError with an appropriate message set.
     String new_name{};
 };
+void EnableInlineStorage(InlineStorageTag<RenameParams>);
 
 /// Registration options for a RenameRequest.
 struct RenameRegistrationOptions : lsp::TextDocumentRegistrationOptions, lsp::RenameOptions {};
+void EnableInlineStorage(InlineStorageTag<RenameRegistrationOptions>);
 
 /// No documentation available
 struct PrepareRenameParams : lsp::TextDocumentPositionParams {};
+void EnableInlineStorage(InlineStorageTag<PrepareRenameParams>);
 
 /// The parameters of a ExecuteCommandRequest.
 struct ExecuteCommandParams {
@@ -5771,9 +6255,11 @@ struct ExecuteCommandParams {
     /// Arguments that the command should be invoked with.
     Optional<std::vector<lsp::LSPAny>> arguments;
 };
+void EnableInlineStorage(InlineStorageTag<ExecuteCommandParams>);
 
 /// Registration options for a ExecuteCommandRequest.
 struct ExecuteCommandRegistrationOptions : lsp::ExecuteCommandOptions {};
+void EnableInlineStorage(InlineStorageTag<ExecuteCommandRegistrationOptions>);
 
 /// The parameters passed via an apply workspace edit request.
 struct ApplyWorkspaceEditParams {
@@ -5784,6 +6270,7 @@ struct ApplyWorkspaceEditParams {
     /// The edits to apply.
     lsp::WorkspaceEdit edit{};
 };
+void EnableInlineStorage(InlineStorageTag<ApplyWorkspaceEditParams>);
 
 /// The result returned from the apply workspace edit request.
 ///
@@ -5802,6 +6289,7 @@ struct ApplyWorkspaceEditResult {
     /// `failureHandlingStrategy` in its client capabilities.
     Optional<Uinteger> failed_change;
 };
+void EnableInlineStorage(InlineStorageTag<ApplyWorkspaceEditResult>);
 
 /// No documentation available
 struct WorkDoneProgressBegin {
@@ -5827,6 +6315,7 @@ struct WorkDoneProgressBegin {
     /// ignore values that are not following this rule. The value range is [0, 100].
     Optional<Uinteger> percentage;
 };
+void EnableInlineStorage(InlineStorageTag<WorkDoneProgressBegin>);
 
 /// No documentation available
 struct WorkDoneProgressReport {
@@ -5848,6 +6337,7 @@ struct WorkDoneProgressReport {
     /// ignore values that are not following this rule. The value range is [0, 100]
     Optional<Uinteger> percentage;
 };
+void EnableInlineStorage(InlineStorageTag<WorkDoneProgressReport>);
 
 /// No documentation available
 struct WorkDoneProgressEnd {
@@ -5857,12 +6347,14 @@ struct WorkDoneProgressEnd {
     /// Optional, a final message indicating to for example indicate the outcome of the operation.
     Optional<String> message;
 };
+void EnableInlineStorage(InlineStorageTag<WorkDoneProgressEnd>);
 
 /// No documentation available
 struct SetTraceParams {
     /// No documentation available
     lsp::TraceValues value{};
 };
+void EnableInlineStorage(InlineStorageTag<SetTraceParams>);
 
 /// No documentation available
 struct LogTraceParams {
@@ -5872,12 +6364,14 @@ struct LogTraceParams {
     /// No documentation available
     Optional<String> verbose;
 };
+void EnableInlineStorage(InlineStorageTag<LogTraceParams>);
 
 /// No documentation available
 struct CancelParams {
     /// The request id to cancel.
     OneOf<Integer, String> id{};
 };
+void EnableInlineStorage(InlineStorageTag<CancelParams>);
 
 /// No documentation available
 struct ProgressParams {
@@ -5887,12 +6381,14 @@ struct ProgressParams {
     /// The progress data.
     lsp::LSPAny value{};
 };
+void EnableInlineStorage(InlineStorageTag<ProgressParams>);
 
 /// No documentation available
 struct WorkDoneProgressParams {
     /// An optional token that a server can use to report work done progress.
     Optional<lsp::ProgressToken> work_done_token;
 };
+void EnableInlineStorage(InlineStorageTag<WorkDoneProgressParams>);
 
 /// No documentation available
 struct PartialResultParams {
@@ -5900,6 +6396,7 @@ struct PartialResultParams {
     /// client.
     Optional<lsp::ProgressToken> partial_result_token;
 };
+void EnableInlineStorage(InlineStorageTag<PartialResultParams>);
 
 /// Represents the connection of two locations. Provides additional metadata over normal Location
 /// locations, including an origin range.
@@ -5920,6 +6417,7 @@ struct LocationLink {
     /// name of a function. Must be contained by the `targetRange`. See also `DocumentSymbol#range`
     lsp::Range target_selection_range{};
 };
+void EnableInlineStorage(InlineStorageTag<LocationLink>);
 
 /// Static registration options to be returned in the initialize request.
 struct StaticRegistrationOptions {
@@ -5927,6 +6425,7 @@ struct StaticRegistrationOptions {
     /// also Registration#id.
     Optional<String> id;
 };
+void EnableInlineStorage(InlineStorageTag<StaticRegistrationOptions>);
 
 /// Provide inline value as text.
 ///
@@ -5938,6 +6437,7 @@ struct InlineValueText {
     /// The text of the inline value.
     String text{};
 };
+void EnableInlineStorage(InlineStorageTag<InlineValueText>);
 
 /// Provide inline value through a variable lookup. If only a range is specified, the variable name
 /// will be extracted from the underlying document. An optional variable name can be used to
@@ -5955,6 +6455,7 @@ struct InlineValueVariableLookup {
     /// How to perform the lookup.
     Boolean case_sensitive_lookup{};
 };
+void EnableInlineStorage(InlineStorageTag<InlineValueVariableLookup>);
 
 /// Provide an inline value through an expression evaluation. If only a range is specified, the
 /// expression will be extracted from the underlying document. An optional expression can be used to
@@ -5969,6 +6470,7 @@ struct InlineValueEvaluatableExpression {
     /// If specified the expression overrides the extracted expression.
     Optional<String> expression;
 };
+void EnableInlineStorage(InlineStorageTag<InlineValueEvaluatableExpression>);
 
 /// A full diagnostic report with a set of related documents.
 ///
@@ -5985,6 +6487,7 @@ struct RelatedFullDocumentDiagnosticReport : lsp::FullDocumentDiagnosticReport {
         OneOf<lsp::FullDocumentDiagnosticReport, lsp::UnchangedDocumentDiagnosticReport>>>
         related_documents;
 };
+void EnableInlineStorage(InlineStorageTag<RelatedFullDocumentDiagnosticReport>);
 
 /// An unchanged diagnostic report with a set of related documents.
 ///
@@ -6001,6 +6504,7 @@ struct RelatedUnchangedDocumentDiagnosticReport : lsp::UnchangedDocumentDiagnost
         OneOf<lsp::FullDocumentDiagnosticReport, lsp::UnchangedDocumentDiagnosticReport>>>
         related_documents;
 };
+void EnableInlineStorage(InlineStorageTag<RelatedUnchangedDocumentDiagnosticReport>);
 
 /// @since 3.18.0
 ///
@@ -6012,6 +6516,7 @@ struct PrepareRenamePlaceholder {
     /// No documentation available
     String placeholder{};
 };
+void EnableInlineStorage(InlineStorageTag<PrepareRenamePlaceholder>);
 
 /// @since 3.18.0
 ///
@@ -6020,6 +6525,7 @@ struct PrepareRenameDefaultBehavior {
     /// No documentation available
     Boolean default_behavior{};
 };
+void EnableInlineStorage(InlineStorageTag<PrepareRenameDefaultBehavior>);
 
 /// A full document diagnostic report for a workspace diagnostic result.
 ///
@@ -6211,2120 +6717,3747 @@ struct NotebookDocumentFilterPattern {
 bool operator==(const TextDocumentIdentifier& lhs, const TextDocumentIdentifier& rhs);
 bool operator!=(const TextDocumentIdentifier& lhs, const TextDocumentIdentifier& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentIdentifier& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentIdentifier& out);
+bool Matches(const json::Value& v, const TextDocumentIdentifier*);
+bool Matches(json::StreamReader& r, const TextDocumentIdentifier*);
 Result<const json::Value*> Encode(const TextDocumentIdentifier& in, json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentIdentifier& in, json::StreamWriter& w);
 
 bool operator==(const Position& lhs, const Position& rhs);
 bool operator!=(const Position& lhs, const Position& rhs);
 Result<SuccessType> Decode(const json::Value& v, Position& out);
+Result<SuccessType> Decode(json::StreamReader& r, Position& out);
+bool Matches(const json::Value& v, const Position*);
+bool Matches(json::StreamReader& r, const Position*);
 Result<const json::Value*> Encode(const Position& in, json::Builder& b);
+Result<SuccessType> Encode(const Position& in, json::StreamWriter& w);
 
 bool operator==(const TextDocumentPositionParams& lhs, const TextDocumentPositionParams& rhs);
 bool operator!=(const TextDocumentPositionParams& lhs, const TextDocumentPositionParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentPositionParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentPositionParams& out);
+bool Matches(const json::Value& v, const TextDocumentPositionParams*);
+bool Matches(json::StreamReader& r, const TextDocumentPositionParams*);
 Result<const json::Value*> Encode(const TextDocumentPositionParams& in, json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentPositionParams& in, json::StreamWriter& w);
 
 bool operator==(const ImplementationParams& lhs, const ImplementationParams& rhs);
 bool operator!=(const ImplementationParams& lhs, const ImplementationParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, ImplementationParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, ImplementationParams& out);
+bool Matches(const json::Value& v, const ImplementationParams*);
+bool Matches(json::StreamReader& r, const ImplementationParams*);
 Result<const json::Value*> Encode(const ImplementationParams& in, json::Builder& b);
+Result<SuccessType> Encode(const ImplementationParams& in, json::StreamWriter& w);
 
 bool operator==(const Range& lhs, const Range& rhs);
 bool operator!=(const Range& lhs, const Range& rhs);
 Result<SuccessType> Decode(const json::Value& v, Range& out);
+Result<SuccessType> Decode(json::StreamReader& r, Range& out);
+bool Matches(const json::Value& v, const Range*);
+bool Matches(json::StreamReader& r, const Range*);
 Result<const json::Value*> Encode(const Range& in, json::Builder& b);
+Result<SuccessType> Encode(const Range& in, json::StreamWriter& w);
 
 bool operator==(const Location& lhs, const Location& rhs);
 bool operator!=(const Location& lhs, const Location& rhs);
 Result<SuccessType> Decode(const json::Value& v, Location& out);
+Result<SuccessType> Decode(json::StreamReader& r, Location& out);
+bool Matches(const json::Value& v, const Location*);
+bool Matches(json::StreamReader& r, const Location*);
 Result<const json::Value*> Encode(const Location& in, json::Builder& b);
+Result<SuccessType> Encode(const Location& in, json::StreamWriter& w);
 
 bool operator==(const TextDocumentRegistrationOptions& lhs,
                 const TextDocumentRegistrationOptions& rhs);
 bool operator!=(const TextDocumentRegistrationOptions& lhs,
                 const TextDocumentRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentRegistrationOptions& out);
+bool Matches(const json::Value& v, const TextDocumentRegistrationOptions*);
+bool Matches(json::StreamReader& r, const TextDocumentRegistrationOptions*);
 Result<const json::Value*> Encode(const TextDocumentRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const ImplementationOptions& lhs, const ImplementationOptions& rhs);
 bool operator!=(const ImplementationOptions& lhs, const ImplementationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ImplementationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ImplementationOptions& out);
+bool Matches(const json::Value& v, const ImplementationOptions*);
+bool Matches(json::StreamReader& r, const ImplementationOptions*);
 Result<const json::Value*> Encode(const ImplementationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ImplementationOptions& in, json::StreamWriter& w);
 
 bool operator==(const ImplementationRegistrationOptions& lhs,
                 const ImplementationRegistrationOptions& rhs);
 bool operator!=(const ImplementationRegistrationOptions& lhs,
                 const ImplementationRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ImplementationRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ImplementationRegistrationOptions& out);
+bool Matches(const json::Value& v, const ImplementationRegistrationOptions*);
+bool Matches(json::StreamReader& r, const ImplementationRegistrationOptions*);
 Result<const json::Value*> Encode(const ImplementationRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ImplementationRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const TypeDefinitionParams& lhs, const TypeDefinitionParams& rhs);
 bool operator!=(const TypeDefinitionParams& lhs, const TypeDefinitionParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, TypeDefinitionParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, TypeDefinitionParams& out);
+bool Matches(const json::Value& v, const TypeDefinitionParams*);
+bool Matches(json::StreamReader& r, const TypeDefinitionParams*);
 Result<const json::Value*> Encode(const TypeDefinitionParams& in, json::Builder& b);
+Result<SuccessType> Encode(const TypeDefinitionParams& in, json::StreamWriter& w);
 
 bool operator==(const TypeDefinitionOptions& lhs, const TypeDefinitionOptions& rhs);
 bool operator!=(const TypeDefinitionOptions& lhs, const TypeDefinitionOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, TypeDefinitionOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, TypeDefinitionOptions& out);
+bool Matches(const json::Value& v, const TypeDefinitionOptions*);
+bool Matches(json::StreamReader& r, const TypeDefinitionOptions*);
 Result<const json::Value*> Encode(const TypeDefinitionOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const TypeDefinitionOptions& in, json::StreamWriter& w);
 
 bool operator==(const TypeDefinitionRegistrationOptions& lhs,
                 const TypeDefinitionRegistrationOptions& rhs);
 bool operator!=(const TypeDefinitionRegistrationOptions& lhs,
                 const TypeDefinitionRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, TypeDefinitionRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, TypeDefinitionRegistrationOptions& out);
+bool Matches(const json::Value& v, const TypeDefinitionRegistrationOptions*);
+bool Matches(json::StreamReader& r, const TypeDefinitionRegistrationOptions*);
 Result<const json::Value*> Encode(const TypeDefinitionRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const TypeDefinitionRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceFolder& lhs, const WorkspaceFolder& rhs);
 bool operator!=(const WorkspaceFolder& lhs, const WorkspaceFolder& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceFolder& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceFolder& out);
+bool Matches(const json::Value& v, const WorkspaceFolder*);
+bool Matches(json::StreamReader& r, const WorkspaceFolder*);
 Result<const json::Value*> Encode(const WorkspaceFolder& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceFolder& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceFoldersChangeEvent& lhs, const WorkspaceFoldersChangeEvent& rhs);
 bool operator!=(const WorkspaceFoldersChangeEvent& lhs, const WorkspaceFoldersChangeEvent& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceFoldersChangeEvent& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceFoldersChangeEvent& out);
+bool Matches(const json::Value& v, const WorkspaceFoldersChangeEvent*);
+bool Matches(json::StreamReader& r, const WorkspaceFoldersChangeEvent*);
 Result<const json::Value*> Encode(const WorkspaceFoldersChangeEvent& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceFoldersChangeEvent& in, json::StreamWriter& w);
 
 bool operator==(const DidChangeWorkspaceFoldersParams& lhs,
                 const DidChangeWorkspaceFoldersParams& rhs);
 bool operator!=(const DidChangeWorkspaceFoldersParams& lhs,
                 const DidChangeWorkspaceFoldersParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidChangeWorkspaceFoldersParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidChangeWorkspaceFoldersParams& out);
+bool Matches(const json::Value& v, const DidChangeWorkspaceFoldersParams*);
+bool Matches(json::StreamReader& r, const DidChangeWorkspaceFoldersParams*);
 Result<const json::Value*> Encode(const DidChangeWorkspaceFoldersParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DidChangeWorkspaceFoldersParams& in, json::StreamWriter& w);
 
 bool operator==(const ConfigurationItem& lhs, const ConfigurationItem& rhs);
 bool operator!=(const ConfigurationItem& lhs, const ConfigurationItem& rhs);
 Result<SuccessType> Decode(const json::Value& v, ConfigurationItem& out);
+Result<SuccessType> Decode(json::StreamReader& r, ConfigurationItem& out);
+bool Matches(const json::Value& v, const ConfigurationItem*);
+bool Matches(json::StreamReader& r, const ConfigurationItem*);
 Result<const json::Value*> Encode(const ConfigurationItem& in, json::Builder& b);
+Result<SuccessType> Encode(const ConfigurationItem& in, json::StreamWriter& w);
 
 bool operator==(const ConfigurationParams& lhs, const ConfigurationParams& rhs);
 bool operator!=(const ConfigurationParams& lhs, const ConfigurationParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, ConfigurationParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, ConfigurationParams& out);
+bool Matches(const json::Value& v, const ConfigurationParams*);
+bool Matches(json::StreamReader& r, const ConfigurationParams*);
 Result<const json::Value*> Encode(const ConfigurationParams& in, json::Builder& b);
+Result<SuccessType> Encode(const ConfigurationParams& in, json::StreamWriter& w);
 
 bool operator==(const DocumentColorParams& lhs, const DocumentColorParams& rhs);
 bool operator!=(const DocumentColorParams& lhs, const DocumentColorParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentColorParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentColorParams& out);
+bool Matches(const json::Value& v, const DocumentColorParams*);
+bool Matches(json::StreamReader& r, const DocumentColorParams*);
 Result<const json::Value*> Encode(const DocumentColorParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentColorParams& in, json::StreamWriter& w);
 
 bool operator==(const Color& lhs, const Color& rhs);
 bool operator!=(const Color& lhs, const Color& rhs);
 Result<SuccessType> Decode(const json::Value& v, Color& out);
+Result<SuccessType> Decode(json::StreamReader& r, Color& out);
+bool Matches(const json::Value& v, const Color*);
+bool Matches(json::StreamReader& r, const Color*);
 Result<const json::Value*> Encode(const Color& in, json::Builder& b);
+Result<SuccessType> Encode(const Color& in, json::StreamWriter& w);
 
 bool operator==(const ColorInformation& lhs, const ColorInformation& rhs);
 bool operator!=(const ColorInformation& lhs, const ColorInformation& rhs);
 Result<SuccessType> Decode(const json::Value& v, ColorInformation& out);
+Result<SuccessType> Decode(json::StreamReader& r, ColorInformation& out);
+bool Matches(const json::Value& v, const ColorInformation*);
+bool Matches(json::StreamReader& r, const ColorInformation*);
 Result<const json::Value*> Encode(const ColorInformation& in, json::Builder& b);
+Result<SuccessType> Encode(const ColorInformation& in, json::StreamWriter& w);
 
 bool operator==(const DocumentColorOptions& lhs, const DocumentColorOptions& rhs);
 bool operator!=(const DocumentColorOptions& lhs, const DocumentColorOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentColorOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentColorOptions& out);
+bool Matches(const json::Value& v, const DocumentColorOptions*);
+bool Matches(json::StreamReader& r, const DocumentColorOptions*);
 Result<const json::Value*> Encode(const DocumentColorOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentColorOptions& in, json::StreamWriter& w);
 
 bool operator==(const DocumentColorRegistrationOptions& lhs,
                 const DocumentColorRegistrationOptions& rhs);
 bool operator!=(const DocumentColorRegistrationOptions& lhs,
                 const DocumentColorRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentColorRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentColorRegistrationOptions& out);
+bool Matches(const json::Value& v, const DocumentColorRegistrationOptions*);
+bool Matches(json::StreamReader& r, const DocumentColorRegistrationOptions*);
 Result<const json::Value*> Encode(const DocumentColorRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentColorRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const ColorPresentationParams& lhs, const ColorPresentationParams& rhs);
 bool operator!=(const ColorPresentationParams& lhs, const ColorPresentationParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, ColorPresentationParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, ColorPresentationParams& out);
+bool Matches(const json::Value& v, const ColorPresentationParams*);
+bool Matches(json::StreamReader& r, const ColorPresentationParams*);
 Result<const json::Value*> Encode(const ColorPresentationParams& in, json::Builder& b);
+Result<SuccessType> Encode(const ColorPresentationParams& in, json::StreamWriter& w);
 
 bool operator==(const TextEdit& lhs, const TextEdit& rhs);
 bool operator!=(const TextEdit& lhs, const TextEdit& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextEdit& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextEdit& out);
+bool Matches(const json::Value& v, const TextEdit*);
+bool Matches(json::StreamReader& r, const TextEdit*);
 Result<const json::Value*> Encode(const TextEdit& in, json::Builder& b);
+Result<SuccessType> Encode(const TextEdit& in, json::StreamWriter& w);
 
 bool operator==(const ColorPresentation& lhs, const ColorPresentation& rhs);
 bool operator!=(const ColorPresentation& lhs, const ColorPresentation& rhs);
 Result<SuccessType> Decode(const json::Value& v, ColorPresentation& out);
+Result<SuccessType> Decode(json::StreamReader& r, ColorPresentation& out);
+bool Matches(const json::Value& v, const ColorPresentation*);
+bool Matches(json::StreamReader& r, const ColorPresentation*);
 Result<const json::Value*> Encode(const ColorPresentation& in, json::Builder& b);
+Result<SuccessType> Encode(const ColorPresentation& in, json::StreamWriter& w);
 
 bool operator==(const WorkDoneProgressOptions& lhs, const WorkDoneProgressOptions& rhs);
 bool operator!=(const WorkDoneProgressOptions& lhs, const WorkDoneProgressOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkDoneProgressOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkDoneProgressOptions& out);
+bool Matches(const json::Value& v, const WorkDoneProgressOptions*);
+bool Matches(json::StreamReader& r, const WorkDoneProgressOptions*);
 Result<const json::Value*> Encode(const WorkDoneProgressOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkDoneProgressOptions& in, json::StreamWriter& w);
 
 bool operator==(const FoldingRangeParams& lhs, const FoldingRangeParams& rhs);
 bool operator!=(const FoldingRangeParams& lhs, const FoldingRangeParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, FoldingRangeParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, FoldingRangeParams& out);
+bool Matches(const json::Value& v, const FoldingRangeParams*);
+bool Matches(json::StreamReader& r, const FoldingRangeParams*);
 Result<const json::Value*> Encode(const FoldingRangeParams& in, json::Builder& b);
+Result<SuccessType> Encode(const FoldingRangeParams& in, json::StreamWriter& w);
 
 bool operator==(const FoldingRange& lhs, const FoldingRange& rhs);
 bool operator!=(const FoldingRange& lhs, const FoldingRange& rhs);
 Result<SuccessType> Decode(const json::Value& v, FoldingRange& out);
+Result<SuccessType> Decode(json::StreamReader& r, FoldingRange& out);
+bool Matches(const json::Value& v, const FoldingRange*);
+bool Matches(json::StreamReader& r, const FoldingRange*);
 Result<const json::Value*> Encode(const FoldingRange& in, json::Builder& b);
+Result<SuccessType> Encode(const FoldingRange& in, json::StreamWriter& w);
 
 bool operator==(const FoldingRangeOptions& lhs, const FoldingRangeOptions& rhs);
 bool operator!=(const FoldingRangeOptions& lhs, const FoldingRangeOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, FoldingRangeOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, FoldingRangeOptions& out);
+bool Matches(const json::Value& v, const FoldingRangeOptions*);
+bool Matches(json::StreamReader& r, const FoldingRangeOptions*);
 Result<const json::Value*> Encode(const FoldingRangeOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const FoldingRangeOptions& in, json::StreamWriter& w);
 
 bool operator==(const FoldingRangeRegistrationOptions& lhs,
                 const FoldingRangeRegistrationOptions& rhs);
 bool operator!=(const FoldingRangeRegistrationOptions& lhs,
                 const FoldingRangeRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, FoldingRangeRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, FoldingRangeRegistrationOptions& out);
+bool Matches(const json::Value& v, const FoldingRangeRegistrationOptions*);
+bool Matches(json::StreamReader& r, const FoldingRangeRegistrationOptions*);
 Result<const json::Value*> Encode(const FoldingRangeRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const FoldingRangeRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const DeclarationParams& lhs, const DeclarationParams& rhs);
 bool operator!=(const DeclarationParams& lhs, const DeclarationParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DeclarationParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DeclarationParams& out);
+bool Matches(const json::Value& v, const DeclarationParams*);
+bool Matches(json::StreamReader& r, const DeclarationParams*);
 Result<const json::Value*> Encode(const DeclarationParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DeclarationParams& in, json::StreamWriter& w);
 
 bool operator==(const DeclarationOptions& lhs, const DeclarationOptions& rhs);
 bool operator!=(const DeclarationOptions& lhs, const DeclarationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DeclarationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DeclarationOptions& out);
+bool Matches(const json::Value& v, const DeclarationOptions*);
+bool Matches(json::StreamReader& r, const DeclarationOptions*);
 Result<const json::Value*> Encode(const DeclarationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DeclarationOptions& in, json::StreamWriter& w);
 
 bool operator==(const DeclarationRegistrationOptions& lhs,
                 const DeclarationRegistrationOptions& rhs);
 bool operator!=(const DeclarationRegistrationOptions& lhs,
                 const DeclarationRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DeclarationRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DeclarationRegistrationOptions& out);
+bool Matches(const json::Value& v, const DeclarationRegistrationOptions*);
+bool Matches(json::StreamReader& r, const DeclarationRegistrationOptions*);
 Result<const json::Value*> Encode(const DeclarationRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DeclarationRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const SelectionRangeParams& lhs, const SelectionRangeParams& rhs);
 bool operator!=(const SelectionRangeParams& lhs, const SelectionRangeParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, SelectionRangeParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, SelectionRangeParams& out);
+bool Matches(const json::Value& v, const SelectionRangeParams*);
+bool Matches(json::StreamReader& r, const SelectionRangeParams*);
 Result<const json::Value*> Encode(const SelectionRangeParams& in, json::Builder& b);
+Result<SuccessType> Encode(const SelectionRangeParams& in, json::StreamWriter& w);
 
 bool operator==(const SelectionRange& lhs, const SelectionRange& rhs);
 bool operator!=(const SelectionRange& lhs, const SelectionRange& rhs);
 Result<SuccessType> Decode(const json::Value& v, SelectionRange& out);
+Result<SuccessType> Decode(json::StreamReader& r, SelectionRange& out);
+bool Matches(const json::Value& v, const SelectionRange*);
+bool Matches(json::StreamReader& r, const SelectionRange*);
 Result<const json::Value*> Encode(const SelectionRange& in, json::Builder& b);
+Result<SuccessType> Encode(const SelectionRange& in, json::StreamWriter& w);
 
 bool operator==(const SelectionRangeOptions& lhs, const SelectionRangeOptions& rhs);
 bool operator!=(const SelectionRangeOptions& lhs, const SelectionRangeOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, SelectionRangeOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, SelectionRangeOptions& out);
+bool Matches(const json::Value& v, const SelectionRangeOptions*);
+bool Matches(json::StreamReader& r, const SelectionRangeOptions*);
 Result<const json::Value*> Encode(const SelectionRangeOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const SelectionRangeOptions& in, json::StreamWriter& w);
 
 bool operator==(const SelectionRangeRegistrationOptions& lhs,
                 const SelectionRangeRegistrationOptions& rhs);
 bool operator!=(const SelectionRangeRegistrationOptions& lhs,
                 const SelectionRangeRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, SelectionRangeRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, SelectionRangeRegistrationOptions& out);
+bool Matches(const json::Value& v, const SelectionRangeRegistrationOptions*);
+bool Matches(json::StreamReader& r, const SelectionRangeRegistrationOptions*);
 Result<const json::Value*> Encode(const SelectionRangeRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const SelectionRangeRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const WorkDoneProgressCreateParams& lhs, const WorkDoneProgressCreateParams& rhs);
 bool operator!=(const WorkDoneProgressCreateParams& lhs, const WorkDoneProgressCreateParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkDoneProgressCreateParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkDoneProgressCreateParams& out);
+bool Matches(const json::Value& v, const WorkDoneProgressCreateParams*);
+bool Matches(json::StreamReader& r, const WorkDoneProgressCreateParams*);
 Result<const json::Value*> Encode(const WorkDoneProgressCreateParams& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkDoneProgressCreateParams& in, json::StreamWriter& w);
 
 bool operator==(const WorkDoneProgressCancelParams& lhs, const WorkDoneProgressCancelParams& rhs);
 bool operator!=(const WorkDoneProgressCancelParams& lhs, const WorkDoneProgressCancelParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkDoneProgressCancelParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkDoneProgressCancelParams& out);
+bool Matches(const json::Value& v, const WorkDoneProgressCancelParams*);
+bool Matches(json::StreamReader& r, const WorkDoneProgressCancelParams*);
 Result<const json::Value*> Encode(const WorkDoneProgressCancelParams& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkDoneProgressCancelParams& in, json::StreamWriter& w);
 
 bool operator==(const CallHierarchyPrepareParams& lhs, const CallHierarchyPrepareParams& rhs);
 bool operator!=(const CallHierarchyPrepareParams& lhs, const CallHierarchyPrepareParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, CallHierarchyPrepareParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, CallHierarchyPrepareParams& out);
+bool Matches(const json::Value& v, const CallHierarchyPrepareParams*);
+bool Matches(json::StreamReader& r, const CallHierarchyPrepareParams*);
 Result<const json::Value*> Encode(const CallHierarchyPrepareParams& in, json::Builder& b);
+Result<SuccessType> Encode(const CallHierarchyPrepareParams& in, json::StreamWriter& w);
 
 bool operator==(const CallHierarchyItem& lhs, const CallHierarchyItem& rhs);
 bool operator!=(const CallHierarchyItem& lhs, const CallHierarchyItem& rhs);
 Result<SuccessType> Decode(const json::Value& v, CallHierarchyItem& out);
+Result<SuccessType> Decode(json::StreamReader& r, CallHierarchyItem& out);
+bool Matches(const json::Value& v, const CallHierarchyItem*);
+bool Matches(json::StreamReader& r, const CallHierarchyItem*);
 Result<const json::Value*> Encode(const CallHierarchyItem& in, json::Builder& b);
+Result<SuccessType> Encode(const CallHierarchyItem& in, json::StreamWriter& w);
 
 bool operator==(const CallHierarchyOptions& lhs, const CallHierarchyOptions& rhs);
 bool operator!=(const CallHierarchyOptions& lhs, const CallHierarchyOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, CallHierarchyOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, CallHierarchyOptions& out);
+bool Matches(const json::Value& v, const CallHierarchyOptions*);
+bool Matches(json::StreamReader& r, const CallHierarchyOptions*);
 Result<const json::Value*> Encode(const CallHierarchyOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const CallHierarchyOptions& in, json::StreamWriter& w);
 
 bool operator==(const CallHierarchyRegistrationOptions& lhs,
                 const CallHierarchyRegistrationOptions& rhs);
 bool operator!=(const CallHierarchyRegistrationOptions& lhs,
                 const CallHierarchyRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, CallHierarchyRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, CallHierarchyRegistrationOptions& out);
+bool Matches(const json::Value& v, const CallHierarchyRegistrationOptions*);
+bool Matches(json::StreamReader& r, const CallHierarchyRegistrationOptions*);
 Result<const json::Value*> Encode(const CallHierarchyRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const CallHierarchyRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const CallHierarchyIncomingCallsParams& lhs,
                 const CallHierarchyIncomingCallsParams& rhs);
 bool operator!=(const CallHierarchyIncomingCallsParams& lhs,
                 const CallHierarchyIncomingCallsParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, CallHierarchyIncomingCallsParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, CallHierarchyIncomingCallsParams& out);
+bool Matches(const json::Value& v, const CallHierarchyIncomingCallsParams*);
+bool Matches(json::StreamReader& r, const CallHierarchyIncomingCallsParams*);
 Result<const json::Value*> Encode(const CallHierarchyIncomingCallsParams& in, json::Builder& b);
+Result<SuccessType> Encode(const CallHierarchyIncomingCallsParams& in, json::StreamWriter& w);
 
 bool operator==(const CallHierarchyIncomingCall& lhs, const CallHierarchyIncomingCall& rhs);
 bool operator!=(const CallHierarchyIncomingCall& lhs, const CallHierarchyIncomingCall& rhs);
 Result<SuccessType> Decode(const json::Value& v, CallHierarchyIncomingCall& out);
+Result<SuccessType> Decode(json::StreamReader& r, CallHierarchyIncomingCall& out);
+bool Matches(const json::Value& v, const CallHierarchyIncomingCall*);
+bool Matches(json::StreamReader& r, const CallHierarchyIncomingCall*);
 Result<const json::Value*> Encode(const CallHierarchyIncomingCall& in, json::Builder& b);
+Result<SuccessType> Encode(const CallHierarchyIncomingCall& in, json::StreamWriter& w);
 
 bool operator==(const CallHierarchyOutgoingCallsParams& lhs,
                 const CallHierarchyOutgoingCallsParams& rhs);
 bool operator!=(const CallHierarchyOutgoingCallsParams& lhs,
                 const CallHierarchyOutgoingCallsParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, CallHierarchyOutgoingCallsParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, CallHierarchyOutgoingCallsParams& out);
+bool Matches(const json::Value& v, const CallHierarchyOutgoingCallsParams*);
+bool Matches(json::StreamReader& r, const CallHierarchyOutgoingCallsParams*);
 Result<const json::Value*> Encode(const CallHierarchyOutgoingCallsParams& in, json::Builder& b);
+Result<SuccessType> Encode(const CallHierarchyOutgoingCallsParams& in, json::StreamWriter& w);
 
 bool operator==(const CallHierarchyOutgoingCall& lhs, const CallHierarchyOutgoingCall& rhs);
 bool operator!=(const CallHierarchyOutgoingCall& lhs, const CallHierarchyOutgoingCall& rhs);
 Result<SuccessType> Decode(const json::Value& v, CallHierarchyOutgoingCall& out);
+Result<SuccessType> Decode(json::StreamReader& r, CallHierarchyOutgoingCall& out);
+bool Matches(const json::Value& v, const CallHierarchyOutgoingCall*);
+bool Matches(json::StreamReader& r, const CallHierarchyOutgoingCall*);
 Result<const json::Value*> Encode(const CallHierarchyOutgoingCall& in, json::Builder& b);
+Result<SuccessType> Encode(const CallHierarchyOutgoingCall& in, json::StreamWriter& w);
 
 bool operator==(const SemanticTokensParams& lhs, const SemanticTokensParams& rhs);
 bool operator!=(const SemanticTokensParams& lhs, const SemanticTokensParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensParams& out);
+bool Matches(const json::Value& v, const SemanticTokensParams*);
+bool Matches(json::StreamReader& r, const SemanticTokensParams*);
 Result<const json::Value*> Encode(const SemanticTokensParams& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensParams& in, json::StreamWriter& w);
 
 bool operator==(const SemanticTokens& lhs, const SemanticTokens& rhs);
 bool operator!=(const SemanticTokens& lhs, const SemanticTokens& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokens& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokens& out);
+bool Matches(const json::Value& v, const SemanticTokens*);
+bool Matches(json::StreamReader& r, const SemanticTokens*);
 Result<const json::Value*> Encode(const SemanticTokens& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokens& in, json::StreamWriter& w);
 
 bool operator==(const SemanticTokensPartialResult& lhs, const SemanticTokensPartialResult& rhs);
 bool operator!=(const SemanticTokensPartialResult& lhs, const SemanticTokensPartialResult& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensPartialResult& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensPartialResult& out);
+bool Matches(const json::Value& v, const SemanticTokensPartialResult*);
+bool Matches(json::StreamReader& r, const SemanticTokensPartialResult*);
 Result<const json::Value*> Encode(const SemanticTokensPartialResult& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensPartialResult& in, json::StreamWriter& w);
 
 bool operator==(const SemanticTokensLegend& lhs, const SemanticTokensLegend& rhs);
 bool operator!=(const SemanticTokensLegend& lhs, const SemanticTokensLegend& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensLegend& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensLegend& out);
+bool Matches(const json::Value& v, const SemanticTokensLegend*);
+bool Matches(json::StreamReader& r, const SemanticTokensLegend*);
 Result<const json::Value*> Encode(const SemanticTokensLegend& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensLegend& in, json::StreamWriter& w);
 
 bool operator==(const SemanticTokensFullDelta& lhs, const SemanticTokensFullDelta& rhs);
 bool operator!=(const SemanticTokensFullDelta& lhs, const SemanticTokensFullDelta& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensFullDelta& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensFullDelta& out);
+bool Matches(const json::Value& v, const SemanticTokensFullDelta*);
+bool Matches(json::StreamReader& r, const SemanticTokensFullDelta*);
 Result<const json::Value*> Encode(const SemanticTokensFullDelta& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensFullDelta& in, json::StreamWriter& w);
 
 bool operator==(const SemanticTokensOptions& lhs, const SemanticTokensOptions& rhs);
 bool operator!=(const SemanticTokensOptions& lhs, const SemanticTokensOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensOptions& out);
+bool Matches(const json::Value& v, const SemanticTokensOptions*);
+bool Matches(json::StreamReader& r, const SemanticTokensOptions*);
 Result<const json::Value*> Encode(const SemanticTokensOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensOptions& in, json::StreamWriter& w);
 bool operator==(const SemanticTokensOptions::Range& lhs, const SemanticTokensOptions::Range& rhs);
 bool operator!=(const SemanticTokensOptions::Range& lhs, const SemanticTokensOptions::Range& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensOptions::Range& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensOptions::Range& out);
+bool Matches(const json::Value& v, const SemanticTokensOptions::Range*);
+bool Matches(json::StreamReader& r, const SemanticTokensOptions::Range*);
 Result<const json::Value*> Encode(const SemanticTokensOptions::Range& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensOptions::Range& in, json::StreamWriter& w);
 
 bool operator==(const SemanticTokensRegistrationOptions& lhs,
                 const SemanticTokensRegistrationOptions& rhs);
 bool operator!=(const SemanticTokensRegistrationOptions& lhs,
                 const SemanticTokensRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensRegistrationOptions& out);
+bool Matches(const json::Value& v, const SemanticTokensRegistrationOptions*);
+bool Matches(json::StreamReader& r, const SemanticTokensRegistrationOptions*);
 Result<const json::Value*> Encode(const SemanticTokensRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const SemanticTokensDeltaParams& lhs, const SemanticTokensDeltaParams& rhs);
 bool operator!=(const SemanticTokensDeltaParams& lhs, const SemanticTokensDeltaParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensDeltaParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensDeltaParams& out);
+bool Matches(const json::Value& v, const SemanticTokensDeltaParams*);
+bool Matches(json::StreamReader& r, const SemanticTokensDeltaParams*);
 Result<const json::Value*> Encode(const SemanticTokensDeltaParams& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensDeltaParams& in, json::StreamWriter& w);
 
 bool operator==(const SemanticTokensEdit& lhs, const SemanticTokensEdit& rhs);
 bool operator!=(const SemanticTokensEdit& lhs, const SemanticTokensEdit& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensEdit& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensEdit& out);
+bool Matches(const json::Value& v, const SemanticTokensEdit*);
+bool Matches(json::StreamReader& r, const SemanticTokensEdit*);
 Result<const json::Value*> Encode(const SemanticTokensEdit& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensEdit& in, json::StreamWriter& w);
 
 bool operator==(const SemanticTokensDelta& lhs, const SemanticTokensDelta& rhs);
 bool operator!=(const SemanticTokensDelta& lhs, const SemanticTokensDelta& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensDelta& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensDelta& out);
+bool Matches(const json::Value& v, const SemanticTokensDelta*);
+bool Matches(json::StreamReader& r, const SemanticTokensDelta*);
 Result<const json::Value*> Encode(const SemanticTokensDelta& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensDelta& in, json::StreamWriter& w);
 
 bool operator==(const SemanticTokensDeltaPartialResult& lhs,
                 const SemanticTokensDeltaPartialResult& rhs);
 bool operator!=(const SemanticTokensDeltaPartialResult& lhs,
                 const SemanticTokensDeltaPartialResult& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensDeltaPartialResult& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensDeltaPartialResult& out);
+bool Matches(const json::Value& v, const SemanticTokensDeltaPartialResult*);
+bool Matches(json::StreamReader& r, const SemanticTokensDeltaPartialResult*);
 Result<const json::Value*> Encode(const SemanticTokensDeltaPartialResult& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensDeltaPartialResult& in, json::StreamWriter& w);
 
 bool operator==(const SemanticTokensRangeParams& lhs, const SemanticTokensRangeParams& rhs);
 bool operator!=(const SemanticTokensRangeParams& lhs, const SemanticTokensRangeParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensRangeParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensRangeParams& out);
+bool Matches(const json::Value& v, const SemanticTokensRangeParams*);
+bool Matches(json::StreamReader& r, const SemanticTokensRangeParams*);
 Result<const json::Value*> Encode(const SemanticTokensRangeParams& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensRangeParams& in, json::StreamWriter& w);
 
 bool operator==(const ShowDocumentParams& lhs, const ShowDocumentParams& rhs);
 bool operator!=(const ShowDocumentParams& lhs, const ShowDocumentParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, ShowDocumentParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, ShowDocumentParams& out);
+bool Matches(const json::Value& v, const ShowDocumentParams*);
+bool Matches(json::StreamReader& r, const ShowDocumentParams*);
 Result<const json::Value*> Encode(const ShowDocumentParams& in, json::Builder& b);
+Result<SuccessType> Encode(const ShowDocumentParams& in, json::StreamWriter& w);
 
 bool operator==(const ShowDocumentResult& lhs, const ShowDocumentResult& rhs);
 bool operator!=(const ShowDocumentResult& lhs, const ShowDocumentResult& rhs);
 Result<SuccessType> Decode(const json::Value& v, ShowDocumentResult& out);
+Result<SuccessType> Decode(json::StreamReader& r, ShowDocumentResult& out);
+bool Matches(const json::Value& v, const ShowDocumentResult*);
+bool Matches(json::StreamReader& r, const ShowDocumentResult*);
 Result<const json::Value*> Encode(const ShowDocumentResult& in, json::Builder& b);
+Result<SuccessType> Encode(const ShowDocumentResult& in, json::StreamWriter& w);
 
 bool operator==(const LinkedEditingRangeParams& lhs, const LinkedEditingRangeParams& rhs);
 bool operator!=(const LinkedEditingRangeParams& lhs, const LinkedEditingRangeParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, LinkedEditingRangeParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, LinkedEditingRangeParams& out);
+bool Matches(const json::Value& v, const LinkedEditingRangeParams*);
+bool Matches(json::StreamReader& r, const LinkedEditingRangeParams*);
 Result<const json::Value*> Encode(const LinkedEditingRangeParams& in, json::Builder& b);
+Result<SuccessType> Encode(const LinkedEditingRangeParams& in, json::StreamWriter& w);
 
 bool operator==(const LinkedEditingRanges& lhs, const LinkedEditingRanges& rhs);
 bool operator!=(const LinkedEditingRanges& lhs, const LinkedEditingRanges& rhs);
 Result<SuccessType> Decode(const json::Value& v, LinkedEditingRanges& out);
+Result<SuccessType> Decode(json::StreamReader& r, LinkedEditingRanges& out);
+bool Matches(const json::Value& v, const LinkedEditingRanges*);
+bool Matches(json::StreamReader& r, const LinkedEditingRanges*);
 Result<const json::Value*> Encode(const LinkedEditingRanges& in, json::Builder& b);
+Result<SuccessType> Encode(const LinkedEditingRanges& in, json::StreamWriter& w);
 
 bool operator==(const LinkedEditingRangeOptions& lhs, const LinkedEditingRangeOptions& rhs);
 bool operator!=(const LinkedEditingRangeOptions& lhs, const LinkedEditingRangeOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, LinkedEditingRangeOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, LinkedEditingRangeOptions& out);
+bool Matches(const json::Value& v, const LinkedEditingRangeOptions*);
+bool Matches(json::StreamReader& r, const LinkedEditingRangeOptions*);
 Result<const json::Value*> Encode(const LinkedEditingRangeOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const LinkedEditingRangeOptions& in, json::StreamWriter& w);
 
 bool operator==(const LinkedEditingRangeRegistrationOptions& lhs,
                 const LinkedEditingRangeRegistrationOptions& rhs);
 bool operator!=(const LinkedEditingRangeRegistrationOptions& lhs,
                 const LinkedEditingRangeRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, LinkedEditingRangeRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, LinkedEditingRangeRegistrationOptions& out);
+bool Matches(const json::Value& v, const LinkedEditingRangeRegistrationOptions*);
+bool Matches(json::StreamReader& r, const LinkedEditingRangeRegistrationOptions*);
 Result<const json::Value*> Encode(const LinkedEditingRangeRegistrationOptions& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const LinkedEditingRangeRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const FileCreate& lhs, const FileCreate& rhs);
 bool operator!=(const FileCreate& lhs, const FileCreate& rhs);
 Result<SuccessType> Decode(const json::Value& v, FileCreate& out);
+Result<SuccessType> Decode(json::StreamReader& r, FileCreate& out);
+bool Matches(const json::Value& v, const FileCreate*);
+bool Matches(json::StreamReader& r, const FileCreate*);
 Result<const json::Value*> Encode(const FileCreate& in, json::Builder& b);
+Result<SuccessType> Encode(const FileCreate& in, json::StreamWriter& w);
 
 bool operator==(const CreateFilesParams& lhs, const CreateFilesParams& rhs);
 bool operator!=(const CreateFilesParams& lhs, const CreateFilesParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, CreateFilesParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, CreateFilesParams& out);
+bool Matches(const json::Value& v, const CreateFilesParams*);
+bool Matches(json::StreamReader& r, const CreateFilesParams*);
 Result<const json::Value*> Encode(const CreateFilesParams& in, json::Builder& b);
+Result<SuccessType> Encode(const CreateFilesParams& in, json::StreamWriter& w);
 
 bool operator==(const ResourceOperation& lhs, const ResourceOperation& rhs);
 bool operator!=(const ResourceOperation& lhs, const ResourceOperation& rhs);
 Result<SuccessType> Decode(const json::Value& v, ResourceOperation& out);
+Result<SuccessType> Decode(json::StreamReader& r, ResourceOperation& out);
+bool Matches(const json::Value& v, const ResourceOperation*);
+bool Matches(json::StreamReader& r, const ResourceOperation*);
 Result<const json::Value*> Encode(const ResourceOperation& in, json::Builder& b);
+Result<SuccessType> Encode(const ResourceOperation& in, json::StreamWriter& w);
 
 bool operator==(const DeleteFileOptions& lhs, const DeleteFileOptions& rhs);
 bool operator!=(const DeleteFileOptions& lhs, const DeleteFileOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DeleteFileOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DeleteFileOptions& out);
+bool Matches(const json::Value& v, const DeleteFileOptions*);
+bool Matches(json::StreamReader& r, const DeleteFileOptions*);
 Result<const json::Value*> Encode(const DeleteFileOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DeleteFileOptions& in, json::StreamWriter& w);
 
 bool operator==(const DeleteFile& lhs, const DeleteFile& rhs);
 bool operator!=(const DeleteFile& lhs, const DeleteFile& rhs);
 Result<SuccessType> Decode(const json::Value& v, DeleteFile& out);
+Result<SuccessType> Decode(json::StreamReader& r, DeleteFile& out);
+bool Matches(const json::Value& v, const DeleteFile*);
+bool Matches(json::StreamReader& r, const DeleteFile*);
 Result<const json::Value*> Encode(const DeleteFile& in, json::Builder& b);
+Result<SuccessType> Encode(const DeleteFile& in, json::StreamWriter& w);
 
 bool operator==(const RenameFileOptions& lhs, const RenameFileOptions& rhs);
 bool operator!=(const RenameFileOptions& lhs, const RenameFileOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, RenameFileOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, RenameFileOptions& out);
+bool Matches(const json::Value& v, const RenameFileOptions*);
+bool Matches(json::StreamReader& r, const RenameFileOptions*);
 Result<const json::Value*> Encode(const RenameFileOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const RenameFileOptions& in, json::StreamWriter& w);
 
 bool operator==(const RenameFile& lhs, const RenameFile& rhs);
 bool operator!=(const RenameFile& lhs, const RenameFile& rhs);
 Result<SuccessType> Decode(const json::Value& v, RenameFile& out);
+Result<SuccessType> Decode(json::StreamReader& r, RenameFile& out);
+bool Matches(const json::Value& v, const RenameFile*);
+bool Matches(json::StreamReader& r, const RenameFile*);
 Result<const json::Value*> Encode(const RenameFile& in, json::Builder& b);
+Result<SuccessType> Encode(const RenameFile& in, json::StreamWriter& w);
 
 bool operator==(const CreateFileOptions& lhs, const CreateFileOptions& rhs);
 bool operator!=(const CreateFileOptions& lhs, const CreateFileOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, CreateFileOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, CreateFileOptions& out);
+bool Matches(const json::Value& v, const CreateFileOptions*);
+bool Matches(json::StreamReader& r, const CreateFileOptions*);
 Result<const json::Value*> Encode(const CreateFileOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const CreateFileOptions& in, json::StreamWriter& w);
 
 bool operator==(const CreateFile& lhs, const CreateFile& rhs);
 bool operator!=(const CreateFile& lhs, const CreateFile& rhs);
 Result<SuccessType> Decode(const json::Value& v, CreateFile& out);
+Result<SuccessType> Decode(json::StreamReader& r, CreateFile& out);
+bool Matches(const json::Value& v, const CreateFile*);
+bool Matches(json::StreamReader& r, const CreateFile*);
 Result<const json::Value*> Encode(const CreateFile& in, json::Builder& b);
+Result<SuccessType> Encode(const CreateFile& in, json::StreamWriter& w);
 
 bool operator==(const OptionalVersionedTextDocumentIdentifier& lhs,
                 const OptionalVersionedTextDocumentIdentifier& rhs);
 bool operator!=(const OptionalVersionedTextDocumentIdentifier& lhs,
                 const OptionalVersionedTextDocumentIdentifier& rhs);
 Result<SuccessType> Decode(const json::Value& v, OptionalVersionedTextDocumentIdentifier& out);
+Result<SuccessType> Decode(json::StreamReader& r, OptionalVersionedTextDocumentIdentifier& out);
+bool Matches(const json::Value& v, const OptionalVersionedTextDocumentIdentifier*);
+bool Matches(json::StreamReader& r, const OptionalVersionedTextDocumentIdentifier*);
 Result<const json::Value*> Encode(const OptionalVersionedTextDocumentIdentifier& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const OptionalVersionedTextDocumentIdentifier& in,
+                           json::StreamWriter& w);
 
 bool operator==(const AnnotatedTextEdit& lhs, const AnnotatedTextEdit& rhs);
 bool operator!=(const AnnotatedTextEdit& lhs, const AnnotatedTextEdit& rhs);
 Result<SuccessType> Decode(const json::Value& v, AnnotatedTextEdit& out);
+Result<SuccessType> Decode(json::StreamReader& r, AnnotatedTextEdit& out);
+bool Matches(const json::Value& v, const AnnotatedTextEdit*);
+bool Matches(json::StreamReader& r, const AnnotatedTextEdit*);
 Result<const json::Value*> Encode(const AnnotatedTextEdit& in, json::Builder& b);
+Result<SuccessType> Encode(const AnnotatedTextEdit& in, json::StreamWriter& w);
 
 bool operator==(const TextDocumentEdit& lhs, const TextDocumentEdit& rhs);
 bool operator!=(const TextDocumentEdit& lhs, const TextDocumentEdit& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentEdit& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentEdit& out);
+bool Matches(const json::Value& v, const TextDocumentEdit*);
+bool Matches(json::StreamReader& r, const TextDocumentEdit*);
 Result<const json::Value*> Encode(const TextDocumentEdit& in, json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentEdit& in, json::StreamWriter& w);
 
 bool operator==(const ChangeAnnotation& lhs, const ChangeAnnotation& rhs);
 bool operator!=(const ChangeAnnotation& lhs, const ChangeAnnotation& rhs);
 Result<SuccessType> Decode(const json::Value& v, ChangeAnnotation& out);
+Result<SuccessType> Decode(json::StreamReader& r, ChangeAnnotation& out);
+bool Matches(const json::Value& v, const ChangeAnnotation*);
+bool Matches(json::StreamReader& r, const ChangeAnnotation*);
 Result<const json::Value*> Encode(const ChangeAnnotation& in, json::Builder& b);
+Result<SuccessType> Encode(const ChangeAnnotation& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceEdit& lhs, const WorkspaceEdit& rhs);
 bool operator!=(const WorkspaceEdit& lhs, const WorkspaceEdit& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceEdit& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceEdit& out);
+bool Matches(const json::Value& v, const WorkspaceEdit*);
+bool Matches(json::StreamReader& r, const WorkspaceEdit*);
 Result<const json::Value*> Encode(const WorkspaceEdit& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceEdit& in, json::StreamWriter& w);
 
 bool operator==(const FileOperationPatternOptions& lhs, const FileOperationPatternOptions& rhs);
 bool operator!=(const FileOperationPatternOptions& lhs, const FileOperationPatternOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, FileOperationPatternOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, FileOperationPatternOptions& out);
+bool Matches(const json::Value& v, const FileOperationPatternOptions*);
+bool Matches(json::StreamReader& r, const FileOperationPatternOptions*);
 Result<const json::Value*> Encode(const FileOperationPatternOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const FileOperationPatternOptions& in, json::StreamWriter& w);
 
 bool operator==(const FileOperationPattern& lhs, const FileOperationPattern& rhs);
 bool operator!=(const FileOperationPattern& lhs, const FileOperationPattern& rhs);
 Result<SuccessType> Decode(const json::Value& v, FileOperationPattern& out);
+Result<SuccessType> Decode(json::StreamReader& r, FileOperationPattern& out);
+bool Matches(const json::Value& v, const FileOperationPattern*);
+bool Matches(json::StreamReader& r, const FileOperationPattern*);
 Result<const json::Value*> Encode(const FileOperationPattern& in, json::Builder& b);
+Result<SuccessType> Encode(const FileOperationPattern& in, json::StreamWriter& w);
 
 bool operator==(const FileOperationFilter& lhs, const FileOperationFilter& rhs);
 bool operator!=(const FileOperationFilter& lhs, const FileOperationFilter& rhs);
 Result<SuccessType> Decode(const json::Value& v, FileOperationFilter& out);
+Result<SuccessType> Decode(json::StreamReader& r, FileOperationFilter& out);
+bool Matches(const json::Value& v, const FileOperationFilter*);
+bool Matches(json::StreamReader& r, const FileOperationFilter*);
 Result<const json::Value*> Encode(const FileOperationFilter& in, json::Builder& b);
+Result<SuccessType> Encode(const FileOperationFilter& in, json::StreamWriter& w);
 
 bool operator==(const FileOperationRegistrationOptions& lhs,
                 const FileOperationRegistrationOptions& rhs);
 bool operator!=(const FileOperationRegistrationOptions& lhs,
                 const FileOperationRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, FileOperationRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, FileOperationRegistrationOptions& out);
+bool Matches(const json::Value& v, const FileOperationRegistrationOptions*);
+bool Matches(json::StreamReader& r, const FileOperationRegistrationOptions*);
 Result<const json::Value*> Encode(const FileOperationRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const FileOperationRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const FileRename& lhs, const FileRename& rhs);
 bool operator!=(const FileRename& lhs, const FileRename& rhs);
 Result<SuccessType> Decode(const json::Value& v, FileRename& out);
+Result<SuccessType> Decode(json::StreamReader& r, FileRename& out);
+bool Matches(const json::Value& v, const FileRename*);
+bool Matches(json::StreamReader& r, const FileRename*);
 Result<const json::Value*> Encode(const FileRename& in, json::Builder& b);
+Result<SuccessType> Encode(const FileRename& in, json::StreamWriter& w);
 
 bool operator==(const RenameFilesParams& lhs, const RenameFilesParams& rhs);
 bool operator!=(const RenameFilesParams& lhs, const RenameFilesParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, RenameFilesParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, RenameFilesParams& out);
+bool Matches(const json::Value& v, const RenameFilesParams*);
+bool Matches(json::StreamReader& r, const RenameFilesParams*);
 Result<const json::Value*> Encode(const RenameFilesParams& in, json::Builder& b);
+Result<SuccessType> Encode(const RenameFilesParams& in, json::StreamWriter& w);
 
 bool operator==(const FileDelete& lhs, const FileDelete& rhs);
 bool operator!=(const FileDelete& lhs, const FileDelete& rhs);
 Result<SuccessType> Decode(const json::Value& v, FileDelete& out);
+Result<SuccessType> Decode(json::StreamReader& r, FileDelete& out);
+bool Matches(const json::Value& v, const FileDelete*);
+bool Matches(json::StreamReader& r, const FileDelete*);
 Result<const json::Value*> Encode(const FileDelete& in, json::Builder& b);
+Result<SuccessType> Encode(const FileDelete& in, json::StreamWriter& w);
 
 bool operator==(const DeleteFilesParams& lhs, const DeleteFilesParams& rhs);
 bool operator!=(const DeleteFilesParams& lhs, const DeleteFilesParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DeleteFilesParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DeleteFilesParams& out);
+bool Matches(const json::Value& v, const DeleteFilesParams*);
+bool Matches(json::StreamReader& r, const DeleteFilesParams*);
 Result<const json::Value*> Encode(const DeleteFilesParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DeleteFilesParams& in, json::StreamWriter& w);
 
 bool operator==(const MonikerParams& lhs, const MonikerParams& rhs);
 bool operator!=(const MonikerParams& lhs, const MonikerParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, MonikerParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, MonikerParams& out);
+bool Matches(const json::Value& v, const MonikerParams*);
+bool Matches(json::StreamReader& r, const MonikerParams*);
 Result<const json::Value*> Encode(const MonikerParams& in, json::Builder& b);
+Result<SuccessType> Encode(const MonikerParams& in, json::StreamWriter& w);
 
 bool operator==(const Moniker& lhs, const Moniker& rhs);
 bool operator!=(const Moniker& lhs, const Moniker& rhs);
 Result<SuccessType> Decode(const json::Value& v, Moniker& out);
+Result<SuccessType> Decode(json::StreamReader& r, Moniker& out);
+bool Matches(const json::Value& v, const Moniker*);
+bool Matches(json::StreamReader& r, const Moniker*);
 Result<const json::Value*> Encode(const Moniker& in, json::Builder& b);
+Result<SuccessType> Encode(const Moniker& in, json::StreamWriter& w);
 
 bool operator==(const MonikerOptions& lhs, const MonikerOptions& rhs);
 bool operator!=(const MonikerOptions& lhs, const MonikerOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, MonikerOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, MonikerOptions& out);
+bool Matches(const json::Value& v, const MonikerOptions*);
+bool Matches(json::StreamReader& r, const MonikerOptions*);
 Result<const json::Value*> Encode(const MonikerOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const MonikerOptions& in, json::StreamWriter& w);
 
 bool operator==(const MonikerRegistrationOptions& lhs, const MonikerRegistrationOptions& rhs);
 bool operator!=(const MonikerRegistrationOptions& lhs, const MonikerRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, MonikerRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, MonikerRegistrationOptions& out);
+bool Matches(const json::Value& v, const MonikerRegistrationOptions*);
+bool Matches(json::StreamReader& r, const MonikerRegistrationOptions*);
 Result<const json::Value*> Encode(const MonikerRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const MonikerRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const TypeHierarchyPrepareParams& lhs, const TypeHierarchyPrepareParams& rhs);
 bool operator!=(const TypeHierarchyPrepareParams& lhs, const TypeHierarchyPrepareParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, TypeHierarchyPrepareParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, TypeHierarchyPrepareParams& out);
+bool Matches(const json::Value& v, const TypeHierarchyPrepareParams*);
+bool Matches(json::StreamReader& r, const TypeHierarchyPrepareParams*);
 Result<const json::Value*> Encode(const TypeHierarchyPrepareParams& in, json::Builder& b);
+Result<SuccessType> Encode(const TypeHierarchyPrepareParams& in, json::StreamWriter& w);
 
 bool operator==(const TypeHierarchyItem& lhs, const TypeHierarchyItem& rhs);
 bool operator!=(const TypeHierarchyItem& lhs, const TypeHierarchyItem& rhs);
 Result<SuccessType> Decode(const json::Value& v, TypeHierarchyItem& out);
+Result<SuccessType> Decode(json::StreamReader& r, TypeHierarchyItem& out);
+bool Matches(const json::Value& v, const TypeHierarchyItem*);
+bool Matches(json::StreamReader& r, const TypeHierarchyItem*);
 Result<const json::Value*> Encode(const TypeHierarchyItem& in, json::Builder& b);
+Result<SuccessType> Encode(const TypeHierarchyItem& in, json::StreamWriter& w);
 
 bool operator==(const TypeHierarchyOptions& lhs, const TypeHierarchyOptions& rhs);
 bool operator!=(const TypeHierarchyOptions& lhs, const TypeHierarchyOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, TypeHierarchyOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, TypeHierarchyOptions& out);
+bool Matches(const json::Value& v, const TypeHierarchyOptions*);
+bool Matches(json::StreamReader& r, const TypeHierarchyOptions*);
 Result<const json::Value*> Encode(const TypeHierarchyOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const TypeHierarchyOptions& in, json::StreamWriter& w);
 
 bool operator==(const TypeHierarchyRegistrationOptions& lhs,
                 const TypeHierarchyRegistrationOptions& rhs);
 bool operator!=(const TypeHierarchyRegistrationOptions& lhs,
                 const TypeHierarchyRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, TypeHierarchyRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, TypeHierarchyRegistrationOptions& out);
+bool Matches(const json::Value& v, const TypeHierarchyRegistrationOptions*);
+bool Matches(json::StreamReader& r, const TypeHierarchyRegistrationOptions*);
 Result<const json::Value*> Encode(const TypeHierarchyRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const TypeHierarchyRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const TypeHierarchySupertypesParams& lhs, const TypeHierarchySupertypesParams& rhs);
 bool operator!=(const TypeHierarchySupertypesParams& lhs, const TypeHierarchySupertypesParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, TypeHierarchySupertypesParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, TypeHierarchySupertypesParams& out);
+bool Matches(const json::Value& v, const TypeHierarchySupertypesParams*);
+bool Matches(json::StreamReader& r, const TypeHierarchySupertypesParams*);
 Result<const json::Value*> Encode(const TypeHierarchySupertypesParams& in, json::Builder& b);
+Result<SuccessType> Encode(const TypeHierarchySupertypesParams& in, json::StreamWriter& w);
 
 bool operator==(const TypeHierarchySubtypesParams& lhs, const TypeHierarchySubtypesParams& rhs);
 bool operator!=(const TypeHierarchySubtypesParams& lhs, const TypeHierarchySubtypesParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, TypeHierarchySubtypesParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, TypeHierarchySubtypesParams& out);
+bool Matches(const json::Value& v, const TypeHierarchySubtypesParams*);
+bool Matches(json::StreamReader& r, const TypeHierarchySubtypesParams*);
 Result<const json::Value*> Encode(const TypeHierarchySubtypesParams& in, json::Builder& b);
+Result<SuccessType> Encode(const TypeHierarchySubtypesParams& in, json::StreamWriter& w);
 
 bool operator==(const InlineValueContext& lhs, const InlineValueContext& rhs);
 bool operator!=(const InlineValueContext& lhs, const InlineValueContext& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineValueContext& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineValueContext& out);
+bool Matches(const json::Value& v, const InlineValueContext*);
+bool Matches(json::StreamReader& r, const InlineValueContext*);
 Result<const json::Value*> Encode(const InlineValueContext& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineValueContext& in, json::StreamWriter& w);
 
 bool operator==(const InlineValueParams& lhs, const InlineValueParams& rhs);
 bool operator!=(const InlineValueParams& lhs, const InlineValueParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineValueParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineValueParams& out);
+bool Matches(const json::Value& v, const InlineValueParams*);
+bool Matches(json::StreamReader& r, const InlineValueParams*);
 Result<const json::Value*> Encode(const InlineValueParams& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineValueParams& in, json::StreamWriter& w);
 
 bool operator==(const InlineValueOptions& lhs, const InlineValueOptions& rhs);
 bool operator!=(const InlineValueOptions& lhs, const InlineValueOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineValueOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineValueOptions& out);
+bool Matches(const json::Value& v, const InlineValueOptions*);
+bool Matches(json::StreamReader& r, const InlineValueOptions*);
 Result<const json::Value*> Encode(const InlineValueOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineValueOptions& in, json::StreamWriter& w);
 
 bool operator==(const InlineValueRegistrationOptions& lhs,
                 const InlineValueRegistrationOptions& rhs);
 bool operator!=(const InlineValueRegistrationOptions& lhs,
                 const InlineValueRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineValueRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineValueRegistrationOptions& out);
+bool Matches(const json::Value& v, const InlineValueRegistrationOptions*);
+bool Matches(json::StreamReader& r, const InlineValueRegistrationOptions*);
 Result<const json::Value*> Encode(const InlineValueRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineValueRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const InlayHintParams& lhs, const InlayHintParams& rhs);
 bool operator!=(const InlayHintParams& lhs, const InlayHintParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlayHintParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlayHintParams& out);
+bool Matches(const json::Value& v, const InlayHintParams*);
+bool Matches(json::StreamReader& r, const InlayHintParams*);
 Result<const json::Value*> Encode(const InlayHintParams& in, json::Builder& b);
+Result<SuccessType> Encode(const InlayHintParams& in, json::StreamWriter& w);
 
 bool operator==(const MarkupContent& lhs, const MarkupContent& rhs);
 bool operator!=(const MarkupContent& lhs, const MarkupContent& rhs);
 Result<SuccessType> Decode(const json::Value& v, MarkupContent& out);
+Result<SuccessType> Decode(json::StreamReader& r, MarkupContent& out);
+bool Matches(const json::Value& v, const MarkupContent*);
+bool Matches(json::StreamReader& r, const MarkupContent*);
 Result<const json::Value*> Encode(const MarkupContent& in, json::Builder& b);
+Result<SuccessType> Encode(const MarkupContent& in, json::StreamWriter& w);
 
 bool operator==(const Command& lhs, const Command& rhs);
 bool operator!=(const Command& lhs, const Command& rhs);
 Result<SuccessType> Decode(const json::Value& v, Command& out);
+Result<SuccessType> Decode(json::StreamReader& r, Command& out);
+bool Matches(const json::Value& v, const Command*);
+bool Matches(json::StreamReader& r, const Command*);
 Result<const json::Value*> Encode(const Command& in, json::Builder& b);
+Result<SuccessType> Encode(const Command& in, json::StreamWriter& w);
 
 bool operator==(const InlayHintLabelPart& lhs, const InlayHintLabelPart& rhs);
 bool operator!=(const InlayHintLabelPart& lhs, const InlayHintLabelPart& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlayHintLabelPart& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlayHintLabelPart& out);
+bool Matches(const json::Value& v, const InlayHintLabelPart*);
+bool Matches(json::StreamReader& r, const InlayHintLabelPart*);
 Result<const json::Value*> Encode(const InlayHintLabelPart& in, json::Builder& b);
+Result<SuccessType> Encode(const InlayHintLabelPart& in, json::StreamWriter& w);
 
 bool operator==(const InlayHint& lhs, const InlayHint& rhs);
 bool operator!=(const InlayHint& lhs, const InlayHint& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlayHint& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlayHint& out);
+bool Matches(const json::Value& v, const InlayHint*);
+bool Matches(json::StreamReader& r, const InlayHint*);
 Result<const json::Value*> Encode(const InlayHint& in, json::Builder& b);
+Result<SuccessType> Encode(const InlayHint& in, json::StreamWriter& w);
 
 bool operator==(const InlayHintOptions& lhs, const InlayHintOptions& rhs);
 bool operator!=(const InlayHintOptions& lhs, const InlayHintOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlayHintOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlayHintOptions& out);
+bool Matches(const json::Value& v, const InlayHintOptions*);
+bool Matches(json::StreamReader& r, const InlayHintOptions*);
 Result<const json::Value*> Encode(const InlayHintOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const InlayHintOptions& in, json::StreamWriter& w);
 
 bool operator==(const InlayHintRegistrationOptions& lhs, const InlayHintRegistrationOptions& rhs);
 bool operator!=(const InlayHintRegistrationOptions& lhs, const InlayHintRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlayHintRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlayHintRegistrationOptions& out);
+bool Matches(const json::Value& v, const InlayHintRegistrationOptions*);
+bool Matches(json::StreamReader& r, const InlayHintRegistrationOptions*);
 Result<const json::Value*> Encode(const InlayHintRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const InlayHintRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const DocumentDiagnosticParams& lhs, const DocumentDiagnosticParams& rhs);
 bool operator!=(const DocumentDiagnosticParams& lhs, const DocumentDiagnosticParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentDiagnosticParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentDiagnosticParams& out);
+bool Matches(const json::Value& v, const DocumentDiagnosticParams*);
+bool Matches(json::StreamReader& r, const DocumentDiagnosticParams*);
 Result<const json::Value*> Encode(const DocumentDiagnosticParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentDiagnosticParams& in, json::StreamWriter& w);
 
 bool operator==(const UnchangedDocumentDiagnosticReport& lhs,
                 const UnchangedDocumentDiagnosticReport& rhs);
 bool operator!=(const UnchangedDocumentDiagnosticReport& lhs,
                 const UnchangedDocumentDiagnosticReport& rhs);
 Result<SuccessType> Decode(const json::Value& v, UnchangedDocumentDiagnosticReport& out);
+Result<SuccessType> Decode(json::StreamReader& r, UnchangedDocumentDiagnosticReport& out);
+bool Matches(const json::Value& v, const UnchangedDocumentDiagnosticReport*);
+bool Matches(json::StreamReader& r, const UnchangedDocumentDiagnosticReport*);
 Result<const json::Value*> Encode(const UnchangedDocumentDiagnosticReport& in, json::Builder& b);
+Result<SuccessType> Encode(const UnchangedDocumentDiagnosticReport& in, json::StreamWriter& w);
 
 bool operator==(const CodeDescription& lhs, const CodeDescription& rhs);
 bool operator!=(const CodeDescription& lhs, const CodeDescription& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeDescription& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeDescription& out);
+bool Matches(const json::Value& v, const CodeDescription*);
+bool Matches(json::StreamReader& r, const CodeDescription*);
 Result<const json::Value*> Encode(const CodeDescription& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeDescription& in, json::StreamWriter& w);
 
 bool operator==(const DiagnosticRelatedInformation& lhs, const DiagnosticRelatedInformation& rhs);
 bool operator!=(const DiagnosticRelatedInformation& lhs, const DiagnosticRelatedInformation& rhs);
 Result<SuccessType> Decode(const json::Value& v, DiagnosticRelatedInformation& out);
+Result<SuccessType> Decode(json::StreamReader& r, DiagnosticRelatedInformation& out);
+bool Matches(const json::Value& v, const DiagnosticRelatedInformation*);
+bool Matches(json::StreamReader& r, const DiagnosticRelatedInformation*);
 Result<const json::Value*> Encode(const DiagnosticRelatedInformation& in, json::Builder& b);
+Result<SuccessType> Encode(const DiagnosticRelatedInformation& in, json::StreamWriter& w);
 
 bool operator==(const Diagnostic& lhs, const Diagnostic& rhs);
 bool operator!=(const Diagnostic& lhs, const Diagnostic& rhs);
 Result<SuccessType> Decode(const json::Value& v, Diagnostic& out);
+Result<SuccessType> Decode(json::StreamReader& r, Diagnostic& out);
+bool Matches(const json::Value& v, const Diagnostic*);
+bool Matches(json::StreamReader& r, const Diagnostic*);
 Result<const json::Value*> Encode(const Diagnostic& in, json::Builder& b);
+Result<SuccessType> Encode(const Diagnostic& in, json::StreamWriter& w);
 
 bool operator==(const FullDocumentDiagnosticReport& lhs, const FullDocumentDiagnosticReport& rhs);
 bool operator!=(const FullDocumentDiagnosticReport& lhs, const FullDocumentDiagnosticReport& rhs);
 Result<SuccessType> Decode(const json::Value& v, FullDocumentDiagnosticReport& out);
+Result<SuccessType> Decode(json::StreamReader& r, FullDocumentDiagnosticReport& out);
+bool Matches(const json::Value& v, const FullDocumentDiagnosticReport*);
+bool Matches(json::StreamReader& r, const FullDocumentDiagnosticReport*);
 Result<const json::Value*> Encode(const FullDocumentDiagnosticReport& in, json::Builder& b);
+Result<SuccessType> Encode(const FullDocumentDiagnosticReport& in, json::StreamWriter& w);
 
 bool operator==(const DocumentDiagnosticReportPartialResult& lhs,
                 const DocumentDiagnosticReportPartialResult& rhs);
 bool operator!=(const DocumentDiagnosticReportPartialResult& lhs,
                 const DocumentDiagnosticReportPartialResult& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentDiagnosticReportPartialResult& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentDiagnosticReportPartialResult& out);
+bool Matches(const json::Value& v, const DocumentDiagnosticReportPartialResult*);
+bool Matches(json::StreamReader& r, const DocumentDiagnosticReportPartialResult*);
 Result<const json::Value*> Encode(const DocumentDiagnosticReportPartialResult& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const DocumentDiagnosticReportPartialResult& in, json::StreamWriter& w);
 
 bool operator==(const DiagnosticServerCancellationData& lhs,
                 const DiagnosticServerCancellationData& rhs);
 bool operator!=(const DiagnosticServerCancellationData& lhs,
                 const DiagnosticServerCancellationData& rhs);
 Result<SuccessType> Decode(const json::Value& v, DiagnosticServerCancellationData& out);
+Result<SuccessType> Decode(json::StreamReader& r, DiagnosticServerCancellationData& out);
+bool Matches(const json::Value& v, const DiagnosticServerCancellationData*);
+bool Matches(json::StreamReader& r, const DiagnosticServerCancellationData*);
 Result<const json::Value*> Encode(const DiagnosticServerCancellationData& in, json::Builder& b);
+Result<SuccessType> Encode(const DiagnosticServerCancellationData& in, json::StreamWriter& w);
 
 bool operator==(const DiagnosticOptions& lhs, const DiagnosticOptions& rhs);
 bool operator!=(const DiagnosticOptions& lhs, const DiagnosticOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DiagnosticOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DiagnosticOptions& out);
+bool Matches(const json::Value& v, const DiagnosticOptions*);
+bool Matches(json::StreamReader& r, const DiagnosticOptions*);
 Result<const json::Value*> Encode(const DiagnosticOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DiagnosticOptions& in, json::StreamWriter& w);
 
 bool operator==(const DiagnosticRegistrationOptions& lhs, const DiagnosticRegistrationOptions& rhs);
 bool operator!=(const DiagnosticRegistrationOptions& lhs, const DiagnosticRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DiagnosticRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DiagnosticRegistrationOptions& out);
+bool Matches(const json::Value& v, const DiagnosticRegistrationOptions*);
+bool Matches(json::StreamReader& r, const DiagnosticRegistrationOptions*);
 Result<const json::Value*> Encode(const DiagnosticRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DiagnosticRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const PreviousResultId& lhs, const PreviousResultId& rhs);
 bool operator!=(const PreviousResultId& lhs, const PreviousResultId& rhs);
 Result<SuccessType> Decode(const json::Value& v, PreviousResultId& out);
+Result<SuccessType> Decode(json::StreamReader& r, PreviousResultId& out);
+bool Matches(const json::Value& v, const PreviousResultId*);
+bool Matches(json::StreamReader& r, const PreviousResultId*);
 Result<const json::Value*> Encode(const PreviousResultId& in, json::Builder& b);
+Result<SuccessType> Encode(const PreviousResultId& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceDiagnosticParams& lhs, const WorkspaceDiagnosticParams& rhs);
 bool operator!=(const WorkspaceDiagnosticParams& lhs, const WorkspaceDiagnosticParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceDiagnosticParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceDiagnosticParams& out);
+bool Matches(const json::Value& v, const WorkspaceDiagnosticParams*);
+bool Matches(json::StreamReader& r, const WorkspaceDiagnosticParams*);
 Result<const json::Value*> Encode(const WorkspaceDiagnosticParams& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceDiagnosticParams& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceDiagnosticReport& lhs, const WorkspaceDiagnosticReport& rhs);
 bool operator!=(const WorkspaceDiagnosticReport& lhs, const WorkspaceDiagnosticReport& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceDiagnosticReport& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceDiagnosticReport& out);
+bool Matches(const json::Value& v, const WorkspaceDiagnosticReport*);
+bool Matches(json::StreamReader& r, const WorkspaceDiagnosticReport*);
 Result<const json::Value*> Encode(const WorkspaceDiagnosticReport& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceDiagnosticReport& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceDiagnosticReportPartialResult& lhs,
                 const WorkspaceDiagnosticReportPartialResult& rhs);
 bool operator!=(const WorkspaceDiagnosticReportPartialResult& lhs,
                 const WorkspaceDiagnosticReportPartialResult& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceDiagnosticReportPartialResult& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceDiagnosticReportPartialResult& out);
+bool Matches(const json::Value& v, const WorkspaceDiagnosticReportPartialResult*);
+bool Matches(json::StreamReader& r, const WorkspaceDiagnosticReportPartialResult*);
 Result<const json::Value*> Encode(const WorkspaceDiagnosticReportPartialResult& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceDiagnosticReportPartialResult& in, json::StreamWriter& w);
 
 bool operator==(const ExecutionSummary& lhs, const ExecutionSummary& rhs);
 bool operator!=(const ExecutionSummary& lhs, const ExecutionSummary& rhs);
 Result<SuccessType> Decode(const json::Value& v, ExecutionSummary& out);
+Result<SuccessType> Decode(json::StreamReader& r, ExecutionSummary& out);
+bool Matches(const json::Value& v, const ExecutionSummary*);
+bool Matches(json::StreamReader& r, const ExecutionSummary*);
 Result<const json::Value*> Encode(const ExecutionSummary& in, json::Builder& b);
+Result<SuccessType> Encode(const ExecutionSummary& in, json::StreamWriter& w);
 
 bool operator==(const NotebookCell& lhs, const NotebookCell& rhs);
 bool operator!=(const NotebookCell& lhs, const NotebookCell& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookCell& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookCell& out);
+bool Matches(const json::Value& v, const NotebookCell*);
+bool Matches(json::StreamReader& r, const NotebookCell*);
 Result<const json::Value*> Encode(const NotebookCell& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookCell& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocument& lhs, const NotebookDocument& rhs);
 bool operator!=(const NotebookDocument& lhs, const NotebookDocument& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocument& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocument& out);
+bool Matches(const json::Value& v, const NotebookDocument*);
+bool Matches(json::StreamReader& r, const NotebookDocument*);
 Result<const json::Value*> Encode(const NotebookDocument& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocument& in, json::StreamWriter& w);
 
 bool operator==(const TextDocumentItem& lhs, const TextDocumentItem& rhs);
 bool operator!=(const TextDocumentItem& lhs, const TextDocumentItem& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentItem& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentItem& out);
+bool Matches(const json::Value& v, const TextDocumentItem*);
+bool Matches(json::StreamReader& r, const TextDocumentItem*);
 Result<const json::Value*> Encode(const TextDocumentItem& in, json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentItem& in, json::StreamWriter& w);
 
 bool operator==(const DidOpenNotebookDocumentParams& lhs, const DidOpenNotebookDocumentParams& rhs);
 bool operator!=(const DidOpenNotebookDocumentParams& lhs, const DidOpenNotebookDocumentParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidOpenNotebookDocumentParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidOpenNotebookDocumentParams& out);
+bool Matches(const json::Value& v, const DidOpenNotebookDocumentParams*);
+bool Matches(json::StreamReader& r, const DidOpenNotebookDocumentParams*);
 Result<const json::Value*> Encode(const DidOpenNotebookDocumentParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DidOpenNotebookDocumentParams& in, json::StreamWriter& w);
 
 bool operator==(const VersionedNotebookDocumentIdentifier& lhs,
                 const VersionedNotebookDocumentIdentifier& rhs);
 bool operator!=(const VersionedNotebookDocumentIdentifier& lhs,
                 const VersionedNotebookDocumentIdentifier& rhs);
 Result<SuccessType> Decode(const json::Value& v, VersionedNotebookDocumentIdentifier& out);
+Result<SuccessType> Decode(json::StreamReader& r, VersionedNotebookDocumentIdentifier& out);
+bool Matches(const json::Value& v, const VersionedNotebookDocumentIdentifier*);
+bool Matches(json::StreamReader& r, const VersionedNotebookDocumentIdentifier*);
 Result<const json::Value*> Encode(const VersionedNotebookDocumentIdentifier& in, json::Builder& b);
+Result<SuccessType> Encode(const VersionedNotebookDocumentIdentifier& in, json::StreamWriter& w);
 
 bool operator==(const NotebookCellArrayChange& lhs, const NotebookCellArrayChange& rhs);
 bool operator!=(const NotebookCellArrayChange& lhs, const NotebookCellArrayChange& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookCellArrayChange& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookCellArrayChange& out);
+bool Matches(const json::Value& v, const NotebookCellArrayChange*);
+bool Matches(json::StreamReader& r, const NotebookCellArrayChange*);
 Result<const json::Value*> Encode(const NotebookCellArrayChange& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookCellArrayChange& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentCellChangeStructure& lhs,
                 const NotebookDocumentCellChangeStructure& rhs);
 bool operator!=(const NotebookDocumentCellChangeStructure& lhs,
                 const NotebookDocumentCellChangeStructure& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentCellChangeStructure& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentCellChangeStructure& out);
+bool Matches(const json::Value& v, const NotebookDocumentCellChangeStructure*);
+bool Matches(json::StreamReader& r, const NotebookDocumentCellChangeStructure*);
 Result<const json::Value*> Encode(const NotebookDocumentCellChangeStructure& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentCellChangeStructure& in, json::StreamWriter& w);
 
 bool operator==(const VersionedTextDocumentIdentifier& lhs,
                 const VersionedTextDocumentIdentifier& rhs);
 bool operator!=(const VersionedTextDocumentIdentifier& lhs,
                 const VersionedTextDocumentIdentifier& rhs);
 Result<SuccessType> Decode(const json::Value& v, VersionedTextDocumentIdentifier& out);
+Result<SuccessType> Decode(json::StreamReader& r, VersionedTextDocumentIdentifier& out);
+bool Matches(const json::Value& v, const VersionedTextDocumentIdentifier*);
+bool Matches(json::StreamReader& r, const VersionedTextDocumentIdentifier*);
 Result<const json::Value*> Encode(const VersionedTextDocumentIdentifier& in, json::Builder& b);
+Result<SuccessType> Encode(const VersionedTextDocumentIdentifier& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentCellContentChanges& lhs,
                 const NotebookDocumentCellContentChanges& rhs);
 bool operator!=(const NotebookDocumentCellContentChanges& lhs,
                 const NotebookDocumentCellContentChanges& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentCellContentChanges& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentCellContentChanges& out);
+bool Matches(const json::Value& v, const NotebookDocumentCellContentChanges*);
+bool Matches(json::StreamReader& r, const NotebookDocumentCellContentChanges*);
 Result<const json::Value*> Encode(const NotebookDocumentCellContentChanges& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentCellContentChanges& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentCellChanges& lhs, const NotebookDocumentCellChanges& rhs);
 bool operator!=(const NotebookDocumentCellChanges& lhs, const NotebookDocumentCellChanges& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentCellChanges& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentCellChanges& out);
+bool Matches(const json::Value& v, const NotebookDocumentCellChanges*);
+bool Matches(json::StreamReader& r, const NotebookDocumentCellChanges*);
 Result<const json::Value*> Encode(const NotebookDocumentCellChanges& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentCellChanges& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentChangeEvent& lhs, const NotebookDocumentChangeEvent& rhs);
 bool operator!=(const NotebookDocumentChangeEvent& lhs, const NotebookDocumentChangeEvent& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentChangeEvent& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentChangeEvent& out);
+bool Matches(const json::Value& v, const NotebookDocumentChangeEvent*);
+bool Matches(json::StreamReader& r, const NotebookDocumentChangeEvent*);
 Result<const json::Value*> Encode(const NotebookDocumentChangeEvent& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentChangeEvent& in, json::StreamWriter& w);
 
 bool operator==(const DidChangeNotebookDocumentParams& lhs,
                 const DidChangeNotebookDocumentParams& rhs);
 bool operator!=(const DidChangeNotebookDocumentParams& lhs,
                 const DidChangeNotebookDocumentParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidChangeNotebookDocumentParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidChangeNotebookDocumentParams& out);
+bool Matches(const json::Value& v, const DidChangeNotebookDocumentParams*);
+bool Matches(json::StreamReader& r, const DidChangeNotebookDocumentParams*);
 Result<const json::Value*> Encode(const DidChangeNotebookDocumentParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DidChangeNotebookDocumentParams& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentIdentifier& lhs, const NotebookDocumentIdentifier& rhs);
 bool operator!=(const NotebookDocumentIdentifier& lhs, const NotebookDocumentIdentifier& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentIdentifier& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentIdentifier& out);
+bool Matches(const json::Value& v, const NotebookDocumentIdentifier*);
+bool Matches(json::StreamReader& r, const NotebookDocumentIdentifier*);
 Result<const json::Value*> Encode(const NotebookDocumentIdentifier& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentIdentifier& in, json::StreamWriter& w);
 
 bool operator==(const DidSaveNotebookDocumentParams& lhs, const DidSaveNotebookDocumentParams& rhs);
 bool operator!=(const DidSaveNotebookDocumentParams& lhs, const DidSaveNotebookDocumentParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidSaveNotebookDocumentParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidSaveNotebookDocumentParams& out);
+bool Matches(const json::Value& v, const DidSaveNotebookDocumentParams*);
+bool Matches(json::StreamReader& r, const DidSaveNotebookDocumentParams*);
 Result<const json::Value*> Encode(const DidSaveNotebookDocumentParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DidSaveNotebookDocumentParams& in, json::StreamWriter& w);
 
 bool operator==(const DidCloseNotebookDocumentParams& lhs,
                 const DidCloseNotebookDocumentParams& rhs);
 bool operator!=(const DidCloseNotebookDocumentParams& lhs,
                 const DidCloseNotebookDocumentParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidCloseNotebookDocumentParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidCloseNotebookDocumentParams& out);
+bool Matches(const json::Value& v, const DidCloseNotebookDocumentParams*);
+bool Matches(json::StreamReader& r, const DidCloseNotebookDocumentParams*);
 Result<const json::Value*> Encode(const DidCloseNotebookDocumentParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DidCloseNotebookDocumentParams& in, json::StreamWriter& w);
 
 bool operator==(const SelectedCompletionInfo& lhs, const SelectedCompletionInfo& rhs);
 bool operator!=(const SelectedCompletionInfo& lhs, const SelectedCompletionInfo& rhs);
 Result<SuccessType> Decode(const json::Value& v, SelectedCompletionInfo& out);
+Result<SuccessType> Decode(json::StreamReader& r, SelectedCompletionInfo& out);
+bool Matches(const json::Value& v, const SelectedCompletionInfo*);
+bool Matches(json::StreamReader& r, const SelectedCompletionInfo*);
 Result<const json::Value*> Encode(const SelectedCompletionInfo& in, json::Builder& b);
+Result<SuccessType> Encode(const SelectedCompletionInfo& in, json::StreamWriter& w);
 
 bool operator==(const InlineCompletionContext& lhs, const InlineCompletionContext& rhs);
 bool operator!=(const InlineCompletionContext& lhs, const InlineCompletionContext& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineCompletionContext& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineCompletionContext& out);
+bool Matches(const json::Value& v, const InlineCompletionContext*);
+bool Matches(json::StreamReader& r, const InlineCompletionContext*);
 Result<const json::Value*> Encode(const InlineCompletionContext& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineCompletionContext& in, json::StreamWriter& w);
 
 bool operator==(const InlineCompletionParams& lhs, const InlineCompletionParams& rhs);
 bool operator!=(const InlineCompletionParams& lhs, const InlineCompletionParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineCompletionParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineCompletionParams& out);
+bool Matches(const json::Value& v, const InlineCompletionParams*);
+bool Matches(json::StreamReader& r, const InlineCompletionParams*);
 Result<const json::Value*> Encode(const InlineCompletionParams& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineCompletionParams& in, json::StreamWriter& w);
 
 bool operator==(const StringValue& lhs, const StringValue& rhs);
 bool operator!=(const StringValue& lhs, const StringValue& rhs);
 Result<SuccessType> Decode(const json::Value& v, StringValue& out);
+Result<SuccessType> Decode(json::StreamReader& r, StringValue& out);
+bool Matches(const json::Value& v, const StringValue*);
+bool Matches(json::StreamReader& r, const StringValue*);
 Result<const json::Value*> Encode(const StringValue& in, json::Builder& b);
+Result<SuccessType> Encode(const StringValue& in, json::StreamWriter& w);
 
 bool operator==(const InlineCompletionItem& lhs, const InlineCompletionItem& rhs);
 bool operator!=(const InlineCompletionItem& lhs, const InlineCompletionItem& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineCompletionItem& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineCompletionItem& out);
+bool Matches(const json::Value& v, const InlineCompletionItem*);
+bool Matches(json::StreamReader& r, const InlineCompletionItem*);
 Result<const json::Value*> Encode(const InlineCompletionItem& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineCompletionItem& in, json::StreamWriter& w);
 
 bool operator==(const InlineCompletionList& lhs, const InlineCompletionList& rhs);
 bool operator!=(const InlineCompletionList& lhs, const InlineCompletionList& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineCompletionList& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineCompletionList& out);
+bool Matches(const json::Value& v, const InlineCompletionList*);
+bool Matches(json::StreamReader& r, const InlineCompletionList*);
 Result<const json::Value*> Encode(const InlineCompletionList& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineCompletionList& in, json::StreamWriter& w);
 
 bool operator==(const InlineCompletionOptions& lhs, const InlineCompletionOptions& rhs);
 bool operator!=(const InlineCompletionOptions& lhs, const InlineCompletionOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineCompletionOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineCompletionOptions& out);
+bool Matches(const json::Value& v, const InlineCompletionOptions*);
+bool Matches(json::StreamReader& r, const InlineCompletionOptions*);
 Result<const json::Value*> Encode(const InlineCompletionOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineCompletionOptions& in, json::StreamWriter& w);
 
 bool operator==(const InlineCompletionRegistrationOptions& lhs,
                 const InlineCompletionRegistrationOptions& rhs);
 bool operator!=(const InlineCompletionRegistrationOptions& lhs,
                 const InlineCompletionRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineCompletionRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineCompletionRegistrationOptions& out);
+bool Matches(const json::Value& v, const InlineCompletionRegistrationOptions*);
+bool Matches(json::StreamReader& r, const InlineCompletionRegistrationOptions*);
 Result<const json::Value*> Encode(const InlineCompletionRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineCompletionRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const Registration& lhs, const Registration& rhs);
 bool operator!=(const Registration& lhs, const Registration& rhs);
 Result<SuccessType> Decode(const json::Value& v, Registration& out);
+Result<SuccessType> Decode(json::StreamReader& r, Registration& out);
+bool Matches(const json::Value& v, const Registration*);
+bool Matches(json::StreamReader& r, const Registration*);
 Result<const json::Value*> Encode(const Registration& in, json::Builder& b);
+Result<SuccessType> Encode(const Registration& in, json::StreamWriter& w);
 
 bool operator==(const RegistrationParams& lhs, const RegistrationParams& rhs);
 bool operator!=(const RegistrationParams& lhs, const RegistrationParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, RegistrationParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, RegistrationParams& out);
+bool Matches(const json::Value& v, const RegistrationParams*);
+bool Matches(json::StreamReader& r, const RegistrationParams*);
 Result<const json::Value*> Encode(const RegistrationParams& in, json::Builder& b);
+Result<SuccessType> Encode(const RegistrationParams& in, json::StreamWriter& w);
 
 bool operator==(const Unregistration& lhs, const Unregistration& rhs);
 bool operator!=(const Unregistration& lhs, const Unregistration& rhs);
 Result<SuccessType> Decode(const json::Value& v, Unregistration& out);
+Result<SuccessType> Decode(json::StreamReader& r, Unregistration& out);
+bool Matches(const json::Value& v, const Unregistration*);
+bool Matches(json::StreamReader& r, const Unregistration*);
 Result<const json::Value*> Encode(const Unregistration& in, json::Builder& b);
+Result<SuccessType> Encode(const Unregistration& in, json::StreamWriter& w);
 
 bool operator==(const UnregistrationParams& lhs, const UnregistrationParams& rhs);
 bool operator!=(const UnregistrationParams& lhs, const UnregistrationParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, UnregistrationParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, UnregistrationParams& out);
+bool Matches(const json::Value& v, const UnregistrationParams*);
+bool Matches(json::StreamReader& r, const UnregistrationParams*);
 Result<const json::Value*> Encode(const UnregistrationParams& in, json::Builder& b);
+Result<SuccessType> Encode(const UnregistrationParams& in, json::StreamWriter& w);
 
 bool operator==(const ClientInfo& lhs, const ClientInfo& rhs);
 bool operator!=(const ClientInfo& lhs, const ClientInfo& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientInfo& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientInfo& out);
+bool Matches(const json::Value& v, const ClientInfo*);
+bool Matches(json::StreamReader& r, const ClientInfo*);
 Result<const json::Value*> Encode(const ClientInfo& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientInfo& in, json::StreamWriter& w);
 
 bool operator==(const ChangeAnnotationsSupportOptions& lhs,
                 const ChangeAnnotationsSupportOptions& rhs);
 bool operator!=(const ChangeAnnotationsSupportOptions& lhs,
                 const ChangeAnnotationsSupportOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ChangeAnnotationsSupportOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ChangeAnnotationsSupportOptions& out);
+bool Matches(const json::Value& v, const ChangeAnnotationsSupportOptions*);
+bool Matches(json::StreamReader& r, const ChangeAnnotationsSupportOptions*);
 Result<const json::Value*> Encode(const ChangeAnnotationsSupportOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ChangeAnnotationsSupportOptions& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceEditClientCapabilities& lhs,
                 const WorkspaceEditClientCapabilities& rhs);
 bool operator!=(const WorkspaceEditClientCapabilities& lhs,
                 const WorkspaceEditClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceEditClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceEditClientCapabilities& out);
+bool Matches(const json::Value& v, const WorkspaceEditClientCapabilities*);
+bool Matches(json::StreamReader& r, const WorkspaceEditClientCapabilities*);
 Result<const json::Value*> Encode(const WorkspaceEditClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceEditClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const DidChangeConfigurationClientCapabilities& lhs,
                 const DidChangeConfigurationClientCapabilities& rhs);
 bool operator!=(const DidChangeConfigurationClientCapabilities& lhs,
                 const DidChangeConfigurationClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidChangeConfigurationClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidChangeConfigurationClientCapabilities& out);
+bool Matches(const json::Value& v, const DidChangeConfigurationClientCapabilities*);
+bool Matches(json::StreamReader& r, const DidChangeConfigurationClientCapabilities*);
 Result<const json::Value*> Encode(const DidChangeConfigurationClientCapabilities& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const DidChangeConfigurationClientCapabilities& in,
+                           json::StreamWriter& w);
 
 bool operator==(const DidChangeWatchedFilesClientCapabilities& lhs,
                 const DidChangeWatchedFilesClientCapabilities& rhs);
 bool operator!=(const DidChangeWatchedFilesClientCapabilities& lhs,
                 const DidChangeWatchedFilesClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidChangeWatchedFilesClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidChangeWatchedFilesClientCapabilities& out);
+bool Matches(const json::Value& v, const DidChangeWatchedFilesClientCapabilities*);
+bool Matches(json::StreamReader& r, const DidChangeWatchedFilesClientCapabilities*);
 Result<const json::Value*> Encode(const DidChangeWatchedFilesClientCapabilities& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const DidChangeWatchedFilesClientCapabilities& in,
+                           json::StreamWriter& w);
 
 bool operator==(const ClientSymbolKindOptions& lhs, const ClientSymbolKindOptions& rhs);
 bool operator!=(const ClientSymbolKindOptions& lhs, const ClientSymbolKindOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientSymbolKindOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientSymbolKindOptions& out);
+bool Matches(const json::Value& v, const ClientSymbolKindOptions*);
+bool Matches(json::StreamReader& r, const ClientSymbolKindOptions*);
 Result<const json::Value*> Encode(const ClientSymbolKindOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientSymbolKindOptions& in, json::StreamWriter& w);
 
 bool operator==(const ClientSymbolTagOptions& lhs, const ClientSymbolTagOptions& rhs);
 bool operator!=(const ClientSymbolTagOptions& lhs, const ClientSymbolTagOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientSymbolTagOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientSymbolTagOptions& out);
+bool Matches(const json::Value& v, const ClientSymbolTagOptions*);
+bool Matches(json::StreamReader& r, const ClientSymbolTagOptions*);
 Result<const json::Value*> Encode(const ClientSymbolTagOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientSymbolTagOptions& in, json::StreamWriter& w);
 
 bool operator==(const ClientSymbolResolveOptions& lhs, const ClientSymbolResolveOptions& rhs);
 bool operator!=(const ClientSymbolResolveOptions& lhs, const ClientSymbolResolveOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientSymbolResolveOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientSymbolResolveOptions& out);
+bool Matches(const json::Value& v, const ClientSymbolResolveOptions*);
+bool Matches(json::StreamReader& r, const ClientSymbolResolveOptions*);
 Result<const json::Value*> Encode(const ClientSymbolResolveOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientSymbolResolveOptions& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceSymbolClientCapabilities& lhs,
                 const WorkspaceSymbolClientCapabilities& rhs);
 bool operator!=(const WorkspaceSymbolClientCapabilities& lhs,
                 const WorkspaceSymbolClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceSymbolClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceSymbolClientCapabilities& out);
+bool Matches(const json::Value& v, const WorkspaceSymbolClientCapabilities*);
+bool Matches(json::StreamReader& r, const WorkspaceSymbolClientCapabilities*);
 Result<const json::Value*> Encode(const WorkspaceSymbolClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceSymbolClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const ExecuteCommandClientCapabilities& lhs,
                 const ExecuteCommandClientCapabilities& rhs);
 bool operator!=(const ExecuteCommandClientCapabilities& lhs,
                 const ExecuteCommandClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, ExecuteCommandClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, ExecuteCommandClientCapabilities& out);
+bool Matches(const json::Value& v, const ExecuteCommandClientCapabilities*);
+bool Matches(json::StreamReader& r, const ExecuteCommandClientCapabilities*);
 Result<const json::Value*> Encode(const ExecuteCommandClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const ExecuteCommandClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const SemanticTokensWorkspaceClientCapabilities& lhs,
                 const SemanticTokensWorkspaceClientCapabilities& rhs);
 bool operator!=(const SemanticTokensWorkspaceClientCapabilities& lhs,
                 const SemanticTokensWorkspaceClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensWorkspaceClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensWorkspaceClientCapabilities& out);
+bool Matches(const json::Value& v, const SemanticTokensWorkspaceClientCapabilities*);
+bool Matches(json::StreamReader& r, const SemanticTokensWorkspaceClientCapabilities*);
 Result<const json::Value*> Encode(const SemanticTokensWorkspaceClientCapabilities& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensWorkspaceClientCapabilities& in,
+                           json::StreamWriter& w);
 
 bool operator==(const CodeLensWorkspaceClientCapabilities& lhs,
                 const CodeLensWorkspaceClientCapabilities& rhs);
 bool operator!=(const CodeLensWorkspaceClientCapabilities& lhs,
                 const CodeLensWorkspaceClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeLensWorkspaceClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeLensWorkspaceClientCapabilities& out);
+bool Matches(const json::Value& v, const CodeLensWorkspaceClientCapabilities*);
+bool Matches(json::StreamReader& r, const CodeLensWorkspaceClientCapabilities*);
 Result<const json::Value*> Encode(const CodeLensWorkspaceClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeLensWorkspaceClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const FileOperationClientCapabilities& lhs,
                 const FileOperationClientCapabilities& rhs);
 bool operator!=(const FileOperationClientCapabilities& lhs,
                 const FileOperationClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, FileOperationClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, FileOperationClientCapabilities& out);
+bool Matches(const json::Value& v, const FileOperationClientCapabilities*);
+bool Matches(json::StreamReader& r, const FileOperationClientCapabilities*);
 Result<const json::Value*> Encode(const FileOperationClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const FileOperationClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const InlineValueWorkspaceClientCapabilities& lhs,
                 const InlineValueWorkspaceClientCapabilities& rhs);
 bool operator!=(const InlineValueWorkspaceClientCapabilities& lhs,
                 const InlineValueWorkspaceClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineValueWorkspaceClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineValueWorkspaceClientCapabilities& out);
+bool Matches(const json::Value& v, const InlineValueWorkspaceClientCapabilities*);
+bool Matches(json::StreamReader& r, const InlineValueWorkspaceClientCapabilities*);
 Result<const json::Value*> Encode(const InlineValueWorkspaceClientCapabilities& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const InlineValueWorkspaceClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const InlayHintWorkspaceClientCapabilities& lhs,
                 const InlayHintWorkspaceClientCapabilities& rhs);
 bool operator!=(const InlayHintWorkspaceClientCapabilities& lhs,
                 const InlayHintWorkspaceClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlayHintWorkspaceClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlayHintWorkspaceClientCapabilities& out);
+bool Matches(const json::Value& v, const InlayHintWorkspaceClientCapabilities*);
+bool Matches(json::StreamReader& r, const InlayHintWorkspaceClientCapabilities*);
 Result<const json::Value*> Encode(const InlayHintWorkspaceClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const InlayHintWorkspaceClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const DiagnosticWorkspaceClientCapabilities& lhs,
                 const DiagnosticWorkspaceClientCapabilities& rhs);
 bool operator!=(const DiagnosticWorkspaceClientCapabilities& lhs,
                 const DiagnosticWorkspaceClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, DiagnosticWorkspaceClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, DiagnosticWorkspaceClientCapabilities& out);
+bool Matches(const json::Value& v, const DiagnosticWorkspaceClientCapabilities*);
+bool Matches(json::StreamReader& r, const DiagnosticWorkspaceClientCapabilities*);
 Result<const json::Value*> Encode(const DiagnosticWorkspaceClientCapabilities& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const DiagnosticWorkspaceClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const FoldingRangeWorkspaceClientCapabilities& lhs,
                 const FoldingRangeWorkspaceClientCapabilities& rhs);
 bool operator!=(const FoldingRangeWorkspaceClientCapabilities& lhs,
                 const FoldingRangeWorkspaceClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, FoldingRangeWorkspaceClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, FoldingRangeWorkspaceClientCapabilities& out);
+bool Matches(const json::Value& v, const FoldingRangeWorkspaceClientCapabilities*);
+bool Matches(json::StreamReader& r, const FoldingRangeWorkspaceClientCapabilities*);
 Result<const json::Value*> Encode(const FoldingRangeWorkspaceClientCapabilities& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const FoldingRangeWorkspaceClientCapabilities& in,
+                           json::StreamWriter& w);
 
 bool operator==(const WorkspaceClientCapabilities& lhs, const WorkspaceClientCapabilities& rhs);
 bool operator!=(const WorkspaceClientCapabilities& lhs, const WorkspaceClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceClientCapabilities& out);
+bool Matches(const json::Value& v, const WorkspaceClientCapabilities*);
+bool Matches(json::StreamReader& r, const WorkspaceClientCapabilities*);
 Result<const json::Value*> Encode(const WorkspaceClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const TextDocumentSyncClientCapabilities& lhs,
                 const TextDocumentSyncClientCapabilities& rhs);
 bool operator!=(const TextDocumentSyncClientCapabilities& lhs,
                 const TextDocumentSyncClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentSyncClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentSyncClientCapabilities& out);
+bool Matches(const json::Value& v, const TextDocumentSyncClientCapabilities*);
+bool Matches(json::StreamReader& r, const TextDocumentSyncClientCapabilities*);
 Result<const json::Value*> Encode(const TextDocumentSyncClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentSyncClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const CompletionItemTagOptions& lhs, const CompletionItemTagOptions& rhs);
 bool operator!=(const CompletionItemTagOptions& lhs, const CompletionItemTagOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, CompletionItemTagOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionItemTagOptions& out);
+bool Matches(const json::Value& v, const CompletionItemTagOptions*);
+bool Matches(json::StreamReader& r, const CompletionItemTagOptions*);
 Result<const json::Value*> Encode(const CompletionItemTagOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const CompletionItemTagOptions& in, json::StreamWriter& w);
 
 bool operator==(const ClientCompletionItemResolveOptions& lhs,
                 const ClientCompletionItemResolveOptions& rhs);
 bool operator!=(const ClientCompletionItemResolveOptions& lhs,
                 const ClientCompletionItemResolveOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientCompletionItemResolveOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientCompletionItemResolveOptions& out);
+bool Matches(const json::Value& v, const ClientCompletionItemResolveOptions*);
+bool Matches(json::StreamReader& r, const ClientCompletionItemResolveOptions*);
 Result<const json::Value*> Encode(const ClientCompletionItemResolveOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientCompletionItemResolveOptions& in, json::StreamWriter& w);
 
 bool operator==(const ClientCompletionItemInsertTextModeOptions& lhs,
                 const ClientCompletionItemInsertTextModeOptions& rhs);
 bool operator!=(const ClientCompletionItemInsertTextModeOptions& lhs,
                 const ClientCompletionItemInsertTextModeOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientCompletionItemInsertTextModeOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientCompletionItemInsertTextModeOptions& out);
+bool Matches(const json::Value& v, const ClientCompletionItemInsertTextModeOptions*);
+bool Matches(json::StreamReader& r, const ClientCompletionItemInsertTextModeOptions*);
 Result<const json::Value*> Encode(const ClientCompletionItemInsertTextModeOptions& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const ClientCompletionItemInsertTextModeOptions& in,
+                           json::StreamWriter& w);
 
 bool operator==(const ClientCompletionItemOptions& lhs, const ClientCompletionItemOptions& rhs);
 bool operator!=(const ClientCompletionItemOptions& lhs, const ClientCompletionItemOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientCompletionItemOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientCompletionItemOptions& out);
+bool Matches(const json::Value& v, const ClientCompletionItemOptions*);
+bool Matches(json::StreamReader& r, const ClientCompletionItemOptions*);
 Result<const json::Value*> Encode(const ClientCompletionItemOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientCompletionItemOptions& in, json::StreamWriter& w);
 
 bool operator==(const ClientCompletionItemOptionsKind& lhs,
                 const ClientCompletionItemOptionsKind& rhs);
 bool operator!=(const ClientCompletionItemOptionsKind& lhs,
                 const ClientCompletionItemOptionsKind& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientCompletionItemOptionsKind& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientCompletionItemOptionsKind& out);
+bool Matches(const json::Value& v, const ClientCompletionItemOptionsKind*);
+bool Matches(json::StreamReader& r, const ClientCompletionItemOptionsKind*);
 Result<const json::Value*> Encode(const ClientCompletionItemOptionsKind& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientCompletionItemOptionsKind& in, json::StreamWriter& w);
 
 bool operator==(const CompletionListCapabilities& lhs, const CompletionListCapabilities& rhs);
 bool operator!=(const CompletionListCapabilities& lhs, const CompletionListCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, CompletionListCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionListCapabilities& out);
+bool Matches(const json::Value& v, const CompletionListCapabilities*);
+bool Matches(json::StreamReader& r, const CompletionListCapabilities*);
 Result<const json::Value*> Encode(const CompletionListCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const CompletionListCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const CompletionClientCapabilities& lhs, const CompletionClientCapabilities& rhs);
 bool operator!=(const CompletionClientCapabilities& lhs, const CompletionClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, CompletionClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionClientCapabilities& out);
+bool Matches(const json::Value& v, const CompletionClientCapabilities*);
+bool Matches(json::StreamReader& r, const CompletionClientCapabilities*);
 Result<const json::Value*> Encode(const CompletionClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const CompletionClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const HoverClientCapabilities& lhs, const HoverClientCapabilities& rhs);
 bool operator!=(const HoverClientCapabilities& lhs, const HoverClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, HoverClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, HoverClientCapabilities& out);
+bool Matches(const json::Value& v, const HoverClientCapabilities*);
+bool Matches(json::StreamReader& r, const HoverClientCapabilities*);
 Result<const json::Value*> Encode(const HoverClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const HoverClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const ClientSignatureParameterInformationOptions& lhs,
                 const ClientSignatureParameterInformationOptions& rhs);
 bool operator!=(const ClientSignatureParameterInformationOptions& lhs,
                 const ClientSignatureParameterInformationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientSignatureParameterInformationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientSignatureParameterInformationOptions& out);
+bool Matches(const json::Value& v, const ClientSignatureParameterInformationOptions*);
+bool Matches(json::StreamReader& r, const ClientSignatureParameterInformationOptions*);
 Result<const json::Value*> Encode(const ClientSignatureParameterInformationOptions& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const ClientSignatureParameterInformationOptions& in,
+                           json::StreamWriter& w);
 
 bool operator==(const ClientSignatureInformationOptions& lhs,
                 const ClientSignatureInformationOptions& rhs);
 bool operator!=(const ClientSignatureInformationOptions& lhs,
                 const ClientSignatureInformationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientSignatureInformationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientSignatureInformationOptions& out);
+bool Matches(const json::Value& v, const ClientSignatureInformationOptions*);
+bool Matches(json::StreamReader& r, const ClientSignatureInformationOptions*);
 Result<const json::Value*> Encode(const ClientSignatureInformationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientSignatureInformationOptions& in, json::StreamWriter& w);
 
 bool operator==(const SignatureHelpClientCapabilities& lhs,
                 const SignatureHelpClientCapabilities& rhs);
 bool operator!=(const SignatureHelpClientCapabilities& lhs,
                 const SignatureHelpClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, SignatureHelpClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, SignatureHelpClientCapabilities& out);
+bool Matches(const json::Value& v, const SignatureHelpClientCapabilities*);
+bool Matches(json::StreamReader& r, const SignatureHelpClientCapabilities*);
 Result<const json::Value*> Encode(const SignatureHelpClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const SignatureHelpClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const DeclarationClientCapabilities& lhs, const DeclarationClientCapabilities& rhs);
 bool operator!=(const DeclarationClientCapabilities& lhs, const DeclarationClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, DeclarationClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, DeclarationClientCapabilities& out);
+bool Matches(const json::Value& v, const DeclarationClientCapabilities*);
+bool Matches(json::StreamReader& r, const DeclarationClientCapabilities*);
 Result<const json::Value*> Encode(const DeclarationClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const DeclarationClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const DefinitionClientCapabilities& lhs, const DefinitionClientCapabilities& rhs);
 bool operator!=(const DefinitionClientCapabilities& lhs, const DefinitionClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, DefinitionClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, DefinitionClientCapabilities& out);
+bool Matches(const json::Value& v, const DefinitionClientCapabilities*);
+bool Matches(json::StreamReader& r, const DefinitionClientCapabilities*);
 Result<const json::Value*> Encode(const DefinitionClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const DefinitionClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const TypeDefinitionClientCapabilities& lhs,
                 const TypeDefinitionClientCapabilities& rhs);
 bool operator!=(const TypeDefinitionClientCapabilities& lhs,
                 const TypeDefinitionClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, TypeDefinitionClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, TypeDefinitionClientCapabilities& out);
+bool Matches(const json::Value& v, const TypeDefinitionClientCapabilities*);
+bool Matches(json::StreamReader& r, const TypeDefinitionClientCapabilities*);
 Result<const json::Value*> Encode(const TypeDefinitionClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const TypeDefinitionClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const ImplementationClientCapabilities& lhs,
                 const ImplementationClientCapabilities& rhs);
 bool operator!=(const ImplementationClientCapabilities& lhs,
                 const ImplementationClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, ImplementationClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, ImplementationClientCapabilities& out);
+bool Matches(const json::Value& v, const ImplementationClientCapabilities*);
+bool Matches(json::StreamReader& r, const ImplementationClientCapabilities*);
 Result<const json::Value*> Encode(const ImplementationClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const ImplementationClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const ReferenceClientCapabilities& lhs, const ReferenceClientCapabilities& rhs);
 bool operator!=(const ReferenceClientCapabilities& lhs, const ReferenceClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, ReferenceClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, ReferenceClientCapabilities& out);
+bool Matches(const json::Value& v, const ReferenceClientCapabilities*);
+bool Matches(json::StreamReader& r, const ReferenceClientCapabilities*);
 Result<const json::Value*> Encode(const ReferenceClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const ReferenceClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const DocumentHighlightClientCapabilities& lhs,
                 const DocumentHighlightClientCapabilities& rhs);
 bool operator!=(const DocumentHighlightClientCapabilities& lhs,
                 const DocumentHighlightClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentHighlightClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentHighlightClientCapabilities& out);
+bool Matches(const json::Value& v, const DocumentHighlightClientCapabilities*);
+bool Matches(json::StreamReader& r, const DocumentHighlightClientCapabilities*);
 Result<const json::Value*> Encode(const DocumentHighlightClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentHighlightClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const DocumentSymbolClientCapabilities& lhs,
                 const DocumentSymbolClientCapabilities& rhs);
 bool operator!=(const DocumentSymbolClientCapabilities& lhs,
                 const DocumentSymbolClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentSymbolClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentSymbolClientCapabilities& out);
+bool Matches(const json::Value& v, const DocumentSymbolClientCapabilities*);
+bool Matches(json::StreamReader& r, const DocumentSymbolClientCapabilities*);
 Result<const json::Value*> Encode(const DocumentSymbolClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentSymbolClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const ClientCodeActionKindOptions& lhs, const ClientCodeActionKindOptions& rhs);
 bool operator!=(const ClientCodeActionKindOptions& lhs, const ClientCodeActionKindOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientCodeActionKindOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientCodeActionKindOptions& out);
+bool Matches(const json::Value& v, const ClientCodeActionKindOptions*);
+bool Matches(json::StreamReader& r, const ClientCodeActionKindOptions*);
 Result<const json::Value*> Encode(const ClientCodeActionKindOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientCodeActionKindOptions& in, json::StreamWriter& w);
 
 bool operator==(const ClientCodeActionLiteralOptions& lhs,
                 const ClientCodeActionLiteralOptions& rhs);
 bool operator!=(const ClientCodeActionLiteralOptions& lhs,
                 const ClientCodeActionLiteralOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientCodeActionLiteralOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientCodeActionLiteralOptions& out);
+bool Matches(const json::Value& v, const ClientCodeActionLiteralOptions*);
+bool Matches(json::StreamReader& r, const ClientCodeActionLiteralOptions*);
 Result<const json::Value*> Encode(const ClientCodeActionLiteralOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientCodeActionLiteralOptions& in, json::StreamWriter& w);
 
 bool operator==(const ClientCodeActionResolveOptions& lhs,
                 const ClientCodeActionResolveOptions& rhs);
 bool operator!=(const ClientCodeActionResolveOptions& lhs,
                 const ClientCodeActionResolveOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientCodeActionResolveOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientCodeActionResolveOptions& out);
+bool Matches(const json::Value& v, const ClientCodeActionResolveOptions*);
+bool Matches(json::StreamReader& r, const ClientCodeActionResolveOptions*);
 Result<const json::Value*> Encode(const ClientCodeActionResolveOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientCodeActionResolveOptions& in, json::StreamWriter& w);
 
 bool operator==(const CodeActionClientCapabilities& lhs, const CodeActionClientCapabilities& rhs);
 bool operator!=(const CodeActionClientCapabilities& lhs, const CodeActionClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeActionClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeActionClientCapabilities& out);
+bool Matches(const json::Value& v, const CodeActionClientCapabilities*);
+bool Matches(json::StreamReader& r, const CodeActionClientCapabilities*);
 Result<const json::Value*> Encode(const CodeActionClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeActionClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const CodeLensClientCapabilities& lhs, const CodeLensClientCapabilities& rhs);
 bool operator!=(const CodeLensClientCapabilities& lhs, const CodeLensClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeLensClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeLensClientCapabilities& out);
+bool Matches(const json::Value& v, const CodeLensClientCapabilities*);
+bool Matches(json::StreamReader& r, const CodeLensClientCapabilities*);
 Result<const json::Value*> Encode(const CodeLensClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeLensClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const DocumentLinkClientCapabilities& lhs,
                 const DocumentLinkClientCapabilities& rhs);
 bool operator!=(const DocumentLinkClientCapabilities& lhs,
                 const DocumentLinkClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentLinkClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentLinkClientCapabilities& out);
+bool Matches(const json::Value& v, const DocumentLinkClientCapabilities*);
+bool Matches(json::StreamReader& r, const DocumentLinkClientCapabilities*);
 Result<const json::Value*> Encode(const DocumentLinkClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentLinkClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const DocumentColorClientCapabilities& lhs,
                 const DocumentColorClientCapabilities& rhs);
 bool operator!=(const DocumentColorClientCapabilities& lhs,
                 const DocumentColorClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentColorClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentColorClientCapabilities& out);
+bool Matches(const json::Value& v, const DocumentColorClientCapabilities*);
+bool Matches(json::StreamReader& r, const DocumentColorClientCapabilities*);
 Result<const json::Value*> Encode(const DocumentColorClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentColorClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const DocumentFormattingClientCapabilities& lhs,
                 const DocumentFormattingClientCapabilities& rhs);
 bool operator!=(const DocumentFormattingClientCapabilities& lhs,
                 const DocumentFormattingClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentFormattingClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentFormattingClientCapabilities& out);
+bool Matches(const json::Value& v, const DocumentFormattingClientCapabilities*);
+bool Matches(json::StreamReader& r, const DocumentFormattingClientCapabilities*);
 Result<const json::Value*> Encode(const DocumentFormattingClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentFormattingClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const DocumentRangeFormattingClientCapabilities& lhs,
                 const DocumentRangeFormattingClientCapabilities& rhs);
 bool operator!=(const DocumentRangeFormattingClientCapabilities& lhs,
                 const DocumentRangeFormattingClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentRangeFormattingClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentRangeFormattingClientCapabilities& out);
+bool Matches(const json::Value& v, const DocumentRangeFormattingClientCapabilities*);
+bool Matches(json::StreamReader& r, const DocumentRangeFormattingClientCapabilities*);
 Result<const json::Value*> Encode(const DocumentRangeFormattingClientCapabilities& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const DocumentRangeFormattingClientCapabilities& in,
+                           json::StreamWriter& w);
 
 bool operator==(const DocumentOnTypeFormattingClientCapabilities& lhs,
                 const DocumentOnTypeFormattingClientCapabilities& rhs);
 bool operator!=(const DocumentOnTypeFormattingClientCapabilities& lhs,
                 const DocumentOnTypeFormattingClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentOnTypeFormattingClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentOnTypeFormattingClientCapabilities& out);
+bool Matches(const json::Value& v, const DocumentOnTypeFormattingClientCapabilities*);
+bool Matches(json::StreamReader& r, const DocumentOnTypeFormattingClientCapabilities*);
 Result<const json::Value*> Encode(const DocumentOnTypeFormattingClientCapabilities& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const DocumentOnTypeFormattingClientCapabilities& in,
+                           json::StreamWriter& w);
 
 bool operator==(const RenameClientCapabilities& lhs, const RenameClientCapabilities& rhs);
 bool operator!=(const RenameClientCapabilities& lhs, const RenameClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, RenameClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, RenameClientCapabilities& out);
+bool Matches(const json::Value& v, const RenameClientCapabilities*);
+bool Matches(json::StreamReader& r, const RenameClientCapabilities*);
 Result<const json::Value*> Encode(const RenameClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const RenameClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const ClientFoldingRangeKindOptions& lhs, const ClientFoldingRangeKindOptions& rhs);
 bool operator!=(const ClientFoldingRangeKindOptions& lhs, const ClientFoldingRangeKindOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientFoldingRangeKindOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientFoldingRangeKindOptions& out);
+bool Matches(const json::Value& v, const ClientFoldingRangeKindOptions*);
+bool Matches(json::StreamReader& r, const ClientFoldingRangeKindOptions*);
 Result<const json::Value*> Encode(const ClientFoldingRangeKindOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientFoldingRangeKindOptions& in, json::StreamWriter& w);
 
 bool operator==(const ClientFoldingRangeOptions& lhs, const ClientFoldingRangeOptions& rhs);
 bool operator!=(const ClientFoldingRangeOptions& lhs, const ClientFoldingRangeOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientFoldingRangeOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientFoldingRangeOptions& out);
+bool Matches(const json::Value& v, const ClientFoldingRangeOptions*);
+bool Matches(json::StreamReader& r, const ClientFoldingRangeOptions*);
 Result<const json::Value*> Encode(const ClientFoldingRangeOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientFoldingRangeOptions& in, json::StreamWriter& w);
 
 bool operator==(const FoldingRangeClientCapabilities& lhs,
                 const FoldingRangeClientCapabilities& rhs);
 bool operator!=(const FoldingRangeClientCapabilities& lhs,
                 const FoldingRangeClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, FoldingRangeClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, FoldingRangeClientCapabilities& out);
+bool Matches(const json::Value& v, const FoldingRangeClientCapabilities*);
+bool Matches(json::StreamReader& r, const FoldingRangeClientCapabilities*);
 Result<const json::Value*> Encode(const FoldingRangeClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const FoldingRangeClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const SelectionRangeClientCapabilities& lhs,
                 const SelectionRangeClientCapabilities& rhs);
 bool operator!=(const SelectionRangeClientCapabilities& lhs,
                 const SelectionRangeClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, SelectionRangeClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, SelectionRangeClientCapabilities& out);
+bool Matches(const json::Value& v, const SelectionRangeClientCapabilities*);
+bool Matches(json::StreamReader& r, const SelectionRangeClientCapabilities*);
 Result<const json::Value*> Encode(const SelectionRangeClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const SelectionRangeClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const ClientDiagnosticsTagOptions& lhs, const ClientDiagnosticsTagOptions& rhs);
 bool operator!=(const ClientDiagnosticsTagOptions& lhs, const ClientDiagnosticsTagOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientDiagnosticsTagOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientDiagnosticsTagOptions& out);
+bool Matches(const json::Value& v, const ClientDiagnosticsTagOptions*);
+bool Matches(json::StreamReader& r, const ClientDiagnosticsTagOptions*);
 Result<const json::Value*> Encode(const ClientDiagnosticsTagOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientDiagnosticsTagOptions& in, json::StreamWriter& w);
 
 bool operator==(const PublishDiagnosticsClientCapabilities& lhs,
                 const PublishDiagnosticsClientCapabilities& rhs);
 bool operator!=(const PublishDiagnosticsClientCapabilities& lhs,
                 const PublishDiagnosticsClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, PublishDiagnosticsClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, PublishDiagnosticsClientCapabilities& out);
+bool Matches(const json::Value& v, const PublishDiagnosticsClientCapabilities*);
+bool Matches(json::StreamReader& r, const PublishDiagnosticsClientCapabilities*);
 Result<const json::Value*> Encode(const PublishDiagnosticsClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const PublishDiagnosticsClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const CallHierarchyClientCapabilities& lhs,
                 const CallHierarchyClientCapabilities& rhs);
 bool operator!=(const CallHierarchyClientCapabilities& lhs,
                 const CallHierarchyClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, CallHierarchyClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, CallHierarchyClientCapabilities& out);
+bool Matches(const json::Value& v, const CallHierarchyClientCapabilities*);
+bool Matches(json::StreamReader& r, const CallHierarchyClientCapabilities*);
 Result<const json::Value*> Encode(const CallHierarchyClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const CallHierarchyClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const ClientSemanticTokensRequestFullDelta& lhs,
                 const ClientSemanticTokensRequestFullDelta& rhs);
 bool operator!=(const ClientSemanticTokensRequestFullDelta& lhs,
                 const ClientSemanticTokensRequestFullDelta& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientSemanticTokensRequestFullDelta& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientSemanticTokensRequestFullDelta& out);
+bool Matches(const json::Value& v, const ClientSemanticTokensRequestFullDelta*);
+bool Matches(json::StreamReader& r, const ClientSemanticTokensRequestFullDelta*);
 Result<const json::Value*> Encode(const ClientSemanticTokensRequestFullDelta& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientSemanticTokensRequestFullDelta& in, json::StreamWriter& w);
 
 bool operator==(const ClientSemanticTokensRequestOptions& lhs,
                 const ClientSemanticTokensRequestOptions& rhs);
 bool operator!=(const ClientSemanticTokensRequestOptions& lhs,
                 const ClientSemanticTokensRequestOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientSemanticTokensRequestOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientSemanticTokensRequestOptions& out);
+bool Matches(const json::Value& v, const ClientSemanticTokensRequestOptions*);
+bool Matches(json::StreamReader& r, const ClientSemanticTokensRequestOptions*);
 Result<const json::Value*> Encode(const ClientSemanticTokensRequestOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientSemanticTokensRequestOptions& in, json::StreamWriter& w);
 bool operator==(const ClientSemanticTokensRequestOptions::Range& lhs,
                 const ClientSemanticTokensRequestOptions::Range& rhs);
 bool operator!=(const ClientSemanticTokensRequestOptions::Range& lhs,
                 const ClientSemanticTokensRequestOptions::Range& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientSemanticTokensRequestOptions::Range& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientSemanticTokensRequestOptions::Range& out);
+bool Matches(const json::Value& v, const ClientSemanticTokensRequestOptions::Range*);
+bool Matches(json::StreamReader& r, const ClientSemanticTokensRequestOptions::Range*);
 Result<const json::Value*> Encode(const ClientSemanticTokensRequestOptions::Range& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const ClientSemanticTokensRequestOptions::Range& in,
+                           json::StreamWriter& w);
 
 bool operator==(const SemanticTokensClientCapabilities& lhs,
                 const SemanticTokensClientCapabilities& rhs);
 bool operator!=(const SemanticTokensClientCapabilities& lhs,
                 const SemanticTokensClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, SemanticTokensClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, SemanticTokensClientCapabilities& out);
+bool Matches(const json::Value& v, const SemanticTokensClientCapabilities*);
+bool Matches(json::StreamReader& r, const SemanticTokensClientCapabilities*);
 Result<const json::Value*> Encode(const SemanticTokensClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const SemanticTokensClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const LinkedEditingRangeClientCapabilities& lhs,
                 const LinkedEditingRangeClientCapabilities& rhs);
 bool operator!=(const LinkedEditingRangeClientCapabilities& lhs,
                 const LinkedEditingRangeClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, LinkedEditingRangeClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, LinkedEditingRangeClientCapabilities& out);
+bool Matches(const json::Value& v, const LinkedEditingRangeClientCapabilities*);
+bool Matches(json::StreamReader& r, const LinkedEditingRangeClientCapabilities*);
 Result<const json::Value*> Encode(const LinkedEditingRangeClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const LinkedEditingRangeClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const MonikerClientCapabilities& lhs, const MonikerClientCapabilities& rhs);
 bool operator!=(const MonikerClientCapabilities& lhs, const MonikerClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, MonikerClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, MonikerClientCapabilities& out);
+bool Matches(const json::Value& v, const MonikerClientCapabilities*);
+bool Matches(json::StreamReader& r, const MonikerClientCapabilities*);
 Result<const json::Value*> Encode(const MonikerClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const MonikerClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const TypeHierarchyClientCapabilities& lhs,
                 const TypeHierarchyClientCapabilities& rhs);
 bool operator!=(const TypeHierarchyClientCapabilities& lhs,
                 const TypeHierarchyClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, TypeHierarchyClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, TypeHierarchyClientCapabilities& out);
+bool Matches(const json::Value& v, const TypeHierarchyClientCapabilities*);
+bool Matches(json::StreamReader& r, const TypeHierarchyClientCapabilities*);
 Result<const json::Value*> Encode(const TypeHierarchyClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const TypeHierarchyClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const InlineValueClientCapabilities& lhs, const InlineValueClientCapabilities& rhs);
 bool operator!=(const InlineValueClientCapabilities& lhs, const InlineValueClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineValueClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineValueClientCapabilities& out);
+bool Matches(const json::Value& v, const InlineValueClientCapabilities*);
+bool Matches(json::StreamReader& r, const InlineValueClientCapabilities*);
 Result<const json::Value*> Encode(const InlineValueClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineValueClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const ClientInlayHintResolveOptions& lhs, const ClientInlayHintResolveOptions& rhs);
 bool operator!=(const ClientInlayHintResolveOptions& lhs, const ClientInlayHintResolveOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientInlayHintResolveOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientInlayHintResolveOptions& out);
+bool Matches(const json::Value& v, const ClientInlayHintResolveOptions*);
+bool Matches(json::StreamReader& r, const ClientInlayHintResolveOptions*);
 Result<const json::Value*> Encode(const ClientInlayHintResolveOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientInlayHintResolveOptions& in, json::StreamWriter& w);
 
 bool operator==(const InlayHintClientCapabilities& lhs, const InlayHintClientCapabilities& rhs);
 bool operator!=(const InlayHintClientCapabilities& lhs, const InlayHintClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlayHintClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlayHintClientCapabilities& out);
+bool Matches(const json::Value& v, const InlayHintClientCapabilities*);
+bool Matches(json::StreamReader& r, const InlayHintClientCapabilities*);
 Result<const json::Value*> Encode(const InlayHintClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const InlayHintClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const DiagnosticClientCapabilities& lhs, const DiagnosticClientCapabilities& rhs);
 bool operator!=(const DiagnosticClientCapabilities& lhs, const DiagnosticClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, DiagnosticClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, DiagnosticClientCapabilities& out);
+bool Matches(const json::Value& v, const DiagnosticClientCapabilities*);
+bool Matches(json::StreamReader& r, const DiagnosticClientCapabilities*);
 Result<const json::Value*> Encode(const DiagnosticClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const DiagnosticClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const InlineCompletionClientCapabilities& lhs,
                 const InlineCompletionClientCapabilities& rhs);
 bool operator!=(const InlineCompletionClientCapabilities& lhs,
                 const InlineCompletionClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineCompletionClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineCompletionClientCapabilities& out);
+bool Matches(const json::Value& v, const InlineCompletionClientCapabilities*);
+bool Matches(json::StreamReader& r, const InlineCompletionClientCapabilities*);
 Result<const json::Value*> Encode(const InlineCompletionClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineCompletionClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const TextDocumentClientCapabilities& lhs,
                 const TextDocumentClientCapabilities& rhs);
 bool operator!=(const TextDocumentClientCapabilities& lhs,
                 const TextDocumentClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentClientCapabilities& out);
+bool Matches(const json::Value& v, const TextDocumentClientCapabilities*);
+bool Matches(json::StreamReader& r, const TextDocumentClientCapabilities*);
 Result<const json::Value*> Encode(const TextDocumentClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentSyncClientCapabilities& lhs,
                 const NotebookDocumentSyncClientCapabilities& rhs);
 bool operator!=(const NotebookDocumentSyncClientCapabilities& lhs,
                 const NotebookDocumentSyncClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentSyncClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentSyncClientCapabilities& out);
+bool Matches(const json::Value& v, const NotebookDocumentSyncClientCapabilities*);
+bool Matches(json::StreamReader& r, const NotebookDocumentSyncClientCapabilities*);
 Result<const json::Value*> Encode(const NotebookDocumentSyncClientCapabilities& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentSyncClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentClientCapabilities& lhs,
                 const NotebookDocumentClientCapabilities& rhs);
 bool operator!=(const NotebookDocumentClientCapabilities& lhs,
                 const NotebookDocumentClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentClientCapabilities& out);
+bool Matches(const json::Value& v, const NotebookDocumentClientCapabilities*);
+bool Matches(json::StreamReader& r, const NotebookDocumentClientCapabilities*);
 Result<const json::Value*> Encode(const NotebookDocumentClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const ClientShowMessageActionItemOptions& lhs,
                 const ClientShowMessageActionItemOptions& rhs);
 bool operator!=(const ClientShowMessageActionItemOptions& lhs,
                 const ClientShowMessageActionItemOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientShowMessageActionItemOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientShowMessageActionItemOptions& out);
+bool Matches(const json::Value& v, const ClientShowMessageActionItemOptions*);
+bool Matches(json::StreamReader& r, const ClientShowMessageActionItemOptions*);
 Result<const json::Value*> Encode(const ClientShowMessageActionItemOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientShowMessageActionItemOptions& in, json::StreamWriter& w);
 
 bool operator==(const ShowMessageRequestClientCapabilities& lhs,
                 const ShowMessageRequestClientCapabilities& rhs);
 bool operator!=(const ShowMessageRequestClientCapabilities& lhs,
                 const ShowMessageRequestClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, ShowMessageRequestClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, ShowMessageRequestClientCapabilities& out);
+bool Matches(const json::Value& v, const ShowMessageRequestClientCapabilities*);
+bool Matches(json::StreamReader& r, const ShowMessageRequestClientCapabilities*);
 Result<const json::Value*> Encode(const ShowMessageRequestClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const ShowMessageRequestClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const ShowDocumentClientCapabilities& lhs,
                 const ShowDocumentClientCapabilities& rhs);
 bool operator!=(const ShowDocumentClientCapabilities& lhs,
                 const ShowDocumentClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, ShowDocumentClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, ShowDocumentClientCapabilities& out);
+bool Matches(const json::Value& v, const ShowDocumentClientCapabilities*);
+bool Matches(json::StreamReader& r, const ShowDocumentClientCapabilities*);
 Result<const json::Value*> Encode(const ShowDocumentClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const ShowDocumentClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const WindowClientCapabilities& lhs, const WindowClientCapabilities& rhs);
 bool operator!=(const WindowClientCapabilities& lhs, const WindowClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, WindowClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, WindowClientCapabilities& out);
+bool Matches(const json::Value& v, const WindowClientCapabilities*);
+bool Matches(json::StreamReader& r, const WindowClientCapabilities*);
 Result<const json::Value*> Encode(const WindowClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const WindowClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const StaleRequestSupportOptions& lhs, const StaleRequestSupportOptions& rhs);
 bool operator!=(const StaleRequestSupportOptions& lhs, const StaleRequestSupportOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, StaleRequestSupportOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, StaleRequestSupportOptions& out);
+bool Matches(const json::Value& v, const StaleRequestSupportOptions*);
+bool Matches(json::StreamReader& r, const StaleRequestSupportOptions*);
 Result<const json::Value*> Encode(const StaleRequestSupportOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const StaleRequestSupportOptions& in, json::StreamWriter& w);
 
 bool operator==(const RegularExpressionsClientCapabilities& lhs,
                 const RegularExpressionsClientCapabilities& rhs);
 bool operator!=(const RegularExpressionsClientCapabilities& lhs,
                 const RegularExpressionsClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, RegularExpressionsClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, RegularExpressionsClientCapabilities& out);
+bool Matches(const json::Value& v, const RegularExpressionsClientCapabilities*);
+bool Matches(json::StreamReader& r, const RegularExpressionsClientCapabilities*);
 Result<const json::Value*> Encode(const RegularExpressionsClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const RegularExpressionsClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const MarkdownClientCapabilities& lhs, const MarkdownClientCapabilities& rhs);
 bool operator!=(const MarkdownClientCapabilities& lhs, const MarkdownClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, MarkdownClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, MarkdownClientCapabilities& out);
+bool Matches(const json::Value& v, const MarkdownClientCapabilities*);
+bool Matches(json::StreamReader& r, const MarkdownClientCapabilities*);
 Result<const json::Value*> Encode(const MarkdownClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const MarkdownClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const GeneralClientCapabilities& lhs, const GeneralClientCapabilities& rhs);
 bool operator!=(const GeneralClientCapabilities& lhs, const GeneralClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, GeneralClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, GeneralClientCapabilities& out);
+bool Matches(const json::Value& v, const GeneralClientCapabilities*);
+bool Matches(json::StreamReader& r, const GeneralClientCapabilities*);
 Result<const json::Value*> Encode(const GeneralClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const GeneralClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const ClientCapabilities& lhs, const ClientCapabilities& rhs);
 bool operator!=(const ClientCapabilities& lhs, const ClientCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, ClientCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, ClientCapabilities& out);
+bool Matches(const json::Value& v, const ClientCapabilities*);
+bool Matches(json::StreamReader& r, const ClientCapabilities*);
 Result<const json::Value*> Encode(const ClientCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const ClientCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const InitializeParamsBase& lhs, const InitializeParamsBase& rhs);
 bool operator!=(const InitializeParamsBase& lhs, const InitializeParamsBase& rhs);
 Result<SuccessType> Decode(const json::Value& v, InitializeParamsBase& out);
+Result<SuccessType> Decode(json::StreamReader& r, InitializeParamsBase& out);
+bool Matches(const json::Value& v, const InitializeParamsBase*);
+bool Matches(json::StreamReader& r, const InitializeParamsBase*);
 Result<const json::Value*> Encode(const InitializeParamsBase& in, json::Builder& b);
+Result<SuccessType> Encode(const InitializeParamsBase& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceFoldersInitializeParams& lhs,
                 const WorkspaceFoldersInitializeParams& rhs);
 bool operator!=(const WorkspaceFoldersInitializeParams& lhs,
                 const WorkspaceFoldersInitializeParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceFoldersInitializeParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceFoldersInitializeParams& out);
+bool Matches(const json::Value& v, const WorkspaceFoldersInitializeParams*);
+bool Matches(json::StreamReader& r, const WorkspaceFoldersInitializeParams*);
 Result<const json::Value*> Encode(const WorkspaceFoldersInitializeParams& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceFoldersInitializeParams& in, json::StreamWriter& w);
 
 bool operator==(const InitializeParams& lhs, const InitializeParams& rhs);
 bool operator!=(const InitializeParams& lhs, const InitializeParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, InitializeParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, InitializeParams& out);
+bool Matches(const json::Value& v, const InitializeParams*);
+bool Matches(json::StreamReader& r, const InitializeParams*);
 Result<const json::Value*> Encode(const InitializeParams& in, json::Builder& b);
+Result<SuccessType> Encode(const InitializeParams& in, json::StreamWriter& w);
 
 bool operator==(const SaveOptions& lhs, const SaveOptions& rhs);
 bool operator!=(const SaveOptions& lhs, const SaveOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, SaveOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, SaveOptions& out);
+bool Matches(const json::Value& v, const SaveOptions*);
+bool Matches(json::StreamReader& r, const SaveOptions*);
 Result<const json::Value*> Encode(const SaveOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const SaveOptions& in, json::StreamWriter& w);
 
 bool operator==(const TextDocumentSyncOptions& lhs, const TextDocumentSyncOptions& rhs);
 bool operator!=(const TextDocumentSyncOptions& lhs, const TextDocumentSyncOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentSyncOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentSyncOptions& out);
+bool Matches(const json::Value& v, const TextDocumentSyncOptions*);
+bool Matches(json::StreamReader& r, const TextDocumentSyncOptions*);
 Result<const json::Value*> Encode(const TextDocumentSyncOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentSyncOptions& in, json::StreamWriter& w);
 
 bool operator==(const NotebookCellLanguage& lhs, const NotebookCellLanguage& rhs);
 bool operator!=(const NotebookCellLanguage& lhs, const NotebookCellLanguage& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookCellLanguage& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookCellLanguage& out);
+bool Matches(const json::Value& v, const NotebookCellLanguage*);
+bool Matches(json::StreamReader& r, const NotebookCellLanguage*);
 Result<const json::Value*> Encode(const NotebookCellLanguage& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookCellLanguage& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentFilterWithCells& lhs,
                 const NotebookDocumentFilterWithCells& rhs);
 bool operator!=(const NotebookDocumentFilterWithCells& lhs,
                 const NotebookDocumentFilterWithCells& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentFilterWithCells& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentFilterWithCells& out);
+bool Matches(const json::Value& v, const NotebookDocumentFilterWithCells*);
+bool Matches(json::StreamReader& r, const NotebookDocumentFilterWithCells*);
 Result<const json::Value*> Encode(const NotebookDocumentFilterWithCells& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentFilterWithCells& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentFilterWithNotebook& lhs,
                 const NotebookDocumentFilterWithNotebook& rhs);
 bool operator!=(const NotebookDocumentFilterWithNotebook& lhs,
                 const NotebookDocumentFilterWithNotebook& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentFilterWithNotebook& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentFilterWithNotebook& out);
+bool Matches(const json::Value& v, const NotebookDocumentFilterWithNotebook*);
+bool Matches(json::StreamReader& r, const NotebookDocumentFilterWithNotebook*);
 Result<const json::Value*> Encode(const NotebookDocumentFilterWithNotebook& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentFilterWithNotebook& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentSyncOptions& lhs, const NotebookDocumentSyncOptions& rhs);
 bool operator!=(const NotebookDocumentSyncOptions& lhs, const NotebookDocumentSyncOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentSyncOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentSyncOptions& out);
+bool Matches(const json::Value& v, const NotebookDocumentSyncOptions*);
+bool Matches(json::StreamReader& r, const NotebookDocumentSyncOptions*);
 Result<const json::Value*> Encode(const NotebookDocumentSyncOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentSyncOptions& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentSyncRegistrationOptions& lhs,
                 const NotebookDocumentSyncRegistrationOptions& rhs);
 bool operator!=(const NotebookDocumentSyncRegistrationOptions& lhs,
                 const NotebookDocumentSyncRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentSyncRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentSyncRegistrationOptions& out);
+bool Matches(const json::Value& v, const NotebookDocumentSyncRegistrationOptions*);
+bool Matches(json::StreamReader& r, const NotebookDocumentSyncRegistrationOptions*);
 Result<const json::Value*> Encode(const NotebookDocumentSyncRegistrationOptions& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentSyncRegistrationOptions& in,
+                           json::StreamWriter& w);
 
 bool operator==(const ServerCompletionItemOptions& lhs, const ServerCompletionItemOptions& rhs);
 bool operator!=(const ServerCompletionItemOptions& lhs, const ServerCompletionItemOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ServerCompletionItemOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ServerCompletionItemOptions& out);
+bool Matches(const json::Value& v, const ServerCompletionItemOptions*);
+bool Matches(json::StreamReader& r, const ServerCompletionItemOptions*);
 Result<const json::Value*> Encode(const ServerCompletionItemOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ServerCompletionItemOptions& in, json::StreamWriter& w);
 
 bool operator==(const CompletionOptions& lhs, const CompletionOptions& rhs);
 bool operator!=(const CompletionOptions& lhs, const CompletionOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, CompletionOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionOptions& out);
+bool Matches(const json::Value& v, const CompletionOptions*);
+bool Matches(json::StreamReader& r, const CompletionOptions*);
 Result<const json::Value*> Encode(const CompletionOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const CompletionOptions& in, json::StreamWriter& w);
 
 bool operator==(const HoverOptions& lhs, const HoverOptions& rhs);
 bool operator!=(const HoverOptions& lhs, const HoverOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, HoverOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, HoverOptions& out);
+bool Matches(const json::Value& v, const HoverOptions*);
+bool Matches(json::StreamReader& r, const HoverOptions*);
 Result<const json::Value*> Encode(const HoverOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const HoverOptions& in, json::StreamWriter& w);
 
 bool operator==(const SignatureHelpOptions& lhs, const SignatureHelpOptions& rhs);
 bool operator!=(const SignatureHelpOptions& lhs, const SignatureHelpOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, SignatureHelpOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, SignatureHelpOptions& out);
+bool Matches(const json::Value& v, const SignatureHelpOptions*);
+bool Matches(json::StreamReader& r, const SignatureHelpOptions*);
 Result<const json::Value*> Encode(const SignatureHelpOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const SignatureHelpOptions& in, json::StreamWriter& w);
 
 bool operator==(const DefinitionOptions& lhs, const DefinitionOptions& rhs);
 bool operator!=(const DefinitionOptions& lhs, const DefinitionOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DefinitionOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DefinitionOptions& out);
+bool Matches(const json::Value& v, const DefinitionOptions*);
+bool Matches(json::StreamReader& r, const DefinitionOptions*);
 Result<const json::Value*> Encode(const DefinitionOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DefinitionOptions& in, json::StreamWriter& w);
 
 bool operator==(const ReferenceOptions& lhs, const ReferenceOptions& rhs);
 bool operator!=(const ReferenceOptions& lhs, const ReferenceOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ReferenceOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ReferenceOptions& out);
+bool Matches(const json::Value& v, const ReferenceOptions*);
+bool Matches(json::StreamReader& r, const ReferenceOptions*);
 Result<const json::Value*> Encode(const ReferenceOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ReferenceOptions& in, json::StreamWriter& w);
 
 bool operator==(const DocumentHighlightOptions& lhs, const DocumentHighlightOptions& rhs);
 bool operator!=(const DocumentHighlightOptions& lhs, const DocumentHighlightOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentHighlightOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentHighlightOptions& out);
+bool Matches(const json::Value& v, const DocumentHighlightOptions*);
+bool Matches(json::StreamReader& r, const DocumentHighlightOptions*);
 Result<const json::Value*> Encode(const DocumentHighlightOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentHighlightOptions& in, json::StreamWriter& w);
 
 bool operator==(const DocumentSymbolOptions& lhs, const DocumentSymbolOptions& rhs);
 bool operator!=(const DocumentSymbolOptions& lhs, const DocumentSymbolOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentSymbolOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentSymbolOptions& out);
+bool Matches(const json::Value& v, const DocumentSymbolOptions*);
+bool Matches(json::StreamReader& r, const DocumentSymbolOptions*);
 Result<const json::Value*> Encode(const DocumentSymbolOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentSymbolOptions& in, json::StreamWriter& w);
 
 bool operator==(const CodeActionOptions& lhs, const CodeActionOptions& rhs);
 bool operator!=(const CodeActionOptions& lhs, const CodeActionOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeActionOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeActionOptions& out);
+bool Matches(const json::Value& v, const CodeActionOptions*);
+bool Matches(json::StreamReader& r, const CodeActionOptions*);
 Result<const json::Value*> Encode(const CodeActionOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeActionOptions& in, json::StreamWriter& w);
 
 bool operator==(const CodeLensOptions& lhs, const CodeLensOptions& rhs);
 bool operator!=(const CodeLensOptions& lhs, const CodeLensOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeLensOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeLensOptions& out);
+bool Matches(const json::Value& v, const CodeLensOptions*);
+bool Matches(json::StreamReader& r, const CodeLensOptions*);
 Result<const json::Value*> Encode(const CodeLensOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeLensOptions& in, json::StreamWriter& w);
 
 bool operator==(const DocumentLinkOptions& lhs, const DocumentLinkOptions& rhs);
 bool operator!=(const DocumentLinkOptions& lhs, const DocumentLinkOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentLinkOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentLinkOptions& out);
+bool Matches(const json::Value& v, const DocumentLinkOptions*);
+bool Matches(json::StreamReader& r, const DocumentLinkOptions*);
 Result<const json::Value*> Encode(const DocumentLinkOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentLinkOptions& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceSymbolOptions& lhs, const WorkspaceSymbolOptions& rhs);
 bool operator!=(const WorkspaceSymbolOptions& lhs, const WorkspaceSymbolOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceSymbolOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceSymbolOptions& out);
+bool Matches(const json::Value& v, const WorkspaceSymbolOptions*);
+bool Matches(json::StreamReader& r, const WorkspaceSymbolOptions*);
 Result<const json::Value*> Encode(const WorkspaceSymbolOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceSymbolOptions& in, json::StreamWriter& w);
 
 bool operator==(const DocumentFormattingOptions& lhs, const DocumentFormattingOptions& rhs);
 bool operator!=(const DocumentFormattingOptions& lhs, const DocumentFormattingOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentFormattingOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentFormattingOptions& out);
+bool Matches(const json::Value& v, const DocumentFormattingOptions*);
+bool Matches(json::StreamReader& r, const DocumentFormattingOptions*);
 Result<const json::Value*> Encode(const DocumentFormattingOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentFormattingOptions& in, json::StreamWriter& w);
 
 bool operator==(const DocumentRangeFormattingOptions& lhs,
                 const DocumentRangeFormattingOptions& rhs);
 bool operator!=(const DocumentRangeFormattingOptions& lhs,
                 const DocumentRangeFormattingOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentRangeFormattingOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentRangeFormattingOptions& out);
+bool Matches(const json::Value& v, const DocumentRangeFormattingOptions*);
+bool Matches(json::StreamReader& r, const DocumentRangeFormattingOptions*);
 Result<const json::Value*> Encode(const DocumentRangeFormattingOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentRangeFormattingOptions& in, json::StreamWriter& w);
 
 bool operator==(const DocumentOnTypeFormattingOptions& lhs,
                 const DocumentOnTypeFormattingOptions& rhs);
 bool operator!=(const DocumentOnTypeFormattingOptions& lhs,
                 const DocumentOnTypeFormattingOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentOnTypeFormattingOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentOnTypeFormattingOptions& out);
+bool Matches(const json::Value& v, const DocumentOnTypeFormattingOptions*);
+bool Matches(json::StreamReader& r, const DocumentOnTypeFormattingOptions*);
 Result<const json::Value*> Encode(const DocumentOnTypeFormattingOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentOnTypeFormattingOptions& in, json::StreamWriter& w);
 
 bool operator==(const RenameOptions& lhs, const RenameOptions& rhs);
 bool operator!=(const RenameOptions& lhs, const RenameOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, RenameOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, RenameOptions& out);
+bool Matches(const json::Value& v, const RenameOptions*);
+bool Matches(json::StreamReader& r, const RenameOptions*);
 Result<const json::Value*> Encode(const RenameOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const RenameOptions& in, json::StreamWriter& w);
 
 bool operator==(const ExecuteCommandOptions& lhs, const ExecuteCommandOptions& rhs);
 bool operator!=(const ExecuteCommandOptions& lhs, const ExecuteCommandOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ExecuteCommandOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ExecuteCommandOptions& out);
+bool Matches(const json::Value& v, const ExecuteCommandOptions*);
+bool Matches(json::StreamReader& r, const ExecuteCommandOptions*);
 Result<const json::Value*> Encode(const ExecuteCommandOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ExecuteCommandOptions& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceFoldersServerCapabilities& lhs,
                 const WorkspaceFoldersServerCapabilities& rhs);
 bool operator!=(const WorkspaceFoldersServerCapabilities& lhs,
                 const WorkspaceFoldersServerCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceFoldersServerCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceFoldersServerCapabilities& out);
+bool Matches(const json::Value& v, const WorkspaceFoldersServerCapabilities*);
+bool Matches(json::StreamReader& r, const WorkspaceFoldersServerCapabilities*);
 Result<const json::Value*> Encode(const WorkspaceFoldersServerCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceFoldersServerCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const FileOperationOptions& lhs, const FileOperationOptions& rhs);
 bool operator!=(const FileOperationOptions& lhs, const FileOperationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, FileOperationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, FileOperationOptions& out);
+bool Matches(const json::Value& v, const FileOperationOptions*);
+bool Matches(json::StreamReader& r, const FileOperationOptions*);
 Result<const json::Value*> Encode(const FileOperationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const FileOperationOptions& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceOptions& lhs, const WorkspaceOptions& rhs);
 bool operator!=(const WorkspaceOptions& lhs, const WorkspaceOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceOptions& out);
+bool Matches(const json::Value& v, const WorkspaceOptions*);
+bool Matches(json::StreamReader& r, const WorkspaceOptions*);
 Result<const json::Value*> Encode(const WorkspaceOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceOptions& in, json::StreamWriter& w);
 
 bool operator==(const ServerCapabilities& lhs, const ServerCapabilities& rhs);
 bool operator!=(const ServerCapabilities& lhs, const ServerCapabilities& rhs);
 Result<SuccessType> Decode(const json::Value& v, ServerCapabilities& out);
+Result<SuccessType> Decode(json::StreamReader& r, ServerCapabilities& out);
+bool Matches(const json::Value& v, const ServerCapabilities*);
+bool Matches(json::StreamReader& r, const ServerCapabilities*);
 Result<const json::Value*> Encode(const ServerCapabilities& in, json::Builder& b);
+Result<SuccessType> Encode(const ServerCapabilities& in, json::StreamWriter& w);
 
 bool operator==(const ServerInfo& lhs, const ServerInfo& rhs);
 bool operator!=(const ServerInfo& lhs, const ServerInfo& rhs);
 Result<SuccessType> Decode(const json::Value& v, ServerInfo& out);
+Result<SuccessType> Decode(json::StreamReader& r, ServerInfo& out);
+bool Matches(const json::Value& v, const ServerInfo*);
+bool Matches(json::StreamReader& r, const ServerInfo*);
 Result<const json::Value*> Encode(const ServerInfo& in, json::Builder& b);
+Result<SuccessType> Encode(const ServerInfo& in, json::StreamWriter& w);
 
 bool operator==(const InitializeResult& lhs, const InitializeResult& rhs);
 bool operator!=(const InitializeResult& lhs, const InitializeResult& rhs);
 Result<SuccessType> Decode(const json::Value& v, InitializeResult& out);
+Result<SuccessType> Decode(json::StreamReader& r, InitializeResult& out);
+bool Matches(const json::Value& v, const InitializeResult*);
+bool Matches(json::StreamReader& r, const InitializeResult*);
 Result<const json::Value*> Encode(const InitializeResult& in, json::Builder& b);
+Result<SuccessType> Encode(const InitializeResult& in, json::StreamWriter& w);
 
 bool operator==(const InitializeError& lhs, const InitializeError& rhs);
 bool operator!=(const InitializeError& lhs, const InitializeError& rhs);
 Result<SuccessType> Decode(const json::Value& v, InitializeError& out);
+Result<SuccessType> Decode(json::StreamReader& r, InitializeError& out);
+bool Matches(const json::Value& v, const InitializeError*);
+bool Matches(json::StreamReader& r, const InitializeError*);
 Result<const json::Value*> Encode(const InitializeError& in, json::Builder& b);
+Result<SuccessType> Encode(const InitializeError& in, json::StreamWriter& w);
 
 bool operator==(const InitializedParams& lhs, const InitializedParams& rhs);
 bool operator!=(const InitializedParams& lhs, const InitializedParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, InitializedParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, InitializedParams& out);
+bool Matches(const json::Value& v, const InitializedParams*);
+bool Matches(json::StreamReader& r, const InitializedParams*);
 Result<const json::Value*> Encode(const InitializedParams& in, json::Builder& b);
+Result<SuccessType> Encode(const InitializedParams& in, json::StreamWriter& w);
 
 bool operator==(const DidChangeConfigurationParams& lhs, const DidChangeConfigurationParams& rhs);
 bool operator!=(const DidChangeConfigurationParams& lhs, const DidChangeConfigurationParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidChangeConfigurationParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidChangeConfigurationParams& out);
+bool Matches(const json::Value& v, const DidChangeConfigurationParams*);
+bool Matches(json::StreamReader& r, const DidChangeConfigurationParams*);
 Result<const json::Value*> Encode(const DidChangeConfigurationParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DidChangeConfigurationParams& in, json::StreamWriter& w);
 
 bool operator==(const DidChangeConfigurationRegistrationOptions& lhs,
                 const DidChangeConfigurationRegistrationOptions& rhs);
 bool operator!=(const DidChangeConfigurationRegistrationOptions& lhs,
                 const DidChangeConfigurationRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidChangeConfigurationRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidChangeConfigurationRegistrationOptions& out);
+bool Matches(const json::Value& v, const DidChangeConfigurationRegistrationOptions*);
+bool Matches(json::StreamReader& r, const DidChangeConfigurationRegistrationOptions*);
 Result<const json::Value*> Encode(const DidChangeConfigurationRegistrationOptions& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const DidChangeConfigurationRegistrationOptions& in,
+                           json::StreamWriter& w);
 
 bool operator==(const ShowMessageParams& lhs, const ShowMessageParams& rhs);
 bool operator!=(const ShowMessageParams& lhs, const ShowMessageParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, ShowMessageParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, ShowMessageParams& out);
+bool Matches(const json::Value& v, const ShowMessageParams*);
+bool Matches(json::StreamReader& r, const ShowMessageParams*);
 Result<const json::Value*> Encode(const ShowMessageParams& in, json::Builder& b);
+Result<SuccessType> Encode(const ShowMessageParams& in, json::StreamWriter& w);
 
 bool operator==(const MessageActionItem& lhs, const MessageActionItem& rhs);
 bool operator!=(const MessageActionItem& lhs, const MessageActionItem& rhs);
 Result<SuccessType> Decode(const json::Value& v, MessageActionItem& out);
+Result<SuccessType> Decode(json::StreamReader& r, MessageActionItem& out);
+bool Matches(const json::Value& v, const MessageActionItem*);
+bool Matches(json::StreamReader& r, const MessageActionItem*);
 Result<const json::Value*> Encode(const MessageActionItem& in, json::Builder& b);
+Result<SuccessType> Encode(const MessageActionItem& in, json::StreamWriter& w);
 
 bool operator==(const ShowMessageRequestParams& lhs, const ShowMessageRequestParams& rhs);
 bool operator!=(const ShowMessageRequestParams& lhs, const ShowMessageRequestParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, ShowMessageRequestParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, ShowMessageRequestParams& out);
+bool Matches(const json::Value& v, const ShowMessageRequestParams*);
+bool Matches(json::StreamReader& r, const ShowMessageRequestParams*);
 Result<const json::Value*> Encode(const ShowMessageRequestParams& in, json::Builder& b);
+Result<SuccessType> Encode(const ShowMessageRequestParams& in, json::StreamWriter& w);
 
 bool operator==(const LogMessageParams& lhs, const LogMessageParams& rhs);
 bool operator!=(const LogMessageParams& lhs, const LogMessageParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, LogMessageParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, LogMessageParams& out);
+bool Matches(const json::Value& v, const LogMessageParams*);
+bool Matches(json::StreamReader& r, const LogMessageParams*);
 Result<const json::Value*> Encode(const LogMessageParams& in, json::Builder& b);
+Result<SuccessType> Encode(const LogMessageParams& in, json::StreamWriter& w);
 
 bool operator==(const DidOpenTextDocumentParams& lhs, const DidOpenTextDocumentParams& rhs);
 bool operator!=(const DidOpenTextDocumentParams& lhs, const DidOpenTextDocumentParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidOpenTextDocumentParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidOpenTextDocumentParams& out);
+bool Matches(const json::Value& v, const DidOpenTextDocumentParams*);
+bool Matches(json::StreamReader& r, const DidOpenTextDocumentParams*);
 Result<const json::Value*> Encode(const DidOpenTextDocumentParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DidOpenTextDocumentParams& in, json::StreamWriter& w);
 
 bool operator==(const DidChangeTextDocumentParams& lhs, const DidChangeTextDocumentParams& rhs);
 bool operator!=(const DidChangeTextDocumentParams& lhs, const DidChangeTextDocumentParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidChangeTextDocumentParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidChangeTextDocumentParams& out);
+bool Matches(const json::Value& v, const DidChangeTextDocumentParams*);
+bool Matches(json::StreamReader& r, const DidChangeTextDocumentParams*);
 Result<const json::Value*> Encode(const DidChangeTextDocumentParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DidChangeTextDocumentParams& in, json::StreamWriter& w);
 
 bool operator==(const TextDocumentChangeRegistrationOptions& lhs,
                 const TextDocumentChangeRegistrationOptions& rhs);
 bool operator!=(const TextDocumentChangeRegistrationOptions& lhs,
                 const TextDocumentChangeRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentChangeRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentChangeRegistrationOptions& out);
+bool Matches(const json::Value& v, const TextDocumentChangeRegistrationOptions*);
+bool Matches(json::StreamReader& r, const TextDocumentChangeRegistrationOptions*);
 Result<const json::Value*> Encode(const TextDocumentChangeRegistrationOptions& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentChangeRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const DidCloseTextDocumentParams& lhs, const DidCloseTextDocumentParams& rhs);
 bool operator!=(const DidCloseTextDocumentParams& lhs, const DidCloseTextDocumentParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidCloseTextDocumentParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidCloseTextDocumentParams& out);
+bool Matches(const json::Value& v, const DidCloseTextDocumentParams*);
+bool Matches(json::StreamReader& r, const DidCloseTextDocumentParams*);
 Result<const json::Value*> Encode(const DidCloseTextDocumentParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DidCloseTextDocumentParams& in, json::StreamWriter& w);
 
 bool operator==(const DidSaveTextDocumentParams& lhs, const DidSaveTextDocumentParams& rhs);
 bool operator!=(const DidSaveTextDocumentParams& lhs, const DidSaveTextDocumentParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidSaveTextDocumentParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidSaveTextDocumentParams& out);
+bool Matches(const json::Value& v, const DidSaveTextDocumentParams*);
+bool Matches(json::StreamReader& r, const DidSaveTextDocumentParams*);
 Result<const json::Value*> Encode(const DidSaveTextDocumentParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DidSaveTextDocumentParams& in, json::StreamWriter& w);
 
 bool operator==(const TextDocumentSaveRegistrationOptions& lhs,
                 const TextDocumentSaveRegistrationOptions& rhs);
 bool operator!=(const TextDocumentSaveRegistrationOptions& lhs,
                 const TextDocumentSaveRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentSaveRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentSaveRegistrationOptions& out);
+bool Matches(const json::Value& v, const TextDocumentSaveRegistrationOptions*);
+bool Matches(json::StreamReader& r, const TextDocumentSaveRegistrationOptions*);
 Result<const json::Value*> Encode(const TextDocumentSaveRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentSaveRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const WillSaveTextDocumentParams& lhs, const WillSaveTextDocumentParams& rhs);
 bool operator!=(const WillSaveTextDocumentParams& lhs, const WillSaveTextDocumentParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, WillSaveTextDocumentParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, WillSaveTextDocumentParams& out);
+bool Matches(const json::Value& v, const WillSaveTextDocumentParams*);
+bool Matches(json::StreamReader& r, const WillSaveTextDocumentParams*);
 Result<const json::Value*> Encode(const WillSaveTextDocumentParams& in, json::Builder& b);
+Result<SuccessType> Encode(const WillSaveTextDocumentParams& in, json::StreamWriter& w);
 
 bool operator==(const FileEvent& lhs, const FileEvent& rhs);
 bool operator!=(const FileEvent& lhs, const FileEvent& rhs);
 Result<SuccessType> Decode(const json::Value& v, FileEvent& out);
+Result<SuccessType> Decode(json::StreamReader& r, FileEvent& out);
+bool Matches(const json::Value& v, const FileEvent*);
+bool Matches(json::StreamReader& r, const FileEvent*);
 Result<const json::Value*> Encode(const FileEvent& in, json::Builder& b);
+Result<SuccessType> Encode(const FileEvent& in, json::StreamWriter& w);
 
 bool operator==(const DidChangeWatchedFilesParams& lhs, const DidChangeWatchedFilesParams& rhs);
 bool operator!=(const DidChangeWatchedFilesParams& lhs, const DidChangeWatchedFilesParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidChangeWatchedFilesParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidChangeWatchedFilesParams& out);
+bool Matches(const json::Value& v, const DidChangeWatchedFilesParams*);
+bool Matches(json::StreamReader& r, const DidChangeWatchedFilesParams*);
 Result<const json::Value*> Encode(const DidChangeWatchedFilesParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DidChangeWatchedFilesParams& in, json::StreamWriter& w);
 
 bool operator==(const FileSystemWatcher& lhs, const FileSystemWatcher& rhs);
 bool operator!=(const FileSystemWatcher& lhs, const FileSystemWatcher& rhs);
 Result<SuccessType> Decode(const json::Value& v, FileSystemWatcher& out);
+Result<SuccessType> Decode(json::StreamReader& r, FileSystemWatcher& out);
+bool Matches(const json::Value& v, const FileSystemWatcher*);
+bool Matches(json::StreamReader& r, const FileSystemWatcher*);
 Result<const json::Value*> Encode(const FileSystemWatcher& in, json::Builder& b);
+Result<SuccessType> Encode(const FileSystemWatcher& in, json::StreamWriter& w);
 
 bool operator==(const DidChangeWatchedFilesRegistrationOptions& lhs,
                 const DidChangeWatchedFilesRegistrationOptions& rhs);
 bool operator!=(const DidChangeWatchedFilesRegistrationOptions& lhs,
                 const DidChangeWatchedFilesRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DidChangeWatchedFilesRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DidChangeWatchedFilesRegistrationOptions& out);
+bool Matches(const json::Value& v, const DidChangeWatchedFilesRegistrationOptions*);
+bool Matches(json::StreamReader& r, const DidChangeWatchedFilesRegistrationOptions*);
 Result<const json::Value*> Encode(const DidChangeWatchedFilesRegistrationOptions& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const DidChangeWatchedFilesRegistrationOptions& in,
+                           json::StreamWriter& w);
 
 bool operator==(const PublishDiagnosticsParams& lhs, const PublishDiagnosticsParams& rhs);
 bool operator!=(const PublishDiagnosticsParams& lhs, const PublishDiagnosticsParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, PublishDiagnosticsParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, PublishDiagnosticsParams& out);
+bool Matches(const json::Value& v, const PublishDiagnosticsParams*);
+bool Matches(json::StreamReader& r, const PublishDiagnosticsParams*);
 Result<const json::Value*> Encode(const PublishDiagnosticsParams& in, json::Builder& b);
+Result<SuccessType> Encode(const PublishDiagnosticsParams& in, json::StreamWriter& w);
 
 bool operator==(const CompletionContext& lhs, const CompletionContext& rhs);
 bool operator!=(const CompletionContext& lhs, const CompletionContext& rhs);
 Result<SuccessType> Decode(const json::Value& v, CompletionContext& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionContext& out);
+bool Matches(const json::Value& v, const CompletionContext*);
+bool Matches(json::StreamReader& r, const CompletionContext*);
 Result<const json::Value*> Encode(const CompletionContext& in, json::Builder& b);
+Result<SuccessType> Encode(const CompletionContext& in, json::StreamWriter& w);
 
 bool operator==(const CompletionParams& lhs, const CompletionParams& rhs);
 bool operator!=(const CompletionParams& lhs, const CompletionParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, CompletionParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionParams& out);
+bool Matches(const json::Value& v, const CompletionParams*);
+bool Matches(json::StreamReader& r, const CompletionParams*);
 Result<const json::Value*> Encode(const CompletionParams& in, json::Builder& b);
+Result<SuccessType> Encode(const CompletionParams& in, json::StreamWriter& w);
 
 bool operator==(const CompletionItemLabelDetails& lhs, const CompletionItemLabelDetails& rhs);
 bool operator!=(const CompletionItemLabelDetails& lhs, const CompletionItemLabelDetails& rhs);
 Result<SuccessType> Decode(const json::Value& v, CompletionItemLabelDetails& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionItemLabelDetails& out);
+bool Matches(const json::Value& v, const CompletionItemLabelDetails*);
+bool Matches(json::StreamReader& r, const CompletionItemLabelDetails*);
 Result<const json::Value*> Encode(const CompletionItemLabelDetails& in, json::Builder& b);
+Result<SuccessType> Encode(const CompletionItemLabelDetails& in, json::StreamWriter& w);
 
 bool operator==(const InsertReplaceEdit& lhs, const InsertReplaceEdit& rhs);
 bool operator!=(const InsertReplaceEdit& lhs, const InsertReplaceEdit& rhs);
 Result<SuccessType> Decode(const json::Value& v, InsertReplaceEdit& out);
+Result<SuccessType> Decode(json::StreamReader& r, InsertReplaceEdit& out);
+bool Matches(const json::Value& v, const InsertReplaceEdit*);
+bool Matches(json::StreamReader& r, const InsertReplaceEdit*);
 Result<const json::Value*> Encode(const InsertReplaceEdit& in, json::Builder& b);
+Result<SuccessType> Encode(const InsertReplaceEdit& in, json::StreamWriter& w);
 
 bool operator==(const CompletionItem& lhs, const CompletionItem& rhs);
 bool operator!=(const CompletionItem& lhs, const CompletionItem& rhs);
 Result<SuccessType> Decode(const json::Value& v, CompletionItem& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionItem& out);
+bool Matches(const json::Value& v, const CompletionItem*);
+bool Matches(json::StreamReader& r, const CompletionItem*);
 Result<const json::Value*> Encode(const CompletionItem& in, json::Builder& b);
+Result<SuccessType> Encode(const CompletionItem& in, json::StreamWriter& w);
 
 bool operator==(const EditRangeWithInsertReplace& lhs, const EditRangeWithInsertReplace& rhs);
 bool operator!=(const EditRangeWithInsertReplace& lhs, const EditRangeWithInsertReplace& rhs);
 Result<SuccessType> Decode(const json::Value& v, EditRangeWithInsertReplace& out);
+Result<SuccessType> Decode(json::StreamReader& r, EditRangeWithInsertReplace& out);
+bool Matches(const json::Value& v, const EditRangeWithInsertReplace*);
+bool Matches(json::StreamReader& r, const EditRangeWithInsertReplace*);
 Result<const json::Value*> Encode(const EditRangeWithInsertReplace& in, json::Builder& b);
+Result<SuccessType> Encode(const EditRangeWithInsertReplace& in, json::StreamWriter& w);
 
 bool operator==(const CompletionItemDefaults& lhs, const CompletionItemDefaults& rhs);
 bool operator!=(const CompletionItemDefaults& lhs, const CompletionItemDefaults& rhs);
 Result<SuccessType> Decode(const json::Value& v, CompletionItemDefaults& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionItemDefaults& out);
+bool Matches(const json::Value& v, const CompletionItemDefaults*);
+bool Matches(json::StreamReader& r, const CompletionItemDefaults*);
 Result<const json::Value*> Encode(const CompletionItemDefaults& in, json::Builder& b);
+Result<SuccessType> Encode(const CompletionItemDefaults& in, json::StreamWriter& w);
 
 bool operator==(const CompletionList& lhs, const CompletionList& rhs);
 bool operator!=(const CompletionList& lhs, const CompletionList& rhs);
 Result<SuccessType> Decode(const json::Value& v, CompletionList& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionList& out);
+bool Matches(const json::Value& v, const CompletionList*);
+bool Matches(json::StreamReader& r, const CompletionList*);
 Result<const json::Value*> Encode(const CompletionList& in, json::Builder& b);
+Result<SuccessType> Encode(const CompletionList& in, json::StreamWriter& w);
 
 bool operator==(const CompletionRegistrationOptions& lhs, const CompletionRegistrationOptions& rhs);
 bool operator!=(const CompletionRegistrationOptions& lhs, const CompletionRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, CompletionRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, CompletionRegistrationOptions& out);
+bool Matches(const json::Value& v, const CompletionRegistrationOptions*);
+bool Matches(json::StreamReader& r, const CompletionRegistrationOptions*);
 Result<const json::Value*> Encode(const CompletionRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const CompletionRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const HoverParams& lhs, const HoverParams& rhs);
 bool operator!=(const HoverParams& lhs, const HoverParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, HoverParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, HoverParams& out);
+bool Matches(const json::Value& v, const HoverParams*);
+bool Matches(json::StreamReader& r, const HoverParams*);
 Result<const json::Value*> Encode(const HoverParams& in, json::Builder& b);
+Result<SuccessType> Encode(const HoverParams& in, json::StreamWriter& w);
 
 bool operator==(const Hover& lhs, const Hover& rhs);
 bool operator!=(const Hover& lhs, const Hover& rhs);
 Result<SuccessType> Decode(const json::Value& v, Hover& out);
+Result<SuccessType> Decode(json::StreamReader& r, Hover& out);
+bool Matches(const json::Value& v, const Hover*);
+bool Matches(json::StreamReader& r, const Hover*);
 Result<const json::Value*> Encode(const Hover& in, json::Builder& b);
+Result<SuccessType> Encode(const Hover& in, json::StreamWriter& w);
 
 bool operator==(const HoverRegistrationOptions& lhs, const HoverRegistrationOptions& rhs);
 bool operator!=(const HoverRegistrationOptions& lhs, const HoverRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, HoverRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, HoverRegistrationOptions& out);
+bool Matches(const json::Value& v, const HoverRegistrationOptions*);
+bool Matches(json::StreamReader& r, const HoverRegistrationOptions*);
 Result<const json::Value*> Encode(const HoverRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const HoverRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const ParameterInformation& lhs, const ParameterInformation& rhs);
 bool operator!=(const ParameterInformation& lhs, const ParameterInformation& rhs);
 Result<SuccessType> Decode(const json::Value& v, ParameterInformation& out);
+Result<SuccessType> Decode(json::StreamReader& r, ParameterInformation& out);
+bool Matches(const json::Value& v, const ParameterInformation*);
+bool Matches(json::StreamReader& r, const ParameterInformation*);
 Result<const json::Value*> Encode(const ParameterInformation& in, json::Builder& b);
+Result<SuccessType> Encode(const ParameterInformation& in, json::StreamWriter& w);
 
 bool operator==(const SignatureInformation& lhs, const SignatureInformation& rhs);
 bool operator!=(const SignatureInformation& lhs, const SignatureInformation& rhs);
 Result<SuccessType> Decode(const json::Value& v, SignatureInformation& out);
+Result<SuccessType> Decode(json::StreamReader& r, SignatureInformation& out);
+bool Matches(const json::Value& v, const SignatureInformation*);
+bool Matches(json::StreamReader& r, const SignatureInformation*);
 Result<const json::Value*> Encode(const SignatureInformation& in, json::Builder& b);
+Result<SuccessType> Encode(const SignatureInformation& in, json::StreamWriter& w);
 
 bool operator==(const SignatureHelp& lhs, const SignatureHelp& rhs);
 bool operator!=(const SignatureHelp& lhs, const SignatureHelp& rhs);
 Result<SuccessType> Decode(const json::Value& v, SignatureHelp& out);
+Result<SuccessType> Decode(json::StreamReader& r, SignatureHelp& out);
+bool Matches(const json::Value& v, const SignatureHelp*);
+bool Matches(json::StreamReader& r, const SignatureHelp*);
 Result<const json::Value*> Encode(const SignatureHelp& in, json::Builder& b);
+Result<SuccessType> Encode(const SignatureHelp& in, json::StreamWriter& w);
 
 bool operator==(const SignatureHelpContext& lhs, const SignatureHelpContext& rhs);
 bool operator!=(const SignatureHelpContext& lhs, const SignatureHelpContext& rhs);
 Result<SuccessType> Decode(const json::Value& v, SignatureHelpContext& out);
+Result<SuccessType> Decode(json::StreamReader& r, SignatureHelpContext& out);
+bool Matches(const json::Value& v, const SignatureHelpContext*);
+bool Matches(json::StreamReader& r, const SignatureHelpContext*);
 Result<const json::Value*> Encode(const SignatureHelpContext& in, json::Builder& b);
+Result<SuccessType> Encode(const SignatureHelpContext& in, json::StreamWriter& w);
 
 bool operator==(const SignatureHelpParams& lhs, const SignatureHelpParams& rhs);
 bool operator!=(const SignatureHelpParams& lhs, const SignatureHelpParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, SignatureHelpParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, SignatureHelpParams& out);
+bool Matches(const json::Value& v, const SignatureHelpParams*);
+bool Matches(json::StreamReader& r, const SignatureHelpParams*);
 Result<const json::Value*> Encode(const SignatureHelpParams& in, json::Builder& b);
+Result<SuccessType> Encode(const SignatureHelpParams& in, json::StreamWriter& w);
 
 bool operator==(const SignatureHelpRegistrationOptions& lhs,
                 const SignatureHelpRegistrationOptions& rhs);
 bool operator!=(const SignatureHelpRegistrationOptions& lhs,
                 const SignatureHelpRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, SignatureHelpRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, SignatureHelpRegistrationOptions& out);
+bool Matches(const json::Value& v, const SignatureHelpRegistrationOptions*);
+bool Matches(json::StreamReader& r, const SignatureHelpRegistrationOptions*);
 Result<const json::Value*> Encode(const SignatureHelpRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const SignatureHelpRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const DefinitionParams& lhs, const DefinitionParams& rhs);
 bool operator!=(const DefinitionParams& lhs, const DefinitionParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DefinitionParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DefinitionParams& out);
+bool Matches(const json::Value& v, const DefinitionParams*);
+bool Matches(json::StreamReader& r, const DefinitionParams*);
 Result<const json::Value*> Encode(const DefinitionParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DefinitionParams& in, json::StreamWriter& w);
 
 bool operator==(const DefinitionRegistrationOptions& lhs, const DefinitionRegistrationOptions& rhs);
 bool operator!=(const DefinitionRegistrationOptions& lhs, const DefinitionRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DefinitionRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DefinitionRegistrationOptions& out);
+bool Matches(const json::Value& v, const DefinitionRegistrationOptions*);
+bool Matches(json::StreamReader& r, const DefinitionRegistrationOptions*);
 Result<const json::Value*> Encode(const DefinitionRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DefinitionRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const ReferenceContext& lhs, const ReferenceContext& rhs);
 bool operator!=(const ReferenceContext& lhs, const ReferenceContext& rhs);
 Result<SuccessType> Decode(const json::Value& v, ReferenceContext& out);
+Result<SuccessType> Decode(json::StreamReader& r, ReferenceContext& out);
+bool Matches(const json::Value& v, const ReferenceContext*);
+bool Matches(json::StreamReader& r, const ReferenceContext*);
 Result<const json::Value*> Encode(const ReferenceContext& in, json::Builder& b);
+Result<SuccessType> Encode(const ReferenceContext& in, json::StreamWriter& w);
 
 bool operator==(const ReferenceParams& lhs, const ReferenceParams& rhs);
 bool operator!=(const ReferenceParams& lhs, const ReferenceParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, ReferenceParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, ReferenceParams& out);
+bool Matches(const json::Value& v, const ReferenceParams*);
+bool Matches(json::StreamReader& r, const ReferenceParams*);
 Result<const json::Value*> Encode(const ReferenceParams& in, json::Builder& b);
+Result<SuccessType> Encode(const ReferenceParams& in, json::StreamWriter& w);
 
 bool operator==(const ReferenceRegistrationOptions& lhs, const ReferenceRegistrationOptions& rhs);
 bool operator!=(const ReferenceRegistrationOptions& lhs, const ReferenceRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ReferenceRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ReferenceRegistrationOptions& out);
+bool Matches(const json::Value& v, const ReferenceRegistrationOptions*);
+bool Matches(json::StreamReader& r, const ReferenceRegistrationOptions*);
 Result<const json::Value*> Encode(const ReferenceRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ReferenceRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const DocumentHighlightParams& lhs, const DocumentHighlightParams& rhs);
 bool operator!=(const DocumentHighlightParams& lhs, const DocumentHighlightParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentHighlightParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentHighlightParams& out);
+bool Matches(const json::Value& v, const DocumentHighlightParams*);
+bool Matches(json::StreamReader& r, const DocumentHighlightParams*);
 Result<const json::Value*> Encode(const DocumentHighlightParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentHighlightParams& in, json::StreamWriter& w);
 
 bool operator==(const DocumentHighlight& lhs, const DocumentHighlight& rhs);
 bool operator!=(const DocumentHighlight& lhs, const DocumentHighlight& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentHighlight& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentHighlight& out);
+bool Matches(const json::Value& v, const DocumentHighlight*);
+bool Matches(json::StreamReader& r, const DocumentHighlight*);
 Result<const json::Value*> Encode(const DocumentHighlight& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentHighlight& in, json::StreamWriter& w);
 
 bool operator==(const DocumentHighlightRegistrationOptions& lhs,
                 const DocumentHighlightRegistrationOptions& rhs);
 bool operator!=(const DocumentHighlightRegistrationOptions& lhs,
                 const DocumentHighlightRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentHighlightRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentHighlightRegistrationOptions& out);
+bool Matches(const json::Value& v, const DocumentHighlightRegistrationOptions*);
+bool Matches(json::StreamReader& r, const DocumentHighlightRegistrationOptions*);
 Result<const json::Value*> Encode(const DocumentHighlightRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentHighlightRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const DocumentSymbolParams& lhs, const DocumentSymbolParams& rhs);
 bool operator!=(const DocumentSymbolParams& lhs, const DocumentSymbolParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentSymbolParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentSymbolParams& out);
+bool Matches(const json::Value& v, const DocumentSymbolParams*);
+bool Matches(json::StreamReader& r, const DocumentSymbolParams*);
 Result<const json::Value*> Encode(const DocumentSymbolParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentSymbolParams& in, json::StreamWriter& w);
 
 bool operator==(const BaseSymbolInformation& lhs, const BaseSymbolInformation& rhs);
 bool operator!=(const BaseSymbolInformation& lhs, const BaseSymbolInformation& rhs);
 Result<SuccessType> Decode(const json::Value& v, BaseSymbolInformation& out);
+Result<SuccessType> Decode(json::StreamReader& r, BaseSymbolInformation& out);
+bool Matches(const json::Value& v, const BaseSymbolInformation*);
+bool Matches(json::StreamReader& r, const BaseSymbolInformation*);
 Result<const json::Value*> Encode(const BaseSymbolInformation& in, json::Builder& b);
+Result<SuccessType> Encode(const BaseSymbolInformation& in, json::StreamWriter& w);
 
 bool operator==(const SymbolInformation& lhs, const SymbolInformation& rhs);
 bool operator!=(const SymbolInformation& lhs, const SymbolInformation& rhs);
 Result<SuccessType> Decode(const json::Value& v, SymbolInformation& out);
+Result<SuccessType> Decode(json::StreamReader& r, SymbolInformation& out);
+bool Matches(const json::Value& v, const SymbolInformation*);
+bool Matches(json::StreamReader& r, const SymbolInformation*);
 Result<const json::Value*> Encode(const SymbolInformation& in, json::Builder& b);
+Result<SuccessType> Encode(const SymbolInformation& in, json::StreamWriter& w);
 
 bool operator==(const DocumentSymbol& lhs, const DocumentSymbol& rhs);
 bool operator!=(const DocumentSymbol& lhs, const DocumentSymbol& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentSymbol& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentSymbol& out);
+bool Matches(const json::Value& v, const DocumentSymbol*);
+bool Matches(json::StreamReader& r, const DocumentSymbol*);
 Result<const json::Value*> Encode(const DocumentSymbol& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentSymbol& in, json::StreamWriter& w);
 
 bool operator==(const DocumentSymbolRegistrationOptions& lhs,
                 const DocumentSymbolRegistrationOptions& rhs);
 bool operator!=(const DocumentSymbolRegistrationOptions& lhs,
                 const DocumentSymbolRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentSymbolRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentSymbolRegistrationOptions& out);
+bool Matches(const json::Value& v, const DocumentSymbolRegistrationOptions*);
+bool Matches(json::StreamReader& r, const DocumentSymbolRegistrationOptions*);
 Result<const json::Value*> Encode(const DocumentSymbolRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentSymbolRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const CodeActionContext& lhs, const CodeActionContext& rhs);
 bool operator!=(const CodeActionContext& lhs, const CodeActionContext& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeActionContext& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeActionContext& out);
+bool Matches(const json::Value& v, const CodeActionContext*);
+bool Matches(json::StreamReader& r, const CodeActionContext*);
 Result<const json::Value*> Encode(const CodeActionContext& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeActionContext& in, json::StreamWriter& w);
 
 bool operator==(const CodeActionParams& lhs, const CodeActionParams& rhs);
 bool operator!=(const CodeActionParams& lhs, const CodeActionParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeActionParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeActionParams& out);
+bool Matches(const json::Value& v, const CodeActionParams*);
+bool Matches(json::StreamReader& r, const CodeActionParams*);
 Result<const json::Value*> Encode(const CodeActionParams& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeActionParams& in, json::StreamWriter& w);
 
 bool operator==(const CodeActionDisabled& lhs, const CodeActionDisabled& rhs);
 bool operator!=(const CodeActionDisabled& lhs, const CodeActionDisabled& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeActionDisabled& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeActionDisabled& out);
+bool Matches(const json::Value& v, const CodeActionDisabled*);
+bool Matches(json::StreamReader& r, const CodeActionDisabled*);
 Result<const json::Value*> Encode(const CodeActionDisabled& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeActionDisabled& in, json::StreamWriter& w);
 
 bool operator==(const CodeAction& lhs, const CodeAction& rhs);
 bool operator!=(const CodeAction& lhs, const CodeAction& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeAction& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeAction& out);
+bool Matches(const json::Value& v, const CodeAction*);
+bool Matches(json::StreamReader& r, const CodeAction*);
 Result<const json::Value*> Encode(const CodeAction& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeAction& in, json::StreamWriter& w);
 
 bool operator==(const CodeActionRegistrationOptions& lhs, const CodeActionRegistrationOptions& rhs);
 bool operator!=(const CodeActionRegistrationOptions& lhs, const CodeActionRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeActionRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeActionRegistrationOptions& out);
+bool Matches(const json::Value& v, const CodeActionRegistrationOptions*);
+bool Matches(json::StreamReader& r, const CodeActionRegistrationOptions*);
 Result<const json::Value*> Encode(const CodeActionRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeActionRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceSymbolParams& lhs, const WorkspaceSymbolParams& rhs);
 bool operator!=(const WorkspaceSymbolParams& lhs, const WorkspaceSymbolParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceSymbolParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceSymbolParams& out);
+bool Matches(const json::Value& v, const WorkspaceSymbolParams*);
+bool Matches(json::StreamReader& r, const WorkspaceSymbolParams*);
 Result<const json::Value*> Encode(const WorkspaceSymbolParams& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceSymbolParams& in, json::StreamWriter& w);
 
 bool operator==(const LocationUriOnly& lhs, const LocationUriOnly& rhs);
 bool operator!=(const LocationUriOnly& lhs, const LocationUriOnly& rhs);
 Result<SuccessType> Decode(const json::Value& v, LocationUriOnly& out);
+Result<SuccessType> Decode(json::StreamReader& r, LocationUriOnly& out);
+bool Matches(const json::Value& v, const LocationUriOnly*);
+bool Matches(json::StreamReader& r, const LocationUriOnly*);
 Result<const json::Value*> Encode(const LocationUriOnly& in, json::Builder& b);
+Result<SuccessType> Encode(const LocationUriOnly& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceSymbol& lhs, const WorkspaceSymbol& rhs);
 bool operator!=(const WorkspaceSymbol& lhs, const WorkspaceSymbol& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceSymbol& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceSymbol& out);
+bool Matches(const json::Value& v, const WorkspaceSymbol*);
+bool Matches(json::StreamReader& r, const WorkspaceSymbol*);
 Result<const json::Value*> Encode(const WorkspaceSymbol& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceSymbol& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceSymbolRegistrationOptions& lhs,
                 const WorkspaceSymbolRegistrationOptions& rhs);
 bool operator!=(const WorkspaceSymbolRegistrationOptions& lhs,
                 const WorkspaceSymbolRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceSymbolRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceSymbolRegistrationOptions& out);
+bool Matches(const json::Value& v, const WorkspaceSymbolRegistrationOptions*);
+bool Matches(json::StreamReader& r, const WorkspaceSymbolRegistrationOptions*);
 Result<const json::Value*> Encode(const WorkspaceSymbolRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceSymbolRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const CodeLensParams& lhs, const CodeLensParams& rhs);
 bool operator!=(const CodeLensParams& lhs, const CodeLensParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeLensParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeLensParams& out);
+bool Matches(const json::Value& v, const CodeLensParams*);
+bool Matches(json::StreamReader& r, const CodeLensParams*);
 Result<const json::Value*> Encode(const CodeLensParams& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeLensParams& in, json::StreamWriter& w);
 
 bool operator==(const CodeLens& lhs, const CodeLens& rhs);
 bool operator!=(const CodeLens& lhs, const CodeLens& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeLens& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeLens& out);
+bool Matches(const json::Value& v, const CodeLens*);
+bool Matches(json::StreamReader& r, const CodeLens*);
 Result<const json::Value*> Encode(const CodeLens& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeLens& in, json::StreamWriter& w);
 
 bool operator==(const CodeLensRegistrationOptions& lhs, const CodeLensRegistrationOptions& rhs);
 bool operator!=(const CodeLensRegistrationOptions& lhs, const CodeLensRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, CodeLensRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, CodeLensRegistrationOptions& out);
+bool Matches(const json::Value& v, const CodeLensRegistrationOptions*);
+bool Matches(json::StreamReader& r, const CodeLensRegistrationOptions*);
 Result<const json::Value*> Encode(const CodeLensRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const CodeLensRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const DocumentLinkParams& lhs, const DocumentLinkParams& rhs);
 bool operator!=(const DocumentLinkParams& lhs, const DocumentLinkParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentLinkParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentLinkParams& out);
+bool Matches(const json::Value& v, const DocumentLinkParams*);
+bool Matches(json::StreamReader& r, const DocumentLinkParams*);
 Result<const json::Value*> Encode(const DocumentLinkParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentLinkParams& in, json::StreamWriter& w);
 
 bool operator==(const DocumentLink& lhs, const DocumentLink& rhs);
 bool operator!=(const DocumentLink& lhs, const DocumentLink& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentLink& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentLink& out);
+bool Matches(const json::Value& v, const DocumentLink*);
+bool Matches(json::StreamReader& r, const DocumentLink*);
 Result<const json::Value*> Encode(const DocumentLink& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentLink& in, json::StreamWriter& w);
 
 bool operator==(const DocumentLinkRegistrationOptions& lhs,
                 const DocumentLinkRegistrationOptions& rhs);
 bool operator!=(const DocumentLinkRegistrationOptions& lhs,
                 const DocumentLinkRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentLinkRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentLinkRegistrationOptions& out);
+bool Matches(const json::Value& v, const DocumentLinkRegistrationOptions*);
+bool Matches(json::StreamReader& r, const DocumentLinkRegistrationOptions*);
 Result<const json::Value*> Encode(const DocumentLinkRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentLinkRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const FormattingOptions& lhs, const FormattingOptions& rhs);
 bool operator!=(const FormattingOptions& lhs, const FormattingOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, FormattingOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, FormattingOptions& out);
+bool Matches(const json::Value& v, const FormattingOptions*);
+bool Matches(json::StreamReader& r, const FormattingOptions*);
 Result<const json::Value*> Encode(const FormattingOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const FormattingOptions& in, json::StreamWriter& w);
 
 bool operator==(const DocumentFormattingParams& lhs, const DocumentFormattingParams& rhs);
 bool operator!=(const DocumentFormattingParams& lhs, const DocumentFormattingParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentFormattingParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentFormattingParams& out);
+bool Matches(const json::Value& v, const DocumentFormattingParams*);
+bool Matches(json::StreamReader& r, const DocumentFormattingParams*);
 Result<const json::Value*> Encode(const DocumentFormattingParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentFormattingParams& in, json::StreamWriter& w);
 
 bool operator==(const DocumentFormattingRegistrationOptions& lhs,
                 const DocumentFormattingRegistrationOptions& rhs);
 bool operator!=(const DocumentFormattingRegistrationOptions& lhs,
                 const DocumentFormattingRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentFormattingRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentFormattingRegistrationOptions& out);
+bool Matches(const json::Value& v, const DocumentFormattingRegistrationOptions*);
+bool Matches(json::StreamReader& r, const DocumentFormattingRegistrationOptions*);
 Result<const json::Value*> Encode(const DocumentFormattingRegistrationOptions& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const DocumentFormattingRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const DocumentRangeFormattingParams& lhs, const DocumentRangeFormattingParams& rhs);
 bool operator!=(const DocumentRangeFormattingParams& lhs, const DocumentRangeFormattingParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentRangeFormattingParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentRangeFormattingParams& out);
+bool Matches(const json::Value& v, const DocumentRangeFormattingParams*);
+bool Matches(json::StreamReader& r, const DocumentRangeFormattingParams*);
 Result<const json::Value*> Encode(const DocumentRangeFormattingParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentRangeFormattingParams& in, json::StreamWriter& w);
 
 bool operator==(const DocumentRangeFormattingRegistrationOptions& lhs,
                 const DocumentRangeFormattingRegistrationOptions& rhs);
 bool operator!=(const DocumentRangeFormattingRegistrationOptions& lhs,
                 const DocumentRangeFormattingRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentRangeFormattingRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentRangeFormattingRegistrationOptions& out);
+bool Matches(const json::Value& v, const DocumentRangeFormattingRegistrationOptions*);
+bool Matches(json::StreamReader& r, const DocumentRangeFormattingRegistrationOptions*);
 Result<const json::Value*> Encode(const DocumentRangeFormattingRegistrationOptions& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const DocumentRangeFormattingRegistrationOptions& in,
+                           json::StreamWriter& w);
 
 bool operator==(const DocumentRangesFormattingParams& lhs,
                 const DocumentRangesFormattingParams& rhs);
 bool operator!=(const DocumentRangesFormattingParams& lhs,
                 const DocumentRangesFormattingParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentRangesFormattingParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentRangesFormattingParams& out);
+bool Matches(const json::Value& v, const DocumentRangesFormattingParams*);
+bool Matches(json::StreamReader& r, const DocumentRangesFormattingParams*);
 Result<const json::Value*> Encode(const DocumentRangesFormattingParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentRangesFormattingParams& in, json::StreamWriter& w);
 
 bool operator==(const DocumentOnTypeFormattingParams& lhs,
                 const DocumentOnTypeFormattingParams& rhs);
 bool operator!=(const DocumentOnTypeFormattingParams& lhs,
                 const DocumentOnTypeFormattingParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentOnTypeFormattingParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentOnTypeFormattingParams& out);
+bool Matches(const json::Value& v, const DocumentOnTypeFormattingParams*);
+bool Matches(json::StreamReader& r, const DocumentOnTypeFormattingParams*);
 Result<const json::Value*> Encode(const DocumentOnTypeFormattingParams& in, json::Builder& b);
+Result<SuccessType> Encode(const DocumentOnTypeFormattingParams& in, json::StreamWriter& w);
 
 bool operator==(const DocumentOnTypeFormattingRegistrationOptions& lhs,
                 const DocumentOnTypeFormattingRegistrationOptions& rhs);
 bool operator!=(const DocumentOnTypeFormattingRegistrationOptions& lhs,
                 const DocumentOnTypeFormattingRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, DocumentOnTypeFormattingRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, DocumentOnTypeFormattingRegistrationOptions& out);
+bool Matches(const json::Value& v, const DocumentOnTypeFormattingRegistrationOptions*);
+bool Matches(json::StreamReader& r, const DocumentOnTypeFormattingRegistrationOptions*);
 Result<const json::Value*> Encode(const DocumentOnTypeFormattingRegistrationOptions& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const DocumentOnTypeFormattingRegistrationOptions& in,
+                           json::StreamWriter& w);
 
 bool operator==(const RenameParams& lhs, const RenameParams& rhs);
 bool operator!=(const RenameParams& lhs, const RenameParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, RenameParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, RenameParams& out);
+bool Matches(const json::Value& v, const RenameParams*);
+bool Matches(json::StreamReader& r, const RenameParams*);
 Result<const json::Value*> Encode(const RenameParams& in, json::Builder& b);
+Result<SuccessType> Encode(const RenameParams& in, json::StreamWriter& w);
 
 bool operator==(const RenameRegistrationOptions& lhs, const RenameRegistrationOptions& rhs);
 bool operator!=(const RenameRegistrationOptions& lhs, const RenameRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, RenameRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, RenameRegistrationOptions& out);
+bool Matches(const json::Value& v, const RenameRegistrationOptions*);
+bool Matches(json::StreamReader& r, const RenameRegistrationOptions*);
 Result<const json::Value*> Encode(const RenameRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const RenameRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const PrepareRenameParams& lhs, const PrepareRenameParams& rhs);
 bool operator!=(const PrepareRenameParams& lhs, const PrepareRenameParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, PrepareRenameParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, PrepareRenameParams& out);
+bool Matches(const json::Value& v, const PrepareRenameParams*);
+bool Matches(json::StreamReader& r, const PrepareRenameParams*);
 Result<const json::Value*> Encode(const PrepareRenameParams& in, json::Builder& b);
+Result<SuccessType> Encode(const PrepareRenameParams& in, json::StreamWriter& w);
 
 bool operator==(const ExecuteCommandParams& lhs, const ExecuteCommandParams& rhs);
 bool operator!=(const ExecuteCommandParams& lhs, const ExecuteCommandParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, ExecuteCommandParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, ExecuteCommandParams& out);
+bool Matches(const json::Value& v, const ExecuteCommandParams*);
+bool Matches(json::StreamReader& r, const ExecuteCommandParams*);
 Result<const json::Value*> Encode(const ExecuteCommandParams& in, json::Builder& b);
+Result<SuccessType> Encode(const ExecuteCommandParams& in, json::StreamWriter& w);
 
 bool operator==(const ExecuteCommandRegistrationOptions& lhs,
                 const ExecuteCommandRegistrationOptions& rhs);
 bool operator!=(const ExecuteCommandRegistrationOptions& lhs,
                 const ExecuteCommandRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, ExecuteCommandRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, ExecuteCommandRegistrationOptions& out);
+bool Matches(const json::Value& v, const ExecuteCommandRegistrationOptions*);
+bool Matches(json::StreamReader& r, const ExecuteCommandRegistrationOptions*);
 Result<const json::Value*> Encode(const ExecuteCommandRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const ExecuteCommandRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const ApplyWorkspaceEditParams& lhs, const ApplyWorkspaceEditParams& rhs);
 bool operator!=(const ApplyWorkspaceEditParams& lhs, const ApplyWorkspaceEditParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, ApplyWorkspaceEditParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, ApplyWorkspaceEditParams& out);
+bool Matches(const json::Value& v, const ApplyWorkspaceEditParams*);
+bool Matches(json::StreamReader& r, const ApplyWorkspaceEditParams*);
 Result<const json::Value*> Encode(const ApplyWorkspaceEditParams& in, json::Builder& b);
+Result<SuccessType> Encode(const ApplyWorkspaceEditParams& in, json::StreamWriter& w);
 
 bool operator==(const ApplyWorkspaceEditResult& lhs, const ApplyWorkspaceEditResult& rhs);
 bool operator!=(const ApplyWorkspaceEditResult& lhs, const ApplyWorkspaceEditResult& rhs);
 Result<SuccessType> Decode(const json::Value& v, ApplyWorkspaceEditResult& out);
+Result<SuccessType> Decode(json::StreamReader& r, ApplyWorkspaceEditResult& out);
+bool Matches(const json::Value& v, const ApplyWorkspaceEditResult*);
+bool Matches(json::StreamReader& r, const ApplyWorkspaceEditResult*);
 Result<const json::Value*> Encode(const ApplyWorkspaceEditResult& in, json::Builder& b);
+Result<SuccessType> Encode(const ApplyWorkspaceEditResult& in, json::StreamWriter& w);
 
 bool operator==(const WorkDoneProgressBegin& lhs, const WorkDoneProgressBegin& rhs);
 bool operator!=(const WorkDoneProgressBegin& lhs, const WorkDoneProgressBegin& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkDoneProgressBegin& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkDoneProgressBegin& out);
+bool Matches(const json::Value& v, const WorkDoneProgressBegin*);
+bool Matches(json::StreamReader& r, const WorkDoneProgressBegin*);
 Result<const json::Value*> Encode(const WorkDoneProgressBegin& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkDoneProgressBegin& in, json::StreamWriter& w);
 
 bool operator==(const WorkDoneProgressReport& lhs, const WorkDoneProgressReport& rhs);
 bool operator!=(const WorkDoneProgressReport& lhs, const WorkDoneProgressReport& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkDoneProgressReport& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkDoneProgressReport& out);
+bool Matches(const json::Value& v, const WorkDoneProgressReport*);
+bool Matches(json::StreamReader& r, const WorkDoneProgressReport*);
 Result<const json::Value*> Encode(const WorkDoneProgressReport& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkDoneProgressReport& in, json::StreamWriter& w);
 
 bool operator==(const WorkDoneProgressEnd& lhs, const WorkDoneProgressEnd& rhs);
 bool operator!=(const WorkDoneProgressEnd& lhs, const WorkDoneProgressEnd& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkDoneProgressEnd& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkDoneProgressEnd& out);
+bool Matches(const json::Value& v, const WorkDoneProgressEnd*);
+bool Matches(json::StreamReader& r, const WorkDoneProgressEnd*);
 Result<const json::Value*> Encode(const WorkDoneProgressEnd& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkDoneProgressEnd& in, json::StreamWriter& w);
 
 bool operator==(const SetTraceParams& lhs, const SetTraceParams& rhs);
 bool operator!=(const SetTraceParams& lhs, const SetTraceParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, SetTraceParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, SetTraceParams& out);
+bool Matches(const json::Value& v, const SetTraceParams*);
+bool Matches(json::StreamReader& r, const SetTraceParams*);
 Result<const json::Value*> Encode(const SetTraceParams& in, json::Builder& b);
+Result<SuccessType> Encode(const SetTraceParams& in, json::StreamWriter& w);
 
 bool operator==(const LogTraceParams& lhs, const LogTraceParams& rhs);
 bool operator!=(const LogTraceParams& lhs, const LogTraceParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, LogTraceParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, LogTraceParams& out);
+bool Matches(const json::Value& v, const LogTraceParams*);
+bool Matches(json::StreamReader& r, const LogTraceParams*);
 Result<const json::Value*> Encode(const LogTraceParams& in, json::Builder& b);
+Result<SuccessType> Encode(const LogTraceParams& in, json::StreamWriter& w);
 
 bool operator==(const CancelParams& lhs, const CancelParams& rhs);
 bool operator!=(const CancelParams& lhs, const CancelParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, CancelParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, CancelParams& out);
+bool Matches(const json::Value& v, const CancelParams*);
+bool Matches(json::StreamReader& r, const CancelParams*);
 Result<const json::Value*> Encode(const CancelParams& in, json::Builder& b);
+Result<SuccessType> Encode(const CancelParams& in, json::StreamWriter& w);
 
 bool operator==(const ProgressParams& lhs, const ProgressParams& rhs);
 bool operator!=(const ProgressParams& lhs, const ProgressParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, ProgressParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, ProgressParams& out);
+bool Matches(const json::Value& v, const ProgressParams*);
+bool Matches(json::StreamReader& r, const ProgressParams*);
 Result<const json::Value*> Encode(const ProgressParams& in, json::Builder& b);
+Result<SuccessType> Encode(const ProgressParams& in, json::StreamWriter& w);
 
 bool operator==(const WorkDoneProgressParams& lhs, const WorkDoneProgressParams& rhs);
 bool operator!=(const WorkDoneProgressParams& lhs, const WorkDoneProgressParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkDoneProgressParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkDoneProgressParams& out);
+bool Matches(const json::Value& v, const WorkDoneProgressParams*);
+bool Matches(json::StreamReader& r, const WorkDoneProgressParams*);
 Result<const json::Value*> Encode(const WorkDoneProgressParams& in, json::Builder& b);
+Result<SuccessType> Encode(const WorkDoneProgressParams& in, json::StreamWriter& w);
 
 bool operator==(const PartialResultParams& lhs, const PartialResultParams& rhs);
 bool operator!=(const PartialResultParams& lhs, const PartialResultParams& rhs);
 Result<SuccessType> Decode(const json::Value& v, PartialResultParams& out);
+Result<SuccessType> Decode(json::StreamReader& r, PartialResultParams& out);
+bool Matches(const json::Value& v, const PartialResultParams*);
+bool Matches(json::StreamReader& r, const PartialResultParams*);
 Result<const json::Value*> Encode(const PartialResultParams& in, json::Builder& b);
+Result<SuccessType> Encode(const PartialResultParams& in, json::StreamWriter& w);
 
 bool operator==(const LocationLink& lhs, const LocationLink& rhs);
 bool operator!=(const LocationLink& lhs, const LocationLink& rhs);
 Result<SuccessType> Decode(const json::Value& v, LocationLink& out);
+Result<SuccessType> Decode(json::StreamReader& r, LocationLink& out);
+bool Matches(const json::Value& v, const LocationLink*);
+bool Matches(json::StreamReader& r, const LocationLink*);
 Result<const json::Value*> Encode(const LocationLink& in, json::Builder& b);
+Result<SuccessType> Encode(const LocationLink& in, json::StreamWriter& w);
 
 bool operator==(const StaticRegistrationOptions& lhs, const StaticRegistrationOptions& rhs);
 bool operator!=(const StaticRegistrationOptions& lhs, const StaticRegistrationOptions& rhs);
 Result<SuccessType> Decode(const json::Value& v, StaticRegistrationOptions& out);
+Result<SuccessType> Decode(json::StreamReader& r, StaticRegistrationOptions& out);
+bool Matches(const json::Value& v, const StaticRegistrationOptions*);
+bool Matches(json::StreamReader& r, const StaticRegistrationOptions*);
 Result<const json::Value*> Encode(const StaticRegistrationOptions& in, json::Builder& b);
+Result<SuccessType> Encode(const StaticRegistrationOptions& in, json::StreamWriter& w);
 
 bool operator==(const InlineValueText& lhs, const InlineValueText& rhs);
 bool operator!=(const InlineValueText& lhs, const InlineValueText& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineValueText& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineValueText& out);
+bool Matches(const json::Value& v, const InlineValueText*);
+bool Matches(json::StreamReader& r, const InlineValueText*);
 Result<const json::Value*> Encode(const InlineValueText& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineValueText& in, json::StreamWriter& w);
 
 bool operator==(const InlineValueVariableLookup& lhs, const InlineValueVariableLookup& rhs);
 bool operator!=(const InlineValueVariableLookup& lhs, const InlineValueVariableLookup& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineValueVariableLookup& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineValueVariableLookup& out);
+bool Matches(const json::Value& v, const InlineValueVariableLookup*);
+bool Matches(json::StreamReader& r, const InlineValueVariableLookup*);
 Result<const json::Value*> Encode(const InlineValueVariableLookup& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineValueVariableLookup& in, json::StreamWriter& w);
 
 bool operator==(const InlineValueEvaluatableExpression& lhs,
                 const InlineValueEvaluatableExpression& rhs);
 bool operator!=(const InlineValueEvaluatableExpression& lhs,
                 const InlineValueEvaluatableExpression& rhs);
 Result<SuccessType> Decode(const json::Value& v, InlineValueEvaluatableExpression& out);
+Result<SuccessType> Decode(json::StreamReader& r, InlineValueEvaluatableExpression& out);
+bool Matches(const json::Value& v, const InlineValueEvaluatableExpression*);
+bool Matches(json::StreamReader& r, const InlineValueEvaluatableExpression*);
 Result<const json::Value*> Encode(const InlineValueEvaluatableExpression& in, json::Builder& b);
+Result<SuccessType> Encode(const InlineValueEvaluatableExpression& in, json::StreamWriter& w);
 
 bool operator==(const RelatedFullDocumentDiagnosticReport& lhs,
                 const RelatedFullDocumentDiagnosticReport& rhs);
 bool operator!=(const RelatedFullDocumentDiagnosticReport& lhs,
                 const RelatedFullDocumentDiagnosticReport& rhs);
 Result<SuccessType> Decode(const json::Value& v, RelatedFullDocumentDiagnosticReport& out);
+Result<SuccessType> Decode(json::StreamReader& r, RelatedFullDocumentDiagnosticReport& out);
+bool Matches(const json::Value& v, const RelatedFullDocumentDiagnosticReport*);
+bool Matches(json::StreamReader& r, const RelatedFullDocumentDiagnosticReport*);
 Result<const json::Value*> Encode(const RelatedFullDocumentDiagnosticReport& in, json::Builder& b);
+Result<SuccessType> Encode(const RelatedFullDocumentDiagnosticReport& in, json::StreamWriter& w);
 
 bool operator==(const RelatedUnchangedDocumentDiagnosticReport& lhs,
                 const RelatedUnchangedDocumentDiagnosticReport& rhs);
 bool operator!=(const RelatedUnchangedDocumentDiagnosticReport& lhs,
                 const RelatedUnchangedDocumentDiagnosticReport& rhs);
 Result<SuccessType> Decode(const json::Value& v, RelatedUnchangedDocumentDiagnosticReport& out);
+Result<SuccessType> Decode(json::StreamReader& r, RelatedUnchangedDocumentDiagnosticReport& out);
+bool Matches(const json::Value& v, const RelatedUnchangedDocumentDiagnosticReport*);
+bool Matches(json::StreamReader& r, const RelatedUnchangedDocumentDiagnosticReport*);
 Result<const json::Value*> Encode(const RelatedUnchangedDocumentDiagnosticReport& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const RelatedUnchangedDocumentDiagnosticReport& in,
+                           json::StreamWriter& w);
 
 bool operator==(const PrepareRenamePlaceholder& lhs, const PrepareRenamePlaceholder& rhs);
 bool operator!=(const PrepareRenamePlaceholder& lhs, const PrepareRenamePlaceholder& rhs);
 Result<SuccessType> Decode(const json::Value& v, PrepareRenamePlaceholder& out);
+Result<SuccessType> Decode(json::StreamReader& r, PrepareRenamePlaceholder& out);
+bool Matches(const json::Value& v, const PrepareRenamePlaceholder*);
+bool Matches(json::StreamReader& r, const PrepareRenamePlaceholder*);
 Result<const json::Value*> Encode(const PrepareRenamePlaceholder& in, json::Builder& b);
+Result<SuccessType> Encode(const PrepareRenamePlaceholder& in, json::StreamWriter& w);
 
 bool operator==(const PrepareRenameDefaultBehavior& lhs, const PrepareRenameDefaultBehavior& rhs);
 bool operator!=(const PrepareRenameDefaultBehavior& lhs, const PrepareRenameDefaultBehavior& rhs);
 Result<SuccessType> Decode(const json::Value& v, PrepareRenameDefaultBehavior& out);
+Result<SuccessType> Decode(json::StreamReader& r, PrepareRenameDefaultBehavior& out);
+bool Matches(const json::Value& v, const PrepareRenameDefaultBehavior*);
+bool Matches(json::StreamReader& r, const PrepareRenameDefaultBehavior*);
 Result<const json::Value*> Encode(const PrepareRenameDefaultBehavior& in, json::Builder& b);
+Result<SuccessType> Encode(const PrepareRenameDefaultBehavior& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceFullDocumentDiagnosticReport& lhs,
                 const WorkspaceFullDocumentDiagnosticReport& rhs);
 bool operator!=(const WorkspaceFullDocumentDiagnosticReport& lhs,
                 const WorkspaceFullDocumentDiagnosticReport& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceFullDocumentDiagnosticReport& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceFullDocumentDiagnosticReport& out);
+bool Matches(const json::Value& v, const WorkspaceFullDocumentDiagnosticReport*);
+bool Matches(json::StreamReader& r, const WorkspaceFullDocumentDiagnosticReport*);
 Result<const json::Value*> Encode(const WorkspaceFullDocumentDiagnosticReport& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceFullDocumentDiagnosticReport& in, json::StreamWriter& w);
 
 bool operator==(const WorkspaceUnchangedDocumentDiagnosticReport& lhs,
                 const WorkspaceUnchangedDocumentDiagnosticReport& rhs);
 bool operator!=(const WorkspaceUnchangedDocumentDiagnosticReport& lhs,
                 const WorkspaceUnchangedDocumentDiagnosticReport& rhs);
 Result<SuccessType> Decode(const json::Value& v, WorkspaceUnchangedDocumentDiagnosticReport& out);
+Result<SuccessType> Decode(json::StreamReader& r, WorkspaceUnchangedDocumentDiagnosticReport& out);
+bool Matches(const json::Value& v, const WorkspaceUnchangedDocumentDiagnosticReport*);
+bool Matches(json::StreamReader& r, const WorkspaceUnchangedDocumentDiagnosticReport*);
 Result<const json::Value*> Encode(const WorkspaceUnchangedDocumentDiagnosticReport& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const WorkspaceUnchangedDocumentDiagnosticReport& in,
+                           json::StreamWriter& w);
 
 bool operator==(const TextDocumentContentChangePartial& lhs,
                 const TextDocumentContentChangePartial& rhs);
 bool operator!=(const TextDocumentContentChangePartial& lhs,
                 const TextDocumentContentChangePartial& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentContentChangePartial& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentContentChangePartial& out);
+bool Matches(const json::Value& v, const TextDocumentContentChangePartial*);
+bool Matches(json::StreamReader& r, const TextDocumentContentChangePartial*);
 Result<const json::Value*> Encode(const TextDocumentContentChangePartial& in, json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentContentChangePartial& in, json::StreamWriter& w);
 
 bool operator==(const TextDocumentContentChangeWholeDocument& lhs,
                 const TextDocumentContentChangeWholeDocument& rhs);
 bool operator!=(const TextDocumentContentChangeWholeDocument& lhs,
                 const TextDocumentContentChangeWholeDocument& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentContentChangeWholeDocument& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentContentChangeWholeDocument& out);
+bool Matches(const json::Value& v, const TextDocumentContentChangeWholeDocument*);
+bool Matches(json::StreamReader& r, const TextDocumentContentChangeWholeDocument*);
 Result<const json::Value*> Encode(const TextDocumentContentChangeWholeDocument& in,
                                   json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentContentChangeWholeDocument& in, json::StreamWriter& w);
 
 bool operator==(const MarkedStringWithLanguage& lhs, const MarkedStringWithLanguage& rhs);
 bool operator!=(const MarkedStringWithLanguage& lhs, const MarkedStringWithLanguage& rhs);
 Result<SuccessType> Decode(const json::Value& v, MarkedStringWithLanguage& out);
+Result<SuccessType> Decode(json::StreamReader& r, MarkedStringWithLanguage& out);
+bool Matches(const json::Value& v, const MarkedStringWithLanguage*);
+bool Matches(json::StreamReader& r, const MarkedStringWithLanguage*);
 Result<const json::Value*> Encode(const MarkedStringWithLanguage& in, json::Builder& b);
+Result<SuccessType> Encode(const MarkedStringWithLanguage& in, json::StreamWriter& w);
 
 bool operator==(const NotebookCellTextDocumentFilter& lhs,
                 const NotebookCellTextDocumentFilter& rhs);
 bool operator!=(const NotebookCellTextDocumentFilter& lhs,
                 const NotebookCellTextDocumentFilter& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookCellTextDocumentFilter& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookCellTextDocumentFilter& out);
+bool Matches(const json::Value& v, const NotebookCellTextDocumentFilter*);
+bool Matches(json::StreamReader& r, const NotebookCellTextDocumentFilter*);
 Result<const json::Value*> Encode(const NotebookCellTextDocumentFilter& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookCellTextDocumentFilter& in, json::StreamWriter& w);
 
 bool operator==(const RelativePattern& lhs, const RelativePattern& rhs);
 bool operator!=(const RelativePattern& lhs, const RelativePattern& rhs);
 Result<SuccessType> Decode(const json::Value& v, RelativePattern& out);
+Result<SuccessType> Decode(json::StreamReader& r, RelativePattern& out);
+bool Matches(const json::Value& v, const RelativePattern*);
+bool Matches(json::StreamReader& r, const RelativePattern*);
 Result<const json::Value*> Encode(const RelativePattern& in, json::Builder& b);
+Result<SuccessType> Encode(const RelativePattern& in, json::StreamWriter& w);
 
 bool operator==(const TextDocumentFilterLanguage& lhs, const TextDocumentFilterLanguage& rhs);
 bool operator!=(const TextDocumentFilterLanguage& lhs, const TextDocumentFilterLanguage& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentFilterLanguage& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentFilterLanguage& out);
+bool Matches(const json::Value& v, const TextDocumentFilterLanguage*);
+bool Matches(json::StreamReader& r, const TextDocumentFilterLanguage*);
 Result<const json::Value*> Encode(const TextDocumentFilterLanguage& in, json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentFilterLanguage& in, json::StreamWriter& w);
 
 bool operator==(const TextDocumentFilterScheme& lhs, const TextDocumentFilterScheme& rhs);
 bool operator!=(const TextDocumentFilterScheme& lhs, const TextDocumentFilterScheme& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentFilterScheme& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentFilterScheme& out);
+bool Matches(const json::Value& v, const TextDocumentFilterScheme*);
+bool Matches(json::StreamReader& r, const TextDocumentFilterScheme*);
 Result<const json::Value*> Encode(const TextDocumentFilterScheme& in, json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentFilterScheme& in, json::StreamWriter& w);
 
 bool operator==(const TextDocumentFilterPattern& lhs, const TextDocumentFilterPattern& rhs);
 bool operator!=(const TextDocumentFilterPattern& lhs, const TextDocumentFilterPattern& rhs);
 Result<SuccessType> Decode(const json::Value& v, TextDocumentFilterPattern& out);
+Result<SuccessType> Decode(json::StreamReader& r, TextDocumentFilterPattern& out);
+bool Matches(const json::Value& v, const TextDocumentFilterPattern*);
+bool Matches(json::StreamReader& r, const TextDocumentFilterPattern*);
 Result<const json::Value*> Encode(const TextDocumentFilterPattern& in, json::Builder& b);
+Result<SuccessType> Encode(const TextDocumentFilterPattern& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentFilterNotebookType& lhs,
                 const NotebookDocumentFilterNotebookType& rhs);
 bool operator!=(const NotebookDocumentFilterNotebookType& lhs,
                 const NotebookDocumentFilterNotebookType& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentFilterNotebookType& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentFilterNotebookType& out);
+bool Matches(const json::Value& v, const NotebookDocumentFilterNotebookType*);
+bool Matches(json::StreamReader& r, const NotebookDocumentFilterNotebookType*);
 Result<const json::Value*> Encode(const NotebookDocumentFilterNotebookType& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentFilterNotebookType& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentFilterScheme& lhs, const NotebookDocumentFilterScheme& rhs);
 bool operator!=(const NotebookDocumentFilterScheme& lhs, const NotebookDocumentFilterScheme& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentFilterScheme& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentFilterScheme& out);
+bool Matches(const json::Value& v, const NotebookDocumentFilterScheme*);
+bool Matches(json::StreamReader& r, const NotebookDocumentFilterScheme*);
 Result<const json::Value*> Encode(const NotebookDocumentFilterScheme& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentFilterScheme& in, json::StreamWriter& w);
 
 bool operator==(const NotebookDocumentFilterPattern& lhs, const NotebookDocumentFilterPattern& rhs);
 bool operator!=(const NotebookDocumentFilterPattern& lhs, const NotebookDocumentFilterPattern& rhs);
 Result<SuccessType> Decode(const json::Value& v, NotebookDocumentFilterPattern& out);
+Result<SuccessType> Decode(json::StreamReader& r, NotebookDocumentFilterPattern& out);
+bool Matches(const json::Value& v, const NotebookDocumentFilterPattern*);
+bool Matches(json::StreamReader& r, const NotebookDocumentFilterPattern*);
 Result<const json::Value*> Encode(const NotebookDocumentFilterPattern& in, json::Builder& b);
+Result<SuccessType> Encode(const NotebookDocumentFilterPattern& in, json::StreamWriter& w);
+
+////////////////////////////////////////////////////////////////////////////////
+// Methods
+////////////////////////////////////////////////////////////////////////////////
+
+/// MethodId identifies the method of a LSP request or notification
+enum class MethodId : uint16_t {
+    kTextDocumentImplementationRequest,
+    kTextDocumentTypeDefinitionRequest,
+    kWorkspaceWorkspaceFoldersRequest,
+    kWorkspaceConfigurationRequest,
+    kTextDocumentDocumentColorRequest,
+    kTextDocumentColorPresentationRequest,
+    kTextDocumentFoldingRangeRequest,
+    kWorkspaceFoldingRangeRefreshRequest,
+    kTextDocumentDeclarationRequest,
+    kTextDocumentSelectionRangeRequest,
+    kWindowWorkDoneProgressCreateRequest,
+    kTextDocumentPrepareCallHierarchyRequest,
+    kCallHierarchyIncomingCallsRequest,
+    kCallHierarchyOutgoingCallsRequest,
+    kTextDocumentSemanticTokensFullRequest,
+    kTextDocumentSemanticTokensFullDeltaRequest,
+    kTextDocumentSemanticTokensRangeRequest,
+    kWorkspaceSemanticTokensRefreshRequest,
+    kWindowShowDocumentRequest,
+    kTextDocumentLinkedEditingRangeRequest,
+    kWorkspaceWillCreateFilesRequest,
+    kWorkspaceWillRenameFilesRequest,
+    kWorkspaceWillDeleteFilesRequest,
+    kTextDocumentMonikerRequest,
+    kTextDocumentPrepareTypeHierarchyRequest,
+    kTypeHierarchySupertypesRequest,
+    kTypeHierarchySubtypesRequest,
+    kTextDocumentInlineValueRequest,
+    kWorkspaceInlineValueRefreshRequest,
+    kTextDocumentInlayHintRequest,
+    kInlayHintResolveRequest,
+    kWorkspaceInlayHintRefreshRequest,
+    kTextDocumentDiagnosticRequest,
+    kWorkspaceDiagnosticRequest,
+    kWorkspaceDiagnosticRefreshRequest,
+    kTextDocumentInlineCompletionRequest,
+    kClientRegisterCapabilityRequest,
+    kClientUnregisterCapabilityRequest,
+    kInitializeRequest,
+    kShutdownRequest,
+    kWindowShowMessageRequestRequest,
+    kTextDocumentWillSaveWaitUntilRequest,
+    kTextDocumentCompletionRequest,
+    kCompletionItemResolveRequest,
+    kTextDocumentHoverRequest,
+    kTextDocumentSignatureHelpRequest,
+    kTextDocumentDefinitionRequest,
+    kTextDocumentReferencesRequest,
+    kTextDocumentDocumentHighlightRequest,
+    kTextDocumentDocumentSymbolRequest,
+    kTextDocumentCodeActionRequest,
+    kCodeActionResolveRequest,
+    kWorkspaceSymbolRequest,
+    kWorkspaceSymbolResolveRequest,
+    kTextDocumentCodeLensRequest,
+    kCodeLensResolveRequest,
+    kWorkspaceCodeLensRefreshRequest,
+    kTextDocumentDocumentLinkRequest,
+    kDocumentLinkResolveRequest,
+    kTextDocumentFormattingRequest,
+    kTextDocumentRangeFormattingRequest,
+    kTextDocumentRangesFormattingRequest,
+    kTextDocumentOnTypeFormattingRequest,
+    kTextDocumentRenameRequest,
+    kTextDocumentPrepareRenameRequest,
+    kWorkspaceExecuteCommandRequest,
+    kWorkspaceApplyEditRequest,
+    kWorkspaceDidChangeWorkspaceFoldersNotification,
+    kWindowWorkDoneProgressCancelNotification,
+    kWorkspaceDidCreateFilesNotification,
+    kWorkspaceDidRenameFilesNotification,
+    kWorkspaceDidDeleteFilesNotification,
+    kNotebookDocumentDidOpenNotification,
+    kNotebookDocumentDidChangeNotification,
+    kNotebookDocumentDidSaveNotification,
+    kNotebookDocumentDidCloseNotification,
+    kInitializedNotification,
+    kExitNotification,
+    kWorkspaceDidChangeConfigurationNotification,
+    kWindowShowMessageNotification,
+    kWindowLogMessageNotification,
+    kTelemetryEventNotification,
+    kTextDocumentDidOpenNotification,
+    kTextDocumentDidChangeNotification,
+    kTextDocumentDidCloseNotification,
+    kTextDocumentDidSaveNotification,
+    kTextDocumentWillSaveNotification,
+    kWorkspaceDidChangeWatchedFilesNotification,
+    kTextDocumentPublishDiagnosticsNotification,
+    kSetTraceNotification,
+    kLogTraceNotification,
+    kCancelRequestNotification,
+    kProgressNotification,
+};
+
+/// The number of MethodId values
+static constexpr size_t kMethodCount = 93;
+
+/// LookupMethodId looks up the MethodId of a LSP method name
+/// @param method the LSP method name, such as "textDocument/hover"
+/// @param out assigned the MethodId of @p method
+/// @returns true if @p method is the method of a LSP request or notification
+bool LookupMethodId(std::string_view method, MethodId& out);
 
 ////////////////////////////////////////////////////////////////////////////////
 // Requests
@@ -8340,6 +10473,9 @@ struct TextDocumentImplementationRequest : lsp::ImplementationParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/implementation";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentImplementationRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8361,6 +10497,9 @@ struct TextDocumentTypeDefinitionRequest : lsp::TypeDefinitionParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/typeDefinition";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentTypeDefinitionRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8381,6 +10520,9 @@ struct WorkspaceWorkspaceFoldersRequest {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/workspaceFolders";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceWorkspaceFoldersRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = false;
 
@@ -8405,6 +10547,9 @@ struct WorkspaceConfigurationRequest : lsp::ConfigurationParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/configuration";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceConfigurationRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8426,6 +10571,9 @@ struct TextDocumentDocumentColorRequest : lsp::DocumentColorParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/documentColor";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentDocumentColorRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8447,6 +10595,9 @@ struct TextDocumentColorPresentationRequest : lsp::ColorPresentationParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/colorPresentation";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentColorPresentationRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8468,6 +10619,9 @@ struct TextDocumentFoldingRangeRequest : lsp::FoldingRangeParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/foldingRange";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentFoldingRangeRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8489,6 +10643,9 @@ struct WorkspaceFoldingRangeRefreshRequest {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/foldingRange/refresh";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceFoldingRangeRefreshRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = false;
 
@@ -8510,6 +10667,9 @@ struct TextDocumentDeclarationRequest : lsp::DeclarationParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/declaration";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentDeclarationRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8531,6 +10691,9 @@ struct TextDocumentSelectionRangeRequest : lsp::SelectionRangeParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/selectionRange";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentSelectionRangeRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8551,6 +10714,9 @@ struct WindowWorkDoneProgressCreateRequest : lsp::WorkDoneProgressCreateParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "window/workDoneProgress/create";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWindowWorkDoneProgressCreateRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8573,6 +10739,9 @@ struct TextDocumentPrepareCallHierarchyRequest : lsp::CallHierarchyPrepareParams
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/prepareCallHierarchy";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentPrepareCallHierarchyRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8594,6 +10763,9 @@ struct CallHierarchyIncomingCallsRequest : lsp::CallHierarchyIncomingCallsParams
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "callHierarchy/incomingCalls";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kCallHierarchyIncomingCallsRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8615,6 +10787,9 @@ struct CallHierarchyOutgoingCallsRequest : lsp::CallHierarchyOutgoingCallsParams
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "callHierarchy/outgoingCalls";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kCallHierarchyOutgoingCallsRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8634,6 +10809,9 @@ struct TextDocumentSemanticTokensFullRequest : lsp::SemanticTokensParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/semanticTokens/full";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentSemanticTokensFullRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8653,6 +10831,9 @@ struct TextDocumentSemanticTokensFullDeltaRequest : lsp::SemanticTokensDeltaPara
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/semanticTokens/full/delta";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentSemanticTokensFullDeltaRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8672,6 +10853,9 @@ struct TextDocumentSemanticTokensRangeRequest : lsp::SemanticTokensRangeParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/semanticTokens/range";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentSemanticTokensRangeRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8691,6 +10875,9 @@ struct WorkspaceSemanticTokensRefreshRequest {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/semanticTokens/refresh";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceSemanticTokensRefreshRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = false;
 
@@ -8714,6 +10901,9 @@ struct WindowShowDocumentRequest : lsp::ShowDocumentParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "window/showDocument";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWindowShowDocumentRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8735,6 +10925,9 @@ struct TextDocumentLinkedEditingRangeRequest : lsp::LinkedEditingRangeParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/linkedEditingRange";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentLinkedEditingRangeRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8759,6 +10952,9 @@ struct WorkspaceWillCreateFilesRequest : lsp::CreateFilesParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/willCreateFiles";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceWillCreateFilesRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8781,6 +10977,9 @@ struct WorkspaceWillRenameFilesRequest : lsp::RenameFilesParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/willRenameFiles";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceWillRenameFilesRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8803,6 +11002,9 @@ struct WorkspaceWillDeleteFilesRequest : lsp::DeleteFilesParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/willDeleteFiles";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceWillDeleteFilesRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8824,6 +11026,9 @@ struct TextDocumentMonikerRequest : lsp::MonikerParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/moniker";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentMonikerRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8846,6 +11051,9 @@ struct TextDocumentPrepareTypeHierarchyRequest : lsp::TypeHierarchyPrepareParams
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/prepareTypeHierarchy";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentPrepareTypeHierarchyRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8867,6 +11075,9 @@ struct TypeHierarchySupertypesRequest : lsp::TypeHierarchySupertypesParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "typeHierarchy/supertypes";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTypeHierarchySupertypesRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8888,6 +11099,9 @@ struct TypeHierarchySubtypesRequest : lsp::TypeHierarchySubtypesParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "typeHierarchy/subtypes";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTypeHierarchySubtypesRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8911,6 +11125,9 @@ struct TextDocumentInlineValueRequest : lsp::InlineValueParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/inlineValue";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentInlineValueRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8930,6 +11147,9 @@ struct WorkspaceInlineValueRefreshRequest {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/inlineValue/refresh";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceInlineValueRefreshRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = false;
 
@@ -8953,6 +11173,9 @@ struct TextDocumentInlayHintRequest : lsp::InlayHintParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/inlayHint";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentInlayHintRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8975,6 +11198,9 @@ struct InlayHintResolveRequest : lsp::InlayHint {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "inlayHint/resolve";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kInlayHintResolveRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -8994,6 +11220,9 @@ struct WorkspaceInlayHintRefreshRequest {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/inlayHint/refresh";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceInlayHintRefreshRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = false;
 
@@ -9015,6 +11244,9 @@ struct TextDocumentDiagnosticRequest : lsp::DocumentDiagnosticParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/diagnostic";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentDiagnosticRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9036,6 +11268,9 @@ struct WorkspaceDiagnosticRequest : lsp::WorkspaceDiagnosticParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/diagnostic";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceDiagnosticRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9057,6 +11292,9 @@ struct WorkspaceDiagnosticRefreshRequest {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/diagnostic/refresh";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceDiagnosticRefreshRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = false;
 
@@ -9082,6 +11320,9 @@ struct TextDocumentInlineCompletionRequest : lsp::InlineCompletionParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/inlineCompletion";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentInlineCompletionRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9103,6 +11344,9 @@ struct ClientRegisterCapabilityRequest : lsp::RegistrationParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "client/registerCapability";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kClientRegisterCapabilityRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9123,6 +11367,9 @@ struct ClientUnregisterCapabilityRequest : lsp::UnregistrationParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "client/unregisterCapability";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kClientUnregisterCapabilityRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9144,6 +11391,9 @@ struct InitializeRequest : lsp::InitializeParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "initialize";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kInitializeRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9165,6 +11415,9 @@ struct ShutdownRequest {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "shutdown";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kShutdownRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = false;
 
@@ -9185,6 +11438,9 @@ struct WindowShowMessageRequestRequest : lsp::ShowMessageRequestParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "window/showMessageRequest";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWindowShowMessageRequestRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9208,6 +11464,9 @@ struct TextDocumentWillSaveWaitUntilRequest : lsp::WillSaveTextDocumentParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/willSaveWaitUntil";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentWillSaveWaitUntilRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9233,6 +11492,9 @@ struct TextDocumentCompletionRequest : lsp::CompletionParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/completion";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentCompletionRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9254,6 +11516,9 @@ struct CompletionItemResolveRequest : lsp::CompletionItem {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "completionItem/resolve";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kCompletionItemResolveRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9275,6 +11540,9 @@ struct TextDocumentHoverRequest : lsp::HoverParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/hover";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentHoverRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9294,6 +11562,9 @@ struct TextDocumentSignatureHelpRequest : lsp::SignatureHelpParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/signatureHelp";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentSignatureHelpRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9315,6 +11586,9 @@ struct TextDocumentDefinitionRequest : lsp::DefinitionParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/definition";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentDefinitionRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9336,6 +11610,9 @@ struct TextDocumentReferencesRequest : lsp::ReferenceParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/references";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentReferencesRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9357,6 +11634,9 @@ struct TextDocumentDocumentHighlightRequest : lsp::DocumentHighlightParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/documentHighlight";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentDocumentHighlightRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9378,6 +11658,9 @@ struct TextDocumentDocumentSymbolRequest : lsp::DocumentSymbolParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/documentSymbol";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentDocumentSymbolRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9398,6 +11681,9 @@ struct TextDocumentCodeActionRequest : lsp::CodeActionParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/codeAction";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentCodeActionRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9418,6 +11704,9 @@ struct CodeActionResolveRequest : lsp::CodeAction {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "codeAction/resolve";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kCodeActionResolveRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9442,6 +11731,9 @@ struct WorkspaceSymbolRequest : lsp::WorkspaceSymbolParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/symbol";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceSymbolRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9464,6 +11756,9 @@ struct WorkspaceSymbolResolveRequest : lsp::WorkspaceSymbol {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspaceSymbol/resolve";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceSymbolResolveRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9483,6 +11778,9 @@ struct TextDocumentCodeLensRequest : lsp::CodeLensParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/codeLens";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentCodeLensRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9502,6 +11800,9 @@ struct CodeLensResolveRequest : lsp::CodeLens {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "codeLens/resolve";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kCodeLensResolveRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9523,6 +11824,9 @@ struct WorkspaceCodeLensRefreshRequest {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/codeLens/refresh";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceCodeLensRefreshRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = false;
 
@@ -9542,6 +11846,9 @@ struct TextDocumentDocumentLinkRequest : lsp::DocumentLinkParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/documentLink";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentDocumentLinkRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9562,6 +11869,9 @@ struct DocumentLinkResolveRequest : lsp::DocumentLink {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "documentLink/resolve";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kDocumentLinkResolveRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9581,6 +11891,9 @@ struct TextDocumentFormattingRequest : lsp::DocumentFormattingParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/formatting";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentFormattingRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9600,6 +11913,9 @@ struct TextDocumentRangeFormattingRequest : lsp::DocumentRangeFormattingParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/rangeFormatting";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentRangeFormattingRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9623,6 +11939,9 @@ struct TextDocumentRangesFormattingRequest : lsp::DocumentRangesFormattingParams
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/rangesFormatting";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentRangesFormattingRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9642,6 +11961,9 @@ struct TextDocumentOnTypeFormattingRequest : lsp::DocumentOnTypeFormattingParams
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/onTypeFormatting";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentOnTypeFormattingRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9661,6 +11983,9 @@ struct TextDocumentRenameRequest : lsp::RenameParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/rename";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentRenameRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9682,6 +12007,9 @@ struct TextDocumentPrepareRenameRequest : lsp::PrepareRenameParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "textDocument/prepareRename";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentPrepareRenameRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9702,6 +12030,9 @@ struct WorkspaceExecuteCommandRequest : lsp::ExecuteCommandParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/executeCommand";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceExecuteCommandRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9721,6 +12052,9 @@ struct WorkspaceApplyEditRequest : lsp::ApplyWorkspaceEditParams {
     /// The LSP name for the request
     static constexpr std::string_view kMethod = "workspace/applyEdit";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceApplyEditRequest;
+
     /// Does the request take parameters?
     static constexpr bool kHasParams = true;
 
@@ -9745,6 +12079,9 @@ struct WorkspaceDidChangeWorkspaceFoldersNotification : lsp::DidChangeWorkspaceF
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "workspace/didChangeWorkspaceFolders";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceDidChangeWorkspaceFoldersNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9758,6 +12095,9 @@ struct WindowWorkDoneProgressCancelNotification : lsp::WorkDoneProgressCancelPar
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "window/workDoneProgress/cancel";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWindowWorkDoneProgressCancelNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9773,6 +12113,9 @@ struct WorkspaceDidCreateFilesNotification : lsp::CreateFilesParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "workspace/didCreateFiles";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceDidCreateFilesNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9788,6 +12131,9 @@ struct WorkspaceDidRenameFilesNotification : lsp::RenameFilesParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "workspace/didRenameFiles";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceDidRenameFilesNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9803,6 +12149,9 @@ struct WorkspaceDidDeleteFilesNotification : lsp::DeleteFilesParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "workspace/didDeleteFiles";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceDidDeleteFilesNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9817,6 +12166,9 @@ struct NotebookDocumentDidOpenNotification : lsp::DidOpenNotebookDocumentParams
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "notebookDocument/didOpen";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kNotebookDocumentDidOpenNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9829,6 +12181,9 @@ struct NotebookDocumentDidChangeNotification : lsp::DidChangeNotebookDocumentPar
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "notebookDocument/didChange";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kNotebookDocumentDidChangeNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9843,6 +12198,9 @@ struct NotebookDocumentDidSaveNotification : lsp::DidSaveNotebookDocumentParams
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "notebookDocument/didSave";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kNotebookDocumentDidSaveNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9857,6 +12215,9 @@ struct NotebookDocumentDidCloseNotification : lsp::DidCloseNotebookDocumentParam
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "notebookDocument/didClose";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kNotebookDocumentDidCloseNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9870,6 +12231,9 @@ struct InitializedNotification : lsp::InitializedParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "initialized";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kInitializedNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9882,6 +12246,9 @@ struct ExitNotification {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "exit";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kExitNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = false;
 };
@@ -9896,6 +12263,9 @@ struct WorkspaceDidChangeConfigurationNotification : lsp::DidChangeConfiguration
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "workspace/didChangeConfiguration";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceDidChangeConfigurationNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9909,6 +12279,9 @@ struct WindowShowMessageNotification : lsp::ShowMessageParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "window/showMessage";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWindowShowMessageNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9922,6 +12295,9 @@ struct WindowLogMessageNotification : lsp::LogMessageParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "window/logMessage";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWindowLogMessageNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9935,6 +12311,9 @@ struct TelemetryEventNotification : lsp::LSPAny {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "telemetry/event";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTelemetryEventNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9952,6 +12331,9 @@ struct TextDocumentDidOpenNotification : lsp::DidOpenTextDocumentParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "textDocument/didOpen";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentDidOpenNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9965,6 +12347,9 @@ struct TextDocumentDidChangeNotification : lsp::DidChangeTextDocumentParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "textDocument/didChange";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentDidChangeNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9982,6 +12367,9 @@ struct TextDocumentDidCloseNotification : lsp::DidCloseTextDocumentParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "textDocument/didClose";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentDidCloseNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -9995,6 +12383,9 @@ struct TextDocumentDidSaveNotification : lsp::DidSaveTextDocumentParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "textDocument/didSave";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentDidSaveNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -10008,6 +12399,9 @@ struct TextDocumentWillSaveNotification : lsp::WillSaveTextDocumentParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "textDocument/willSave";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentWillSaveNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -10021,6 +12415,9 @@ struct WorkspaceDidChangeWatchedFilesNotification : lsp::DidChangeWatchedFilesPa
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "workspace/didChangeWatchedFiles";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kWorkspaceDidChangeWatchedFilesNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -10034,6 +12431,9 @@ struct TextDocumentPublishDiagnosticsNotification : lsp::PublishDiagnosticsParam
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "textDocument/publishDiagnostics";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kTextDocumentPublishDiagnosticsNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -10046,6 +12446,9 @@ struct SetTraceNotification : lsp::SetTraceParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "$/setTrace";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kSetTraceNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -10058,6 +12461,9 @@ struct LogTraceNotification : lsp::LogTraceParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "$/logTrace";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kLogTraceNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -10070,6 +12476,9 @@ struct CancelRequestNotification : lsp::CancelParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "$/cancelRequest";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kCancelRequestNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
@@ -10082,6 +12491,9 @@ struct ProgressNotification : lsp::ProgressParams {
     /// The LSP name for the notification
     static constexpr std::string_view kMethod = "$/progress";
 
+    /// The identifier of the LSP method
+    static constexpr MethodId kMethodId = MethodId::kProgressNotification;
+
     /// Does the Notification take parameters?
     static constexpr bool kHasParams = true;
 };
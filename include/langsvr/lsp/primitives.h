@@ -31,6 +31,8 @@
 #include <stdint.h>
 #include <string>
 
+#include "langsvr/traits.h"
+
 namespace langsvr::lsp {
 
 using Boolean = bool;
@@ -53,6 +55,9 @@ inline bool operator!=(Null, Null) {
     return false;
 }
 
+/// Null is held inline by OneOf and Optional
+void EnableInlineStorage(InlineStorageTag<Null>);
+
 }  // namespace langsvr::lsp
 
 #endif  // LANGSVR_LSP_PRIMITIVES_H_
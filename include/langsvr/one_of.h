@@ -28,7 +28,10 @@
 #ifndef LANGSVR_ONE_OF_H_
 #define LANGSVR_ONE_OF_H_
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -36,9 +39,10 @@
 
 namespace langsvr {
 
-/// OneOf is similar to std::variant with an implicit std::monostate, but internally uses a pointer
-/// for the value. This allows OneOf to use forward-declared type lists, which is required as the
-/// LSP has cyclic dependencies.
+/// OneOf is similar to std::variant with an implicit std::monostate. Values of small
+/// inline-storable types (see IsInline) are held within the OneOf, and all other types are held by
+/// pointer. This allows OneOf to use forward-declared type lists, which is required as the LSP has
+/// cyclic dependencies.
 template <typename... TYPES>
 struct OneOf {
     template <typename T>
@@ -62,27 +66,44 @@ struct OneOf {
     OneOf(const OneOf& other) { *this = other; }
 
     /// Move constructor
-    OneOf(OneOf&& other) {
-        ptr = other.ptr;
-        kind = other.kind;
-        other.ptr = nullptr;
-    }
+    OneOf(OneOf&& other) { MoveFrom(other); }
 
     /// Copy assignment operator
     OneOf& operator=(const OneOf& other) {
+        if (this == &other) {
+            return *this;
+        }
         Reset();
-        auto copy = [this](auto* p) {
-            if (p) {
-                this->ptr = new std::decay_t<decltype(*p)>(*p);
-                return true;
-            }
-            return false;
-        };
-        (copy(other.Get<TYPES>()) || ...);
+        if constexpr (kIsTrivial) {
+            std::memcpy(storage, other.storage, sizeof(storage));
+        } else {
+            auto copy = [this](auto* p) {
+                if (p) {
+                    using T = std::decay_t<decltype(*p)>;
+                    if constexpr (IsInline<T>) {
+                        new (storage) T(*p);
+                    } else {
+                        this->ptr = new T(*p);
+                    }
+                    return true;
+                }
+                return false;
+            };
+            (copy(other.Get<TYPES>()) || ...);
+        }
         kind = other.kind;
         return *this;
     }
 
+    /// Move assignment operator
+    OneOf& operator=(OneOf&& other) {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
     /// Move assignment constructor
     template <typename T, typename = std::enable_if_t<IsValidType<T>>>
     OneOf& operator=(T&& value) {
@@ -106,7 +127,9 @@ struct OneOf {
 
     /// Reset clears the value of the OneOf
     void Reset() {
-        (delete Get<TYPES>(), ...);
+        if constexpr (!kIsTrivial) {
+            (Destroy(Get<TYPES>()), ...);
+        }
         ptr = nullptr;
         kind = kNoKind;
     }
@@ -116,8 +139,12 @@ struct OneOf {
     void Set(T&& value) {
         using D = std::decay_t<T>;
         Reset();
+        if constexpr (IsInline<D>) {
+            new (storage) D(std::forward<T>(value));
+        } else {
+            ptr = new D(std::forward<T>(value));
+        }
         kind = static_cast<uint8_t>(TypeIndex<D, TYPES...>);
-        ptr = new D(std::forward<T>(value));
     }
 
     /// @returns true if the OneOf holds a value of the type T
@@ -129,13 +156,20 @@ struct OneOf {
     /// @returns a pointer to the value if the value is of type T
     template <typename T>
     T* Get() {
-        return this->Is<T>() ? static_cast<T*>(ptr) : nullptr;
+        if (!this->Is<T>()) {
+            return nullptr;
+        }
+        if constexpr (IsInline<T>) {
+            return std::launder(reinterpret_cast<T*>(storage));
+        } else {
+            return static_cast<T*>(ptr);
+        }
     }
 
     /// @returns a pointer to the value if the value is of type T
     template <typename T>
     const T* Get() const {
-        return this->Is<T>() ? static_cast<const T*>(ptr) : nullptr;
+        return const_cast<OneOf*>(this)->Get<T>();
     }
 
     /// Visit calls @p cb passing the value held by the OneOf as the single argument.
@@ -166,7 +200,58 @@ struct OneOf {
   private:
     static_assert(sizeof...(TYPES) < 255);
     static constexpr uint8_t kNoKind = 0xff;
-    void* ptr = nullptr;
+
+    /// The size and alignment of the storage, which holds either a pointer or an inline value
+    static constexpr size_t kStorageSize =
+        std::max({sizeof(void*), detail::InlineLayout<TYPES>::size...});
+    static constexpr size_t kStorageAlign =
+        std::max({alignof(void*), detail::InlineLayout<TYPES>::align...});
+
+    /// True if all the types are held inline and are trivially copyable, in which case the OneOf
+    /// is copied with a memcpy() and never destructs the value.
+    static constexpr bool kIsTrivial = std::conjunction_v<detail::IsTriviallyInline<TYPES>...>;
+
+    /// Destroys the value pointed to by @p p, if @p p is not null
+    template <typename T>
+    static void Destroy(T* p) {
+        if (p) {
+            if constexpr (IsInline<T>) {
+                p->~T();
+            } else {
+                delete p;
+            }
+        }
+    }
+
+    /// Moves the value of @p other to this OneOf, which must be empty, and resets @p other.
+    void MoveFrom(OneOf& other) {
+        if constexpr (kIsTrivial) {
+            std::memcpy(storage, other.storage, sizeof(storage));
+        } else {
+            auto move = [this](auto* p) {
+                if (p) {
+                    using T = std::decay_t<decltype(*p)>;
+                    if constexpr (IsInline<T>) {
+                        new (storage) T(std::move(*p));
+                        p->~T();
+                    } else {
+                        this->ptr = p;
+                    }
+                    return true;
+                }
+                return false;
+            };
+            (move(other.Get<TYPES>()) || ...);
+        }
+        kind = other.kind;
+        other.ptr = nullptr;
+        other.kind = kNoKind;
+    }
+
+    union {
+        void* ptr = nullptr;
+        alignas(kStorageAlign) unsigned char storage[kStorageSize];
+    };
     uint8_t kind = 0xff;
 };
 
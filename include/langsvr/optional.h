@@ -29,14 +29,97 @@
 #define LANGSVR_OPTIONAL_H_
 
 #include <cassert>
+#include <new>
 #include <type_traits>
 #include <utility>
 
+#include "langsvr/traits.h"
+
+namespace langsvr::detail {
+
+/// IsOptionalInline is true if an Optional<T> holds its value inline. This requires T to be
+/// inline-storable, and the value and its presence flag to fit within a pointer, so that storing
+/// the value inline never makes the Optional larger than holding it on the heap.
+template <typename T>
+static constexpr bool IsOptionalInline =
+    IsInline<T> && InlineLayout<T>::size + InlineLayout<T>::align <= sizeof(void*);
+
+/// OptionalStorage holds the value of an Optional<T> on the heap.
+/// This allows Optional to be used with forward-declared types.
+template <typename T, bool INLINE = IsOptionalInline<T>>
+struct OptionalStorage {
+    /// @returns a pointer to the value, or nullptr if there is no value
+    T* Ptr() { return ptr; }
+    const T* Ptr() const { return ptr; }
+
+    /// Constructs the value from @p args. There must be no existing value.
+    template <typename... ARGS>
+    void Emplace(ARGS&&... args) {
+        ptr = new T(std::forward<ARGS>(args)...);
+    }
+
+    /// Destructs the value, if there is one
+    void Reset() {
+        delete ptr;
+        ptr = nullptr;
+    }
+
+    /// Moves the value of @p other to this storage, which must have no value, and resets @p other
+    void MoveFrom(OptionalStorage& other) {
+        ptr = other.ptr;
+        other.ptr = nullptr;
+    }
+
+    T* ptr = nullptr;
+};
+
+/// OptionalStorage holds the value of an Optional<T> inline, for small inline-storable types.
+template <typename T>
+struct OptionalStorage<T, true> {
+    OptionalStorage() {}
+    ~OptionalStorage() {}
+
+    /// @returns a pointer to the value, or nullptr if there is no value
+    T* Ptr() { return has_value ? &value : nullptr; }
+    const T* Ptr() const { return has_value ? &value : nullptr; }
+
+    /// Constructs the value from @p args. There must be no existing value.
+    template <typename... ARGS>
+    void Emplace(ARGS&&... args) {
+        new (&value) T(std::forward<ARGS>(args)...);
+        has_value = true;
+    }
+
+    /// Destructs the value, if there is one
+    void Reset() {
+        if (has_value) {
+            value.~T();
+            has_value = false;
+        }
+    }
+
+    /// Moves the value of @p other to this storage, which must have no value, and resets @p other
+    void MoveFrom(OptionalStorage& other) {
+        if (other.has_value) {
+            Emplace(std::move(other.value));
+            other.Reset();
+        }
+    }
+
+    union {
+        T value;
+    };
+    bool has_value = false;
+};
+
+}  // namespace langsvr::detail
+
 namespace langsvr {
 
-/// Optional is similar to std::optional, but internally uses a pointer for the value. This allows
-/// Optional to use forward-declared type lists, which is required as the LSP has cyclic
-/// dependencies.
+/// Optional is similar to std::optional. Values of inline-storable types (see IsInline) that fit
+/// in a pointer alongside a presence flag are held within the Optional, and all other types are
+/// held by pointer. This allows Optional to use forward-declared type lists, which is required as
+/// the LSP has cyclic dependencies.
 template <typename T>
 struct Optional {
     /// Constructor
@@ -59,53 +142,47 @@ struct Optional {
     Optional(T&& other) { *this = std::move(other); }
 
     /// Reset clears the value from the optional
-    void Reset() {
-        if (ptr) {
-            delete ptr;
-            ptr = nullptr;
-        }
-    }
+    void Reset() { storage.Reset(); }
 
     /// Copy assignment operator
     Optional& operator=(const Optional& other) {
-        Reset();
-        if (other.ptr) {
-            ptr = new T(*other);
+        if (this != &other) {
+            Reset();
+            if (other) {
+                storage.Emplace(*other);
+            }
         }
         return *this;
     }
 
     /// Move assignment operator
     Optional& operator=(Optional&& other) {
-        Reset();
-        ptr = other.ptr;
-        other.ptr = nullptr;
+        if (this != &other) {
+            Reset();
+            storage.MoveFrom(other.storage);
+        }
         return *this;
     }
 
     /// Copy assignment operator
     Optional& operator=(const T& value) {
         Reset();
-        if (!ptr) {
-            ptr = new T(value);
-        }
+        storage.Emplace(value);
         return *this;
     }
 
     /// Move assignment operator
     Optional& operator=(T&& value) {
         Reset();
-        if (!ptr) {
-            ptr = new T(std::move(value));
-        }
+        storage.Emplace(std::move(value));
         return *this;
     }
 
     /// @returns true if the optional holds a value
-    operator bool() const { return ptr != nullptr; }
+    operator bool() const { return storage.Ptr() != nullptr; }
 
     /// @returns false if the optional holds a value
-    bool operator!() const { return ptr == nullptr; }
+    bool operator!() const { return storage.Ptr() == nullptr; }
 
     T* operator->() { return &Get(); }
     const T* operator->() const { return &Get(); }
@@ -119,7 +196,7 @@ struct Optional {
         if constexpr (std::is_same_v<Optional, std::decay_t<V>>) {
             return (!*this && !value) || (*this && value && (Get() == value.Get()));
         } else {
-            if (!ptr) {
+            if (!*this) {
                 return false;
             }
             return Get() == std::forward<V>(value);
@@ -134,16 +211,16 @@ struct Optional {
 
   private:
     T& Get() {
-        assert(ptr);
-        return *ptr;
+        assert(storage.Ptr());
+        return *storage.Ptr();
     }
 
     const T& Get() const {
-        assert(ptr);
-        return *ptr;
+        assert(storage.Ptr());
+        return *storage.Ptr();
     }
 
-    T* ptr = nullptr;
+    detail::OptionalStorage<T> storage;
 };
 
 }  // namespace langsvr
@@ -50,6 +50,18 @@ class Reader {
     /// then the end of the stream has been reached.
     virtual size_t Read(std::byte* out, size_t count) = 0;
 
+    /// ReadSome reads up to @p count bytes from the stream, blocking until at least one byte is
+    /// available, or the end of the stream has been reached. Unlike Read(), ReadSome() does not
+    /// wait for more bytes once some have been read, so it can be used to fill a buffer from a pipe
+    /// without waiting for data that has not been sent.
+    /// The default implementation reads a single byte with Read().
+    /// @param out a pointer to the byte buffer that will be filled with the read data. Must be at
+    /// least @p count size.
+    /// @param count the maximum number of bytes to read. Must be greater than 0.
+    /// @returns the number of bytes read from the stream. If ReadSome() returns 0, then the end of
+    /// the stream has been reached.
+    virtual size_t ReadSome(std::byte* out, size_t count);
+
     /// Reads a string of @p len bytes from the stream.
     /// If there are too few bytes remaining in the stream, then a failure is returned.
     /// @param len the length of the returned string in bytes
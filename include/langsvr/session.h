@@ -28,45 +28,113 @@
 #ifndef LANGSVR_SESSION_H_
 #define LANGSVR_SESSION_H_
 
+#include <array>
+#include <atomic>
+#include <deque>
 #include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "langsvr/cancellation_token.h"
+#include "langsvr/executor.h"
 #include "langsvr/json/builder.h"
+#include "langsvr/json/stream_reader.h"
+#include "langsvr/json/stream_writer.h"
 #include "langsvr/json/value.h"
 #include "langsvr/lsp/lsp.h"
 #include "langsvr/lsp/message_kind.h"
 #include "langsvr/one_of.h"
 #include "langsvr/result.h"
 
+namespace langsvr::detail {
+
+/// HasTextDocumentUri is true if T has a 'text_document' member with a 'uri' member
+template <typename T, typename = void>
+struct HasTextDocumentUri : std::false_type {};
+template <typename T>
+struct HasTextDocumentUri<T, std::void_t<decltype(std::declval<T>().text_document.uri)>>
+    : std::true_type {};
+
+}  // namespace langsvr::detail
+
 namespace langsvr {
 
+template <typename T>
+class Responder;
+
 /// Session provides a message dispatch registry for LSP messages.
 class Session {
-    struct RequestHandler {
-        // Returns a member of 'result' or 'error'
-        std::function<Result<json::Builder::Member>(const json::Value&, json::Builder&)> function;
+    // Request handlers are shared with the tasks posted to the executor, so that registering a new
+    // handler for the same method does not destroy a handler that is still in use.
+    struct RequestHandler : std::enable_shared_from_this<RequestHandler> {
+        // Decodes the raw JSON 'params' of the request with the given 'id', then calls the handler
+        // and sends the response, or posts this to the executor
+        std::function<Result<SuccessType>(Session&,
+                                          const RequestHandler&,
+                                          json::I64,
+                                          std::string_view)>
+            function;
         std::function<void()> post_send;
     };
     struct NotificationHandler {
-        std::function<Result<SuccessType>(const json::Value&)> function;
+        // Decodes the raw JSON 'params' of the notification, then calls the handler, or posts this
+        // to the executor
+        std::function<Result<SuccessType>(Session&, std::string_view)> function;
     };
 
   public:
     using Sender = std::function<Result<SuccessType>(std::string_view)>;
+    using ErrorHandler = std::function<void(const Failure&)>;
 
     /// SetSender sets the message send handler used by Session for sending request responses and
-    /// notifications.
+    /// notifications. Calls to the sender are serialized, but may be made from the executor's
+    /// threads, or from any thread that completes a Responder.
     /// @param sender the new sender for the session.
     void SetSender(Sender&& sender) { sender_ = std::move(sender); }
 
+    /// SetExecutor sets the executor used to run the registered request and notification handlers.
+    /// If no executor is set, then handlers are called by Receive() before it returns.
+    /// If an executor is set, then Receive() decodes the message params and posts the handler call
+    /// to the executor. Messages that act on the same text document are handled in the order they
+    /// were received, as are the notifications that do not act on a text document. Messages that
+    /// act on different text documents, and requests that do not act on a text document, may be
+    /// handled concurrently, and the responses to requests are sent as they complete. An 'exit'
+    /// notification is only handled once the handlers of all the messages received before it have
+    /// returned, and the messages received after it are only handled once its handler has
+    /// returned.
+    /// When using an executor:
+    ///  * Failures of the handlers and of sending their responses are passed to the ErrorHandler.
+    ///  * All posted tasks must have completed, and all Responders must have been destructed,
+    ///    before the Session is destructed.
+    /// SetExecutor must not be called while messages are being handled.
+    /// @param executor the executor, or nullptr to call handlers synchronously
+    void SetExecutor(Executor* executor) { executor_ = executor; }
+
+    /// SetErrorHandler sets the handler called with the failures of the message handlers run by the
+    /// executor, which cannot be returned by Receive(). The error handler may be called
+    /// concurrently from the executor's threads.
+    /// @param handler the new error handler for the session.
+    void SetErrorHandler(ErrorHandler&& handler) { error_handler_ = std::move(handler); }
+
     /// Receive decodes the LSP message from the JSON string @p json, calling the appropriate
     /// registered message handler, and sending the response to the registered Sender if the message
     /// was an LSP request.
+    /// Only the message envelope ('id', 'method') is decoded up front. The 'params' are only
+    /// decoded if there is a handler registered for the message.
+    /// @p json is tokenized in place, and is not referenced once Receive() returns, even when using
+    /// an executor, so it may be a view of a reused buffer, such as the one passed to
+    /// ReadContent(Reader&, std::string&).
+    /// '$/cancelRequest' notifications are handled by the Session, before calling any registered
+    /// handler. Requests queued on the executor that are cancelled before they start are not passed
+    /// to their handler, and a 'RequestCancelled' error is sent in place of the result of any
+    /// cancelled request.
     /// @param json the incoming JSON message.
     /// @return success or failure
     Result<SuccessType> Receive(std::string_view json);
@@ -94,20 +162,27 @@ class Session {
     template <typename T>
     Result<std::future<typename std::decay_t<T>::ResultType>> SendRequest(T&& request) {
         using Request = std::decay_t<T>;
-        auto b = json::Builder::Create();
-        auto id = next_request_id_++;
-        std::vector<json::Builder::Member> members{
-            json::Builder::Member{"jsonrpc", b->String("2.0")},
-            json::Builder::Member{"id", b->I64(id)},
-            json::Builder::Member{"method", b->String(Request::kMethod)},
-        };
+        json::I64 id = 0;
+        {
+            std::lock_guard lock(response_handlers_mutex_);
+            id = next_request_id_++;
+        }
+        auto writer = writers_.Acquire();
+        auto& w = *writer;
+        w.BeginObject();
+        w.Key("jsonrpc");
+        w.String("2.0");
+        w.Key("id");
+        w.I64(id);
+        w.Key("method");
+        w.String(Request::kMethod);
         if constexpr (Request::kHasParams) {
-            auto params = Encode(request, *b.get());
-            if (params != Success) {
-                return params.Failure();
+            w.Key("params");
+            if (auto res = Encode(request, w); res != Success) {
+                return res.Failure();
             }
-            members.push_back(json::Builder::Member{"params", params.Get()});
         }
+        w.EndObject();
 
         using ResponseResultType = typename Request::ResultType;
         using ResponseSuccessType = typename Request::SuccessType;
@@ -115,6 +190,7 @@ class Session {
 
         // TODO: Avoid the need for a shared pointer.
         auto promise = std::make_shared<std::promise<ResponseResultType>>();
+        std::unique_lock lock(response_handlers_mutex_);
         response_handlers_.emplace(
             id, [promise](const json::Value& response) -> Result<SuccessType> {
                 if (auto result_json = response.Get(kResponseResult); result_json == Success) {
@@ -140,8 +216,9 @@ class Session {
                 }
                 return Success;
             });
+        lock.unlock();
 
-        auto send = SendJson(b->Object(members)->Json());
+        auto send = SendJson(w.Json());
         if (send != Success) {
             return send.Failure();
         }
@@ -156,19 +233,21 @@ class Session {
     template <typename T>
     Result<SuccessType> SendNotification(T&& notification) {
         using Notification = std::decay_t<T>;
-        auto b = json::Builder::Create();
-        std::vector<json::Builder::Member> members{
-            json::Builder::Member{"jsonrpc", b->String("2.0")},
-            json::Builder::Member{"method", b->String(Notification::kMethod)},
-        };
+        auto writer = writers_.Acquire();
+        auto& w = *writer;
+        w.BeginObject();
+        w.Key("jsonrpc");
+        w.String("2.0");
+        w.Key("method");
+        w.String(Notification::kMethod);
         if constexpr (Notification::kHasParams) {
-            auto params = Encode(notification, *b.get());
-            if (params != Success) {
-                return params.Failure();
+            w.Key("params");
+            if (auto res = Encode(notification, w); res != Success) {
+                return res.Failure();
             }
-            members.push_back(json::Builder::Member{"params", params.Get()});
         }
-        return SendJson(b->Object(members)->Json());
+        w.EndObject();
+        return SendJson(w.Json());
     }
 
     /// RegisteredRequestHandler is the return type Register() when registering a Request handler.
@@ -194,15 +273,20 @@ class Session {
     /// `T` is a LSP request and `RESULT` is one of:
     ///   * `Result<T::Result, T::Failure>`
     ///   * `T::Result`
+    ///   * `lsp::Encoded<T::Result>`
     ///   * `T::Failure`
     /// `T` is a LSP notification and `RESULT` is `Result<SuccessType>`.
+    /// Request handlers may also take the signature `RESULT(const T&, const CancellationToken&)`,
+    /// or `void(const T&, Responder<T>)` to send the response later with the Responder.
+    /// Registering a handler replaces any handler previously registered for the same message type.
+    /// Tasks already posted to the executor keep the replaced handler alive, and still call it.
     /// @return a RegisteredRequestHandler if the parameter type of F is a LSP request, otherwise
     /// void.
     template <typename F>
     auto Register(F&& callback) {
         // Examine the function signature to determine the message type
         using Sig = SignatureOf<F>;
-        static_assert(Sig::parameter_count == 1);
+        static_assert(Sig::parameter_count == 1 || Sig::parameter_count == 2);
         using Message = typename Sig::template parameter<0>;
 
         // Is the message a request or notification?
@@ -211,101 +295,473 @@ class Session {
             Message::kMessageKind == lsp::MessageKind::kNotification;
         static_assert(kIsRequest || kIsNotification);
 
-        // The method is the identification string used in the JSON message.
-        auto method = std::string(Message::kMethod);
+        // Does the request handler take a CancellationToken, or a Responder to respond later?
+        using LastParameter = typename Sig::template parameter<Sig::parameter_count - 1>;
+        static constexpr bool kTakesToken = std::is_same_v<LastParameter, CancellationToken>;
+        static constexpr bool kIsDeferred = std::is_same_v<LastParameter, Responder<Message>>;
+        static_assert(Sig::parameter_count == 1 || (kIsRequest && (kTakesToken || kIsDeferred)),
+                      "the second parameter of a request handler must be a CancellationToken or "
+                      "a Responder of the request type");
+
+        // Handlers are indexed by the identifier of the message's method.
+        auto method = static_cast<size_t>(Message::kMethodId);
+
+        // The callback is shared by the handler and the tasks that it posts to the executor
+        auto f = std::make_shared<std::decay_t<F>>(std::forward<F>(callback));
 
         if constexpr (kIsRequest) {
             // Build the request handler function that deserializes the message and calls the
             // handler function. The result of the handler is then sent back as a 'result' or
             // 'error'.
-            auto& handler = request_handlers_[method];
-            handler.function = [f = std::forward<F>(callback)](
-                                   const json::Value& object,
-                                   json::Builder& json_builder) -> Result<json::Builder::Member> {
+            auto handler = std::make_shared<RequestHandler>();
+            if (request_handlers_[method]) {
+                handler->post_send = request_handlers_[method]->post_send;
+            }
+            handler->function =
+                [f = std::move(f)](
+                    Session& session,
+                    const RequestHandler& handler,
+                    json::I64 id,
+                    [[maybe_unused]] std::string_view params) -> Result<SuccessType> {
                 Message request;
                 if constexpr (Message::kHasParams) {
-                    auto params = object.Get("params");
-                    if (params != Success) {
-                        return params.Failure();
-                    }
-                    if (auto res = Decode(*params.Get(), request); res != Success) {
+                    if (auto res = DecodeParams(params, request); res != Success) {
                         return res.Failure();
                     }
                 }
-                auto res = f(request);
-                using RES_TYPE = std::decay_t<decltype(res)>;
-                using RequestSuccessType = typename Message::SuccessType;
-                using RequestFailureType = typename Message::FailureType;
-                if constexpr (IsResult<RES_TYPE>) {
-                    using ResultSuccessType = typename RES_TYPE::ResultSuccess;
-                    using ResultFailureType = typename RES_TYPE::ResultFailure;
-                    static_assert(
-                        std::is_same_v<ResultSuccessType, RequestSuccessType>,
-                        "request handler Result<> success return type does not match Request's "
-                        "Result type");
-                    static_assert(std::is_same_v<ResultFailureType, RequestFailureType>,
-                                  "request handler Result<> failure return type does not match "
-                                  "Request's Failure type");
-                    if (res == Success) {
-                        auto enc = Encode(res.Get(), json_builder);
-                        if (enc != Success) {
-                            return enc.Failure();
-                        }
-                        return json::Builder::Member{std::string(kResponseResult), enc.Get()};
-                    } else {
-                        auto enc = Encode(res.Failure(), json_builder);
-                        if (enc != Success) {
-                            return enc.Failure();
-                        }
-                        return json::Builder::Member{std::string(kResponseError), enc.Get()};
+                if constexpr (kIsDeferred) {
+                    // The request remains in flight until the Responder sends the response
+                    auto cancelled = session.BeginRequest(id);
+                    if (!session.executor_) {
+                        (*f)(request,
+                             Responder<Message>{session, handler, id, std::move(cancelled)});
+                        return Success;
                     }
+                    std::string strand(StrandOf(request));
+                    auto task = [f, &session, handler = handler.shared_from_this(), id,
+                                 cancelled = std::move(cancelled),
+                                 request = std::move(request)]() -> Result<SuccessType> {
+                        // Requests that are cancelled before they start are dropped
+                        if (cancelled->load(std::memory_order_relaxed)) {
+                            session.EndRequest(id);
+                            return session.SendCancelled(id, *handler);
+                        }
+                        (*f)(request, Responder<Message>{session, *handler, id, cancelled});
+                        return Success;
+                    };
+                    session.Post(strand, std::move(task));
                 } else {
-                    static_assert((std::is_same_v<RES_TYPE, RequestSuccessType> ||
-                                   std::is_same_v<RES_TYPE, RequestFailureType>),
-                                  "request handler return type is not supported");
-                    auto enc = Encode(res, json_builder);
-                    if (enc != Success) {
-                        return enc.Failure();
+                    // Calls the handler, then sends its result as the response
+                    auto respond = [f, &session, id](const RequestHandler& handler,
+                                                     const Message& request,
+                                                     const CancellationToken& token) {
+                        auto res = [&] {
+                            if constexpr (kTakesToken) {
+                                return (*f)(request, token);
+                            } else {
+                                return (*f)(request);
+                            }
+                        }();
+                        if (token.IsCancelled()) {
+                            // The client has discarded the request, so do not encode the result
+                            return session.SendCancelled(id, handler);
+                        }
+                        return session.SendResponse<Message>(id, handler, res);
+                    };
+                    if (!session.executor_) {
+                        return respond(handler, request, CancellationToken{});
                     }
-                    return json::Builder::Member{
-                        std::string(std::is_same_v<RES_TYPE, RequestSuccessType> ? kResponseResult
-                                                                                 : kResponseError),
-                        enc.Get()};
+                    auto cancelled = session.BeginRequest(id);
+                    std::string strand(StrandOf(request));
+                    auto task = [&session, handler = handler.shared_from_this(), respond, id,
+                                 cancelled = std::move(cancelled), request = std::move(request)] {
+                        CancellationToken token{cancelled.get()};
+                        // Requests that are cancelled before they start are dropped
+                        auto res = token.IsCancelled() ? session.SendCancelled(id, *handler)
+                                                       : respond(*handler, request, token);
+                        session.EndRequest(id);
+                        return res;
+                    };
+                    session.Post(strand, std::move(task));
                 }
+                return Success;
             };
-            return RegisteredRequestHandler{handler};
+            request_handlers_[method] = handler;
+            return RegisteredRequestHandler{*handler};
         } else if constexpr (kIsNotification) {
             auto& handler = notification_handlers_[method];
             handler.function =
-                [f = std::forward<F>(callback)](const json::Value& object) -> Result<SuccessType> {
+                [f = std::move(f)](
+                    Session& session,
+                    [[maybe_unused]] std::string_view params) -> Result<SuccessType> {
                 Message notification;
                 if constexpr (Message::kHasParams) {
-                    auto params = object.Get("params");
-                    if (params != Success) {
-                        return params.Failure();
-                    }
-                    if (auto res = Decode(*params.Get(), notification); res != Success) {
+                    if (auto res = DecodeParams(params, notification); res != Success) {
                         return res.Failure();
                     }
                 }
-                return f(notification);
+                if (!session.executor_) {
+                    return (*f)(notification);
+                }
+                std::string strand(StrandOf(notification));
+                auto task = [f, notification = std::move(notification)] {
+                    return (*f)(notification);
+                };
+                session.Post(strand, std::move(task),
+                             /* barrier */ Message::kMethodId == lsp::MethodId::kExitNotification);
+                return Success;
             };
             return;
         }
     }
 
   private:
+    template <typename>
+    friend class Responder;
+
+    /// Pool holds objects that are reused between messages, so that steady-state message handling
+    /// does not need to make large heap allocations. Pools may be used re-entrantly and
+    /// concurrently, as each Acquire() leases a separate object.
+    template <typename T>
+    class Pool {
+      public:
+        /// Lease is an object leased from the Pool. The object is reset and returned to the pool
+        /// when the Lease is destructed.
+        class Lease {
+          public:
+            Lease(Pool& pool, std::unique_ptr<T>&& object)
+                : pool_(pool), object_(std::move(object)) {}
+            ~Lease() {
+                object_->Reset();
+                std::lock_guard lock(pool_.mutex_);
+                pool_.free_.push_back(std::move(object_));
+            }
+            T& operator*() const { return *object_; }
+            T* operator->() const { return object_.get(); }
+
+          private:
+            Lease(const Lease&) = delete;
+            Lease& operator=(const Lease&) = delete;
+            Pool& pool_;
+            std::unique_ptr<T> object_;
+        };
+
+        /// @returns a free object from the pool, or a new object if the pool is empty
+        Lease Acquire() {
+            std::unique_lock lock(mutex_);
+            if (free_.empty()) {
+                lock.unlock();
+                if constexpr (std::is_same_v<T, json::Builder>) {
+                    return Lease{*this, json::Builder::Create()};
+                } else {
+                    return Lease{*this, std::make_unique<T>()};
+                }
+            }
+            auto object = std::move(free_.back());
+            free_.pop_back();
+            return Lease{*this, std::move(object)};
+        }
+
+      private:
+        std::mutex mutex_;
+        std::vector<std::unique_ptr<T>> free_;
+    };
+
     static constexpr std::string_view kResponseResult = "result";
     static constexpr std::string_view kResponseError = "error";
 
+    /// The executor strand of the notifications that do not act on a text document. '$' cannot
+    /// start a URI, so this cannot clash with a document strand.
+    static constexpr std::string_view kSessionStrand = "$session";
+
+    /// StrandOf returns the executor strand of the message @p message. This is the URI of the text
+    /// document that the message acts on. Otherwise, requests are unordered, and notifications,
+    /// which may change the state used by later messages, use kSessionStrand.
+    template <typename T>
+    static std::string_view StrandOf([[maybe_unused]] const T& message) {
+        if constexpr (detail::HasTextDocumentUri<T>::value) {
+            return message.text_document.uri;
+        } else if constexpr (T::kMessageKind == lsp::MessageKind::kRequest) {
+            return {};
+        } else {
+            return kSessionStrand;
+        }
+    }
+
+    /// DecodeParams decodes the raw JSON message params @p params into @p message
+    template <typename T>
+    static Result<SuccessType> DecodeParams(std::string_view params, T& message) {
+        if (params.empty()) {
+            return Failure{"message has no 'params'"};
+        }
+        json::StreamReader reader(params);
+        if (auto res = Decode(reader, message); res != Success) {
+            return res.Failure();
+        }
+        return reader.End();
+    }
+
+    /// SendResponse sends the response to the request with the ID @p id, then calls the handler's
+    /// post-send callback.
+    /// @param res the value returned by the handler of the request, which is sent as the 'result'
+    /// or 'error' of the response
+    template <typename Message, typename RES_TYPE>
+    Result<SuccessType> SendResponse(json::I64 id,
+                                     const RequestHandler& handler,
+                                     const RES_TYPE& res) {
+        auto writer = writers_.Acquire();
+        auto& response = *writer;
+        response.BeginObject();
+        response.Key("id");
+        response.I64(id);
+        response.Key("jsonrpc");
+        response.String("2.0");
+
+        using RequestSuccessType = typename Message::SuccessType;
+        using RequestFailureType = typename Message::FailureType;
+        if constexpr (IsResult<RES_TYPE>) {
+            using ResultSuccessType = typename RES_TYPE::ResultSuccess;
+            using ResultFailureType = typename RES_TYPE::ResultFailure;
+            static_assert(std::is_same_v<ResultSuccessType, RequestSuccessType>,
+                          "request handler Result<> success return type does not match Request's "
+                          "Result type");
+            static_assert(std::is_same_v<ResultFailureType, RequestFailureType>,
+                          "request handler Result<> failure return type does not match "
+                          "Request's Failure type");
+            if (res == Success) {
+                response.Key(kResponseResult);
+                if (auto enc = Encode(res.Get(), response); enc != Success) {
+                    return enc.Failure();
+                }
+            } else {
+                response.Key(kResponseError);
+                if (auto enc = Encode(res.Failure(), response); enc != Success) {
+                    return enc.Failure();
+                }
+            }
+        } else {
+            static constexpr bool kIsSuccess =
+                std::is_same_v<RES_TYPE, RequestSuccessType> ||
+                std::is_same_v<RES_TYPE, lsp::Encoded<RequestSuccessType>>;
+            static_assert(kIsSuccess || std::is_same_v<RES_TYPE, RequestFailureType>,
+                          "request handler return type is not supported");
+            response.Key(kIsSuccess ? kResponseResult : kResponseError);
+            if (auto enc = Encode(res, response); enc != Success) {
+                return enc.Failure();
+            }
+        }
+        response.EndObject();
+
+        if (auto send = SendJson(response.Json()); send != Success) {
+            return send.Failure();
+        }
+
+        if (handler.post_send) {
+            handler.post_send();
+        }
+        return Success;
+    }
+
+    /// SendError sends an error response with the code @p code and message @p message to the
+    /// request with the ID @p id, then calls the handler's post-send callback.
+    Result<SuccessType> SendError(json::I64 id,
+                                  const RequestHandler& handler,
+                                  lsp::LSPErrorCodes code,
+                                  std::string_view message);
+
+    /// SendCancelled sends a 'RequestCancelled' error response to the request with the ID @p id,
+    /// then calls the handler's post-send callback.
+    Result<SuccessType> SendCancelled(json::I64 id, const RequestHandler& handler) {
+        return SendError(id, handler, lsp::LSPErrorCodes::kRequestCancelled, "request cancelled");
+    }
+
+    /// BeginRequest registers the request with the ID @p id as in-flight, so that it can be
+    /// cancelled with Cancel().
+    /// @returns the flag that is set when the request is cancelled
+    std::shared_ptr<std::atomic<bool>> BeginRequest(json::I64 id);
+
+    /// EndRequest removes the in-flight request with the ID @p id
+    void EndRequest(json::I64 id);
+
+    /// Cancel decodes the params of a '$/cancelRequest' notification, and cancels the in-flight
+    /// request with the given ID, if there is one.
+    Result<SuccessType> Cancel(std::string_view params);
+
+    /// Post posts @p task to the executor on the strand @p strand. A failure returned by the task
+    /// is passed to the ErrorHandler.
+    /// If @p barrier is true, then the task is only run once all the previously posted tasks have
+    /// completed, and the tasks posted after it are held back until it has completed.
+    template <typename TASK>
+    void Post(std::string_view strand, TASK&& task, bool barrier = false) {
+        PostTask(strand, barrier, [this, task = std::forward<TASK>(task)] {
+            if (Result<SuccessType> res = task(); res != Success) {
+                ReportError(res.Failure());
+            }
+        });
+    }
+
+    /// PostTask posts @p task to the executor on the strand @p strand, or queues it behind a
+    /// pending barrier task. See Post().
+    void PostTask(std::string_view strand, bool barrier, Executor::Task&& task);
+
+    /// Execute posts @p task to the executor on the strand @p strand, calling TaskCompleted() once
+    /// the task has run. posted_ must already account for the task.
+    void Execute(std::string_view strand, bool barrier, Executor::Task&& task);
+
+    /// TaskCompleted is called once a task posted by PostTask() has completed, and posts the queued
+    /// tasks that are no longer held back by a barrier.
+    /// @param barrier true if the completed task was a barrier
+    void TaskCompleted(bool barrier);
+
+    /// ReportError passes @p failure to the ErrorHandler, if one is set
+    void ReportError(const Failure& failure);
+
     Result<SuccessType> SendJson(std::string_view msg);
 
     Sender sender_;
-    std::unordered_map<std::string, RequestHandler> request_handlers_;
-    std::unordered_map<std::string, NotificationHandler> notification_handlers_;
+    ErrorHandler error_handler_;
+    Executor* executor_ = nullptr;
+    /// Serializes calls to sender_. This is recursive, as a Sender may synchronously pass the
+    /// message to another Session, which may send a message back before returning.
+    std::recursive_mutex sender_mutex_;
+    /// The registered request handlers, indexed by lsp::MethodId
+    std::array<std::shared_ptr<RequestHandler>, lsp::kMethodCount> request_handlers_;
+    /// The registered notification handlers, indexed by lsp::MethodId
+    std::array<NotificationHandler, lsp::kMethodCount> notification_handlers_;
+    /// Guards in_flight_
+    std::mutex in_flight_mutex_;
+    /// The cancellation flags of the requests posted to the executor that have not yet completed
+    std::unordered_map<json::I64, std::shared_ptr<std::atomic<bool>>> in_flight_;
+    /// QueuedTask is a task held back by a barrier task
+    struct QueuedTask {
+        std::string strand;
+        Executor::Task task;
+        bool barrier = false;
+    };
+    /// Guards posted_ and queued_
+    std::mutex post_mutex_;
+    /// The number of tasks posted to the executor that have not yet completed
+    size_t posted_ = 0;
+    /// The tasks held back by a barrier. If not empty, the front task is the barrier, which is
+    /// either waiting for the earlier tasks to complete, or has been posted to the executor.
+    std::deque<QueuedTask> queued_;
+    /// Guards response_handlers_ and next_request_id_
+    std::mutex response_handlers_mutex_;
     std::unordered_map<json::I64, std::function<Result<SuccessType>(const json::Value&)>>
         response_handlers_;
     json::I64 next_request_id_ = 1;
+    Pool<json::Builder> builders_;
+    Pool<json::StreamWriter> writers_;
+};
+
+/// Responder is passed to a deferred request handler, which has the signature
+/// `void(const T&, Responder<T>)`. The handler may return before the request has completed, and
+/// send the response later, from any thread, by calling Respond(). The Session continues to receive
+/// and dispatch messages while responses are outstanding.
+/// Responder is move-only. If a Responder is destructed without a call to Respond(), then a
+/// 'RequestFailed' error is sent as the response.
+/// All Responders must be destructed before the Session they were created by.
+template <typename T>
+class Responder {
+  public:
+    /// Move constructor
+    Responder(Responder&& other) noexcept
+        : session_(std::exchange(other.session_, nullptr)),
+          handler_(std::move(other.handler_)),
+          id_(other.id_),
+          cancelled_(std::move(other.cancelled_)) {}
+
+    /// Move assignment. If this Responder has not responded, then a 'RequestFailed' error is sent.
+    Responder& operator=(Responder&& other) noexcept {
+        if (this != &other) {
+            Abandon();
+            session_ = std::exchange(other.session_, nullptr);
+            handler_ = std::move(other.handler_);
+            id_ = other.id_;
+            cancelled_ = std::move(other.cancelled_);
+        }
+        return *this;
+    }
+
+    /// Destructor. If Respond() has not been called, then a 'RequestFailed' error is sent.
+    ~Responder() { Abandon(); }
+
+    /// Respond sends @p result as the 'result' of the response.
+    /// If the client has cancelled the request, then @p result is discarded, and a
+    /// 'RequestCancelled' error is sent instead. Respond() must only be called once.
+    /// @returns success or failure
+    Result<SuccessType> Respond(const typename T::SuccessType& result) { return Send(result); }
+
+    /// Respond sends the pre-encoded @p result as the 'result' of the response.
+    /// @copydetails Respond(const typename T::SuccessType&)
+    Result<SuccessType> Respond(const lsp::Encoded<typename T::SuccessType>& result) {
+        return Send(result);
+    }
+
+    /// Respond sends @p result as the 'result' or 'error' of the response.
+    /// @copydetails Respond(const typename T::SuccessType&)
+    template <typename SUCCESS, typename FAILURE>
+    Result<SuccessType> Respond(const Result<SUCCESS, FAILURE>& result) {
+        return Send(result);
+    }
+
+    /// @returns true if the client has cancelled the request
+    bool IsCancelled() const { return cancelled_ && cancelled_->load(std::memory_order_relaxed); }
+
+    /// @returns a CancellationToken for the request, which may be used until the Responder is
+    /// destructed
+    CancellationToken Token() const { return CancellationToken{cancelled_.get()}; }
+
+  private:
+    friend class Session;
+
+    Responder(Session& session,
+              const Session::RequestHandler& handler,
+              json::I64 id,
+              std::shared_ptr<std::atomic<bool>> cancelled)
+        : session_(&session),
+          handler_(handler.shared_from_this()),
+          id_(id),
+          cancelled_(std::move(cancelled)) {}
+    Responder(const Responder&) = delete;
+    Responder& operator=(const Responder&) = delete;
+
+    /// Send sends the response, if it has not already been sent
+    template <typename RES_TYPE>
+    Result<SuccessType> Send(const RES_TYPE& result) {
+        Session* session = std::exchange(session_, nullptr);
+        if (!session) {
+            return Failure{"request has already been responded to"};
+        }
+        session->EndRequest(id_);
+        if (cancelled_->load(std::memory_order_relaxed)) {
+            return session->SendCancelled(id_, *handler_);
+        }
+        return session->SendResponse<T>(id_, *handler_, result);
+    }
+
+    /// Abandon sends a 'RequestCancelled' error if the request was cancelled, otherwise a
+    /// 'RequestFailed' error, if Send() has not been called
+    void Abandon() {
+        if (Session* session = std::exchange(session_, nullptr)) {
+            session->EndRequest(id_);
+            auto res = cancelled_->load(std::memory_order_relaxed)
+                           ? session->SendCancelled(id_, *handler_)
+                           : session->SendError(id_, *handler_, lsp::LSPErrorCodes::kRequestFailed,
+                                                "request handler did not respond");
+            if (res != Success) {
+                session->ReportError(res.Failure());
+            }
+        }
+    }
+
+    /// The session, or nullptr once the response has been sent
+    Session* session_ = nullptr;
+    /// The handler of the request. This is shared, so that the handler's post-send callback remains
+    /// valid if another handler is registered for the request before the Responder responds.
+    std::shared_ptr<const Session::RequestHandler> handler_;
+    json::I64 id_ = 0;
+    std::shared_ptr<std::atomic<bool>> cancelled_;
 };
 
 }  // namespace langsvr
@@ -0,0 +1,117 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LANGSVR_THREAD_POOL_H_
+#define LANGSVR_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "langsvr/executor.h"
+
+namespace langsvr {
+
+/// ThreadPool is an implementation of the Executor interface that runs tasks on a fixed set of
+/// worker threads.
+/// Each worker has its own task queue. Tasks posted by a worker are queued on that worker, and
+/// idle workers steal tasks from the other workers' queues.
+class ThreadPool final : public Executor {
+  public:
+    /// Constructor
+    /// @param thread_count the number of worker threads. If 0, then one thread is used.
+    explicit ThreadPool(size_t thread_count = std::thread::hardware_concurrency());
+
+    /// Destructor. Waits for all posted tasks to complete, then stops the worker threads.
+    ~ThreadPool() override;
+
+    /// @copydoc Executor::Post
+    void Post(std::string_view strand, Task&& task) override;
+
+    /// Wait blocks until all the tasks posted to the pool have completed.
+    void Wait();
+
+  private:
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Worker holds the task queue of a single worker thread
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    /// Schedule queues @p task on a worker
+    void Schedule(Task&& task);
+
+    /// Pop takes the next task for the worker with index @p worker, stealing from the other
+    /// workers if the worker's own queue is empty.
+    /// @returns true if a task was assigned to @p task
+    bool Pop(size_t worker, Task& task);
+
+    /// Run is the entry point of the worker thread with index @p worker
+    void Run(size_t worker);
+
+    /// RunStrand runs the task at the front of the strand @p strand, then schedules the strand's
+    /// next task, if any.
+    void RunStrand(const std::string& strand);
+
+    /// Complete is called once a posted task has finished
+    void Complete();
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread> threads_;
+
+    /// Guards queued_, pending_ and stop_
+    std::mutex mutex_;
+    /// Signalled when a task is queued on a worker, or the pool is stopping
+    std::condition_variable work_cv_;
+    /// Signalled when pending_ reaches zero
+    std::condition_variable idle_cv_;
+    /// The number of tasks held by the worker queues
+    size_t queued_ = 0;
+    /// The number of posted tasks that have not yet completed
+    size_t pending_ = 0;
+    /// The next worker to queue a task posted from outside the pool
+    size_t next_worker_ = 0;
+    bool stop_ = false;
+
+    /// Guards strands_
+    std::mutex strands_mutex_;
+    /// The queued tasks of each strand. The front task of a strand is the one that is scheduled or
+    /// running, and is only removed once it has completed.
+    std::unordered_map<std::string, std::deque<Task>> strands_;
+};
+
+}  // namespace langsvr
+
+#endif  // LANGSVR_THREAD_POOL_H_
@@ -28,13 +28,19 @@
 #ifndef LANGSVR_TRAITS_H_
 #define LANGSVR_TRAITS_H_
 
+#include <cstddef>
 #include <string>
 #include <tuple>
+#include <type_traits>
 
 /// Forward declaration
 namespace langsvr {
 template <typename SUCCESS_TYPE, typename FAILURE_TYPE>
 struct Result;
+template <typename T>
+struct InlineStorageTag;
+template <typename T>
+struct InlineStorable;
 }
 
 namespace langsvr::detail {
@@ -119,6 +125,42 @@ struct IsResult : std::false_type {};
 template <typename SUCCESS, typename FAILURE>
 struct IsResult<Result<SUCCESS, FAILURE>> : std::true_type {};
 
+/// IsTemplateInstance is true if T is a specialization of a class template with type parameters
+template <typename T>
+struct IsTemplateInstance : std::false_type {};
+template <template <typename...> class C, typename... ARGS>
+struct IsTemplateInstance<C<ARGS...>> : std::true_type {};
+
+/// HasEnableInlineStorage is true if EnableInlineStorage(InlineStorageTag<T>) is declared.
+template <typename T, typename = void>
+struct HasEnableInlineStorage : std::false_type {};
+template <typename T>
+struct HasEnableInlineStorage<T, std::void_t<decltype(EnableInlineStorage(InlineStorageTag<T>{}))>>
+    : std::true_type {};
+
+/// The size of the largest type that is stored inline
+static constexpr size_t kMaxInlineSize = 4 * sizeof(void*);
+
+/// InlineLayout holds the size and alignment of T if T is stored inline, otherwise a zero size.
+/// sizeof(T) is only evaluated for inline-storable types.
+template <typename T, bool = InlineStorable<T>::value>
+struct InlineLayout {
+    static constexpr size_t size = 0;
+    static constexpr size_t align = 1;
+};
+
+template <typename T>
+struct InlineLayout<T, true> {
+    static constexpr size_t size = sizeof(T) <= kMaxInlineSize ? sizeof(T) : 0;
+    static constexpr size_t align = size ? alignof(T) : 1;
+};
+
+/// IsTriviallyInline is true if T is stored inline and is trivially copyable.
+/// std::is_trivially_copyable is only evaluated for inline types, as T may be incomplete otherwise.
+template <typename T>
+struct IsTriviallyInline : std::conjunction<std::bool_constant<InlineLayout<T>::size != 0>,
+                                            std::is_trivially_copyable<T>> {};
+
 }  // namespace langsvr::detail
 
 namespace langsvr {
@@ -159,6 +201,33 @@ static constexpr bool IsStringLike =
 template <typename T>
 static constexpr bool IsResult = detail::IsResult<T>::value;
 
+/// InlineStorageTag is the parameter type of EnableInlineStorage(). See InlineStorable.
+template <typename T>
+struct InlineStorageTag {};
+
+/// InlineStorable is true for the types that OneOf and Optional may hold inline, instead of on the
+/// heap. Arithmetic types, enums and std::string are inline-storable. Other classes opt in by
+/// declaring `void EnableInlineStorage(InlineStorageTag<T>)` in the namespace of T, which is found
+/// by argument-dependent lookup. The size of an inline-storable type is taken wherever a OneOf or
+/// Optional of it is declared, so a type must not opt in if it is used in a OneOf or Optional
+/// before it is defined, such as in a recursive structure.
+/// Note: EnableInlineStorage() is not looked up for class template specializations, as
+/// argument-dependent lookup would instantiate the template arguments, which may be incomplete.
+template <typename T>
+struct InlineStorable
+    : std::bool_constant<std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+                         std::conjunction_v<std::negation<detail::IsTemplateInstance<T>>,
+                                            detail::HasEnableInlineStorage<T>>> {};
+
+/// InlineStorable specialization for std::string
+template <>
+struct InlineStorable<std::string> : std::true_type {};
+
+/// Evaluates to true if `T` is stored inline by OneOf. This is true for inline-storable types no
+/// larger than 4 pointers. Optional only holds the smallest of these types inline.
+template <typename T>
+static constexpr bool IsInline = detail::InlineLayout<T>::size != 0;
+
 }  // namespace langsvr
 
 #endif  // LANGSVR_TRAITS_H_
@@ -32,9 +32,28 @@
 #include <string>
 
 #include "langsvr/result.h"
+#include "langsvr/span.h"
 
 namespace langsvr {
 
+/// ConstBuffer is a view of a sequence of bytes, written by Writer::WriteV()
+struct ConstBuffer {
+    /// Constructor
+    /// @param d the pointer to the first byte
+    /// @param s the number of bytes
+    ConstBuffer(const std::byte* d, size_t s) : data(d), size(s) {}
+
+    /// Constructor
+    /// @param str the string to view
+    ConstBuffer(std::string_view str)
+        : data(reinterpret_cast<const std::byte*>(str.data())), size(str.size()) {}
+
+    /// The pointer to the first byte
+    const std::byte* data = nullptr;
+    /// The number of bytes
+    size_t size = 0;
+};
+
 /// A binary stream writer interface
 class Writer {
   public:
@@ -47,6 +66,15 @@ class Writer {
     /// @returns the result of the write
     virtual Result<SuccessType> Write(const std::byte* in, size_t count) = 0;
 
+    /// WriteV writes the bytes of each of the buffers in @p buffers to the stream, in order,
+    /// blocking until the write has finished. This allows data held in separate buffers to be
+    /// written without first copying it into a single buffer. Implementations backed by a file
+    /// descriptor may write all the buffers with a single system call.
+    /// The default implementation calls Write() for each non-empty buffer.
+    /// @param buffers the buffers to write
+    /// @returns the result of the write
+    virtual Result<SuccessType> WriteV(Span<ConstBuffer> buffers);
+
     /// Writes a string of @p len bytes from the stream.
     /// @param value the string to write
     /// @returns the result of the write
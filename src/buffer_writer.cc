@@ -38,6 +38,22 @@ Result<SuccessType> BufferWriter::Write(const std::byte* in, size_t count) {
     return Success;
 }
 
+Result<SuccessType> BufferWriter::WriteV(Span<ConstBuffer> buffers) {
+    size_t total = 0;
+    for (auto& in : buffers) {
+        total += in.size;
+    }
+    size_t at = buffer.size();
+    buffer.resize(at + total);
+    for (auto& in : buffers) {
+        if (in.size > 0) {
+            memcpy(&buffer[at], in.data, in.size);
+            at += in.size;
+        }
+    }
+    return Success;
+}
+
 std::string_view BufferWriter::BufferString() const {
     if (buffer.empty()) {
         return "";
@@ -49,5 +49,13 @@ TEST(BufferWriterTest, String) {
                 testing::ElementsAre(104, 101, 108, 108, 111, 32, 119, 111, 114, 108, 100));
 }
 
+TEST(BufferWriterTest, WriteV) {
+    BufferWriter writer;
+    EXPECT_EQ(writer.String(">"), Success);
+    ConstBuffer buffers[] = {ConstBuffer{"hello"}, ConstBuffer{""}, ConstBuffer{" world"}};
+    EXPECT_EQ(writer.WriteV(Span<ConstBuffer>{buffers, 3}), Success);
+    EXPECT_EQ(writer.BufferString(), ">hello world");
+}
+
 }  // namespace
 }  // namespace langsvr
@@ -0,0 +1,135 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "langsvr/buffered_reader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace langsvr {
+
+BufferedReader::BufferedReader(Reader& source, size_t capacity)
+    : source_(source), buffer_(std::max<size_t>(capacity, 1)) {}
+
+BufferedReader::~BufferedReader() = default;
+
+size_t BufferedReader::Read(std::byte* out, size_t count) {
+    size_t n = 0;
+    while (n < count) {
+        if (begin_ == end_) {
+            size_t remaining = count - n;
+            if (remaining >= buffer_.size()) {
+                // The buffer would be filled and drained in one go. Read directly into the output.
+                return n + source_.Read(out + n, remaining);
+            }
+            if (Fill() == 0) {
+                break;
+            }
+        }
+        size_t chunk = std::min(count - n, end_ - begin_);
+        memcpy(out + n, buffer_.data() + begin_, chunk);
+        begin_ += chunk;
+        n += chunk;
+    }
+    return n;
+}
+
+size_t BufferedReader::ReadSome(std::byte* out, size_t count) {
+    if (begin_ == end_) {
+        if (count >= buffer_.size()) {
+            return source_.ReadSome(out, count);
+        }
+        if (Fill() == 0) {
+            return 0;
+        }
+    }
+    size_t n = std::min(count, end_ - begin_);
+    memcpy(out, buffer_.data() + begin_, n);
+    begin_ += n;
+    return n;
+}
+
+Result<std::string_view> BufferedReader::ReadUntil(std::string_view delimiter, size_t max_length) {
+    const auto first = static_cast<unsigned char>(delimiter[0]);
+    // The offset from begin_ of the next byte to search. Offsets are used as Fill() may move the
+    // buffered data.
+    size_t scanned = 0;
+    while (true) {
+        const char* data = reinterpret_cast<const char*>(buffer_.data());
+        size_t scan = begin_ + scanned;
+        while (end_ - scan >= delimiter.size()) {
+            // memchr() is vectorized by the C library, so candidate positions are found quickly
+            // even in long runs of bytes.
+            auto* candidate = static_cast<const char*>(
+                memchr(data + scan, first, end_ - scan - (delimiter.size() - 1)));
+            if (!candidate) {
+                scan = end_ - (delimiter.size() - 1);
+                break;
+            }
+            if (memcmp(candidate, delimiter.data(), delimiter.size()) == 0) {
+                size_t pos = static_cast<size_t>(candidate - data);
+                std::string_view out{data + begin_, pos - begin_};
+                begin_ = pos + delimiter.size();
+                if (out.size() > max_length) {
+                    return Failure{"delimiter not found within " + std::to_string(max_length) +
+                                   " bytes"};
+                }
+                return out;
+            }
+            scan = static_cast<size_t>(candidate - data) + 1;
+        }
+        scanned = scan - begin_;
+
+        if (end_ - begin_ > max_length + delimiter.size()) {
+            return Failure{"delimiter not found within " + std::to_string(max_length) + " bytes"};
+        }
+        bool empty = begin_ == end_;
+        if (Fill() == 0) {
+            return Failure{empty ? "EOF" : "end of stream before delimiter"};
+        }
+    }
+}
+
+size_t BufferedReader::Fill() {
+    if (end_ == buffer_.size()) {
+        if (begin_ > 0) {
+            memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+            end_ -= begin_;
+            begin_ = 0;
+        } else {
+            buffer_.resize(buffer_.size() * 2);
+        }
+    } else if (begin_ == end_) {
+        begin_ = end_ = 0;
+    }
+    size_t n = source_.ReadSome(buffer_.data() + end_, buffer_.size() - end_);
+    end_ += n;
+    return n;
+}
+
+}  // namespace langsvr
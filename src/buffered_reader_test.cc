@@ -0,0 +1,140 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "langsvr/buffered_reader.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "langsvr/buffer_reader.h"
+
+namespace langsvr {
+namespace {
+
+/// ChunkedReader is a Reader that returns at most kChunkSize bytes from each call to ReadSome(),
+/// like a pipe that has only received part of the data, and counts the calls made to it.
+class ChunkedReader final : public Reader {
+  public:
+    static constexpr size_t kChunkSize = 3;
+
+    explicit ChunkedReader(std::string_view data) : reader_(data) {}
+
+    size_t Read(std::byte* out, size_t count) override {
+        calls++;
+        return reader_.Read(out, count);
+    }
+
+    size_t ReadSome(std::byte* out, size_t count) override {
+        calls++;
+        return reader_.Read(out, std::min(count, kChunkSize));
+    }
+
+    size_t calls = 0;
+
+  private:
+    BufferReader reader_;
+};
+
+std::string ReadString(Reader& reader, size_t count) {
+    std::string out(count, '\0');
+    out.resize(reader.Read(reinterpret_cast<std::byte*>(out.data()), count));
+    return out;
+}
+
+TEST(BufferedReaderTest, Read) {
+    BufferReader source("hello world");
+    BufferedReader reader(source, 4);
+    EXPECT_EQ(ReadString(reader, 2), "he");
+    EXPECT_EQ(ReadString(reader, 7), "llo wor");
+    EXPECT_EQ(ReadString(reader, 5), "ld");
+    EXPECT_EQ(ReadString(reader, 5), "");
+}
+
+TEST(BufferedReaderTest, ReadSome) {
+    ChunkedReader source("hello world");
+    BufferedReader reader(source, 16);
+    std::byte buf[16];
+    EXPECT_EQ(reader.ReadSome(buf, 2), 2u);
+    EXPECT_EQ(reader.ReadSome(buf, 16), 1u);
+    EXPECT_EQ(reader.ReadSome(buf, 16), 3u);
+}
+
+TEST(BufferedReaderTest, BuffersSmallReads) {
+    ChunkedReader source("0123456789abcdef");
+    BufferedReader reader(source, 16);
+    for (char c : std::string("0123456789abcdef")) {
+        EXPECT_EQ(ReadString(reader, 1), std::string(1, c));
+    }
+    // Each call to the source fills the buffer with a full chunk
+    EXPECT_EQ(source.calls, 6u);
+}
+
+TEST(BufferedReaderTest, ReadUntil) {
+    ChunkedReader source("a: 1\r\nb: 2\r\n\r\nbody\r\n\r\n\r\n\r\n");
+    BufferedReader reader(source, 4);
+    auto header = reader.ReadUntil("\r\n\r\n", 100);
+    ASSERT_EQ(header, Success);
+    EXPECT_EQ(header.Get(), "a: 1\r\nb: 2");
+    auto body = reader.ReadUntil("\r\n\r\n", 100);
+    ASSERT_EQ(body, Success);
+    EXPECT_EQ(body.Get(), "body");
+    auto empty = reader.ReadUntil("\r\n\r\n", 100);
+    ASSERT_EQ(empty, Success);
+    EXPECT_EQ(empty.Get(), "");
+    auto end = reader.ReadUntil("\r\n\r\n", 100);
+    ASSERT_NE(end, Success);
+    EXPECT_EQ(end.Failure().reason, "EOF");
+}
+
+TEST(BufferedReaderTest, ReadUntilPartialDelimiter) {
+    BufferReader source("ab\r\n\rcd\r\n\r\n");
+    BufferedReader reader(source, 2);
+    auto got = reader.ReadUntil("\r\n\r\n", 100);
+    ASSERT_EQ(got, Success);
+    EXPECT_EQ(got.Get(), "ab\r\n\rcd");
+}
+
+TEST(BufferedReaderTest, ReadUntilMaxLength) {
+    std::string data = std::string(100, 'x') + ";";
+    BufferReader source(data);
+    BufferedReader reader(source, 8);
+    auto got = reader.ReadUntil(";", 50);
+    ASSERT_NE(got, Success);
+    EXPECT_EQ(got.Failure().reason, "delimiter not found within 50 bytes");
+}
+
+TEST(BufferedReaderTest, ReadUntilEndOfStream) {
+    BufferReader source("abc\r\n");
+    BufferedReader reader(source, 8);
+    auto got = reader.ReadUntil("\r\n\r\n", 50);
+    ASSERT_NE(got, Success);
+    EXPECT_EQ(got.Failure().reason, "end of stream before delimiter");
+}
+
+}  // namespace
+}  // namespace langsvr
@@ -27,77 +27,200 @@
 
 #include "langsvr/content_stream.h"
 
-#include <sstream>
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <iterator>
 #include <string>
 
+#include "langsvr/buffered_reader.h"
 #include "langsvr/reader.h"
 #include "langsvr/writer.h"
-#include "src/utils/replace_all.h"
 
 namespace langsvr {
 
 namespace {
 static constexpr std::string_view kContentLength = "Content-Length: ";
 
-Result<SuccessType> Match(Reader& reader, std::string_view str) {
-    auto got = reader.String(str.size());
-    if (got != Success) {
-        return got.Failure();
+/// The terminator of the header part of a message
+static constexpr std::string_view kHeaderEnd = "\r\n\r\n";
+
+/// The maximum length of the header part of a message
+static constexpr size_t kMaxHeaderLength = 16 * 1024;
+
+/// @returns @p str with leading and trailing spaces and tabs removed
+std::string_view Trim(std::string_view str) {
+    while (!str.empty() && (str.front() == ' ' || str.front() == '\t')) {
+        str.remove_prefix(1);
     }
-    if (got.Get() != str) {
-        std::stringstream err;
-        err << "expected '" << str << "' got '" << got.Get() << "'";
-        return Failure{err.str()};
+    while (!str.empty() && (str.back() == ' ' || str.back() == '\t')) {
+        str.remove_suffix(1);
     }
-    return Success;
+    return str;
 }
 
-}  // namespace
+/// @returns true if the ASCII strings @p a and @p b are equal, ignoring case
+bool EqualsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++) {
+        if ((a[i] | 0x20) != (b[i] | 0x20)) {
+            return false;
+        }
+    }
+    return true;
+}
 
-Result<std::string> ReadContent(Reader& reader) {
-    if (auto match = Match(reader, kContentLength); match != Success) {
-        return match.Failure();
+/// ParseHeader parses the header part of a message, without the terminating empty line.
+/// Header fields may appear in any order, and field names are case-insensitive. Fields other than
+/// 'Content-Length', such as 'Content-Type', do not affect how the content is read, and are
+/// ignored.
+/// @returns the value of the 'Content-Length' header field
+Result<uint64_t> ParseHeader(std::string_view header) {
+    bool has_length = false;
+    uint64_t length = 0;
+    while (!header.empty()) {
+        auto eol = header.find("\r\n");
+        auto field = header.substr(0, eol);
+        header = eol == std::string_view::npos ? std::string_view{} : header.substr(eol + 2);
+
+        auto colon = field.find(':');
+        if (colon == std::string_view::npos) {
+            return Failure{"invalid header field '" + std::string(field) + "'"};
+        }
+        if (!EqualsIgnoreCase(Trim(field.substr(0, colon)), "Content-Length")) {
+            continue;
+        }
+        auto value = Trim(field.substr(colon + 1));
+        if (value.empty()) {
+            return Failure{"invalid content length value"};
+        }
+        length = 0;
+        for (char c : value) {
+            if (c < '0' || c > '9' || length > (UINT64_MAX - 9) / 10) {
+                return Failure{"invalid content length value"};
+            }
+            length = length * 10 + static_cast<uint64_t>(c - '0');
+        }
+        has_length = true;
+    }
+    if (!has_length) {
+        return Failure{"missing Content-Length header"};
+    }
+    return length;
+}
+
+/// ReadBody reads the @p length bytes of content from @p reader into @p buffer
+Result<std::string_view> ReadBody(Reader& reader, uint64_t length, std::string& buffer) {
+    // resize() reuses the buffer's existing capacity, so steady-state messages do not allocate
+    buffer.resize(length);
+    if (reader.Read(reinterpret_cast<std::byte*>(buffer.data()), length) != length) {
+        return Failure{"EOF"};
     }
-    uint64_t len = 0;
-    while (true) {
+    return std::string_view{buffer};
+}
+
+}  // namespace
+
+Result<std::string_view> ReadContent(Reader& reader, std::string& buffer) {
+    // Without a buffered reader, the header can only be read a byte at a time, so that no content
+    // bytes are consumed. The header is read into @p buffer, which is then reused for the content.
+    buffer.clear();
+    while (buffer.size() < kHeaderEnd.size() ||
+           std::string_view(buffer).substr(buffer.size() - kHeaderEnd.size()) != kHeaderEnd) {
         char c = 0;
-        if (auto read = reader.Read(reinterpret_cast<std::byte*>(&c), sizeof(c));
-            read != sizeof(c)) {
-            return Failure{"end of stream while parsing content length"};
+        if (reader.Read(reinterpret_cast<std::byte*>(&c), sizeof(c)) != sizeof(c)) {
+            return Failure{buffer.empty() ? "EOF" : "end of stream while reading content header"};
         }
-        if (c >= '0' && c <= '9') {
-            len = len * 10 + static_cast<uint64_t>(c - '0');
-            continue;
+        if (buffer.size() == kMaxHeaderLength + kHeaderEnd.size()) {
+            return Failure{"content header too long"};
         }
-        if (c == '\r') {
-            break;
+        buffer.push_back(c);
+    }
+
+    auto length =
+        ParseHeader(std::string_view(buffer).substr(0, buffer.size() - kHeaderEnd.size()));
+    if (length != Success) {
+        return length.Failure();
+    }
+    return ReadBody(reader, length.Get(), buffer);
+}
+
+Result<std::string_view> ReadContent(BufferedReader& reader, std::string& buffer) {
+    // The header is parsed in place in the reader's buffer. Failures are reported with the same
+    // messages as the unbuffered ReadContent().
+    auto header = reader.ReadUntil(kHeaderEnd, kMaxHeaderLength);
+    if (header != Success) {
+        if (header.Failure().reason == "EOF") {
+            return header.Failure();
+        }
+        if (header.Failure().reason == "end of stream before delimiter") {
+            return Failure{"end of stream while reading content header"};
         }
-        return Failure{"invalid content length value"};
+        return Failure{"content header too long"};
     }
 
-    auto got = reader.String(3);
-    if (got != Success) {
-        return got.Failure();
+    auto length = ParseHeader(header.Get());
+    if (length != Success) {
+        return length.Failure();
     }
-    if (got.Get() != "\n\r\n") {
-        auto fmt = [](std::string s) {
-            s = ReplaceAll(s, "\n", "␊");
-            s = ReplaceAll(s, "\r", "␍");
-            return s;
-        };
+    return ReadBody(reader, length.Get(), buffer);
+}
 
-        std::stringstream err;
-        err << "expected '␍␊␍␊' got '␍" << fmt(got.Get()) << "'";
-        return Failure{err.str()};
+Result<std::string> ReadContent(Reader& reader) {
+    std::string buffer;
+    if (auto content = ReadContent(reader, buffer); content != Success) {
+        return content.Failure();
     }
+    return buffer;
+}
 
-    return reader.String(len);
+Result<std::string> ReadContent(BufferedReader& reader) {
+    std::string buffer;
+    if (auto content = ReadContent(reader, buffer); content != Success) {
+        return content.Failure();
+    }
+    return buffer;
+}
+
+Result<size_t> FindContent(std::string_view data, std::string_view& content) {
+    auto header_length = data.find(kHeaderEnd);
+    if (header_length == std::string_view::npos) {
+        if (data.size() >= kMaxHeaderLength + kHeaderEnd.size()) {
+            return Failure{"content header too long"};
+        }
+        return size_t{0};
+    }
+    if (header_length > kMaxHeaderLength) {
+        return Failure{"content header too long"};
+    }
+
+    auto length = ParseHeader(data.substr(0, header_length));
+    if (length != Success) {
+        return length.Failure();
+    }
+    size_t body_offset = header_length + kHeaderEnd.size();
+    if (data.size() - body_offset < length.Get()) {
+        return size_t{0};
+    }
+    content = data.substr(body_offset, length.Get());
+    return body_offset + static_cast<size_t>(length.Get());
 }
 
 Result<SuccessType> WriteContent(Writer& writer, std::string_view content) {
-    std::stringstream ss;
-    ss << kContentLength << content.length() << "\r\n\r\n" << content;
-    return writer.String(ss.str());
+    // The header is formatted on the stack, and written with the content in a single gather write,
+    // so the content is not copied.
+    char header[kContentLength.size() + 20 + kHeaderEnd.size()];
+    char* end = std::copy(kContentLength.begin(), kContentLength.end(), header);
+    end = std::to_chars(end, std::end(header), content.length()).ptr;
+    end = std::copy(kHeaderEnd.begin(), kHeaderEnd.end(), end);
+
+    ConstBuffer buffers[] = {
+        ConstBuffer{std::string_view(header, static_cast<size_t>(end - header))},
+        ConstBuffer{content},
+    };
+    return writer.WriteV(Span<ConstBuffer>{buffers, std::size(buffers)});
 }
 
 }  // namespace langsvr
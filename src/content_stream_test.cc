@@ -27,14 +27,31 @@
 
 #include "langsvr/content_stream.h"
 
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 #include "langsvr/buffer_reader.h"
 #include "langsvr/buffer_writer.h"
+#include "langsvr/buffered_reader.h"
 
 namespace langsvr {
 namespace {
 
+/// RecordingWriter is a Writer that uses the default Writer::WriteV(), and records each call to
+/// Write().
+class RecordingWriter final : public Writer {
+  public:
+    Result<SuccessType> Write(const std::byte* in, size_t count) override {
+        writes.emplace_back(reinterpret_cast<const char*>(in), count);
+        return Success;
+    }
+
+    std::vector<std::string> writes;
+};
+
 TEST(ReadContent, Empty) {
     BufferReader reader("");
     auto got = ReadContent(reader);
@@ -43,31 +60,58 @@ TEST(ReadContent, Empty) {
 }
 
 TEST(ReadContent, InvalidContentLength) {
-    BufferReader reader("Content-Length: apples");
+    BufferReader reader("Content-Length: apples\r\n\r\n");
     auto got = ReadContent(reader);
     EXPECT_NE(got, Success);
     EXPECT_EQ(got.Failure().reason, "invalid content length value");
 }
 
 TEST(ReadContent, MissingFirstCR) {
-    BufferReader reader("Content-Length: 10\r    ");
-    auto got = ReadContent(reader);
-    EXPECT_NE(got, Success);
-    EXPECT_EQ(got.Failure().reason, "expected '␍␊␍␊' got '␍   '");
+    {
+        BufferReader reader("Content-Length: 10\r    ");
+        auto got = ReadContent(reader);
+        EXPECT_NE(got, Success);
+        EXPECT_EQ(got.Failure().reason, "end of stream while reading content header");
+    }
+    {
+        BufferReader source("Content-Length: 10\r    ");
+        BufferedReader reader(source);
+        auto got = ReadContent(reader);
+        EXPECT_NE(got, Success);
+        EXPECT_EQ(got.Failure().reason, "end of stream while reading content header");
+    }
 }
 
 TEST(ReadContent, MissingSecondLF) {
-    BufferReader reader("Content-Length: 10\r\n    ");
-    auto got = ReadContent(reader);
-    EXPECT_NE(got, Success);
-    EXPECT_EQ(got.Failure().reason, "expected '␍␊␍␊' got '␍␊  '");
+    {
+        BufferReader reader("Content-Length: 10\r\n    ");
+        auto got = ReadContent(reader);
+        EXPECT_NE(got, Success);
+        EXPECT_EQ(got.Failure().reason, "end of stream while reading content header");
+    }
+    {
+        BufferReader source("Content-Length: 10\r\n    ");
+        BufferedReader reader(source);
+        auto got = ReadContent(reader);
+        EXPECT_NE(got, Success);
+        EXPECT_EQ(got.Failure().reason, "end of stream while reading content header");
+    }
 }
 
 TEST(ReadContent, MissingSecondCR) {
-    BufferReader reader("Content-Length: 10\r\n\r    ");
-    auto got = ReadContent(reader);
-    EXPECT_NE(got, Success);
-    EXPECT_EQ(got.Failure().reason, "expected '␍␊␍␊' got '␍␊␍ '");
+    {
+        BufferReader reader("Content-Length: 10\r\n\r    ");
+        auto got = ReadContent(reader);
+        EXPECT_NE(got, Success);
+        EXPECT_EQ(got.Failure().reason, "end of stream while reading content header");
+    }
+    {
+        BufferReader source("Content-Length: 10\r\n\r    ");
+        BufferedReader reader(source);
+        auto got = ReadContent(reader);
+        EXPECT_NE(got, Success);
+        EXPECT_EQ(got.Failure().reason, "end of stream while reading content header");
+    }
 }
 
 TEST(ReadContent, ValidMessage) {
@@ -95,6 +139,161 @@ TEST(ReadContent, ValidMessages) {
     }
 }
 
+TEST(ReadContent, HeaderFields) {
+    BufferReader reader(
+        "content-type: application/vscode-jsonrpc; charset=utf-8\r\n"
+        "CONTENT-LENGTH:5  \r\n\r\nhello");
+    auto got = ReadContent(reader);
+    EXPECT_EQ(got, "hello");
+}
+
+TEST(ReadContent, MissingContentLength) {
+    BufferReader reader("Content-Type: application/vscode-jsonrpc\r\n\r\nhello");
+    auto got = ReadContent(reader);
+    EXPECT_NE(got, Success);
+    EXPECT_EQ(got.Failure().reason, "missing Content-Length header");
+}
+
+TEST(ReadContent, InvalidHeaderField) {
+    BufferReader reader("Content-Length 5\r\n\r\nhello");
+    auto got = ReadContent(reader);
+    EXPECT_NE(got, Success);
+    EXPECT_EQ(got.Failure().reason, "invalid header field 'Content-Length 5'");
+}
+
+TEST(ReadContent, BufferedEmpty) {
+    BufferReader source("");
+    BufferedReader reader(source);
+    auto got = ReadContent(reader);
+    EXPECT_NE(got, Success);
+    EXPECT_EQ(got.Failure().reason, "EOF");
+}
+
+TEST(ReadContent, BufferedTruncatedHeader) {
+    BufferReader source("Content-Length: 10\r\n\r");
+    BufferedReader reader(source);
+    auto got = ReadContent(reader);
+    EXPECT_NE(got, Success);
+    EXPECT_EQ(got.Failure().reason, "end of stream while reading content header");
+}
+
+TEST(ReadContent, HeaderTooLong) {
+    std::string data =
+        "Content-Length: 1\r\nX-Padding: " + std::string(32 * 1024, 'x') + "\r\n\r\n!";
+    {
+        BufferReader reader(data);
+        auto got = ReadContent(reader);
+        EXPECT_NE(got, Success);
+        EXPECT_EQ(got.Failure().reason, "content header too long");
+    }
+    {
+        BufferReader source(data);
+        BufferedReader reader(source, 64);
+        auto got = ReadContent(reader);
+        EXPECT_NE(got, Success);
+        EXPECT_EQ(got.Failure().reason, "content header too long");
+    }
+}
+
+TEST(ReadContent, BufferedValidMessages) {
+    BufferReader source(
+        "Content-Length: 5\r\n\r\nhello"
+        "Content-Type: application/vscode-jsonrpc; charset=utf-8\r\ncontent-length: 5\r\n\r\n"
+        "world"
+        "Content-Length: 0\r\n\r\n");
+    // A small buffer, so that headers and content span refills
+    BufferedReader reader(source, 8);
+    EXPECT_EQ(ReadContent(reader), "hello");
+    EXPECT_EQ(ReadContent(reader), "world");
+    EXPECT_EQ(ReadContent(reader), "");
+    auto end = ReadContent(reader);
+    EXPECT_NE(end, Success);
+    EXPECT_EQ(end.Failure().reason, "EOF");
+}
+
+TEST(ReadContent, ReusedBuffer) {
+    BufferReader reader(
+        "Content-Length: 11\r\n\r\nhello world"
+        "Content-Length: 5\r\n\r\nhello"
+        "Content-Length: 3\r\n\r\nabc");
+    std::string buffer;
+    auto first = ReadContent(reader, buffer);
+    ASSERT_EQ(first, Success);
+    EXPECT_EQ(first.Get(), "hello world");
+    EXPECT_EQ(first.Get().data(), buffer.data());
+
+    // Smaller messages reuse the buffer's allocation
+    const char* data = buffer.data();
+    auto second = ReadContent(reader, buffer);
+    ASSERT_EQ(second, Success);
+    EXPECT_EQ(second.Get(), "hello");
+    EXPECT_EQ(second.Get().data(), data);
+    auto third = ReadContent(reader, buffer);
+    ASSERT_EQ(third, Success);
+    EXPECT_EQ(third.Get(), "abc");
+    EXPECT_EQ(third.Get().data(), data);
+
+    auto end = ReadContent(reader, buffer);
+    ASSERT_NE(end, Success);
+    EXPECT_EQ(end.Failure().reason, "EOF");
+}
+
+TEST(ReadContent, BufferedReusedBuffer) {
+    BufferReader source(
+        "Content-Length: 11\r\n\r\nhello world"
+        "Content-Length: 5\r\n\r\nhello"
+        "Content-Length: 99\r\n\r\nabc");
+    BufferedReader reader(source, 16);
+    std::string buffer;
+    auto first = ReadContent(reader, buffer);
+    ASSERT_EQ(first, Success);
+    EXPECT_EQ(first.Get(), "hello world");
+
+    const char* data = buffer.data();
+    auto second = ReadContent(reader, buffer);
+    ASSERT_EQ(second, Success);
+    EXPECT_EQ(second.Get(), "hello");
+    EXPECT_EQ(second.Get().data(), data);
+
+    auto truncated = ReadContent(reader, buffer);
+    ASSERT_NE(truncated, Success);
+    EXPECT_EQ(truncated.Failure().reason, "EOF");
+}
+
+TEST(FindContent, Incomplete) {
+    std::string_view content;
+    EXPECT_EQ(FindContent("", content), size_t{0});
+    EXPECT_EQ(FindContent("Content-Length: 5\r\n", content), size_t{0});
+    EXPECT_EQ(FindContent("Content-Length: 5\r\n\r\nhell", content), size_t{0});
+}
+
+TEST(FindContent, Complete) {
+    std::string_view data = "Content-Length: 5\r\n\r\nhelloContent-Length: 3\r\n\r\nabc";
+    std::string_view content;
+    auto first = FindContent(data, content);
+    ASSERT_EQ(first, Success);
+    EXPECT_EQ(first.Get(), 26u);
+    EXPECT_EQ(content, "hello");
+
+    data.remove_prefix(first.Get());
+    auto second = FindContent(data, content);
+    ASSERT_EQ(second, Success);
+    EXPECT_EQ(second.Get(), data.size());
+    EXPECT_EQ(content, "abc");
+}
+
+TEST(FindContent, InvalidHeader) {
+    std::string_view content;
+    auto got = FindContent("Content-Length: apples\r\n\r\n", content);
+    EXPECT_NE(got, Success);
+    EXPECT_EQ(got.Failure().reason, "invalid content length value");
+
+    std::string padding(32 * 1024, 'x');
+    auto too_long = FindContent(padding, content);
+    EXPECT_NE(too_long, Success);
+    EXPECT_EQ(too_long.Failure().reason, "content header too long");
+}
+
 TEST(WriteContent, Single) {
     BufferWriter writer;
     auto got = WriteContent(writer, "hello world");
@@ -102,6 +301,20 @@ TEST(WriteContent, Single) {
     EXPECT_EQ(writer.BufferString(), "Content-Length: 11\r\n\r\nhello world");
 }
 
+TEST(WriteContent, Empty) {
+    BufferWriter writer;
+    EXPECT_EQ(WriteContent(writer, ""), Success);
+    EXPECT_EQ(writer.BufferString(), "Content-Length: 0\r\n\r\n");
+}
+
+TEST(WriteContent, GatherWrite) {
+    // The header and content are passed to the writer separately, without being joined
+    RecordingWriter writer;
+    std::string content(100000, 'x');
+    EXPECT_EQ(WriteContent(writer, content), Success);
+    EXPECT_THAT(writer.writes, testing::ElementsAre("Content-Length: 100000\r\n\r\n", content));
+}
+
 TEST(WriteContent, Multiple) {
     BufferWriter writer;
     {
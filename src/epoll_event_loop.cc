@@ -0,0 +1,403 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/epoll_event_loop.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "langsvr/content_stream.h"
+#include "langsvr/fd_reader.h"
+#include "langsvr/fd_writer.h"
+#include "langsvr/session.h"
+
+namespace langsvr {
+
+namespace {
+
+/// The minimum number of bytes read from a connection per read() call
+static constexpr size_t kReadChunkSize = 64 * 1024;
+
+/// The maximum number of events returned by a single epoll_wait() call
+static constexpr int kMaxEvents = 64;
+
+/// @returns a Failure describing the current errno for the system call @p call
+Failure ErrnoFailure(const char* call) {
+    return Failure{std::string(call) + " failed: " + strerror(errno)};
+}
+
+/// SetNonBlocking sets O_NONBLOCK on the file descriptor @p fd
+Result<SuccessType> SetNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+        return ErrnoFailure("fcntl");
+    }
+    return Success;
+}
+
+}  // namespace
+
+/// Connection holds the state of a Session added to the loop.
+/// Connection is the Writer used by the Session's sender: bytes that cannot be written immediately
+/// are queued, and flushed by the loop when the output file descriptor becomes writable.
+struct EpollEventLoop::Connection final : Writer {
+    Connection(EpollEventLoop& l, Session& s, int in_fd, int out_fd)
+        : loop(l), session(s), reader(in_fd), writer(out_fd) {}
+
+    /// @copydoc Writer::Write
+    Result<SuccessType> Write(const std::byte* in, size_t count) override {
+        ConstBuffer buffer{in, count};
+        return WriteV(Span<ConstBuffer>{&buffer, 1});
+    }
+
+    /// @copydoc Writer::WriteV
+    Result<SuccessType> WriteV(Span<ConstBuffer> buffers) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (closed) {
+            return Failure{"connection closed"};
+        }
+
+        // Bytes can only be written directly if nothing is queued ahead of them
+        size_t written = 0;
+        if (output.empty()) {
+            auto n = writer.TryWriteV(buffers);
+            if (n != Success) {
+                return n.Failure();
+            }
+            written = n.Get();
+        }
+
+        for (auto& buffer : buffers) {
+            if (written >= buffer.size) {
+                written -= buffer.size;
+                continue;
+            }
+            output.append(reinterpret_cast<const char*>(buffer.data) + written,
+                          buffer.size - written);
+            written = 0;
+        }
+
+        if (!output.empty() && !want_write) {
+            want_write = true;
+            return loop.Watch(*this);
+        }
+        return Success;
+    }
+
+    EpollEventLoop& loop;
+    Session& session;
+    FdReader reader;
+    FdWriter writer;
+
+    /// The received bytes. The bytes in [begin, end) have not yet been framed into a message.
+    std::string input;
+    size_t begin = 0;
+    size_t end = 0;
+
+    /// Guards output, want_write and closed, and modifications of draining
+    std::mutex mutex;
+    /// The bytes waiting for the output file descriptor to become writable
+    std::string output;
+    /// True if the loop is waiting for the output file descriptor to become writable
+    bool want_write = false;
+    /// True once the input has ended, or the connection has been removed from the loop. No more
+    /// messages can be sent once the connection is closed.
+    bool closed = false;
+
+    /// True while the connection has stopped reading, and is writing the output queued before it
+    /// was closed. Only modified by the loop thread, with the mutex held.
+    bool draining = false;
+};
+
+Result<std::unique_ptr<EventLoop>> EpollEventLoop::Create() {
+    int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+        return ErrnoFailure("epoll_create1");
+    }
+    int wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wake_fd < 0) {
+        auto failure = ErrnoFailure("eventfd");
+        close(epoll_fd);
+        return failure;
+    }
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = wake_fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &event) < 0) {
+        auto failure = ErrnoFailure("epoll_ctl");
+        close(wake_fd);
+        close(epoll_fd);
+        return failure;
+    }
+    return std::unique_ptr<EventLoop>(new EpollEventLoop(epoll_fd, wake_fd));
+}
+
+EpollEventLoop::EpollEventLoop(int epoll_fd, int wake_fd)
+    : epoll_fd_(epoll_fd), wake_fd_(wake_fd) {}
+
+EpollEventLoop::~EpollEventLoop() {
+    // Senders hold a reference to their connection, which may outlive the loop
+    for (auto& it : connections_) {
+        std::lock_guard<std::mutex> lock(it.second->mutex);
+        it.second->closed = true;
+    }
+    close(wake_fd_);
+    close(epoll_fd_);
+}
+
+Result<SuccessType> EpollEventLoop::Add(Session& session, int in_fd, int out_fd) {
+    if (auto res = SetNonBlocking(in_fd); res != Success) {
+        return res.Failure();
+    }
+    if (auto res = SetNonBlocking(out_fd); res != Success) {
+        return res.Failure();
+    }
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = in_fd;
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, in_fd, &event) < 0) {
+        return ErrnoFailure("epoll_ctl");
+    }
+    if (out_fd != in_fd) {
+        // No events are watched until there is queued output
+        event.events = 0;
+        event.data.fd = out_fd;
+        if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, out_fd, &event) < 0) {
+            auto failure = ErrnoFailure("epoll_ctl");
+            epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, in_fd, nullptr);
+            return failure;
+        }
+    }
+
+    auto conn = std::make_shared<Connection>(*this, session, in_fd, out_fd);
+    connections_[in_fd] = conn;
+    connections_[out_fd] = conn;
+    connection_count_++;
+    session.SetSender([conn](std::string_view msg) { return WriteContent(*conn, msg); });
+    return Success;
+}
+
+Result<SuccessType> EpollEventLoop::Run() {
+    epoll_event events[kMaxEvents];
+    while (connection_count_ > 0 && !stop_) {
+        int count = epoll_wait(epoll_fd_, events, kMaxEvents, -1);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return ErrnoFailure("epoll_wait");
+        }
+        for (int i = 0; i < count; i++) {
+            int fd = events[i].data.fd;
+            if (fd == wake_fd_) {
+                uint64_t value = 0;
+                [[maybe_unused]] auto n = read(wake_fd_, &value, sizeof(value));
+                continue;
+            }
+            // The connection may have been closed by an earlier event of this batch
+            auto it = connections_.find(fd);
+            if (it == connections_.end()) {
+                continue;
+            }
+            auto conn = it->second;
+            if (fd == conn->writer.Fd() && fd != conn->reader.Fd() &&
+                (events[i].events & (EPOLLERR | EPOLLHUP))) {
+                Hangup(*conn);
+                continue;
+            }
+            if (fd == conn->writer.Fd() && (events[i].events & (EPOLLOUT | EPOLLERR))) {
+                Flush(*conn);
+            }
+            if (fd == conn->reader.Fd() && !conn->draining &&
+                (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))) {
+                Receive(*conn);
+            }
+        }
+    }
+    stop_ = false;
+    return Success;
+}
+
+void EpollEventLoop::Stop() {
+    stop_ = true;
+    uint64_t value = 1;
+    [[maybe_unused]] auto n = write(wake_fd_, &value, sizeof(value));
+}
+
+void EpollEventLoop::Receive(Connection& conn) {
+    // Make room for the read, moving the unframed bytes to the front of the buffer, and only
+    // growing the buffer when a message is larger than the buffer.
+    if (conn.input.size() - conn.end < kReadChunkSize) {
+        conn.input.erase(0, conn.begin);
+        conn.end -= conn.begin;
+        conn.begin = 0;
+        if (conn.input.size() - conn.end < kReadChunkSize) {
+            conn.input.resize(conn.end + kReadChunkSize);
+        }
+    }
+
+    auto* buffer = reinterpret_cast<std::byte*>(conn.input.data());
+    auto n = conn.reader.TryRead(buffer + conn.end, conn.input.size() - conn.end);
+    if (n != Success) {
+        ReportError(conn.session, n.Failure());
+        Close(conn);
+        return;
+    }
+    if (n.Get() == FdReader::kWouldBlock) {
+        return;
+    }
+    if (n.Get() == 0) {
+        Close(conn);  // End of input
+        return;
+    }
+    conn.end += n.Get();
+
+    auto data = std::string_view(conn.input).substr(conn.begin, conn.end - conn.begin);
+    bool ok = Dispatch(conn.session, data);
+    conn.begin = conn.end - data.size();
+    if (!ok) {
+        Close(conn);
+        return;
+    }
+    if (conn.begin == conn.end) {
+        conn.begin = conn.end = 0;
+    }
+}
+
+void EpollEventLoop::Flush(Connection& conn) {
+    // Failures are reported once the mutex is released, as the error handler may send messages
+    Result<SuccessType> res = Success;
+    bool drained = false;
+    {
+        std::lock_guard<std::mutex> lock(conn.mutex);
+        if (conn.output.empty()) {
+            return;
+        }
+        ConstBuffer buffer{conn.output};
+        auto n = conn.writer.TryWriteV(Span<ConstBuffer>{&buffer, 1});
+        if (n != Success) {
+            // The output can no longer be written. Drop it, and stop watching the file descriptor.
+            res = n.Failure();
+            conn.output.clear();
+        } else {
+            conn.output.erase(0, n.Get());
+        }
+        if (conn.output.empty()) {
+            conn.want_write = false;
+            if (conn.draining) {
+                drained = true;
+            } else if (auto watch = Watch(conn); watch != Success) {
+                res = watch.Failure();
+            }
+        }
+    }
+    if (res != Success) {
+        ReportError(conn.session, res.Failure());
+    }
+    if (drained) {
+        Remove(conn);
+    }
+}
+
+void EpollEventLoop::Close(Connection& conn) {
+    Result<SuccessType> res = Success;
+    {
+        std::lock_guard<std::mutex> lock(conn.mutex);
+        conn.closed = true;
+        if (!conn.output.empty()) {
+            // Messages sent before the end of the input are still delivered. Stop reading, and let
+            // Flush() remove the connection once the output has been written, so that a peer that
+            // does not read its output cannot stall the loop.
+            conn.draining = true;
+            int in_fd = conn.reader.Fd();
+            if (in_fd != conn.writer.Fd()) {
+                epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, in_fd, nullptr);
+                connections_.erase(in_fd);
+                return;
+            }
+            res = Watch(conn);
+            if (res == Success) {
+                return;
+            }
+            conn.output.clear();
+        }
+    }
+    if (res != Success) {
+        ReportError(conn.session, res.Failure());
+    }
+    Remove(conn);
+}
+
+void EpollEventLoop::Hangup(Connection& conn) {
+    {
+        std::lock_guard<std::mutex> lock(conn.mutex);
+        conn.closed = true;
+        conn.want_write = false;
+        conn.output.clear();
+    }
+    ReportError(conn.session, Failure{"output closed by peer"});
+    Remove(conn);
+}
+
+void EpollEventLoop::Remove(Connection& conn) {
+    // The input file descriptor is no longer watched if the connection was draining
+    int in_fd = conn.reader.Fd();
+    int out_fd = conn.writer.Fd();
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, in_fd, nullptr);
+    if (out_fd != in_fd) {
+        epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, out_fd, nullptr);
+    }
+    connections_.erase(in_fd);
+    connections_.erase(out_fd);
+    connection_count_--;
+}
+
+Result<SuccessType> EpollEventLoop::Watch(Connection& conn) {
+    int in_fd = conn.reader.Fd();
+    int out_fd = conn.writer.Fd();
+    epoll_event event{};
+    event.events = conn.want_write ? uint32_t{EPOLLOUT} : 0u;
+    if (out_fd == in_fd && !conn.draining) {
+        event.events |= EPOLLIN;
+    }
+    event.data.fd = out_fd;
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, out_fd, &event) < 0) {
+        return ErrnoFailure("epoll_ctl");
+    }
+    return Success;
+}
+
+}  // namespace langsvr
@@ -0,0 +1,106 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_LANGSVR_EPOLL_EVENT_LOOP_H_
+#define SRC_LANGSVR_EPOLL_EVENT_LOOP_H_
+
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+
+#include "langsvr/event_loop.h"
+
+namespace langsvr {
+
+/// EpollEventLoop is the EventLoop::Backend::kEpoll implementation of EventLoop.
+/// Messages are written immediately if the output file descriptor can accept them, and are
+/// otherwise queued and flushed once epoll reports the file descriptor as writable.
+class EpollEventLoop final : public EventLoop {
+  public:
+    /// Create constructs a new EpollEventLoop
+    /// @returns the EpollEventLoop, or a failure if the epoll instance could not be created
+    static Result<std::unique_ptr<EventLoop>> Create();
+
+    /// Destructor
+    ~EpollEventLoop() override;
+
+    /// @copydoc EventLoop::GetBackend
+    Backend GetBackend() const override { return Backend::kEpoll; }
+
+    /// @copydoc EventLoop::Add
+    /// Both file descriptors are made non-blocking.
+    Result<SuccessType> Add(Session& session, int in_fd, int out_fd) override;
+
+    /// @copydoc EventLoop::Run
+    Result<SuccessType> Run() override;
+
+    /// @copydoc EventLoop::Stop
+    void Stop() override;
+
+  private:
+    struct Connection;
+
+    /// Constructor
+    EpollEventLoop(int epoll_fd, int wake_fd);
+
+    /// Receive reads the available bytes of @p conn, and dispatches all the complete messages
+    void Receive(Connection& conn);
+
+    /// Flush writes as much of the queued output of @p conn as the output file descriptor accepts
+    void Flush(Connection& conn);
+
+    /// Close stops reading from @p conn, and removes it from the loop once its queued output has
+    /// been written by Flush()
+    void Close(Connection& conn);
+
+    /// Hangup drops the queued output of @p conn and removes it from the loop, once the reader of
+    /// its separate output file descriptor has closed. epoll reports EPOLLERR on the output file
+    /// descriptor regardless of the watched events, so it must no longer be watched.
+    void Hangup(Connection& conn);
+
+    /// Remove removes @p conn from the loop
+    void Remove(Connection& conn);
+
+    /// Watch updates the epoll events of the output file descriptor of @p conn, so that the loop
+    /// is woken when the file descriptor is writable while @p conn has queued output.
+    /// Must be called with the Connection's mutex held.
+    Result<SuccessType> Watch(Connection& conn);
+
+    /// The epoll instance
+    int epoll_fd_ = -1;
+    /// The eventfd used by Stop() to wake Run()
+    int wake_fd_ = -1;
+    /// The connections, keyed by both their input and output file descriptors
+    std::unordered_map<int, std::shared_ptr<Connection>> connections_;
+    /// The number of connections added to the loop
+    size_t connection_count_ = 0;
+    std::atomic<bool> stop_ = false;
+};
+
+}  // namespace langsvr
+
+#endif  // SRC_LANGSVR_EPOLL_EVENT_LOOP_H_
@@ -0,0 +1,86 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "langsvr/event_loop.h"
+
+#include <string>
+
+#include "langsvr/content_stream.h"
+#include "langsvr/session.h"
+#include "src/epoll_event_loop.h"
+
+#if LANGSVR_IO_URING
+#include "src/io_uring_event_loop.h"
+#endif
+
+namespace langsvr {
+
+Result<std::unique_ptr<EventLoop>> EventLoop::Create(Backend backend) {
+#if LANGSVR_IO_URING
+    if (backend == Backend::kIoUring) {
+        // io_uring may be unsupported by the kernel, or disabled by the system's policy, in which
+        // case the epoll backend is used instead.
+        if (auto loop = IoUringEventLoop::Create(); loop == Success) {
+            return loop;
+        }
+    }
+#else
+    (void)backend;
+#endif
+    return EpollEventLoop::Create();
+}
+
+EventLoop::EventLoop() = default;
+
+EventLoop::~EventLoop() = default;
+
+bool EventLoop::Dispatch(Session& session, std::string_view& data) {
+    while (!data.empty()) {
+        std::string_view content;
+        auto length = FindContent(data, content);
+        if (length != Success) {
+            ReportError(session, Failure{"invalid content header: " + length.Failure().reason});
+            return false;
+        }
+        if (length.Get() == 0) {
+            break;  // Wait for the rest of the message
+        }
+        data.remove_prefix(length.Get());
+        if (auto res = session.Receive(content); res != Success) {
+            ReportError(session, res.Failure());
+        }
+    }
+    return true;
+}
+
+void EventLoop::ReportError(Session& session, const Failure& failure) {
+    if (error_handler_) {
+        error_handler_(session, failure);
+    }
+}
+
+}  // namespace langsvr
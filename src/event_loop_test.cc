@@ -0,0 +1,398 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "langsvr/event_loop.h"
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "langsvr/buffered_reader.h"
+#include "langsvr/content_stream.h"
+#include "langsvr/fd_reader.h"
+#include "langsvr/fd_writer.h"
+#include "langsvr/lsp/lsp.h"
+#include "langsvr/session.h"
+#include "langsvr/thread_pool.h"
+
+namespace langsvr {
+namespace {
+
+using testing::HasSubstr;
+
+/// @returns a hover request message with the id @p id
+std::string HoverRequest(int id) {
+    return R"({"jsonrpc":"2.0","id":)" + std::to_string(id) +
+           R"(,"method":"textDocument/hover","params":{"textDocument":{"uri":"a.txt"},)"
+           R"("position":{"line":0,"character":0}}})";
+}
+
+/// RegisterHover registers a hover handler on @p session that responds with @p text
+void RegisterHover(Session& session, const std::string& text) {
+    session.Register([text](const lsp::TextDocumentHoverRequest&)
+                         -> lsp::TextDocumentHoverRequest::SuccessType {
+        lsp::Hover hover;
+        hover.contents = lsp::MarkupContent{lsp::MarkupKind::kPlainText, text};
+        return hover;
+    });
+}
+
+/// SetNonBlocking sets O_NONBLOCK on @p fd
+void SetNonBlocking(int fd) {
+    ASSERT_EQ(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK), 0);
+}
+
+/// @returns true if O_NONBLOCK is set on @p fd
+bool IsNonBlocking(int fd) {
+    return fcntl(fd, F_GETFL) & O_NONBLOCK;
+}
+
+/// EventLoopTest runs each test with each of the EventLoop backends. The io_uring backend falls
+/// back to epoll if io_uring is unavailable, in which case the io_uring tests are skipped.
+class EventLoopTest : public testing::TestWithParam<EventLoop::Backend> {
+  protected:
+    /// Skips the test if the loop of the backend under test falls back to another backend
+    void SetUp() override {
+        auto loop = EventLoop::Create(GetParam());
+        ASSERT_EQ(loop, Success);
+        if (loop.Get()->GetBackend() != GetParam()) {
+            GTEST_SKIP() << "backend unavailable, the loop fell back to epoll";
+        }
+    }
+
+    /// @returns a new loop of the backend under test
+    Result<std::unique_ptr<EventLoop>> CreateLoop() {
+        auto loop = EventLoop::Create(GetParam());
+        if (loop == Success) {
+            EXPECT_EQ(loop.Get()->GetBackend(), GetParam());
+        }
+        return loop;
+    }
+
+    /// TestPipes exchanges messages with a Session over a pair of pipes
+    /// @param non_blocking if true, then the pipes are made non-blocking before they are added
+    void TestPipes(bool non_blocking);
+};
+
+INSTANTIATE_TEST_SUITE_P(Backends,
+                         EventLoopTest,
+                         testing::Values(EventLoop::Backend::kEpoll,
+                                         EventLoop::Backend::kIoUring));
+
+TEST(EventLoop, EpollBackend) {
+    auto loop = EventLoop::Create(EventLoop::Backend::kEpoll);
+    ASSERT_EQ(loop, Success);
+    EXPECT_EQ(loop.Get()->GetBackend(), EventLoop::Backend::kEpoll);
+}
+
+void EventLoopTest::TestPipes(bool non_blocking) {
+    int requests[2];
+    int responses[2];
+    ASSERT_EQ(pipe(requests), 0);
+    ASSERT_EQ(pipe(responses), 0);
+    if (non_blocking) {
+        SetNonBlocking(requests[0]);
+        SetNonBlocking(responses[1]);
+    }
+
+    auto loop = CreateLoop();
+    ASSERT_EQ(loop, Success);
+
+    // The responses are larger than the pipe's buffer, so they are queued until the client reads
+    std::string text(16 * 1024, 'x');
+    Session session;
+    RegisterHover(session, text);
+    ASSERT_EQ(loop.Get()->Add(session, requests[0], responses[1]), Success);
+    if (non_blocking) {
+        EXPECT_TRUE(IsNonBlocking(requests[0]));
+        EXPECT_TRUE(IsNonBlocking(responses[1]));
+    }
+    Result<SuccessType> run;
+    std::thread thread([&] { run = loop.Get()->Run(); });
+
+    static constexpr int kRequests = 32;
+    FdWriter writer(requests[1]);
+    for (int id = 1; id <= kRequests; id++) {
+        ASSERT_EQ(WriteContent(writer, HoverRequest(id)), Success);
+    }
+
+    FdReader fd_reader(responses[0]);
+    BufferedReader reader(fd_reader);
+    for (int id = 1; id <= kRequests; id++) {
+        auto response = ReadContent(reader);
+        ASSERT_EQ(response, Success);
+        EXPECT_THAT(response.Get(), HasSubstr(R"("id":)" + std::to_string(id) + ","));
+        EXPECT_THAT(response.Get(), HasSubstr(text));
+    }
+
+    // The end of the request stream removes the session, and Run() returns
+    close(requests[1]);
+    thread.join();
+    EXPECT_EQ(run, Success);
+    EXPECT_NE(session.Send(lsp::TextDocumentHoverRequest{}), Success);
+
+    close(requests[0]);
+    close(responses[0]);
+    close(responses[1]);
+}
+
+TEST_P(EventLoopTest, Pipes) {
+    TestPipes(/* non_blocking */ false);
+}
+
+TEST_P(EventLoopTest, NonBlockingPipes) {
+    TestPipes(/* non_blocking */ true);
+}
+
+TEST_P(EventLoopTest, SocketsWithExecutor) {
+    static constexpr int kSessions = 3;
+    static constexpr int kRequests = 100;
+
+    auto loop = CreateLoop();
+    ASSERT_EQ(loop, Success);
+    ThreadPool pool(4);
+
+    std::vector<std::unique_ptr<Session>> sessions;
+    std::vector<int> client_fds;
+    std::vector<int> server_fds;
+    for (int i = 0; i < kSessions; i++) {
+        int fds[2];
+        ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+        SetNonBlocking(fds[1]);
+        client_fds.push_back(fds[0]);
+        server_fds.push_back(fds[1]);
+        auto session = std::make_unique<Session>();
+        session->SetExecutor(&pool);
+        RegisterHover(*session, "session " + std::to_string(i));
+        ASSERT_EQ(loop.Get()->Add(*session, fds[1], fds[1]), Success);
+        sessions.push_back(std::move(session));
+    }
+    std::thread thread([&] { EXPECT_EQ(loop.Get()->Run(), Success); });
+
+    for (int i = 0; i < kSessions; i++) {
+        FdWriter writer(client_fds[i]);
+        for (int id = 1; id <= kRequests; id++) {
+            ASSERT_EQ(WriteContent(writer, HoverRequest(id)), Success);
+        }
+    }
+
+    for (int i = 0; i < kSessions; i++) {
+        // Responses are sent as the executor completes the requests, so may be received in any
+        // order.
+        FdReader fd_reader(client_fds[i]);
+        BufferedReader reader(fd_reader);
+        std::vector<bool> received(kRequests + 1);
+        for (int n = 0; n < kRequests; n++) {
+            auto response = ReadContent(reader);
+            ASSERT_EQ(response, Success);
+            EXPECT_THAT(response.Get(), HasSubstr("session " + std::to_string(i)));
+            for (int id = 1; id <= kRequests; id++) {
+                if (response.Get().find(R"("id":)" + std::to_string(id) + ",") !=
+                    std::string::npos) {
+                    received[id] = true;
+                }
+            }
+        }
+        for (int id = 1; id <= kRequests; id++) {
+            EXPECT_TRUE(received[id]) << "session " << i << " id " << id;
+        }
+        shutdown(client_fds[i], SHUT_WR);
+    }
+
+    thread.join();
+    pool.Wait();
+    for (int i = 0; i < kSessions; i++) {
+        close(client_fds[i]);
+        close(server_fds[i]);
+    }
+}
+
+TEST_P(EventLoopTest, PeerNotReading) {
+    int stalled[2];
+    int active[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, stalled), 0);
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, active), 0);
+
+    auto loop = CreateLoop();
+    ASSERT_EQ(loop, Success);
+    std::string text(64 * 1024, 'x');
+    Session stalled_session;
+    RegisterHover(stalled_session, text);
+    Session active_session;
+    RegisterHover(active_session, "active");
+    ASSERT_EQ(loop.Get()->Add(stalled_session, stalled[1], stalled[1]), Success);
+    ASSERT_EQ(loop.Get()->Add(active_session, active[1], active[1]), Success);
+    std::thread thread([&] { EXPECT_EQ(loop.Get()->Run(), Success); });
+
+    // The stalled peer ends its input without reading the responses, which do not fit in the
+    // socket's buffer
+    static constexpr int kRequests = 16;
+    FdWriter stalled_writer(stalled[0]);
+    for (int id = 1; id <= kRequests; id++) {
+        ASSERT_EQ(WriteContent(stalled_writer, HoverRequest(id)), Success);
+    }
+    shutdown(stalled[0], SHUT_WR);
+
+    // The other session is still served
+    FdWriter active_writer(active[0]);
+    ASSERT_EQ(WriteContent(active_writer, HoverRequest(1)), Success);
+    FdReader active_fd_reader(active[0]);
+    BufferedReader active_reader(active_fd_reader);
+    auto response = ReadContent(active_reader);
+    ASSERT_EQ(response, Success);
+    EXPECT_THAT(response.Get(), HasSubstr("active"));
+    shutdown(active[0], SHUT_WR);
+
+    // The responses queued before the end of the input are still delivered
+    FdReader stalled_fd_reader(stalled[0]);
+    BufferedReader stalled_reader(stalled_fd_reader);
+    for (int id = 1; id <= kRequests; id++) {
+        auto stalled_response = ReadContent(stalled_reader);
+        ASSERT_EQ(stalled_response, Success);
+        EXPECT_THAT(stalled_response.Get(), HasSubstr(R"("id":)" + std::to_string(id) + ","));
+    }
+
+    thread.join();
+    close(stalled[0]);
+    close(stalled[1]);
+    close(active[0]);
+    close(active[1]);
+}
+
+TEST_P(EventLoopTest, InvalidHeader) {
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+    auto loop = CreateLoop();
+    ASSERT_EQ(loop, Success);
+    std::vector<std::string> errors;
+    loop.Get()->SetErrorHandler(
+        [&](Session&, const Failure& failure) { errors.push_back(failure.reason); });
+
+    Session session;
+    ASSERT_EQ(loop.Get()->Add(session, fds[1], fds[1]), Success);
+    std::string message = "Content-Length: apples\r\n\r\n";
+    ASSERT_EQ(write(fds[0], message.data(), message.size()),
+              static_cast<ssize_t>(message.size()));
+
+    // The malformed header closes the connection, which is the loop's only connection
+    EXPECT_EQ(loop.Get()->Run(), Success);
+    EXPECT_THAT(errors,
+                testing::ElementsAre("invalid content header: invalid content length value"));
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST_P(EventLoopTest, OutputClosedFirst) {
+    if (GetParam() != EventLoop::Backend::kEpoll) {
+        // The io_uring backend only polls the output while it has a write in flight
+        GTEST_SKIP() << "the closed output is only detected by the next write";
+    }
+    int requests[2];
+    int responses[2];
+    ASSERT_EQ(pipe(requests), 0);
+    ASSERT_EQ(pipe(responses), 0);
+
+    auto loop = CreateLoop();
+    ASSERT_EQ(loop, Success);
+    std::vector<std::string> errors;
+    loop.Get()->SetErrorHandler(
+        [&](Session&, const Failure& failure) { errors.push_back(failure.reason); });
+
+    Session session;
+    ASSERT_EQ(loop.Get()->Add(session, requests[0], responses[1]), Success);
+
+    // The reader of the responses closes while the request stream stays open. The connection is
+    // removed, which is the loop's only connection, instead of the loop spinning on the error.
+    close(responses[0]);
+    EXPECT_EQ(loop.Get()->Run(), Success);
+    EXPECT_THAT(errors, testing::ElementsAre("output closed by peer"));
+    EXPECT_NE(session.Send(lsp::TextDocumentHoverRequest{}), Success);
+
+    close(requests[0]);
+    close(requests[1]);
+    close(responses[1]);
+}
+
+TEST_P(EventLoopTest, PeerClosedMidResponse) {
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+    auto loop = CreateLoop();
+    ASSERT_EQ(loop, Success);
+    std::vector<std::string> errors;
+    loop.Get()->SetErrorHandler(
+        [&](Session&, const Failure& failure) { errors.push_back(failure.reason); });
+
+    // The response is larger than the socket's buffer, so it is still being written when the
+    // peer closes the socket
+    std::string text(4 * 1024 * 1024, 'x');
+    Session session;
+    RegisterHover(session, text);
+    ASSERT_EQ(loop.Get()->Add(session, fds[1], fds[1]), Success);
+    std::thread thread([&] { EXPECT_EQ(loop.Get()->Run(), Success); });
+
+    FdWriter writer(fds[0]);
+    ASSERT_EQ(WriteContent(writer, HoverRequest(1)), Success);
+    char header[16];
+    ASSERT_EQ(read(fds[0], header, sizeof(header)), static_cast<ssize_t>(sizeof(header)));
+    close(fds[0]);
+
+    // Writing the rest of the response fails instead of raising SIGPIPE, and the connection, which
+    // is the loop's only connection, is removed
+    thread.join();
+    EXPECT_FALSE(errors.empty());
+    EXPECT_NE(session.Send(lsp::TextDocumentHoverRequest{}), Success);
+
+    close(fds[1]);
+}
+
+TEST_P(EventLoopTest, Stop) {
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+    auto loop = CreateLoop();
+    ASSERT_EQ(loop, Success);
+    Session session;
+    ASSERT_EQ(loop.Get()->Add(session, fds[1], fds[1]), Success);
+    std::thread thread([&] { EXPECT_EQ(loop.Get()->Run(), Success); });
+    loop.Get()->Stop();
+    thread.join();
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+}  // namespace
+}  // namespace langsvr
@@ -0,0 +1,86 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "langsvr/fd_reader.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <string>
+
+namespace langsvr {
+
+FdReader::~FdReader() = default;
+
+size_t FdReader::Read(std::byte* out, size_t count) {
+    size_t total = 0;
+    while (total < count) {
+        size_t n = ReadSome(out + total, count - total);
+        if (n == 0) {
+            break;
+        }
+        total += n;
+    }
+    return total;
+}
+
+size_t FdReader::ReadSome(std::byte* out, size_t count) {
+    while (true) {
+        auto n = TryRead(out, count);
+        if (n != Success) {
+            return 0;
+        }
+        if (n.Get() != kWouldBlock) {
+            return n.Get();
+        }
+        // The file descriptor is non-blocking, and has no data. Wait for some.
+        pollfd pfd{fd_, POLLIN, 0};
+        if (poll(&pfd, 1, -1) < 0 && errno != EINTR) {
+            return 0;
+        }
+    }
+}
+
+Result<size_t> FdReader::TryRead(std::byte* out, size_t count) {
+    while (true) {
+        ssize_t n = read(fd_, out, count);
+        if (n >= 0) {
+            return static_cast<size_t>(n);
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return kWouldBlock;
+        }
+        return Failure{std::string("read failed: ") + strerror(errno)};
+    }
+}
+
+}  // namespace langsvr
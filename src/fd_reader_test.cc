@@ -0,0 +1,111 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "langsvr/fd_reader.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+
+#include "gmock/gmock.h"
+
+#include "langsvr/buffered_reader.h"
+#include "langsvr/content_stream.h"
+
+namespace langsvr {
+namespace {
+
+class FdReaderTest : public testing::Test {
+  protected:
+    void SetUp() override { ASSERT_EQ(pipe(fds_), 0); }
+    void TearDown() override {
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+    void CloseWriteEnd() {
+        close(fds_[1]);
+        fds_[1] = -1;
+    }
+
+    int fds_[2] = {-1, -1};
+};
+
+TEST_F(FdReaderTest, Read) {
+    ASSERT_EQ(write(fds_[1], "hello world", 11), 11);
+    CloseWriteEnd();
+
+    FdReader reader(fds_[0]);
+    std::string data(5, '\0');
+    EXPECT_EQ(reader.Read(reinterpret_cast<std::byte*>(data.data()), 5), 5u);
+    EXPECT_EQ(data, "hello");
+    data.assign(10, '\0');
+    EXPECT_EQ(reader.Read(reinterpret_cast<std::byte*>(data.data()), 10), 6u);
+    EXPECT_EQ(data.substr(0, 6), " world");
+}
+
+TEST_F(FdReaderTest, TryRead) {
+    ASSERT_EQ(fcntl(fds_[0], F_SETFL, O_NONBLOCK), 0);
+    FdReader reader(fds_[0]);
+    std::byte data[8];
+    EXPECT_EQ(reader.TryRead(data, sizeof(data)), FdReader::kWouldBlock);
+
+    ASSERT_EQ(write(fds_[1], "abc", 3), 3);
+    EXPECT_EQ(reader.TryRead(data, sizeof(data)), size_t{3});
+
+    CloseWriteEnd();
+    EXPECT_EQ(reader.TryRead(data, sizeof(data)), size_t{0});
+}
+
+TEST_F(FdReaderTest, NonBlockingReadContent) {
+    // The reader waits for the data written by the other thread
+    ASSERT_EQ(fcntl(fds_[0], F_SETFL, O_NONBLOCK), 0);
+    std::string content(100 * 1024, 'x');
+    std::thread writer([&] {
+        std::string message = "Content-Length: " + std::to_string(content.size()) + "\r\n\r\n";
+        message += content;
+        for (size_t offset = 0; offset < message.size();) {
+            auto n = write(fds_[1], message.data() + offset, message.size() - offset);
+            ASSERT_GT(n, 0);
+            offset += static_cast<size_t>(n);
+        }
+    });
+
+    FdReader fd_reader(fds_[0]);
+    BufferedReader reader(fd_reader);
+    auto got = ReadContent(reader);
+    writer.join();
+    ASSERT_EQ(got, Success);
+    EXPECT_EQ(got.Get(), content);
+}
+
+}  // namespace
+}  // namespace langsvr
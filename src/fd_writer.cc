@@ -0,0 +1,150 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "langsvr/fd_writer.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace langsvr {
+
+namespace {
+
+/// @returns true if @p fd is a socket
+bool IsSocket(int fd) {
+    struct stat st {};
+    return fstat(fd, &st) == 0 && S_ISSOCK(st.st_mode);
+}
+
+/// Writes the @p count buffers of @p iov to @p fd with a single system call
+/// @param is_socket true if @p fd is a socket
+/// @returns the number of bytes written, or -1 with errno set on failure
+ssize_t WriteIov(int fd, [[maybe_unused]] bool is_socket, const iovec* iov, int count) {
+#ifdef MSG_NOSIGNAL
+    if (is_socket) {
+        // Writing to a socket closed by the peer fails with EPIPE, instead of raising SIGPIPE
+        msghdr msg{};
+        msg.msg_iov = const_cast<iovec*>(iov);
+        msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(count);
+        return sendmsg(fd, &msg, MSG_NOSIGNAL);
+    }
+#endif
+    return writev(fd, iov, count);
+}
+
+}  // namespace
+
+FdWriter::FdWriter(int fd) : fd_(fd), is_socket_(IsSocket(fd)) {}
+
+FdWriter::~FdWriter() = default;
+
+Result<SuccessType> FdWriter::Write(const std::byte* in, size_t count) {
+    ConstBuffer buffer{in, count};
+    return WriteV(Span<ConstBuffer>{&buffer, 1});
+}
+
+Result<SuccessType> FdWriter::WriteV(Span<ConstBuffer> buffers) {
+    std::vector<iovec> iov;
+    iov.reserve(buffers.size());
+    for (auto& buffer : buffers) {
+        if (buffer.size > 0) {
+            iov.push_back(iovec{const_cast<std::byte*>(buffer.data), buffer.size});
+        }
+    }
+
+    size_t first = 0;  // The first iovec with unwritten data
+    while (first < iov.size()) {
+        int count = static_cast<int>(std::min<size_t>(iov.size() - first, IOV_MAX));
+        ssize_t n = WriteIov(fd_, is_socket_, &iov[first], count);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                // The file descriptor is non-blocking, and is full. Wait for it to drain.
+                pollfd pfd{fd_, POLLOUT, 0};
+                if (poll(&pfd, 1, -1) < 0 && errno != EINTR) {
+                    return Failure{std::string("poll failed: ") + strerror(errno)};
+                }
+                continue;
+            }
+            return Failure{std::string(is_socket_ ? "sendmsg failed: " : "writev failed: ") +
+                           strerror(errno)};
+        }
+
+        // Skip over the written bytes
+        auto written = static_cast<size_t>(n);
+        while (first < iov.size() && written >= iov[first].iov_len) {
+            written -= iov[first].iov_len;
+            first++;
+        }
+        if (written > 0) {
+            iov[first].iov_base = static_cast<std::byte*>(iov[first].iov_base) + written;
+            iov[first].iov_len -= written;
+        }
+    }
+    return Success;
+}
+
+Result<size_t> FdWriter::TryWriteV(Span<ConstBuffer> buffers) {
+    iovec iov[16];
+    int count = 0;
+    for (auto& buffer : buffers) {
+        if (buffer.size > 0 && count < static_cast<int>(std::size(iov))) {
+            iov[count++] = iovec{const_cast<std::byte*>(buffer.data), buffer.size};
+        }
+    }
+    if (count == 0) {
+        return size_t{0};
+    }
+    while (true) {
+        ssize_t n = WriteIov(fd_, is_socket_, iov, count);
+        if (n >= 0) {
+            return static_cast<size_t>(n);
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return size_t{0};
+        }
+        return Failure{std::string(is_socket_ ? "sendmsg failed: " : "writev failed: ") +
+                       strerror(errno)};
+    }
+}
+
+}  // namespace langsvr
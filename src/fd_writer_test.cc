@@ -0,0 +1,107 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "langsvr/fd_writer.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+
+#include "gmock/gmock.h"
+
+#include "langsvr/content_stream.h"
+#include "langsvr/fd_reader.h"
+
+namespace langsvr {
+namespace {
+
+class FdWriterTest : public testing::Test {
+  protected:
+    void SetUp() override { ASSERT_EQ(pipe(fds_), 0); }
+    void TearDown() override {
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    int fds_[2] = {-1, -1};
+};
+
+TEST_F(FdWriterTest, WriteV) {
+    FdWriter writer(fds_[1]);
+    ConstBuffer buffers[] = {ConstBuffer{"hello"}, ConstBuffer{""}, ConstBuffer{" world"}};
+    EXPECT_EQ(writer.WriteV(Span<ConstBuffer>{buffers, std::size(buffers)}), Success);
+
+    std::string data(11, '\0');
+    FdReader reader(fds_[0]);
+    EXPECT_EQ(reader.Read(reinterpret_cast<std::byte*>(data.data()), data.size()), data.size());
+    EXPECT_EQ(data, "hello world");
+}
+
+TEST_F(FdWriterTest, TryWriteVFull) {
+    ASSERT_EQ(fcntl(fds_[1], F_SETFL, O_NONBLOCK), 0);
+    FdWriter writer(fds_[1]);
+    std::string data(4096, 'x');
+    ConstBuffer buffer{data};
+    size_t total = 0;
+    while (true) {
+        auto n = writer.TryWriteV(Span<ConstBuffer>{&buffer, 1});
+        ASSERT_EQ(n, Success);
+        if (n.Get() == 0) {
+            break;  // The pipe is full
+        }
+        total += n.Get();
+    }
+    EXPECT_GT(total, 0u);
+}
+
+TEST_F(FdWriterTest, NonBlockingWriteContent) {
+    // The content is larger than the pipe's buffer, so the writer waits for the reader
+    ASSERT_EQ(fcntl(fds_[1], F_SETFL, O_NONBLOCK), 0);
+    std::string content;
+    for (int i = 0; content.size() < 1024 * 1024; i++) {
+        content += std::to_string(i) + ",";
+    }
+    Result<std::string> got;
+    std::thread reader_thread([&] {
+        FdReader reader(fds_[0]);
+        got = ReadContent(reader);
+    });
+
+    FdWriter writer(fds_[1]);
+    EXPECT_EQ(WriteContent(writer, content), Success);
+    reader_thread.join();
+    ASSERT_EQ(got, Success);
+    EXPECT_EQ(got.Get(), content);
+}
+
+}  // namespace
+}  // namespace langsvr
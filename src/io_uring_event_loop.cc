@@ -0,0 +1,943 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/io_uring_event_loop.h"
+
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "langsvr/content_stream.h"
+#include "langsvr/session.h"
+#include "langsvr/writer.h"
+
+namespace langsvr {
+
+namespace {
+
+/// The number of submission queue entries
+static constexpr unsigned kSubmissionQueueSize = 256;
+
+/// The number of completion queue entries
+static constexpr unsigned kCompletionQueueSize = 4 * kSubmissionQueueSize;
+
+/// The number of receive buffers provided to the kernel
+static constexpr unsigned kBufferCount = 128;
+
+/// The size in bytes of each receive buffer
+static constexpr unsigned kBufferSize = 16 * 1024;
+
+/// The identifier of the group of receive buffers
+static constexpr uint16_t kBufferGroup = 0;
+
+/// Op is an enumerator of the operations encoded in the low bits of a submission's user data. The
+/// remaining bits hold the connection identifier, or the buffer identifier of kProvideBuffers.
+enum Op : uint64_t {
+    kWake = 0,
+    kReceive = 1,
+    kWrite = 2,
+    kCancel = 3,
+    kProvideBuffers = 4,
+    kReceivePoll = 5,
+    kWritePoll = 6,
+};
+static constexpr uint64_t kOpBits = 3;
+static constexpr uint64_t kOpMask = (1u << kOpBits) - 1;
+
+/// @returns the user data of the operation @p op for the connection with identifier @p id
+uint64_t UserData(uint64_t id, Op op) {
+    return (id << kOpBits) | op;
+}
+
+/// @returns a Failure describing the current errno for the system call @p call
+Failure ErrnoFailure(const char* call) {
+    return Failure{std::string(call) + " failed: " + strerror(errno)};
+}
+
+/// PreparePoll fills @p sqe with a one-shot poll of @p fd for @p events, that is linked to the next
+/// submission queue entry, so that the next entry is only started once @p fd is ready. The poll
+/// only posts a completion if it fails, such as when it is cancelled, which also fails the linked
+/// entry with -ECANCELED.
+void PreparePoll(io_uring_sqe* sqe, int fd, uint32_t events, uint64_t user_data) {
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    events = (events << 16) | (events >> 16);  // poll32_events is stored half-word swapped
+#endif
+    sqe->poll32_events = events;
+    sqe->flags = IOSQE_IO_LINK | IOSQE_CQE_SKIP_SUCCESS;
+    sqe->user_data = user_data;
+}
+
+/// @returns true if @p fd is a socket
+bool IsSocket(int fd) {
+    struct stat st {};
+    return fstat(fd, &st) == 0 && S_ISSOCK(st.st_mode);
+}
+
+}  // namespace
+
+/// Ring is an io_uring instance, with its submission and completion queues mapped into memory, and
+/// a group of receive buffers provided to the kernel.
+class IoUringEventLoop::Ring {
+  public:
+    /// Create constructs a new Ring
+    /// @returns the Ring, or a failure if a required io_uring feature is not supported
+    static Result<std::unique_ptr<Ring>> Create() {
+        std::unique_ptr<Ring> ring(new Ring());
+
+        io_uring_params params{};
+        params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN;
+        params.cq_entries = kCompletionQueueSize;
+        ring->fd_ = static_cast<int>(syscall(__NR_io_uring_setup, kSubmissionQueueSize, &params));
+        if (ring->fd_ < 0) {
+            return ErrnoFailure("io_uring_setup");
+        }
+        if (!(params.features & IORING_FEAT_SINGLE_MMAP) ||
+            !(params.features & IORING_FEAT_NODROP) || !(params.features & IORING_FEAT_CQE_SKIP)) {
+            return Failure{"io_uring does not support the required features"};
+        }
+
+        // Map the submission and completion queue rings, which share a mapping, and the
+        // submission queue entries.
+        ring->rings_size_ =
+            std::max(params.sq_off.array + params.sq_entries * sizeof(unsigned),
+                     params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+        ring->rings_ = mmap(nullptr, ring->rings_size_, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, ring->fd_, IORING_OFF_SQ_RING);
+        if (ring->rings_ == MAP_FAILED) {
+            ring->rings_ = nullptr;
+            return ErrnoFailure("mmap");
+        }
+        ring->sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = mmap(nullptr, ring->sqes_size_, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, ring->fd_, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            return ErrnoFailure("mmap");
+        }
+        ring->sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        auto* base = static_cast<std::byte*>(ring->rings_);
+        ring->sq_head_ = reinterpret_cast<unsigned*>(base + params.sq_off.head);
+        ring->sq_tail_ = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+        ring->sq_mask_ = *reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+        ring->sq_entries_ = params.sq_entries;
+        ring->cq_head_ = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+        ring->cq_tail_ = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+        ring->cq_mask_ = *reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+        ring->cqes_ = reinterpret_cast<io_uring_cqe*>(base + params.cq_off.cqes);
+
+        // Submission queue entries are used in order, so the index array is the identity
+        auto* array = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+        for (unsigned i = 0; i < params.sq_entries; i++) {
+            array[i] = i;
+        }
+
+        if (auto res = ring->Probe(); res != Success) {
+            return res.Failure();
+        }
+        if (auto res = ring->AllocateBuffers(); res != Success) {
+            return res.Failure();
+        }
+        if (auto res = ring->ProbeMultishotReceive(); res != Success) {
+            return res.Failure();
+        }
+        return ring;
+    }
+
+    /// Destructor
+    ~Ring() {
+        if (buffers_) {
+            munmap(buffers_, kBufferCount * kBufferSize);
+        }
+        if (sqes_) {
+            munmap(sqes_, sqes_size_);
+        }
+        if (rings_) {
+            munmap(rings_, rings_size_);
+        }
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+    }
+
+    /// Reserve ensures that @p count submission queue entries are free, submitting the queued
+    /// entries if the queue is too full.
+    /// @returns true if @p count entries are free
+    bool Reserve(unsigned count) {
+        auto available = [&] {
+            return sq_entries_ - (sqe_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE));
+        };
+        if (available() >= count) {
+            return true;
+        }
+        return Submit(/* wait */ false) == Success && available() >= count;
+    }
+
+    /// NextSqe returns the next zeroed submission queue entry, submitting the queued entries if
+    /// the queue is full.
+    /// @returns the submission queue entry, or nullptr if the queue is full
+    io_uring_sqe* NextSqe() {
+        if (!Reserve(1)) {
+            return nullptr;
+        }
+        io_uring_sqe* sqe = &sqes_[sqe_tail_ & sq_mask_];
+        memset(sqe, 0, sizeof(*sqe));
+        sqe_tail_++;
+        return sqe;
+    }
+
+    /// Submit submits the queued submission queue entries with a single io_uring_enter() call
+    /// @param wait if true, then the call also waits for at least one completion
+    Result<SuccessType> Submit(bool wait) {
+        __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+        unsigned to_submit = sqe_tail_ - submitted_;
+        if (to_submit == 0 && !wait) {
+            return Success;
+        }
+        unsigned flags = wait ? IORING_ENTER_GETEVENTS : 0;
+        long n = syscall(__NR_io_uring_enter, fd_, to_submit, wait ? 1 : 0, flags, nullptr, 0);
+        if (n < 0) {
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+                return Success;  // Retried by the next call
+            }
+            return ErrnoFailure("io_uring_enter");
+        }
+        submitted_ += static_cast<unsigned>(n);
+        return Success;
+    }
+
+    /// Reap calls @p f with the user data, result and flags of each posted completion
+    template <typename F>
+    void Reap(F&& f) {
+        unsigned head = *cq_head_;
+        unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        for (; head != tail; head++) {
+            const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+            f(cqe.user_data, cqe.res, cqe.flags);
+        }
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+    }
+
+    /// @returns the receive buffer with the identifier @p id
+    std::byte* Buffer(uint16_t id) { return buffers_ + size_t{id} * kBufferSize; }
+
+    /// ProvideBuffer queues the provision of the receive buffer with the identifier @p id to the
+    /// kernel. The provision is submitted with the next Submit(), and only posts a completion if it
+    /// fails.
+    /// @returns false if the submission queue is full
+    bool ProvideBuffer(uint16_t id) {
+        io_uring_sqe* sqe = NextSqe();
+        if (!sqe) {
+            return false;
+        }
+        PrepareProvideBuffers(sqe, id, 1);
+        sqe->flags = IOSQE_CQE_SKIP_SUCCESS;
+        return true;
+    }
+
+  private:
+    Ring() = default;
+
+    /// Probe checks that the kernel supports the operations used by the loop
+    Result<SuccessType> Probe() {
+        static constexpr unsigned kMaxOps = 256;
+        std::vector<std::byte> storage(sizeof(io_uring_probe) +
+                                       kMaxOps * sizeof(io_uring_probe_op));
+        auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+        if (syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PROBE, probe, kMaxOps) < 0) {
+            return ErrnoFailure("io_uring_register");
+        }
+        // Operation flags, such as multishot receive, are not reported by the probe. See
+        // ProbeMultishotReceive().
+        for (auto op : {IORING_OP_READ, IORING_OP_WRITE, IORING_OP_RECV, IORING_OP_SEND,
+                        IORING_OP_POLL_ADD, IORING_OP_ASYNC_CANCEL, IORING_OP_PROVIDE_BUFFERS}) {
+            if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+                return Failure{"io_uring does not support the required operations"};
+            }
+        }
+        return Success;
+    }
+
+    /// AllocateBuffers allocates the receive buffers, and queues their provision to the kernel.
+    /// The provision is submitted by ProbeMultishotReceive().
+    Result<SuccessType> AllocateBuffers() {
+        void* buffers = mmap(nullptr, kBufferCount * kBufferSize, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (buffers == MAP_FAILED) {
+            return ErrnoFailure("mmap");
+        }
+        buffers_ = static_cast<std::byte*>(buffers);
+        io_uring_sqe* sqe = NextSqe();
+        if (!sqe) {
+            return Failure{"io_uring submission queue is full"};
+        }
+        PrepareProvideBuffers(sqe, 0, kBufferCount);
+        return Success;
+    }
+
+    /// ProbeMultishotReceive checks that the kernel supports multishot receives, which cannot be
+    /// probed with IORING_REGISTER_PROBE. A multishot receive of an idle socket is submitted, then
+    /// cancelled. Kernels without multishot receive fail the receive with -EINVAL.
+    /// Also submits, and checks the result of, the provision queued by AllocateBuffers().
+    Result<SuccessType> ProbeMultishotReceive() {
+        int fds[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) < 0) {
+            return ErrnoFailure("socketpair");
+        }
+        if (!Reserve(2)) {
+            close(fds[0]);
+            close(fds[1]);
+            return Failure{"io_uring submission queue is full"};
+        }
+        // Connection identifier 0 is never used by a connection
+        io_uring_sqe* recv = NextSqe();
+        recv->opcode = IORING_OP_RECV;
+        recv->ioprio = IORING_RECV_MULTISHOT;
+        recv->fd = fds[0];
+        recv->flags = IOSQE_BUFFER_SELECT;
+        recv->buf_group = kBufferGroup;
+        recv->user_data = UserData(0, kReceive);
+        io_uring_sqe* cancel = NextSqe();
+        cancel->opcode = IORING_OP_ASYNC_CANCEL;
+        cancel->addr = UserData(0, kReceive);
+        cancel->user_data = UserData(0, kCancel);
+
+        // Wait for the final completions of the provision, the receive and the cancellation
+        int32_t provided = 0;
+        int32_t received = 0;
+        int remaining = 3;
+        Result<SuccessType> res = Success;
+        while (remaining > 0 && res == Success) {
+            res = Submit(/* wait */ true);
+            Reap([&](uint64_t user_data, int32_t result, uint32_t flags) {
+                switch (static_cast<Op>(user_data & kOpMask)) {
+                    case kProvideBuffers:
+                        provided = result;
+                        break;
+                    case kReceive:
+                        if (flags & IORING_CQE_F_MORE) {
+                            return;
+                        }
+                        received = result;
+                        break;
+                    default:
+                        break;
+                }
+                remaining--;
+            });
+        }
+        close(fds[0]);
+        close(fds[1]);
+        if (res != Success) {
+            return res.Failure();
+        }
+        if (provided < 0) {
+            return Failure{std::string("io_uring buffer provision failed: ") +
+                           strerror(-provided)};
+        }
+        if (received == -EINVAL) {
+            return Failure{"io_uring does not support multishot receive"};
+        }
+        return Success;
+    }
+
+    /// PrepareProvideBuffers fills @p sqe with the provision of @p count receive buffers, starting
+    /// with the identifier @p id, to the kernel
+    void PrepareProvideBuffers(io_uring_sqe* sqe, uint16_t id, uint16_t count) {
+        sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+        sqe->fd = count;
+        sqe->addr = reinterpret_cast<uint64_t>(Buffer(id));
+        sqe->len = kBufferSize;
+        sqe->off = id;
+        sqe->buf_group = kBufferGroup;
+        sqe->user_data = UserData(id, kProvideBuffers);
+    }
+
+    int fd_ = -1;
+
+    void* rings_ = nullptr;
+    size_t rings_size_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned sq_entries_ = 0;
+    /// The tail of the queued submission queue entries
+    unsigned sqe_tail_ = 0;
+    /// The tail of the submission queue entries consumed by the kernel
+    unsigned submitted_ = 0;
+
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+
+    std::byte* buffers_ = nullptr;
+};
+
+/// Connection holds the state of a Session added to the loop.
+/// Connection is the Writer used by the Session's sender, which queues the written bytes for the
+/// loop to submit.
+struct IoUringEventLoop::Connection final : Writer {
+    Connection(IoUringEventLoop& l, Session& s, uint64_t i, int in, int out)
+        : loop(l),
+          session(s),
+          id(i),
+          in_fd(in),
+          out_fd(out),
+          in_socket(IsSocket(in)),
+          out_socket(IsSocket(out)) {}
+
+    /// @copydoc Writer::Write
+    Result<SuccessType> Write(const std::byte* in, size_t count) override {
+        ConstBuffer buffer{in, count};
+        return WriteV(Span<ConstBuffer>{&buffer, 1});
+    }
+
+    /// @copydoc Writer::WriteV
+    Result<SuccessType> WriteV(Span<ConstBuffer> buffers) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (closed) {
+            return Failure{"connection closed"};
+        }
+        for (auto& buffer : buffers) {
+            output.append(reinterpret_cast<const char*>(buffer.data), buffer.size);
+        }
+        if (!scheduled) {
+            scheduled = true;
+            loop.Schedule(id);
+        }
+        return Success;
+    }
+
+    IoUringEventLoop& loop;
+    Session& session;
+    const uint64_t id;
+    const int in_fd;
+    const int out_fd;
+    const bool in_socket;
+    const bool out_socket;
+
+    // The following are only used by the loop's thread
+    /// The received bytes of a partial message
+    std::string input;
+    /// The bytes of the write in flight. The first written bytes have been written.
+    std::string writing;
+    size_t written = 0;
+    bool receiving = false;
+    bool write_in_flight = false;
+    /// The number of cancellations in flight
+    int cancelling = 0;
+    /// True once the connection stops receiving
+    bool closing = false;
+    /// True if a receive is to be queued once the submission queue has room, or once receive
+    /// buffers have been provided back to the kernel
+    bool receive_pending = false;
+    /// True if the cancellation of the receive is to be queued once the submission queue has room
+    bool cancel_pending = false;
+    /// True if the connection is in the loop's list of deferred connections
+    bool deferred = false;
+
+    /// Guards output, scheduled and closed
+    std::mutex mutex;
+    /// The bytes to write once the write in flight has completed
+    std::string output;
+    /// True if the connection is in the loop's list of scheduled connections
+    bool scheduled = false;
+    /// True once the connection can no longer send
+    bool closed = false;
+};
+
+Result<std::unique_ptr<EventLoop>> IoUringEventLoop::Create() {
+    auto ring = Ring::Create();
+    if (ring != Success) {
+        return ring.Failure();
+    }
+    // The eventfd is blocking, as io_uring fails reads of a non-blocking eventfd with EAGAIN
+    int wake_fd = eventfd(0, EFD_CLOEXEC);
+    if (wake_fd < 0) {
+        return ErrnoFailure("eventfd");
+    }
+    std::unique_ptr<IoUringEventLoop> loop(new IoUringEventLoop(std::move(ring.Get()), wake_fd));
+    if (auto res = loop->ArmWake(); res != Success) {
+        return res.Failure();
+    }
+    return std::unique_ptr<EventLoop>(std::move(loop));
+}
+
+IoUringEventLoop::IoUringEventLoop(std::unique_ptr<Ring> ring, int wake_fd)
+    : ring_(std::move(ring)), wake_fd_(wake_fd), provided_buffers_(kBufferCount) {}
+
+IoUringEventLoop::~IoUringEventLoop() {
+    // Senders hold a reference to their connection, which may outlive the loop
+    for (auto& it : connections_) {
+        std::lock_guard<std::mutex> lock(it.second->mutex);
+        it.second->closed = true;
+    }
+
+    // The operations in flight reference the connections' buffers and the receive buffers, so
+    // must complete before they are freed.
+    if (in_flight_ > 0) {
+        destroying_ = true;
+        if (io_uring_sqe* sqe = ring_->NextSqe()) {
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->cancel_flags = IORING_ASYNC_CANCEL_ANY;
+            sqe->user_data = UserData(0, kCancel);
+            in_flight_++;
+            while (in_flight_ > 0 && ring_->Submit(/* wait */ true) == Success) {
+                ring_->Reap([&](uint64_t user_data, int32_t res, uint32_t flags) {
+                    OnComplete(user_data, res, flags);
+                });
+            }
+        }
+    }
+    ring_.reset();
+    close(wake_fd_);
+}
+
+Result<SuccessType> IoUringEventLoop::Add(Session& session, int in_fd, int out_fd) {
+    auto conn = std::make_shared<Connection>(*this, session, next_id_++, in_fd, out_fd);
+    if (auto res = ArmReceive(*conn); res != Success) {
+        return res.Failure();
+    }
+    connections_[conn->id] = conn;
+    session.SetSender([conn](std::string_view msg) { return WriteContent(*conn, msg); });
+    return Success;
+}
+
+Result<SuccessType> IoUringEventLoop::Run() {
+    while (!connections_.empty() && !stop_) {
+        SubmitWrites();
+        SubmitDeferred();
+
+        // Only wait for completions if there is nothing left to submit. Schedule() wakes the loop
+        // if output is scheduled while it waits.
+        bool wait = false;
+        {
+            std::lock_guard<std::mutex> lock(schedule_mutex_);
+            wait = scheduled_.empty() && deferred_.empty();
+            sleeping_ = wait;
+        }
+        auto res = ring_->Submit(wait);
+        {
+            std::lock_guard<std::mutex> lock(schedule_mutex_);
+            sleeping_ = false;
+        }
+        if (res != Success) {
+            return res.Failure();
+        }
+
+        ring_->Reap([&](uint64_t user_data, int32_t result, uint32_t flags) {
+            OnComplete(user_data, result, flags);
+        });
+    }
+    stop_ = false;
+    return Success;
+}
+
+void IoUringEventLoop::Stop() {
+    stop_ = true;
+    uint64_t value = 1;
+    [[maybe_unused]] auto n = write(wake_fd_, &value, sizeof(value));
+}
+
+void IoUringEventLoop::Schedule(uint64_t id) {
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(schedule_mutex_);
+        scheduled_.push_back(id);
+        wake = sleeping_;
+        sleeping_ = false;
+    }
+    if (wake) {
+        uint64_t value = 1;
+        [[maybe_unused]] auto n = write(wake_fd_, &value, sizeof(value));
+    }
+}
+
+void IoUringEventLoop::SubmitWrites() {
+    {
+        std::lock_guard<std::mutex> lock(schedule_mutex_);
+        std::swap(submitting_, scheduled_);
+    }
+    for (uint64_t id : submitting_) {
+        auto it = connections_.find(id);
+        if (it == connections_.end()) {
+            continue;
+        }
+        auto conn = it->second;
+        StartWrite(*conn);
+        Release(*conn);
+    }
+    submitting_.clear();
+}
+
+void IoUringEventLoop::SubmitDeferred() {
+    // Provide the used receive buffers back to the kernel
+    size_t provided = 0;
+    while (provided < recycled_.size() && ring_->ProvideBuffer(recycled_[provided])) {
+        provided++;
+    }
+    recycled_.erase(recycled_.begin(), recycled_.begin() + static_cast<ptrdiff_t>(provided));
+    provided_buffers_ += provided;
+
+    // Receives that ran out of buffers are re-armed once there are buffers to receive into
+    if (provided_buffers_ > 0) {
+        for (uint64_t id : starved_) {
+            if (auto it = connections_.find(id); it != connections_.end()) {
+                Defer(*it->second);
+            }
+        }
+        starved_.clear();
+    }
+
+    std::swap(retrying_, deferred_);
+    for (uint64_t id : retrying_) {
+        auto it = connections_.find(id);
+        if (it == connections_.end()) {
+            continue;
+        }
+        auto conn = it->second;
+        conn->deferred = false;
+        if (conn->cancel_pending) {
+            CancelReceive(*conn);
+        }
+        if (conn->receive_pending && !conn->closing && ArmReceive(*conn) != Success) {
+            Defer(*conn);
+        }
+        StartWrite(*conn);
+        Release(*conn);
+    }
+    retrying_.clear();
+}
+
+void IoUringEventLoop::Defer(Connection& conn) {
+    if (!conn.deferred) {
+        conn.deferred = true;
+        deferred_.push_back(conn.id);
+    }
+}
+
+Result<SuccessType> IoUringEventLoop::ArmWake() {
+    io_uring_sqe* sqe = ring_->NextSqe();
+    if (!sqe) {
+        return Failure{"io_uring submission queue is full"};
+    }
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = wake_fd_;
+    sqe->addr = reinterpret_cast<uint64_t>(&wake_value_);
+    sqe->len = sizeof(wake_value_);
+    sqe->off = ~uint64_t{0};  // The current file position
+    sqe->user_data = UserData(0, kWake);
+    in_flight_++;
+    return Success;
+}
+
+Result<SuccessType> IoUringEventLoop::ArmReceive(Connection& conn) {
+    if (!ring_->Reserve(conn.in_socket ? 1 : 2)) {
+        return Failure{"io_uring submission queue is full"};
+    }
+    io_uring_sqe* sqe = nullptr;
+    if (conn.in_socket) {
+        // A single multishot receive posts a completion for each chunk of received data
+        sqe = ring_->NextSqe();
+        sqe->opcode = IORING_OP_RECV;
+        sqe->ioprio = IORING_RECV_MULTISHOT;
+    } else {
+        // The read waits for data with a poll, instead of blocking a kernel worker thread
+        PreparePoll(ring_->NextSqe(), conn.in_fd, POLLIN, UserData(conn.id, kReceivePoll));
+        sqe = ring_->NextSqe();
+        sqe->opcode = IORING_OP_READ;
+        sqe->len = kBufferSize;
+        sqe->off = ~uint64_t{0};  // The current file position
+    }
+    sqe->fd = conn.in_fd;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = kBufferGroup;
+    sqe->user_data = UserData(conn.id, kReceive);
+    conn.receiving = true;
+    conn.receive_pending = false;
+    in_flight_++;
+    return Success;
+}
+
+void IoUringEventLoop::CancelReceive(Connection& conn) {
+    if (!conn.receiving) {
+        conn.cancel_pending = false;
+        return;
+    }
+    io_uring_sqe* sqe = ring_->NextSqe();
+    if (!sqe) {
+        conn.cancel_pending = true;
+        Defer(conn);
+        return;
+    }
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    // The read of a file descriptor that is not a socket waits on its linked poll, so the poll is
+    // cancelled, which also cancels the read.
+    sqe->addr = UserData(conn.id, conn.in_socket ? kReceive : kReceivePoll);
+    sqe->user_data = UserData(conn.id, kCancel);
+    conn.cancel_pending = false;
+    conn.cancelling++;
+    in_flight_++;
+}
+
+void IoUringEventLoop::StartWrite(Connection& conn) {
+    if (conn.write_in_flight) {
+        return;
+    }
+    if (conn.written == conn.writing.size()) {
+        // Swap the buffers, so the next write's bytes are written from the previous write's
+        // allocation.
+        conn.writing.clear();
+        conn.written = 0;
+        std::lock_guard<std::mutex> lock(conn.mutex);
+        std::swap(conn.writing, conn.output);
+        conn.scheduled = false;
+    }
+    if (conn.writing.empty()) {
+        return;
+    }
+
+    if (!ring_->Reserve(conn.out_socket ? 1 : 2)) {
+        Defer(conn);  // Retried once the submission queue has room
+        return;
+    }
+    io_uring_sqe* sqe = nullptr;
+    if (conn.out_socket) {
+        sqe = ring_->NextSqe();
+        sqe->opcode = IORING_OP_SEND;
+        sqe->msg_flags = MSG_NOSIGNAL;
+    } else {
+        // The write waits for room with a poll, instead of blocking a kernel worker thread
+        PreparePoll(ring_->NextSqe(), conn.out_fd, POLLOUT, UserData(conn.id, kWritePoll));
+        sqe = ring_->NextSqe();
+        sqe->opcode = IORING_OP_WRITE;
+        sqe->off = ~uint64_t{0};  // The current file position
+    }
+    sqe->fd = conn.out_fd;
+    sqe->addr = reinterpret_cast<uint64_t>(conn.writing.data() + conn.written);
+    sqe->len = static_cast<uint32_t>(conn.writing.size() - conn.written);
+    sqe->user_data = UserData(conn.id, kWrite);
+    conn.write_in_flight = true;
+    in_flight_++;
+}
+
+void IoUringEventLoop::OnComplete(uint64_t user_data, int32_t res, uint32_t flags) {
+    auto op = static_cast<Op>(user_data & kOpMask);
+    uint64_t id = user_data >> kOpBits;
+    if (op == kProvideBuffers) {
+        // Only failed provisions post a completion. The buffer is provided again.
+        if (!destroying_) {
+            provided_buffers_--;
+            recycled_.push_back(static_cast<uint16_t>(id));
+        }
+        return;
+    }
+    if (op == kReceivePoll || op == kWritePoll) {
+        // Only failed polls post a completion, and their linked operation also fails
+        return;
+    }
+    if (flags & IORING_CQE_F_BUFFER) {
+        provided_buffers_--;
+    }
+    if (!(flags & IORING_CQE_F_MORE)) {
+        in_flight_--;
+    }
+    if (destroying_) {
+        return;
+    }
+
+    if (op == kWake) {
+        if (auto armed = ArmWake(); armed != Success) {
+            // The loop can no longer be woken by another thread
+            stop_ = true;
+        }
+        return;
+    }
+
+    auto it = connections_.find(id);
+    if (it == connections_.end()) {
+        if (flags & IORING_CQE_F_BUFFER) {
+            RecycleBuffer(static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT));
+        }
+        return;
+    }
+    auto conn = it->second;
+    switch (op) {
+        case kReceive:
+            OnReceive(*conn, res, flags);
+            break;
+        case kWrite:
+            OnWrite(*conn, res);
+            break;
+        case kCancel:
+            conn->cancelling--;
+            break;
+        case kWake:
+        case kProvideBuffers:
+        case kReceivePoll:
+        case kWritePoll:
+            break;
+    }
+    Release(*conn);
+}
+
+void IoUringEventLoop::RecycleBuffer(uint16_t id) {
+    recycled_.push_back(id);
+}
+
+void IoUringEventLoop::OnReceive(Connection& conn, int32_t res, uint32_t flags) {
+    bool more = flags & IORING_CQE_F_MORE;
+    if (!more) {
+        conn.receiving = false;
+    }
+
+    if (flags & IORING_CQE_F_BUFFER) {
+        auto id = static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+        if (res > 0 && !conn.closing) {
+            auto* data = reinterpret_cast<const char*>(ring_->Buffer(id));
+            Receive(conn, std::string_view(data, static_cast<size_t>(res)));
+        }
+        RecycleBuffer(id);
+    }
+
+    if (conn.closing) {
+        return;
+    }
+    if (res == 0) {
+        Close(conn);  // End of stream
+        return;
+    }
+    if (res < 0 && res != -ENOBUFS && res != -EAGAIN) {
+        ReportError(conn.session, Failure{std::string("receive failed: ") + strerror(-res)});
+        Close(conn);
+        return;
+    }
+    if (more) {
+        return;
+    }
+    if (res == -ENOBUFS && provided_buffers_ == 0) {
+        // All the receive buffers are in use. The receive is re-armed by SubmitDeferred() once
+        // some have been provided back to the kernel.
+        conn.receive_pending = true;
+        starved_.push_back(conn.id);
+        return;
+    }
+    if (ArmReceive(conn) != Success) {
+        conn.receive_pending = true;
+        Defer(conn);  // Retried once the submission queue has room
+    }
+}
+
+void IoUringEventLoop::OnWrite(Connection& conn, int32_t res) {
+    conn.write_in_flight = false;
+    if (res == -EAGAIN) {
+        StartWrite(conn);  // The output file descriptor was not ready. Try again.
+        return;
+    }
+    if (res < 0) {
+        // The output can no longer be written. Drop it, and stop receiving.
+        ReportError(conn.session, Failure{std::string("write failed: ") + strerror(-res)});
+        conn.writing.clear();
+        conn.written = 0;
+        {
+            std::lock_guard<std::mutex> lock(conn.mutex);
+            conn.output.clear();
+        }
+        Close(conn);
+        return;
+    }
+    conn.written += static_cast<size_t>(res);
+    StartWrite(conn);
+}
+
+void IoUringEventLoop::Receive(Connection& conn, std::string_view data) {
+    if (conn.input.empty()) {
+        // Dispatch straight from the receive buffer, only copying a trailing partial message
+        if (!Dispatch(conn.session, data)) {
+            Close(conn);
+            return;
+        }
+        conn.input.assign(data);
+        return;
+    }
+
+    conn.input.append(data);
+    std::string_view pending = conn.input;
+    if (!Dispatch(conn.session, pending)) {
+        Close(conn);
+        return;
+    }
+    conn.input.erase(0, conn.input.size() - pending.size());
+}
+
+void IoUringEventLoop::Close(Connection& conn) {
+    if (conn.closing) {
+        return;
+    }
+    conn.closing = true;
+    conn.receive_pending = false;
+    conn.input.clear();
+    {
+        // Output that has already been sent is still written
+        std::lock_guard<std::mutex> lock(conn.mutex);
+        conn.closed = true;
+    }
+    CancelReceive(conn);
+}
+
+void IoUringEventLoop::Release(Connection& conn) {
+    if (!conn.closing || conn.receiving || conn.write_in_flight || conn.cancelling > 0 ||
+        conn.written != conn.writing.size()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(conn.mutex);
+        if (!conn.output.empty()) {
+            return;  // Scheduled, and written by the next SubmitWrites()
+        }
+    }
+    connections_.erase(conn.id);
+}
+
+}  // namespace langsvr
@@ -0,0 +1,179 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_LANGSVR_IO_URING_EVENT_LOOP_H_
+#define SRC_LANGSVR_IO_URING_EVENT_LOOP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "langsvr/event_loop.h"
+
+namespace langsvr {
+
+/// IoUringEventLoop is the EventLoop::Backend::kIoUring implementation of EventLoop.
+/// The io_uring instance is driven with the raw system calls, so liburing is not required.
+/// Sockets are received with a single multishot receive per connection, and other file
+/// descriptors with a read that is re-armed on completion, and linked to a poll so that it does not
+/// occupy a kernel worker thread while waiting for data. Both receive into a group of buffers
+/// provided to the kernel, and messages are dispatched straight from those buffers, so only the
+/// bytes of a partially received message are copied. Used buffers are provided back to the kernel
+/// with the next submission.
+/// Operations that cannot be queued because the submission queue is full are retried before the
+/// next submission.
+/// Messages sent by Sessions are queued, and the loop submits the writes of all the Sessions with
+/// the next io_uring_enter() call, which also waits for completions.
+class IoUringEventLoop final : public EventLoop {
+  public:
+    /// Create constructs a new IoUringEventLoop
+    /// @returns the IoUringEventLoop, or a failure if io_uring, or one of the io_uring features
+    /// used by the loop, is not supported by the kernel.
+    static Result<std::unique_ptr<EventLoop>> Create();
+
+    /// Destructor. Cancels the operations in flight, and waits for them to complete.
+    ~IoUringEventLoop() override;
+
+    /// @copydoc EventLoop::GetBackend
+    Backend GetBackend() const override { return Backend::kIoUring; }
+
+    /// @copydoc EventLoop::Add
+    /// The file descriptors may be blocking or non-blocking, and their flags are not modified.
+    Result<SuccessType> Add(Session& session, int in_fd, int out_fd) override;
+
+    /// @copydoc EventLoop::Run
+    Result<SuccessType> Run() override;
+
+    /// @copydoc EventLoop::Stop
+    void Stop() override;
+
+  private:
+    class Ring;
+    struct Connection;
+
+    /// Constructor
+    IoUringEventLoop(std::unique_ptr<Ring> ring, int wake_fd);
+
+    /// Schedule queues the connection with the identifier @p id to have its output submitted by
+    /// the loop, waking the loop if it is waiting for completions. Called with the Connection's
+    /// mutex held, from any thread.
+    void Schedule(uint64_t id);
+
+    /// SubmitWrites starts a write for each of the scheduled connections
+    void SubmitWrites();
+
+    /// SubmitDeferred provides the recycled receive buffers back to the kernel, and retries the
+    /// operations of the deferred connections
+    void SubmitDeferred();
+
+    /// Defer adds @p conn to the connections retried by the next SubmitDeferred(), as one of its
+    /// operations could not be queued
+    void Defer(Connection& conn);
+
+    /// ArmWake queues a read of the eventfd used to wake the loop
+    Result<SuccessType> ArmWake();
+
+    /// ArmReceive queues a receive for @p conn
+    /// @returns a failure if the submission queue is full
+    Result<SuccessType> ArmReceive(Connection& conn);
+
+    /// CancelReceive queues the cancellation of the receive of @p conn, if it is receiving, or
+    /// defers it if the submission queue is full
+    void CancelReceive(Connection& conn);
+
+    /// StartWrite queues a write of the output of @p conn, if there is output and no write is in
+    /// flight, or defers it if the submission queue is full
+    void StartWrite(Connection& conn);
+
+    /// OnComplete handles a completion queue entry
+    void OnComplete(uint64_t user_data, int32_t res, uint32_t flags);
+
+    /// RecycleBuffer queues the receive buffer with the identifier @p id to be provided back to the
+    /// kernel by the next SubmitDeferred()
+    void RecycleBuffer(uint16_t id);
+
+    /// OnReceive handles the completion of a receive of @p conn
+    void OnReceive(Connection& conn, int32_t res, uint32_t flags);
+
+    /// OnWrite handles the completion of a write of @p conn
+    void OnWrite(Connection& conn, int32_t res);
+
+    /// Receive dispatches the messages completed by @p data, received by @p conn
+    void Receive(Connection& conn, std::string_view data);
+
+    /// Close stops receiving for @p conn. The connection is removed once its queued output has
+    /// been written, and it has no operations in flight.
+    void Close(Connection& conn);
+
+    /// Release removes @p conn from the loop, if it is closing and has nothing left in flight
+    void Release(Connection& conn);
+
+    /// The io_uring instance
+    std::unique_ptr<Ring> ring_;
+    /// The eventfd used to wake Run()
+    int wake_fd_ = -1;
+    /// The target of the read of wake_fd_
+    uint64_t wake_value_ = 0;
+    /// The connections, keyed by their identifier
+    std::unordered_map<uint64_t, std::shared_ptr<Connection>> connections_;
+    /// The identifier of the next added connection
+    uint64_t next_id_ = 1;
+    /// The number of submitted operations that have not yet posted their final completion
+    size_t in_flight_ = 0;
+    /// The receive buffers to provide back to the kernel
+    std::vector<uint16_t> recycled_;
+    /// The number of receive buffers provided to the kernel that have not been received into
+    size_t provided_buffers_ = 0;
+    /// The identifiers of the connections whose receive failed as there were no receive buffers.
+    /// Their receive is re-armed once buffers have been provided back to the kernel.
+    std::vector<uint64_t> starved_;
+    /// The identifiers of the connections with operations that could not be queued, as the
+    /// submission queue was full
+    std::vector<uint64_t> deferred_;
+    /// The list of deferred_ connections taken by SubmitDeferred(), kept to reuse its allocation
+    std::vector<uint64_t> retrying_;
+    /// True while the destructor waits for the cancelled operations
+    bool destroying_ = false;
+    std::atomic<bool> stop_ = false;
+
+    /// Guards scheduled_ and sleeping_
+    std::mutex schedule_mutex_;
+    /// The identifiers of the connections with output to submit
+    std::vector<uint64_t> scheduled_;
+    /// The list of scheduled_ connections taken by SubmitWrites(), kept to reuse its allocation
+    std::vector<uint64_t> submitting_;
+    /// True while Run() waits for completions, and needs to be woken by Schedule()
+    bool sleeping_ = false;
+};
+
+}  // namespace langsvr
+
+#endif  // SRC_LANGSVR_IO_URING_EVENT_LOOP_H_
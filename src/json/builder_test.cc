@@ -27,6 +27,10 @@
 
 #include "langsvr/json/builder.h"
 
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 #include "src/utils/replace_all.h"
@@ -99,6 +103,16 @@ TEST(JsonBuilder, ParseString) {
     EXPECT_EQ(string_->Json(), "\"hello world\"");
 }
 
+TEST(JsonBuilder, ParseStringView) {
+    auto b = Builder::Create();
+    auto res = b->Parse(R"({"text":"hello\nworld","other":[1]})");
+    ASSERT_EQ(res, Success);
+    auto text = res.Get()->Get("text");
+    ASSERT_EQ(text, Success);
+    EXPECT_EQ(text.Get()->StringView(), "hello\nworld");
+    EXPECT_NE(res.Get()->StringView(), Success);
+}
+
 TEST(JsonBuilder, ParseArray) {
     auto b = Builder::Create();
     auto arr_res = b->Parse("[10, false, \"fish\" ]");
@@ -135,6 +149,131 @@ TEST(JsonBuilder, ParseObject) {
     EXPECT_NE(missing, Success);
 }
 
+TEST(JsonBuilder, ParseForEachMember) {
+    auto b = Builder::Create();
+    auto res = b->Parse(R"({"a":1,"b":{"c":true}})");
+    ASSERT_EQ(res, Success);
+
+    std::vector<std::string> names;
+    auto each = res.Get()->ForEachMember([&](std::string_view name, const Value& value) {
+        names.emplace_back(name);
+        if (name == "b") {
+            EXPECT_EQ(value.Get<json::Bool>("c"), true);
+        } else {
+            EXPECT_EQ(value.I64(), I64{1});
+        }
+        return Success;
+    });
+    EXPECT_EQ(each, Success);
+    EXPECT_THAT(names, testing::UnorderedElementsAre("a", "b"));
+}
+
+TEST(JsonBuilder, ParseForEachMemberStop) {
+    auto b = Builder::Create();
+    auto res = b->Parse(R"({"a":1,"b":2,"c":3})");
+    ASSERT_EQ(res, Success);
+
+    int calls = 0;
+    auto each =
+        res.Get()->ForEachMember([&](std::string_view, const Value&) -> Result<SuccessType> {
+            calls++;
+            return Failure{"stop"};
+        });
+    ASSERT_NE(each, Success);
+    EXPECT_EQ(each.Failure().reason, "stop");
+    EXPECT_EQ(calls, 1);
+
+    auto not_object = b->I64(1)->ForEachMember([&](std::string_view, const Value&) {
+        calls++;
+        return Success;
+    });
+    EXPECT_NE(not_object, Success);
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(JsonBuilder, ParseNegativeI64) {
+    auto b = Builder::Create();
+    auto i64_res = b->Parse("-42");
+    ASSERT_EQ(i64_res, Success);
+
+    auto& i64 = i64_res.Get();
+    EXPECT_EQ(i64->I64(), static_cast<json::I64>(-42));
+    EXPECT_EQ(i64->Kind(), json::Kind::kI64);
+    EXPECT_NE(i64->U64(), Success);
+    EXPECT_EQ(i64->Json(), "-42");
+}
+
+TEST(JsonBuilder, ParseStringEscapes) {
+    auto b = Builder::Create();
+    auto string_res = b->Parse(R"("a\"b\\c\/d\n\u00e9\ud83d\ude00")");
+    ASSERT_EQ(string_res, Success);
+
+    auto& string_ = string_res.Get();
+    EXPECT_EQ(string_->String(), "a\"b\\c/d\n\xc3\xa9\xf0\x9f\x98\x80");
+}
+
+TEST(JsonBuilder, ParseNested) {
+    auto b = Builder::Create();
+    auto root_res = b->Parse(R"({"a": [1, {"b": [true, null]}], "c": {}})");
+    ASSERT_EQ(root_res, Success);
+
+    auto& root = root_res.Get();
+    auto a = root->Get("a");
+    ASSERT_EQ(a, Success);
+    EXPECT_EQ(a.Get()->Count(), 2u);
+    EXPECT_EQ(a.Get()->Get<json::I64>(0u), static_cast<json::I64>(1));
+
+    auto a1 = a.Get()->Get(1);
+    ASSERT_EQ(a1, Success);
+    auto a1b = a1.Get()->Get("b");
+    ASSERT_EQ(a1b, Success);
+    EXPECT_EQ(a1b.Get()->Count(), 2u);
+    EXPECT_EQ(a1b.Get()->Get<json::Bool>(0u), true);
+    auto a1b1 = a1b.Get()->Get(1);
+    ASSERT_EQ(a1b1, Success);
+    EXPECT_EQ(a1b1.Get()->Kind(), json::Kind::kNull);
+
+    auto c = root->Get("c");
+    ASSERT_EQ(c, Success);
+    EXPECT_EQ(c.Get()->Kind(), json::Kind::kObject);
+    EXPECT_EQ(c.Get()->Count(), 0u);
+    EXPECT_FALSE(c.Get()->Has("a"));
+}
+
+TEST(JsonBuilder, ParseMaxDepth) {
+    auto nested = [](size_t depth) {
+        return std::string(depth, '[') + std::string(depth, ']');
+    };
+
+    auto b = Builder::Create();
+    EXPECT_EQ(b->Parse(nested(1000)), Success);
+    EXPECT_NE(b->Parse(nested(1001)), Success);
+    EXPECT_NE(b->Parse(nested(200000)), Success);
+}
+
+TEST(JsonBuilder, ParseInvalid) {
+    auto b = Builder::Create();
+    EXPECT_NE(b->Parse("{"), Success);
+    EXPECT_NE(b->Parse("[1, 2"), Success);
+    EXPECT_NE(b->Parse(R"({"a" 1})"), Success);
+    EXPECT_NE(b->Parse("tru"), Success);
+    EXPECT_NE(b->Parse(R"("unterminated)"), Success);
+}
+
+TEST(JsonBuilder, Reset) {
+    auto b = Builder::Create();
+    for (int i = 0; i < 3; i++) {
+        auto res = b->Parse(R"({"a":[1,2,{"b":"c"}],"d":"e\u00e9"})");
+        ASSERT_EQ(res, Success);
+        EXPECT_EQ(res.Get()->Get<json::String>("d"), "e\xc3\xa9");
+        auto a = res.Get()->Get("a");
+        ASSERT_EQ(a, Success);
+        EXPECT_EQ(a.Get()->Count(), 3u);
+        EXPECT_EQ(b->String("fish")->String(), "fish");
+        b->Reset();
+    }
+}
+
 TEST(JsonBuilder, CreateNull) {
     auto b = Builder::Create();
     auto v = b->Null();
@@ -177,6 +316,20 @@ TEST(JsonBuilder, CreateString) {
     EXPECT_EQ(v->Json(), "\"hello world\"");
 }
 
+TEST(JsonBuilder, CreateStringView) {
+    auto b = Builder::Create();
+    auto v = b->String("cat");
+    EXPECT_EQ(v->StringView(), "cat");
+    EXPECT_NE(b->I64(1)->StringView(), Success);
+}
+
+TEST(JsonBuilder, CreateStringEscaped) {
+    auto b = Builder::Create();
+    auto v = b->String("say \"hi\"\n");
+    EXPECT_EQ(v->Kind(), json::Kind::kString);
+    EXPECT_EQ(v->Json(), R"("say \"hi\"\n")");
+}
+
 TEST(JsonBuilder, CreateArray) {
     auto b = Builder::Create();
     std::vector elements{
@@ -189,6 +342,19 @@ TEST(JsonBuilder, CreateArray) {
     EXPECT_EQ(ReplaceAll(v->Json(), " ", ""), R"([10,false,"fish"])");
 }
 
+TEST(JsonBuilder, CreateU64Array) {
+    auto b = Builder::Create();
+    auto v = b->U64Array(std::vector<U64>{1, 20, 18446744073709551615u});
+    EXPECT_EQ(v->Kind(), json::Kind::kArray);
+    EXPECT_EQ(v->Count(), 3u);
+    EXPECT_EQ(v->Get<json::U64>(1), U64{20});
+    EXPECT_EQ(ReplaceAll(v->Json(), " ", ""), R"([1,20,18446744073709551615])");
+
+    auto empty = b->U64Array(std::vector<U64>{});
+    EXPECT_EQ(empty->Kind(), json::Kind::kArray);
+    EXPECT_EQ(empty->Count(), 0u);
+}
+
 TEST(JsonBuilder, CreateObject) {
     auto b = Builder::Create();
     std::vector members{
@@ -201,5 +367,52 @@ TEST(JsonBuilder, CreateObject) {
     EXPECT_EQ(ReplaceAll(v->Json(), " ", ""), R"({"cat":"meow","ten":10,"yes":true})");
 }
 
+TEST(JsonBuilder, CreateRaw) {
+    auto b = Builder::Create();
+    auto raw = b->Raw(R"({ "a" : [1, 2] })");
+    ASSERT_EQ(raw, Success);
+    EXPECT_EQ(raw.Get()->Kind(), json::Kind::kObject);
+    auto a = raw.Get()->Get("a");
+    ASSERT_EQ(a, Success);
+    EXPECT_EQ(a.Get()->Count(), 2u);
+    EXPECT_EQ(a.Get()->Get<json::I64>(1), I64{2});
+
+    std::vector<const Value*> elements{raw.Get(), b->I64(3)};
+    auto array = b->Array(elements);
+    // The native backend copies the raw JSON verbatim, jsoncpp re-encodes it
+    EXPECT_THAT(array->Json(),
+                testing::AnyOf(R"([{ "a" : [1, 2] },3])", R"([{"a":[1,2]},3])"));
+
+    EXPECT_NE(b->Raw("{"), Success);
+}
+
+TEST(JsonBuilder, GetChildOfCreated) {
+    auto b = Builder::Create();
+    std::vector elements{b->I64(1), b->String("two")};
+    std::vector<Builder::Member> no_members;
+    std::vector members{
+        Builder::Member{"arr", b->Array(elements)},
+        Builder::Member{"obj", b->Object(no_members)},
+    };
+    auto root = b->Object(members);
+
+    auto arr = root->Get("arr");
+    ASSERT_EQ(arr, Success);
+    auto two = arr.Get()->Get(1);
+    ASSERT_EQ(two, Success);
+
+    // Children must remain valid as more values are built
+    for (int i = 0; i < 1000; i++) {
+        b->String("padding");
+    }
+
+    EXPECT_EQ(arr.Get()->Count(), 2u);
+    EXPECT_EQ(arr.Get()->Get<json::I64>(0u), static_cast<json::I64>(1));
+    EXPECT_EQ(two.Get()->String(), "two");
+    auto obj = root->Get("obj");
+    ASSERT_EQ(obj, Success);
+    EXPECT_EQ(obj.Get()->Count(), 0u);
+}
+
 }  // namespace
 }  // namespace langsvr::json
@@ -41,7 +41,13 @@ class BuilderImpl;
 
 class ValueImpl : public Value {
   public:
-    ValueImpl(Json::Value&& value, BuilderImpl& builder) : v(std::move(value)), b(builder) {}
+    /// Constructs a ValueImpl that owns @p value.
+    ValueImpl(Json::Value&& value, BuilderImpl& builder)
+        : owned(std::move(value)), v(owned), b(builder) {}
+
+    /// Constructs a ValueImpl that borrows @p value, which must be owned by another ValueImpl of
+    /// the same builder. Used to access the children of a value without copying the subtree.
+    ValueImpl(const Json::Value& value, BuilderImpl& builder) : v(value), b(builder) {}
 
     std::string Json() const override;
     json::Kind Kind() const override;
@@ -51,21 +57,27 @@ class ValueImpl : public Value {
     Result<json::U64> U64() const override;
     Result<json::F64> F64() const override;
     Result<json::String> String() const override;
+    Result<std::string_view> StringView() const override;
     Result<const Value*> Get(size_t index) const override;
     Result<const Value*> Get(std::string_view name) const override;
     size_t Count() const override;
     Result<std::vector<std::string>> MemberNames() const override;
     bool Has(std::string_view name) const override;
+    Result<SuccessType> VisitMembers(MemberVisitor visitor, void* context) const override;
 
     Failure ErrIncorrectType(std::string_view wanted) const;
 
-    Json::Value v;
+    /// The owned value. Null for borrowed values.
+    Json::Value owned;
+    /// The value. Either #owned, or a value in the tree of another ValueImpl.
+    const Json::Value& v;
     BuilderImpl& b;
 };
 
 class BuilderImpl : public Builder {
   public:
     Result<const Value*> Parse(std::string_view json) override;
+    void Reset() override;
     const Value* Null() override;
     const Value* Bool(json::Bool value) override;
     const Value* I64(json::I64 value) override;
@@ -73,9 +85,13 @@ class BuilderImpl : public Builder {
     const Value* F64(json::F64 value) override;
     const Value* String(json::String value) override;
     const Value* Array(Span<const Value*> elements) override;
+    const Value* U64Array(Span<json::U64> values) override;
+    Result<const Value*> Raw(std::string_view json) override;
     const Value* Object(Span<Member> members) override;
 
     BlockAllocator<ValueImpl> allocator;
+    /// The reader used by Parse(), created on first use
+    std::unique_ptr<Json::CharReader> reader;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -155,11 +171,23 @@ Result<json::String> ValueImpl::String() const {
     return ErrIncorrectType("String");
 }
 
+Result<std::string_view> ValueImpl::StringView() const {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    if (v.getString(&begin, &end)) {
+        return std::string_view(begin, static_cast<size_t>(end - begin));
+    }
+    if (v.isString()) {  // Static strings have no length, so are not returned by getString()
+        return std::string_view(v.asCString());
+    }
+    return ErrIncorrectType("String");
+}
+
 Result<const Value*> ValueImpl::Get(size_t index) const {
     if (v.isArray()) {
         if (index < v.size()) {
-            return b.allocator.Create(
-                v.get(static_cast<Json::ArrayIndex>(index), Json::Value::null), b);
+            const Json::Value& element = v[static_cast<Json::ArrayIndex>(index)];
+            return b.allocator.Create(element, b);
         }
         std::stringstream err;
         err << "index >= array length of " << v.size();
@@ -170,9 +198,8 @@ Result<const Value*> ValueImpl::Get(size_t index) const {
 
 Result<const Value*> ValueImpl::Get(std::string_view name) const {
     if (v.isObject()) {
-        if (v.isMember(name.data(), name.data() + name.length())) {
-            return b.allocator.Create(
-                v.get(name.data(), name.data() + name.length(), Json::Value::null), b);
+        if (auto* member = v.find(name.data(), name.data() + name.length())) {
+            return b.allocator.Create(*member, b);
         }
         std::stringstream err;
         err << "object has no field with name '" << name << "'";
@@ -193,7 +220,25 @@ Result<std::vector<std::string>> ValueImpl::MemberNames() const {
 }
 
 bool ValueImpl::Has(std::string_view name) const {
-    return v.isObject() && v.isMember(name.data(), name.data() + name.length());
+    return v.isObject() && v.find(name.data(), name.data() + name.length()) != nullptr;
+}
+
+Result<SuccessType> ValueImpl::VisitMembers(MemberVisitor visitor, void* context) const {
+    if (!v.isObject()) {
+        return ErrIncorrectType("Object");
+    }
+    for (auto it = v.begin(), end = v.end(); it != end; ++it) {
+        const char* name_end = nullptr;
+        const char* name = it.memberName(&name_end);
+        // Borrow the member, instead of allocating a ValueImpl with the builder's allocator.
+        ValueImpl member(*it, b);
+        auto res = visitor(context, std::string_view(name, static_cast<size_t>(name_end - name)),
+                           member);
+        if (res != Success) {
+            return res.Failure();
+        }
+    }
+    return Success;
 }
 
 Failure ValueImpl::ErrIncorrectType(std::string_view wanted) const {
@@ -207,16 +252,27 @@ Failure ValueImpl::ErrIncorrectType(std::string_view wanted) const {
 ////////////////////////////////////////////////////////////////////////////////
 
 Result<const Value*> BuilderImpl::Parse(std::string_view json) {
-    Json::CharReaderBuilder builder;
-    std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+    if (!reader) {
+        Json::CharReaderBuilder builder;
+        reader.reset(builder.newCharReader());
+    }
     Json::Value root;
     JSONCPP_STRING err;
-    if (!reader->parse(json.data(), json.data() + json.length(), &root, &err)) {
-        return Failure{err};
+    // jsoncpp throws, instead of returning false, when the nesting depth limit is exceeded
+    try {
+        if (!reader->parse(json.data(), json.data() + json.length(), &root, &err)) {
+            return Failure{err};
+        }
+    } catch (const Json::Exception& e) {
+        return Failure{e.what()};
     }
     return allocator.Create(std::move(root), *this);
 }
 
+void BuilderImpl::Reset() {
+    allocator.Rewind();
+}
+
 const Value* BuilderImpl::Null() {
     return allocator.Create(Json::nullValue, *this);
 }
@@ -249,6 +305,20 @@ const Value* BuilderImpl::Array(Span<const Value*> elements) {
     return allocator.Create(std::move(array), *this);
 }
 
+const Value* BuilderImpl::U64Array(Span<json::U64> values) {
+    Json::Value array(Json::arrayValue);
+    array.resize(static_cast<Json::ArrayIndex>(values.size()));
+    for (Json::ArrayIndex i = 0; i < array.size(); i++) {
+        array[i] = Json::Value(values[i]);
+    }
+    return allocator.Create(std::move(array), *this);
+}
+
+Result<const Value*> BuilderImpl::Raw(std::string_view json) {
+    // jsoncpp values cannot hold pre-encoded JSON, so the value is re-encoded by Json().
+    return Parse(json);
+}
+
 const Value* BuilderImpl::Object(Span<Member> members) {
     Json::Value object(Json::objectValue);
     for (auto& member : members) {
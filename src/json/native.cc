@@ -0,0 +1,861 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "langsvr/json/builder.h"
+#include "langsvr/json/stream_reader.h"
+#include "langsvr/json/stream_writer.h"
+#include "langsvr/json/value.h"
+#include "langsvr/span.h"
+#include "src/json/parse_utils.h"
+#include "src/json/structural_index.h"
+#include "src/utils/bump_allocator.h"
+
+namespace langsvr::json {
+
+namespace {
+
+/// @returns the name of the JSON kind @p kind
+std::string_view KindName(json::Kind kind) {
+    switch (kind) {
+        case json::Kind::kNull:
+            return "Null";
+        case json::Kind::kI64:
+            return "I64";
+        case json::Kind::kU64:
+            return "U64";
+        case json::Kind::kF64:
+            return "F64";
+        case json::Kind::kString:
+            return "String";
+        case json::Kind::kBool:
+            return "Bool";
+        case json::Kind::kArray:
+            return "Array";
+        case json::Kind::kObject:
+            return "Object";
+    }
+    return "<invalid>";
+}
+
+/// RawJson holds the encoded JSON of an array or object created by Builder::Raw(). It is
+/// allocated immediately before the value's elements, so that raw values are the same size as
+/// other values.
+struct alignas(alignof(std::max_align_t)) RawJson {
+    std::string_view json;
+};
+
+/// ValueImpl is a single node of a JSON document.
+/// Nodes are immutable, and are allocated from the BuilderImpl's arena. The elements of an array,
+/// and the members of an object are held in contiguous arrays of ValueImpl, which are also
+/// allocated from the arena.
+class ValueImpl final : public Value {
+  public:
+    std::string Json() const override;
+    json::Kind Kind() const override { return kind; }
+    Result<SuccessType> Null() const override;
+    Result<json::Bool> Bool() const override;
+    Result<json::I64> I64() const override;
+    Result<json::U64> U64() const override;
+    Result<json::F64> F64() const override;
+    Result<json::String> String() const override;
+    Result<std::string_view> StringView() const override;
+    Result<const Value*> Get(size_t index) const override;
+    Result<const Value*> Get(std::string_view name) const override;
+    size_t Count() const override;
+    Result<std::vector<std::string>> MemberNames() const override;
+    bool Has(std::string_view name) const override;
+    Result<SuccessType> VisitMembers(MemberVisitor visitor, void* context) const override;
+
+    /// @returns the index of the member with the given name, or -1 if the object does not have a
+    /// member with the name.
+    int64_t Find(std::string_view name) const;
+
+    /// Writes this value to @p out
+    void Write(StreamWriter& out) const;
+
+    /// @returns the RawJson of a raw array or object
+    const RawJson& Raw() const { return reinterpret_cast<const RawJson*>(elements)[-1]; }
+
+    Failure ErrIncorrectType(std::string_view wanted) const;
+
+    /// @returns true if the value is a kI64, kU64 or kF64
+    bool IsNumber() const {
+        return kind == json::Kind::kI64 || kind == json::Kind::kU64 || kind == json::Kind::kF64;
+    }
+
+    /// @returns the value as a Number. Must only be called if IsNumber() returns true.
+    json::Number AsNumber() const {
+        json::Number number;
+        number.kind = kind;
+        if (kind == json::Kind::kI64) {
+            number.i64 = i64;
+        } else if (kind == json::Kind::kU64) {
+            number.u64 = u64;
+        } else {
+            number.f64 = f64;
+        }
+        return number;
+    }
+
+    /// The kind of the value
+    json::Kind kind = json::Kind::kNull;
+    /// True if the value was created by Builder::Raw(). The #elements of raw arrays and objects
+    /// are preceded by a RawJson holding the encoded JSON of the value.
+    bool raw = false;
+    /// The number of array elements, object members or string characters
+    uint32_t count = 0;
+    union {
+        /// The value when #kind is kBool
+        json::Bool b;
+        /// The value when #kind is kI64
+        json::I64 i64;
+        /// The value when #kind is kU64
+        json::U64 u64;
+        /// The value when #kind is kF64
+        json::F64 f64;
+        /// The string characters when #kind is kString
+        const char* chars;
+        /// The elements when #kind is kArray, or the member values when #kind is kObject
+        const ValueImpl* elements = nullptr;
+    };
+    /// The member names when #kind is kObject
+    const std::string_view* names = nullptr;
+};
+
+/// ParserScratch is the scratch storage used by Parser. It is held by the BuilderImpl so that the
+/// storage is reused between calls to Parse().
+struct ParserScratch {
+    /// A container which is currently being parsed
+    struct Frame {
+        /// kArray or kObject
+        json::Kind kind;
+        /// The index of the first value of the container in #values
+        size_t first_value;
+        /// The index of the first name of the container in #names
+        size_t first_name;
+    };
+
+    /// The structural index of the JSON string
+    std::vector<uint32_t> index;
+    /// The containers currently being parsed
+    std::vector<Frame> frames;
+    /// The values of the containers currently being parsed
+    std::vector<ValueImpl> values;
+    /// The member names of the objects currently being parsed
+    std::vector<std::string_view> names;
+};
+
+/// Parser builds a JSON document from a JSON string, in two stages.
+/// The first stage, BuildStructuralIndex(), uses SIMD to find the offsets of the structural
+/// characters, strings and scalars of the JSON string. The second stage walks these offsets to
+/// build the document, never looking at whitespace or the characters of strings without escapes.
+/// Nested values are accumulated on a scratch stack. When an array or object is closed, the
+/// values are moved to a single contiguous allocation in the arena.
+class Parser {
+  public:
+    Parser(std::string_view json, BumpAllocator<>& arena, ParserScratch& scratch)
+        : json_(json),
+          arena_(arena),
+          index_(scratch.index),
+          frames_(scratch.frames),
+          values_(scratch.values),
+          names_(scratch.names) {}
+
+    /// Parses the JSON string
+    /// @returns the root value, or a failure
+    Result<const Value*> Parse();
+
+  private:
+    using Frame = ParserScratch::Frame;
+
+    bool ParseValue(size_t offset, ValueImpl& out);
+    bool ParseString(size_t offset, std::string_view& out);
+    bool ParseNumber(size_t offset, ValueImpl& out);
+    bool ParseLiteral(size_t offset, std::string_view literal);
+    bool CloseContainer(ValueImpl& out);
+    bool IsScalarEnd(size_t offset) const;
+    bool Error(std::string_view msg);
+
+    /// @returns true if all the structural offsets have been consumed
+    bool AtEnd() const { return next_ >= index_.size(); }
+
+    /// @returns the character at the next structural offset. Must not be AtEnd().
+    char Peek() const { return json_[index_[next_]]; }
+
+    /// Consumes the next structural offset. Must not be AtEnd().
+    /// @returns the offset
+    size_t Take() {
+        offset_ = index_[next_++];
+        return offset_;
+    }
+
+    std::string_view json_;
+    BumpAllocator<>& arena_;
+    std::vector<uint32_t>& index_;
+    /// The index of the next offset in #index_
+    size_t next_ = 0;
+    /// The offset of the last consumed token, used for error messages
+    size_t offset_ = 0;
+    std::vector<Frame>& frames_;
+    std::vector<ValueImpl>& values_;
+    std::vector<std::string_view>& names_;
+    std::string error_;
+};
+
+class BuilderImpl final : public Builder {
+  public:
+    Result<const Value*> Parse(std::string_view json) override;
+    void Reset() override;
+    const Value* Null() override;
+    const Value* Bool(json::Bool value) override;
+    const Value* I64(json::I64 value) override;
+    const Value* U64(json::U64 value) override;
+    const Value* F64(json::F64 value) override;
+    const Value* String(json::String value) override;
+    const Value* Array(Span<const Value*> elements) override;
+    const Value* U64Array(Span<json::U64> values) override;
+    Result<const Value*> Raw(std::string_view json) override;
+    const Value* Object(Span<Member> members) override;
+
+    /// @returns a new, zero-initialized ValueImpl with the given kind
+    ValueImpl* New(json::Kind kind);
+
+    /// @returns a copy of @p str allocated from the arena
+    std::string_view Intern(std::string_view str);
+
+    BumpAllocator<> arena;
+    /// Scratch storage for Parse(), reused between calls
+    ParserScratch scratch;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ValueImpl
+////////////////////////////////////////////////////////////////////////////////
+std::string ValueImpl::Json() const {
+    StreamWriter out;
+    Write(out);
+    return out.Take();
+}
+
+Result<SuccessType> ValueImpl::Null() const {
+    if (kind == json::Kind::kNull) {
+        return Success;
+    }
+    return ErrIncorrectType("Null");
+}
+
+Result<json::Bool> ValueImpl::Bool() const {
+    if (kind == json::Kind::kBool) {
+        return b;
+    }
+    return ErrIncorrectType("Bool");
+}
+
+Result<json::I64> ValueImpl::I64() const {
+    json::I64 out = 0;
+    if (IsNumber() && ToI64(AsNumber(), out)) {
+        return out;
+    }
+    return ErrIncorrectType("I64");
+}
+
+Result<json::U64> ValueImpl::U64() const {
+    json::U64 out = 0;
+    if (IsNumber() && ToU64(AsNumber(), out)) {
+        return out;
+    }
+    return ErrIncorrectType("U64");
+}
+
+Result<json::F64> ValueImpl::F64() const {
+    if (IsNumber()) {
+        return ToF64(AsNumber());
+    }
+    return ErrIncorrectType("F64");
+}
+
+Result<json::String> ValueImpl::String() const {
+    if (kind == json::Kind::kString) {
+        return json::String(chars, count);
+    }
+    return ErrIncorrectType("String");
+}
+
+Result<std::string_view> ValueImpl::StringView() const {
+    if (kind == json::Kind::kString) {
+        return std::string_view(chars, count);
+    }
+    return ErrIncorrectType("String");
+}
+
+Result<const Value*> ValueImpl::Get(size_t index) const {
+    if (kind == json::Kind::kArray) {
+        if (index < count) {
+            return &elements[index];
+        }
+        std::stringstream err;
+        err << "index >= array length of " << count;
+        return Failure{err.str()};
+    }
+    return ErrIncorrectType("Array");
+}
+
+Result<const Value*> ValueImpl::Get(std::string_view name) const {
+    if (kind == json::Kind::kObject) {
+        if (auto idx = Find(name); idx >= 0) {
+            return &elements[idx];
+        }
+        std::stringstream err;
+        err << "object has no field with name '" << name << "'";
+        return Failure{err.str()};
+    }
+    return ErrIncorrectType("Object");
+}
+
+size_t ValueImpl::Count() const {
+    if (kind == json::Kind::kArray || kind == json::Kind::kObject) {
+        return count;
+    }
+    return 0;
+}
+
+Result<std::vector<std::string>> ValueImpl::MemberNames() const {
+    if (kind == json::Kind::kObject) {
+        std::vector<std::string> out;
+        out.reserve(count);
+        for (uint32_t i = 0; i < count; i++) {
+            out.emplace_back(names[i]);
+        }
+        return out;
+    }
+    return ErrIncorrectType("Object");
+}
+
+bool ValueImpl::Has(std::string_view name) const {
+    return kind == json::Kind::kObject && Find(name) >= 0;
+}
+
+Result<SuccessType> ValueImpl::VisitMembers(MemberVisitor visitor, void* context) const {
+    if (kind != json::Kind::kObject) {
+        return ErrIncorrectType("Object");
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (auto res = visitor(context, names[i], elements[i]); res != Success) {
+            return res.Failure();
+        }
+    }
+    return Success;
+}
+
+int64_t ValueImpl::Find(std::string_view name) const {
+    // LSP objects have few members, so a linear search is faster than hashing.
+    for (uint32_t i = 0; i < count; i++) {
+        if (names[i] == name) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void ValueImpl::Write(StreamWriter& out) const {
+    if (raw) {
+        out.Raw(Raw().json);
+        return;
+    }
+    switch (kind) {
+        case json::Kind::kNull:
+            out.Null();
+            break;
+        case json::Kind::kBool:
+            out.Bool(b);
+            break;
+        case json::Kind::kI64:
+            out.I64(i64);
+            break;
+        case json::Kind::kU64:
+            out.U64(u64);
+            break;
+        case json::Kind::kF64:
+            out.F64(f64);
+            break;
+        case json::Kind::kString:
+            out.String(std::string_view(chars, count));
+            break;
+        case json::Kind::kArray:
+            out.BeginArray();
+            for (uint32_t i = 0; i < count; i++) {
+                elements[i].Write(out);
+            }
+            out.EndArray();
+            break;
+        case json::Kind::kObject:
+            out.BeginObject();
+            for (uint32_t i = 0; i < count; i++) {
+                out.Key(names[i]);
+                elements[i].Write(out);
+            }
+            out.EndObject();
+            break;
+    }
+}
+
+Failure ValueImpl::ErrIncorrectType(std::string_view wanted) const {
+    std::stringstream err;
+    err << "value is " << KindName(kind) << ", not " << wanted;
+    return Failure{err.str()};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Parser
+////////////////////////////////////////////////////////////////////////////////
+Result<const Value*> Parser::Parse() {
+    if (json_.size() > std::numeric_limits<uint32_t>::max()) {
+        return Failure{"JSON string too long"};
+    }
+    index_.clear();
+    frames_.clear();
+    values_.clear();
+    names_.clear();
+    if (!BuildStructuralIndex(json_, index_)) {
+        offset_ = json_.size();
+        Error("unterminated string");
+        return Failure{std::move(error_)};
+    }
+
+    ValueImpl value;
+    if (AtEnd()) {
+        Error("unexpected end of JSON");
+        return Failure{std::move(error_)};
+    }
+    if (!ParseValue(Take(), value)) {
+        return Failure{std::move(error_)};
+    }
+    while (!frames_.empty()) {
+        auto& frame = frames_.back();
+        if (AtEnd()) {
+            offset_ = json_.size();
+            Error("unexpected end of JSON");
+            return Failure{std::move(error_)};
+        }
+        size_t offset = Take();
+        char c = json_[offset];
+        bool is_object = frame.kind == json::Kind::kObject;
+        bool is_first = values_.size() == frame.first_value;
+        if (c == (is_object ? '}' : ']')) {
+            if (!CloseContainer(value)) {
+                return Failure{std::move(error_)};
+            }
+            continue;
+        }
+        if (!is_first) {
+            if (c != ',') {
+                Error(is_object ? "expected ',' or '}'" : "expected ',' or ']'");
+                return Failure{std::move(error_)};
+            }
+            if (AtEnd()) {
+                Error("unexpected end of JSON");
+                return Failure{std::move(error_)};
+            }
+            offset = Take();
+            c = json_[offset];
+        }
+        if (is_object) {
+            std::string_view name;
+            if (c != '"') {
+                Error("expected object member name");
+                return Failure{std::move(error_)};
+            }
+            if (!ParseString(offset, name)) {
+                return Failure{std::move(error_)};
+            }
+            if (AtEnd() || Peek() != ':') {
+                Error("expected ':'");
+                return Failure{std::move(error_)};
+            }
+            Take();
+            if (AtEnd()) {
+                Error("unexpected end of JSON");
+                return Failure{std::move(error_)};
+            }
+            offset = Take();
+            names_.push_back(name);
+        }
+        if (!ParseValue(offset, value)) {
+            return Failure{std::move(error_)};
+        }
+    }
+    if (!AtEnd()) {
+        Take();
+        Error("unexpected trailing characters");
+        return Failure{std::move(error_)};
+    }
+    auto* root = arena_.Allocate<ValueImpl>(1);
+    return new (root) ValueImpl(value);
+}
+
+/// Parses the value starting at @p offset. Scalar values are pushed on to #values_ if they are
+/// nested in a container, otherwise they are assigned to @p root. Arrays and objects push a new
+/// Frame, failing if this would nest them deeper than StreamReader::kMaxDepth.
+bool Parser::ParseValue(size_t offset, ValueImpl& root) {
+    ValueImpl value;
+    switch (json_[offset]) {
+        case '{':
+        case '[': {
+            if (frames_.size() >= StreamReader::kMaxDepth) {
+                return Error("exceeded maximum nesting depth");
+            }
+            bool is_object = json_[offset] == '{';
+            frames_.push_back(Frame{is_object ? json::Kind::kObject : json::Kind::kArray,
+                                    values_.size(), names_.size()});
+            return true;
+        }
+        case '"': {
+            std::string_view str;
+            if (!ParseString(offset, str)) {
+                return false;
+            }
+            value.kind = json::Kind::kString;
+            value.chars = str.data();
+            value.count = static_cast<uint32_t>(str.size());
+            break;
+        }
+        case 't':
+            if (!ParseLiteral(offset, "true")) {
+                return false;
+            }
+            value.kind = json::Kind::kBool;
+            value.b = true;
+            break;
+        case 'f':
+            if (!ParseLiteral(offset, "false")) {
+                return false;
+            }
+            value.kind = json::Kind::kBool;
+            value.b = false;
+            break;
+        case 'n':
+            if (!ParseLiteral(offset, "null")) {
+                return false;
+            }
+            value.kind = json::Kind::kNull;
+            break;
+        case '}':
+        case ']':
+        case ':':
+        case ',':
+            return Error("expected value");
+        default:
+            if (!ParseNumber(offset, value)) {
+                return false;
+            }
+            break;
+    }
+    if (frames_.empty()) {
+        root = value;
+    } else {
+        values_.push_back(value);
+    }
+    return true;
+}
+
+/// Closes the innermost container, moving its values from the scratch stacks to the arena.
+bool Parser::CloseContainer(ValueImpl& root) {
+    auto frame = frames_.back();
+    frames_.pop_back();
+
+    size_t count = values_.size() - frame.first_value;
+    if (count > std::numeric_limits<uint32_t>::max()) {
+        return Error("too many elements");
+    }
+
+    ValueImpl value;
+    value.kind = frame.kind;
+    value.count = static_cast<uint32_t>(count);
+    if (count > 0) {
+        auto* elements = arena_.Allocate<ValueImpl>(count);
+        for (size_t i = 0; i < count; i++) {
+            new (&elements[i]) ValueImpl(values_[frame.first_value + i]);
+        }
+        value.elements = elements;
+        values_.resize(frame.first_value);
+        if (frame.kind == json::Kind::kObject) {
+            auto* names = arena_.Allocate<std::string_view>(count);
+            std::copy(names_.begin() + static_cast<ptrdiff_t>(frame.first_name), names_.end(),
+                      names);
+            value.names = names;
+            names_.resize(frame.first_name);
+        }
+    }
+
+    if (frames_.empty()) {
+        root = value;
+    } else {
+        values_.push_back(value);
+    }
+    return true;
+}
+
+bool Parser::ParseLiteral(size_t offset, std::string_view literal) {
+    if (json_.substr(offset, literal.size()) != literal ||
+        !IsScalarEnd(offset + literal.size())) {
+        return Error("invalid literal");
+    }
+    return true;
+}
+
+bool Parser::ParseNumber(size_t offset, ValueImpl& out) {
+    const char* end = json_.data() + json_.size();
+    json::Number number;
+    const char* p = json::ParseNumber(json_.data() + offset, end, number);
+    if (p == nullptr || !IsScalarEnd(static_cast<size_t>(p - json_.data()))) {
+        return Error("invalid number");
+    }
+    out.kind = number.kind;
+    if (number.kind == json::Kind::kI64) {
+        out.i64 = number.i64;
+    } else if (number.kind == json::Kind::kU64) {
+        out.u64 = number.u64;
+    } else {
+        out.f64 = number.f64;
+    }
+    return true;
+}
+
+/// Parses the string with the opening quote at @p offset. The closing quote is the next
+/// structural offset.
+bool Parser::ParseString(size_t offset, std::string_view& out) {
+    if (AtEnd() || Peek() != '"') {
+        return Error("unterminated string");
+    }
+    const char* start = json_.data() + offset + 1;
+    const char* end = json_.data() + Take();
+
+    size_t raw_length = static_cast<size_t>(end - start);
+    if (raw_length > std::numeric_limits<uint32_t>::max()) {
+        return Error("string too long");
+    }
+    auto* chars = arena_.Allocate<char>(raw_length);
+    const char* escape = static_cast<const char*>(memchr(start, '\\', raw_length));
+    if (escape == nullptr) {
+        if (raw_length > 0) {
+            memcpy(chars, start, raw_length);
+        }
+        out = std::string_view(chars, raw_length);
+        return true;
+    }
+
+    std::string_view error;
+    char* o = Unescape(start, end, chars, error);
+    if (o == nullptr) {
+        return Error(error);
+    }
+    out = std::string_view(chars, static_cast<size_t>(o - chars));
+    return true;
+}
+
+/// @returns true if @p offset is the end of the JSON string, or the offset of a character that
+/// terminates a number or literal.
+bool Parser::IsScalarEnd(size_t offset) const {
+    if (offset >= json_.size()) {
+        return true;
+    }
+    switch (json_[offset]) {
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\r':
+        case '{':
+        case '}':
+        case '[':
+        case ']':
+        case ':':
+        case ',':
+        case '"':
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool Parser::Error(std::string_view msg) {
+    std::stringstream err;
+    err << "JSON parse error at offset " << offset_ << ": " << msg;
+    error_ = err.str();
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// BuilderImpl
+////////////////////////////////////////////////////////////////////////////////
+Result<const Value*> BuilderImpl::Parse(std::string_view json) {
+    return Parser{json, arena, scratch}.Parse();
+}
+
+void BuilderImpl::Reset() {
+    arena.Rewind();
+}
+
+const Value* BuilderImpl::Null() {
+    return New(json::Kind::kNull);
+}
+
+const Value* BuilderImpl::Bool(json::Bool value) {
+    auto* v = New(json::Kind::kBool);
+    v->b = value;
+    return v;
+}
+
+const Value* BuilderImpl::I64(json::I64 value) {
+    auto* v = New(json::Kind::kI64);
+    v->i64 = value;
+    return v;
+}
+
+const Value* BuilderImpl::U64(json::U64 value) {
+    auto* v = New(json::Kind::kU64);
+    v->u64 = value;
+    return v;
+}
+
+const Value* BuilderImpl::F64(json::F64 value) {
+    auto* v = New(json::Kind::kF64);
+    v->f64 = value;
+    return v;
+}
+
+const Value* BuilderImpl::String(json::String value) {
+    auto str = Intern(value);
+    auto* v = New(json::Kind::kString);
+    v->chars = str.data();
+    v->count = static_cast<uint32_t>(str.size());
+    return v;
+}
+
+const Value* BuilderImpl::Array(Span<const Value*> elements) {
+    auto* v = New(json::Kind::kArray);
+    if (elements.size() > 0) {
+        auto* copies = arena.Allocate<ValueImpl>(elements.size());
+        for (size_t i = 0; i < elements.size(); i++) {
+            new (&copies[i]) ValueImpl(*static_cast<const ValueImpl*>(elements[i]));
+        }
+        v->elements = copies;
+        v->count = static_cast<uint32_t>(elements.size());
+    }
+    return v;
+}
+
+const Value* BuilderImpl::U64Array(Span<json::U64> values) {
+    auto* v = New(json::Kind::kArray);
+    if (values.size() > 0) {
+        auto* elements = arena.Allocate<ValueImpl>(values.size());
+        for (size_t i = 0; i < values.size(); i++) {
+            auto* element = new (&elements[i]) ValueImpl;
+            element->kind = json::Kind::kU64;
+            element->u64 = values[i];
+        }
+        v->elements = elements;
+        v->count = static_cast<uint32_t>(values.size());
+    }
+    return v;
+}
+
+Result<const Value*> BuilderImpl::Raw(std::string_view json) {
+    auto parsed = Parse(json);
+    if (parsed != Success) {
+        return parsed.Failure();
+    }
+    auto* value = static_cast<const ValueImpl*>(parsed.Get());
+    if (value->kind != json::Kind::kArray && value->kind != json::Kind::kObject) {
+        return value;  // Scalars are cheap to re-encode
+    }
+    if (value->count == 0) {
+        return value;
+    }
+    // Move the elements to a new allocation, preceded by the RawJson.
+    static_assert(sizeof(RawJson) % alignof(ValueImpl) == 0);
+    auto* memory = arena.Allocate(sizeof(RawJson) + sizeof(ValueImpl) * value->count);
+    new (memory) RawJson{Intern(json)};
+    auto* elements = reinterpret_cast<ValueImpl*>(memory + sizeof(RawJson));
+    for (uint32_t i = 0; i < value->count; i++) {
+        new (&elements[i]) ValueImpl(value->elements[i]);
+    }
+    auto* v = new (arena.Allocate<ValueImpl>(1)) ValueImpl(*value);
+    v->elements = elements;
+    v->raw = true;
+    return v;
+}
+
+const Value* BuilderImpl::Object(Span<Member> members) {
+    auto* v = New(json::Kind::kObject);
+    if (members.size() > 0) {
+        auto* values = arena.Allocate<ValueImpl>(members.size());
+        auto* names = arena.Allocate<std::string_view>(members.size());
+        for (size_t i = 0; i < members.size(); i++) {
+            new (&values[i]) ValueImpl(*static_cast<const ValueImpl*>(members[i].value));
+            names[i] = Intern(members[i].name);
+        }
+        v->elements = values;
+        v->names = names;
+        v->count = static_cast<uint32_t>(members.size());
+    }
+    return v;
+}
+
+ValueImpl* BuilderImpl::New(json::Kind kind) {
+    auto* v = new (arena.Allocate<ValueImpl>(1)) ValueImpl;
+    v->kind = kind;
+    return v;
+}
+
+std::string_view BuilderImpl::Intern(std::string_view str) {
+    if (str.empty()) {
+        return {};
+    }
+    auto* chars = arena.Allocate<char>(str.size());
+    memcpy(chars, str.data(), str.size());
+    return std::string_view(chars, str.size());
+}
+
+}  // namespace
+
+Value::~Value() = default;
+Builder::~Builder() = default;
+
+std::unique_ptr<Builder> Builder::Create() {
+    return std::make_unique<BuilderImpl>();
+}
+
+}  // namespace langsvr::json
@@ -0,0 +1,325 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "src/json/parse_utils.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace langsvr::json {
+
+namespace {
+
+/// Appends the UTF-8 encoding of the code point @p cp to @p out
+/// @returns the pointer to the byte after the last written byte
+char* EncodeUTF8(char* out, uint32_t cp) {
+    if (cp < 0x80) {
+        *out++ = static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        *out++ = static_cast<char>(0xc0 | (cp >> 6));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3f));
+    } else if (cp < 0x10000) {
+        *out++ = static_cast<char>(0xe0 | (cp >> 12));
+        *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3f));
+    } else {
+        *out++ = static_cast<char>(0xf0 | (cp >> 18));
+        *out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3f));
+        *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3f));
+    }
+    return out;
+}
+
+/// Parses the 4 hex digits at @p in, assigning the value to @p out
+/// @returns true on success
+bool ParseHex4(const char* in, uint32_t& out) {
+    out = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = in[i];
+        out <<= 4;
+        if (c >= '0' && c <= '9') {
+            out |= static_cast<uint32_t>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            out |= static_cast<uint32_t>(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            out |= static_cast<uint32_t>(c - 'A' + 10);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+const char* ParseNumber(const char* begin, const char* end, Number& out) {
+    const char* p = begin;
+
+    bool negative = p < end && *p == '-';
+    if (negative) {
+        p++;
+    }
+    const char* digits = p;
+    while (p < end && *p >= '0' && *p <= '9') {
+        p++;
+    }
+    if (p == digits) {
+        return nullptr;
+    }
+    if (*digits == '0' && p - digits > 1) {
+        return nullptr;  // Leading zeros are not permitted
+    }
+    const char* digits_end = p;
+    const char* frac = p;
+    const char* frac_end = p;
+    bool is_integer = true;
+    if (p < end && *p == '.') {
+        is_integer = false;
+        p++;
+        frac = p;
+        while (p < end && *p >= '0' && *p <= '9') {
+            p++;
+        }
+        if (p == frac) {
+            return nullptr;
+        }
+        frac_end = p;
+    }
+    // The exponent saturates, as any exponent of this size is out of range
+    int64_t exponent = 0;
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        is_integer = false;
+        p++;
+        bool negative_exponent = p < end && *p == '-';
+        if (p < end && (*p == '+' || *p == '-')) {
+            p++;
+        }
+        const char* exp = p;
+        while (p < end && *p >= '0' && *p <= '9') {
+            exponent = std::min<int64_t>(exponent * 10 + (*p - '0'), 1'000'000'000);
+            p++;
+        }
+        if (p == exp) {
+            return nullptr;
+        }
+        if (negative_exponent) {
+            exponent = -exponent;
+        }
+    }
+
+    if (is_integer) {
+        if (negative) {
+            json::I64 i = 0;
+            if (auto res = std::from_chars(begin, p, i); res.ec == std::errc{} && res.ptr == p) {
+                out.kind = json::Kind::kI64;
+                out.i64 = i;
+                return p;
+            }
+        } else {
+            json::U64 u = 0;
+            if (auto res = std::from_chars(begin, p, u); res.ec == std::errc{} && res.ptr == p) {
+                if (u <= static_cast<json::U64>(std::numeric_limits<json::I64>::max())) {
+                    out.kind = json::Kind::kI64;
+                    out.i64 = static_cast<json::I64>(u);
+                } else {
+                    out.kind = json::Kind::kU64;
+                    out.u64 = u;
+                }
+                return p;
+            }
+        }
+        // Integer is out of range. Fall-through to parse as a F64.
+    }
+
+    json::F64 f = 0;
+    auto res = std::from_chars(begin, p, f);
+    if (res.ec == std::errc::result_out_of_range) {
+        // from_chars() reports both overflow and underflow as out of range. The number overflowed
+        // if its magnitude is at least 1, which is when it has a non-zero digit before the
+        // decimal point once the exponent is applied.
+        const char* first = digits;
+        while (first < digits_end && *first == '0') {
+            first++;
+        }
+        int64_t magnitude = 0;
+        if (first < digits_end) {
+            magnitude = (digits_end - first) + exponent;
+        } else {
+            const char* nonzero = frac;
+            while (nonzero < frac_end && *nonzero == '0') {
+                nonzero++;
+            }
+            magnitude = -(nonzero - frac) + exponent;
+        }
+        if (magnitude > 0) {
+            f = std::numeric_limits<json::F64>::infinity();
+        } else {
+            f = 0.0;
+        }
+        if (negative) {
+            f = -f;
+        }
+    } else if (res.ec != std::errc{}) {
+        return nullptr;
+    }
+    out.kind = json::Kind::kF64;
+    out.f64 = f;
+    return p;
+}
+
+bool ToI64(const Number& number, json::I64& out) {
+    switch (number.kind) {
+        case json::Kind::kI64:
+            out = number.i64;
+            return true;
+        case json::Kind::kU64:
+            if (number.u64 <= static_cast<json::U64>(std::numeric_limits<json::I64>::max())) {
+                out = static_cast<json::I64>(number.u64);
+                return true;
+            }
+            return false;
+        case json::Kind::kF64:
+            if (number.f64 >= -9223372036854775808.0 && number.f64 < 9223372036854775808.0 &&
+                std::trunc(number.f64) == number.f64) {
+                out = static_cast<json::I64>(number.f64);
+                return true;
+            }
+            return false;
+        default:
+            return false;
+    }
+}
+
+bool ToU64(const Number& number, json::U64& out) {
+    switch (number.kind) {
+        case json::Kind::kI64:
+            if (number.i64 >= 0) {
+                out = static_cast<json::U64>(number.i64);
+                return true;
+            }
+            return false;
+        case json::Kind::kU64:
+            out = number.u64;
+            return true;
+        case json::Kind::kF64:
+            if (number.f64 >= 0.0 && number.f64 < 18446744073709551616.0 &&
+                std::trunc(number.f64) == number.f64) {
+                out = static_cast<json::U64>(number.f64);
+                return true;
+            }
+            return false;
+        default:
+            return false;
+    }
+}
+
+json::F64 ToF64(const Number& number) {
+    switch (number.kind) {
+        case json::Kind::kI64:
+            return static_cast<json::F64>(number.i64);
+        case json::Kind::kU64:
+            return static_cast<json::F64>(number.u64);
+        default:
+            return number.f64;
+    }
+}
+
+char* Unescape(const char* begin, const char* end, char* out, std::string_view& error) {
+    // Runs of characters between escape sequences are copied with memcpy.
+    const char* i = begin;
+    const char* escape = static_cast<const char*>(memchr(i, '\\', static_cast<size_t>(end - i)));
+    while (escape != nullptr) {
+        memcpy(out, i, static_cast<size_t>(escape - i));
+        out += escape - i;
+        i = escape + 1;
+        if (i >= end) {
+            error = "invalid escape sequence";
+            return nullptr;
+        }
+        switch (*i++) {
+            case '"':
+                *out++ = '"';
+                break;
+            case '\\':
+                *out++ = '\\';
+                break;
+            case '/':
+                *out++ = '/';
+                break;
+            case 'b':
+                *out++ = '\b';
+                break;
+            case 'f':
+                *out++ = '\f';
+                break;
+            case 'n':
+                *out++ = '\n';
+                break;
+            case 'r':
+                *out++ = '\r';
+                break;
+            case 't':
+                *out++ = '\t';
+                break;
+            case 'u': {
+                uint32_t cp = 0;
+                if (end - i < 4 || !ParseHex4(i, cp)) {
+                    error = "invalid unicode escape sequence";
+                    return nullptr;
+                }
+                i += 4;
+                if (cp >= 0xd800 && cp <= 0xdbff) {
+                    // High surrogate. Must be followed by a low surrogate.
+                    uint32_t lo = 0;
+                    if (end - i < 6 || i[0] != '\\' || i[1] != 'u' || !ParseHex4(i + 2, lo) ||
+                        lo < 0xdc00 || lo > 0xdfff) {
+                        error = "invalid unicode surrogate pair";
+                        return nullptr;
+                    }
+                    i += 6;
+                    cp = 0x10000 + ((cp - 0xd800) << 10) + (lo - 0xdc00);
+                }
+                out = EncodeUTF8(out, cp);
+                break;
+            }
+            default:
+                error = "invalid escape sequence";
+                return nullptr;
+        }
+        escape = static_cast<const char*>(memchr(i, '\\', static_cast<size_t>(end - i)));
+    }
+    memcpy(out, i, static_cast<size_t>(end - i));
+    return out + (end - i);
+}
+
+}  // namespace langsvr::json
@@ -0,0 +1,82 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef SRC_LANGSVR_JSON_PARSE_UTILS_H_
+#define SRC_LANGSVR_JSON_PARSE_UTILS_H_
+
+#include <string_view>
+
+#include "langsvr/json/types.h"
+
+namespace langsvr::json {
+
+/// Number is a parsed JSON number
+struct Number {
+    /// kI64, kU64 or kF64
+    json::Kind kind = json::Kind::kI64;
+    union {
+        /// The value when #kind is kI64
+        json::I64 i64 = 0;
+        /// The value when #kind is kU64
+        json::U64 u64;
+        /// The value when #kind is kF64
+        json::F64 f64;
+    };
+};
+
+/// Parses the JSON number at the start of [@p begin, @p end).
+/// Integers that fit in a I64 are parsed as kI64, larger positive integers as kU64, and all other
+/// numbers as kF64. Numbers with a magnitude too large for a F64 are parsed as infinity, and
+/// numbers with a magnitude too small are parsed as zero.
+/// @param begin the pointer to the first character of the number
+/// @param end the pointer to the end of the JSON string
+/// @param out the parsed number
+/// @returns the pointer to the character after the number, or nullptr if the number is invalid
+const char* ParseNumber(const char* begin, const char* end, Number& out);
+
+/// Converts @p number to a I64, following the same rules as json::Value::I64()
+/// @returns true on success, false if the number cannot be represented by a I64
+bool ToI64(const Number& number, json::I64& out);
+
+/// Converts @p number to a U64, following the same rules as json::Value::U64()
+/// @returns true on success, false if the number cannot be represented by a U64
+bool ToU64(const Number& number, json::U64& out);
+
+/// Converts @p number to a F64
+json::F64 ToF64(const Number& number);
+
+/// Decodes the escape sequences of the JSON string characters [@p begin, @p end), which exclude
+/// the quotes, writing the decoded string to @p out. The decoded string is never longer than the
+/// escaped string, so @p out must have space for at least `end - begin` characters.
+/// @param error assigned the reason for failure, if the string has an invalid escape sequence
+/// @returns the pointer to the character after the last written character, or nullptr on failure
+char* Unescape(const char* begin, const char* end, char* out, std::string_view& error);
+
+}  // namespace langsvr::json
+
+#endif  // SRC_LANGSVR_JSON_PARSE_UTILS_H_
@@ -0,0 +1,476 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "langsvr/json/stream_reader.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <sstream>
+
+#include "src/json/parse_utils.h"
+
+namespace langsvr::json {
+
+namespace {
+
+/// @returns the name of the JSON kind @p kind
+std::string_view KindName(json::Kind kind) {
+    switch (kind) {
+        case json::Kind::kNull:
+            return "Null";
+        case json::Kind::kI64:
+            return "I64";
+        case json::Kind::kU64:
+            return "U64";
+        case json::Kind::kF64:
+            return "F64";
+        case json::Kind::kString:
+            return "String";
+        case json::Kind::kBool:
+            return "Bool";
+        case json::Kind::kArray:
+            return "Array";
+        case json::Kind::kObject:
+            return "Object";
+    }
+    return "<invalid>";
+}
+
+/// @returns the offset of the closing quote of the string with the opening quote at @p offset, or
+/// std::string_view::npos if the string is unterminated.
+size_t FindStringEnd(std::string_view json, size_t offset) {
+    const char* begin = json.data();
+    const char* end = begin + json.size();
+    const char* p = begin + offset + 1;
+    while (p < end) {
+        auto* quote = static_cast<const char*>(memchr(p, '"', static_cast<size_t>(end - p)));
+        if (quote == nullptr) {
+            break;
+        }
+        // The quote is escaped if it is preceded by an odd number of backslashes
+        size_t backslashes = 0;
+        for (const char* b = quote - 1; b > begin + offset && *b == '\\'; b--) {
+            backslashes++;
+        }
+        if ((backslashes & 1) == 0) {
+            return static_cast<size_t>(quote - begin);
+        }
+        p = quote + 1;
+    }
+    return std::string_view::npos;
+}
+
+/// @returns true if @p c continues a number after its leading digits
+bool IsNumberSuffix(char c) {
+    return (c >= '0' && c <= '9') || c == '.' || c == 'e' || c == 'E';
+}
+
+}  // namespace
+
+StreamReader::StreamReader(std::string_view json) : json_(json) {}
+
+StreamReader::~StreamReader() = default;
+
+Result<json::Kind> StreamReader::Peek() {
+    SkipWhitespace();
+    if (offset_ >= json_.size()) {
+        return Error("unexpected end of JSON");
+    }
+    switch (json_[offset_]) {
+        case '{':
+            return json::Kind::kObject;
+        case '[':
+            return json::Kind::kArray;
+        case '"':
+            return json::Kind::kString;
+        case 't':
+        case 'f':
+            return json::Kind::kBool;
+        case 'n':
+            return json::Kind::kNull;
+        default: {
+            json::Number number;
+            const char* begin = json_.data() + offset_;
+            if (ParseNumber(begin, json_.data() + json_.size(), number) == nullptr) {
+                return Error("invalid value");
+            }
+            return number.kind;
+        }
+    }
+}
+
+Result<SuccessType> StreamReader::Null() {
+    if (!Expect('n')) {
+        return ErrIncorrectType("Null");
+    }
+    return ParseLiteral("null");
+}
+
+Result<json::Bool> StreamReader::Bool() {
+    if (Expect('t')) {
+        if (auto res = ParseLiteral("true"); res != Success) {
+            return res.Failure();
+        }
+        return true;
+    }
+    if (Expect('f')) {
+        if (auto res = ParseLiteral("false"); res != Success) {
+            return res.Failure();
+        }
+        return false;
+    }
+    return ErrIncorrectType("Bool");
+}
+
+Result<json::I64> StreamReader::I64() {
+    SkipWhitespace();
+    json::Number number;
+    const char* begin = json_.data() + offset_;
+    const char* end = ParseNumber(begin, json_.data() + json_.size(), number);
+    json::I64 out = 0;
+    if (end == nullptr || !ToI64(number, out)) {
+        return ErrIncorrectType("I64");
+    }
+    offset_ += static_cast<size_t>(end - begin);
+    return out;
+}
+
+Result<json::U64> StreamReader::U64() {
+    SkipWhitespace();
+    json::Number number;
+    const char* begin = json_.data() + offset_;
+    const char* end = ParseNumber(begin, json_.data() + json_.size(), number);
+    json::U64 out = 0;
+    if (end == nullptr || !ToU64(number, out)) {
+        return ErrIncorrectType("U64");
+    }
+    offset_ += static_cast<size_t>(end - begin);
+    return out;
+}
+
+Result<json::F64> StreamReader::F64() {
+    SkipWhitespace();
+    json::Number number;
+    const char* begin = json_.data() + offset_;
+    const char* end = ParseNumber(begin, json_.data() + json_.size(), number);
+    if (end == nullptr) {
+        return ErrIncorrectType("F64");
+    }
+    offset_ += static_cast<size_t>(end - begin);
+    return ToF64(number);
+}
+
+Result<json::String> StreamReader::String() {
+    auto str = StringView();
+    if (str != Success) {
+        return str.Failure();
+    }
+    return json::String(str.Get());
+}
+
+Result<std::string_view> StreamReader::StringView() {
+    if (!Expect('"')) {
+        return ErrIncorrectType("String");
+    }
+    return ParseString(scratch_);
+}
+
+Result<SuccessType> StreamReader::BeginArray() {
+    return Begin('[', "Array");
+}
+
+Result<bool> StreamReader::NextElement() {
+    SkipWhitespace();
+    if (offset_ >= json_.size()) {
+        return Error("unexpected end of JSON");
+    }
+    if (json_[offset_] == ']') {
+        offset_++;
+        first_ = false;
+        depth_--;
+        return false;
+    }
+    if (!first_) {
+        if (json_[offset_] != ',') {
+            return Error("expected ',' or ']'");
+        }
+        offset_++;
+    }
+    first_ = false;
+    return true;
+}
+
+Result<SuccessType> StreamReader::U64Array(std::vector<json::U64>& out) {
+    if (auto res = BeginArray(); res != Success) {
+        return res.Failure();
+    }
+    out.clear();
+    for (bool first = true;; first = false) {
+        SkipWhitespace();
+        if (offset_ >= json_.size()) {
+            return Error("unexpected end of JSON");
+        }
+        if (json_[offset_] == ']') {
+            offset_++;
+            first_ = false;
+            depth_--;
+            return Success;
+        }
+        if (!first) {
+            if (json_[offset_] != ',') {
+                return Error("expected ',' or ']'");
+            }
+            offset_++;
+            SkipWhitespace();
+        }
+
+        // Up to 19 digits always fit in a U64. Anything else (signs, fractions, exponents, leading
+        // zeros and longer integers) is left to U64().
+        size_t start = offset_;
+        size_t limit = std::min(json_.size(), start + 19);
+        json::U64 value = 0;
+        for (; offset_ < limit; offset_++) {
+            auto digit = static_cast<unsigned>(json_[offset_] - '0');
+            if (digit > 9) {
+                break;
+            }
+            value = value * 10 + digit;
+        }
+        bool leading_zero = offset_ > start + 1 && json_[start] == '0';
+        if (offset_ > start && !leading_zero &&
+            (offset_ == json_.size() || !IsNumberSuffix(json_[offset_]))) {
+            out.push_back(value);
+            continue;
+        }
+        offset_ = start;
+        auto element = U64();
+        if (element != Success) {
+            return element.Failure();
+        }
+        out.push_back(element.Get());
+    }
+}
+
+Result<SuccessType> StreamReader::BeginObject() {
+    return Begin('{', "Object");
+}
+
+Result<bool> StreamReader::NextMember(std::string_view& name) {
+    SkipWhitespace();
+    if (offset_ >= json_.size()) {
+        return Error("unexpected end of JSON");
+    }
+    if (json_[offset_] == '}') {
+        offset_++;
+        first_ = false;
+        depth_--;
+        return false;
+    }
+    if (!first_) {
+        if (json_[offset_] != ',') {
+            return Error("expected ',' or '}'");
+        }
+        offset_++;
+    }
+    if (!Expect('"')) {
+        return Error("expected object member name");
+    }
+    auto str = ParseString(name_scratch_);
+    if (str != Success) {
+        return str.Failure();
+    }
+    if (!Expect(':')) {
+        return Error("expected ':'");
+    }
+    offset_++;
+    name = str.Get();
+    first_ = false;
+    return true;
+}
+
+Result<SuccessType> StreamReader::Skip() {
+    auto kind = Peek();
+    if (kind != Success) {
+        return kind.Failure();
+    }
+    switch (kind.Get()) {
+        case json::Kind::kObject:
+        case json::Kind::kArray: {
+            // Scan to the matching closing bracket. Only the brackets are validated, with a bit
+            // per open bracket which is set if the bracket opens an object.
+            std::bitset<kMaxDepth> is_object;
+            size_t depth = 0;
+            while (offset_ < json_.size()) {
+                switch (json_[offset_]) {
+                    case '"': {
+                        size_t end = FindStringEnd(json_, offset_);
+                        if (end == std::string_view::npos) {
+                            return Error("unterminated string");
+                        }
+                        offset_ = end;
+                        break;
+                    }
+                    case '{':
+                    case '[':
+                        if (depth_ + depth >= kMaxDepth) {
+                            return Error("exceeded maximum nesting depth");
+                        }
+                        is_object[depth++] = json_[offset_] == '{';
+                        break;
+                    case '}':
+                    case ']':
+                        if (is_object[depth - 1] != (json_[offset_] == '}')) {
+                            return Error("mismatched brackets");
+                        }
+                        if (--depth == 0) {
+                            offset_++;
+                            first_ = false;
+                            return Success;
+                        }
+                        break;
+                    default:
+                        break;
+                }
+                offset_++;
+            }
+            return Error("unexpected end of JSON");
+        }
+        case json::Kind::kString: {
+            size_t end = FindStringEnd(json_, offset_);
+            if (end == std::string_view::npos) {
+                return Error("unterminated string");
+            }
+            offset_ = end + 1;
+            return Success;
+        }
+        case json::Kind::kBool: {
+            auto res = Bool();
+            if (res != Success) {
+                return res.Failure();
+            }
+            return Success;
+        }
+        case json::Kind::kNull:
+            return Null();
+        default: {
+            auto res = F64();
+            if (res != Success) {
+                return res.Failure();
+            }
+            return Success;
+        }
+    }
+}
+
+Result<SuccessType> StreamReader::End() {
+    SkipWhitespace();
+    if (offset_ != json_.size()) {
+        return Error("unexpected trailing characters");
+    }
+    return Success;
+}
+
+void StreamReader::SkipWhitespace() {
+    while (offset_ < json_.size()) {
+        switch (json_[offset_]) {
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+                offset_++;
+                continue;
+            default:
+                return;
+        }
+    }
+}
+
+Result<SuccessType> StreamReader::Begin(char c, std::string_view kind) {
+    if (!Expect(c)) {
+        return ErrIncorrectType(kind);
+    }
+    if (depth_ >= kMaxDepth) {
+        return Error("exceeded maximum nesting depth");
+    }
+    offset_++;
+    first_ = true;
+    depth_++;
+    return Success;
+}
+
+bool StreamReader::Expect(char c) {
+    SkipWhitespace();
+    return offset_ < json_.size() && json_[offset_] == c;
+}
+
+Result<std::string_view> StreamReader::ParseString(std::string& scratch) {
+    size_t end = FindStringEnd(json_, offset_);
+    if (end == std::string_view::npos) {
+        return Error("unterminated string");
+    }
+    const char* begin = json_.data() + offset_ + 1;
+    size_t length = end - offset_ - 1;
+    offset_ = end + 1;
+    if (memchr(begin, '\\', length) == nullptr) {
+        return std::string_view(begin, length);
+    }
+    scratch.resize(length);
+    std::string_view error;
+    char* out = Unescape(begin, begin + length, scratch.data(), error);
+    if (out == nullptr) {
+        return Error(error);
+    }
+    return std::string_view(scratch.data(), static_cast<size_t>(out - scratch.data()));
+}
+
+Result<SuccessType> StreamReader::ParseLiteral(std::string_view literal) {
+    if (json_.substr(offset_, literal.size()) != literal) {
+        return Error("invalid literal");
+    }
+    offset_ += literal.size();
+    return Success;
+}
+
+Failure StreamReader::Error(std::string_view msg) const {
+    std::stringstream err;
+    err << "JSON parse error at offset " << offset_ << ": " << msg;
+    return Failure{err.str()};
+}
+
+Failure StreamReader::ErrIncorrectType(std::string_view wanted) {
+    auto kind = Peek();
+    if (kind != Success) {
+        return kind.Failure();
+    }
+    std::stringstream err;
+    err << "value is " << KindName(kind.Get()) << ", not " << wanted;
+    return Failure{err.str()};
+}
+
+}  // namespace langsvr::json
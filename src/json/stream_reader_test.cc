@@ -0,0 +1,339 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "langsvr/json/stream_reader.h"
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace langsvr::json {
+namespace {
+
+TEST(JsonStreamReader, Scalars) {
+    StreamReader r(R"([null, true, false, -42, 18446744073709551615, 1.5, "fish"])");
+    ASSERT_EQ(r.BeginArray(), Success);
+
+    ASSERT_EQ(r.NextElement(), true);
+    EXPECT_EQ(r.Peek(), Kind::kNull);
+    EXPECT_EQ(r.Null(), Success);
+
+    ASSERT_EQ(r.NextElement(), true);
+    EXPECT_EQ(r.Bool(), true);
+
+    ASSERT_EQ(r.NextElement(), true);
+    EXPECT_EQ(r.Bool(), false);
+
+    ASSERT_EQ(r.NextElement(), true);
+    EXPECT_EQ(r.Peek(), Kind::kI64);
+    EXPECT_EQ(r.I64(), I64{-42});
+
+    ASSERT_EQ(r.NextElement(), true);
+    EXPECT_EQ(r.Peek(), Kind::kU64);
+    EXPECT_EQ(r.U64(), 18446744073709551615u);
+
+    ASSERT_EQ(r.NextElement(), true);
+    EXPECT_EQ(r.Peek(), Kind::kF64);
+    EXPECT_EQ(r.F64(), 1.5);
+
+    ASSERT_EQ(r.NextElement(), true);
+    EXPECT_EQ(r.Peek(), Kind::kString);
+    EXPECT_EQ(r.String(), "fish");
+
+    EXPECT_EQ(r.NextElement(), false);
+    EXPECT_EQ(r.End(), Success);
+}
+
+TEST(JsonStreamReader, Object) {
+    StreamReader r(R"({"a": 1, "b": {"c": [2, 3]}, "d": {}})");
+    ASSERT_EQ(r.BeginObject(), Success);
+
+    std::string_view name;
+    ASSERT_EQ(r.NextMember(name), true);
+    EXPECT_EQ(name, "a");
+    EXPECT_EQ(r.I64(), I64{1});
+
+    ASSERT_EQ(r.NextMember(name), true);
+    EXPECT_EQ(name, "b");
+    ASSERT_EQ(r.BeginObject(), Success);
+    ASSERT_EQ(r.NextMember(name), true);
+    EXPECT_EQ(name, "c");
+    std::vector<I64> elements;
+    ASSERT_EQ(r.BeginArray(), Success);
+    while (r.NextElement() == true) {
+        elements.push_back(r.I64().Get());
+    }
+    EXPECT_THAT(elements, testing::ElementsAre(2, 3));
+    EXPECT_EQ(r.NextMember(name), false);
+
+    ASSERT_EQ(r.NextMember(name), true);
+    EXPECT_EQ(name, "d");
+    ASSERT_EQ(r.BeginObject(), Success);
+    EXPECT_EQ(r.NextMember(name), false);
+
+    EXPECT_EQ(r.NextMember(name), false);
+    EXPECT_EQ(r.End(), Success);
+}
+
+TEST(JsonStreamReader, StringEscapes) {
+    StreamReader r(R"({"k\"ey": "a\\b\né😀"})");
+    ASSERT_EQ(r.BeginObject(), Success);
+    std::string_view name;
+    ASSERT_EQ(r.NextMember(name), true);
+    EXPECT_EQ(name, "k\"ey");
+    EXPECT_EQ(r.String(), "a\\b\n\xc3\xa9\xf0\x9f\x98\x80");
+    // The member name remains valid after reading the value
+    EXPECT_EQ(name, "k\"ey");
+    EXPECT_EQ(r.NextMember(name), false);
+}
+
+TEST(JsonStreamReader, Skip) {
+    StreamReader r(R"([{"a": [1, "]}", {"b": null}]}, "x\"]", 1e5, true, null, 7])");
+    ASSERT_EQ(r.BeginArray(), Success);
+    for (int i = 0; i < 5; i++) {
+        ASSERT_EQ(r.NextElement(), true);
+        ASSERT_EQ(r.Skip(), Success);
+    }
+    ASSERT_EQ(r.NextElement(), true);
+    EXPECT_EQ(r.I64(), I64{7});
+    EXPECT_EQ(r.NextElement(), false);
+    EXPECT_EQ(r.End(), Success);
+}
+
+TEST(JsonStreamReader, SkipMismatchedBrackets) {
+    for (auto json : {"[}", "{]", "[[]}", R"({"a":[}})", R"([{"a":"]"]])"}) {
+        StreamReader r(json);
+        auto res = r.Skip();
+        ASSERT_NE(res, Success) << json;
+        EXPECT_THAT(res.Failure().reason, testing::HasSubstr("mismatched brackets")) << json;
+    }
+
+    StreamReader r(R"({"uri":"x","extra":[}})");
+    ASSERT_EQ(r.BeginObject(), Success);
+    std::string_view name;
+    ASSERT_EQ(r.NextMember(name), true);
+    EXPECT_EQ(r.Skip(), Success);
+    ASSERT_EQ(r.NextMember(name), true);
+    EXPECT_EQ(name, "extra");
+    EXPECT_NE(r.Skip(), Success);
+}
+
+TEST(JsonStreamReader, SkipMaxDepth) {
+    auto nested = [](size_t depth) {
+        return std::string(depth, '[') + std::string(depth, ']');
+    };
+
+    auto ok = nested(StreamReader::kMaxDepth);
+    EXPECT_EQ(StreamReader(ok).Skip(), Success);
+    auto too_deep = nested(StreamReader::kMaxDepth + 1);
+    EXPECT_NE(StreamReader(too_deep).Skip(), Success);
+
+    // The depth of the skipped value adds to the depth of the reader
+    auto nested_ok = "[" + ok + "]";
+    StreamReader r(nested_ok);
+    ASSERT_EQ(r.BeginArray(), Success);
+    ASSERT_EQ(r.NextElement(), true);
+    EXPECT_NE(r.Skip(), Success);
+}
+
+TEST(JsonStreamReader, SaveRestore) {
+    StreamReader r(R"([1, "two"])");
+    ASSERT_EQ(r.BeginArray(), Success);
+    ASSERT_EQ(r.NextElement(), true);
+    auto pos = r.Save();
+    EXPECT_EQ(r.I64(), I64{1});
+    r.Restore(pos);
+    EXPECT_EQ(r.F64(), 1.0);
+    ASSERT_EQ(r.NextElement(), true);
+    EXPECT_EQ(r.StringView(), "two");
+    EXPECT_EQ(r.NextElement(), false);
+}
+
+TEST(JsonStreamReader, IncorrectType) {
+    StreamReader r(R"("str")");
+    auto res = r.I64();
+    ASSERT_NE(res, Success);
+    EXPECT_EQ(res.Failure().reason, "value is String, not I64");
+    // The value was not consumed
+    EXPECT_EQ(r.String(), "str");
+}
+
+TEST(JsonStreamReader, NegativeToU64) {
+    StreamReader r("-1");
+    EXPECT_NE(r.U64(), Success);
+    EXPECT_EQ(r.I64(), I64{-1});
+}
+
+TEST(JsonStreamReader, NumberOverflow) {
+    EXPECT_EQ(StreamReader("1e400").F64(), std::numeric_limits<F64>::infinity());
+    EXPECT_EQ(StreamReader("-1e400").F64(), -std::numeric_limits<F64>::infinity());
+    EXPECT_EQ(StreamReader("0.001e312").F64(), std::numeric_limits<F64>::infinity());
+    EXPECT_EQ(StreamReader(std::string(400, '9')).F64(), std::numeric_limits<F64>::infinity());
+}
+
+TEST(JsonStreamReader, NumberUnderflow) {
+    auto f = StreamReader("1e-400").F64();
+    ASSERT_EQ(f, Success);
+    EXPECT_EQ(f.Get(), 0.0);
+    EXPECT_FALSE(std::signbit(f.Get()));
+
+    f = StreamReader("-1e-400").F64();
+    ASSERT_EQ(f, Success);
+    EXPECT_EQ(f.Get(), 0.0);
+    EXPECT_TRUE(std::signbit(f.Get()));
+
+    EXPECT_EQ(StreamReader("10e-330").F64(), 0.0);
+    EXPECT_EQ(StreamReader("0.0000001e-320").F64(), 0.0);
+    EXPECT_EQ(StreamReader("1e-400").I64(), I64{0});
+}
+
+TEST(JsonStreamReader, LeadingZeros) {
+    EXPECT_EQ(StreamReader("0").I64(), I64{0});
+    EXPECT_EQ(StreamReader("-0").I64(), I64{0});
+    EXPECT_EQ(StreamReader("0.5").F64(), 0.5);
+    EXPECT_EQ(StreamReader("0e1").F64(), 0.0);
+    for (auto json : {"0123", "-0123", "00", "00.5", "01e1"}) {
+        EXPECT_NE(StreamReader(json).I64(), Success) << json;
+        EXPECT_NE(StreamReader(json).F64(), Success) << json;
+        EXPECT_NE(StreamReader(json).Peek(), Success) << json;
+    }
+}
+
+TEST(JsonStreamReader, U64Array) {
+    StreamReader r(R"([[], [ 1 ,2,0, 18446744073709551615, 2.0, 3e1, 12 ], true])");
+    ASSERT_EQ(r.BeginArray(), Success);
+
+    std::vector<U64> got{42};
+    ASSERT_EQ(r.NextElement(), true);
+    EXPECT_EQ(r.U64Array(got), Success);
+    EXPECT_TRUE(got.empty());
+
+    ASSERT_EQ(r.NextElement(), true);
+    EXPECT_EQ(r.U64Array(got), Success);
+    EXPECT_THAT(got, testing::ElementsAre(1u, 2u, 0u, 18446744073709551615u, 2u, 30u, 12u));
+
+    ASSERT_EQ(r.NextElement(), true);
+    EXPECT_EQ(r.Bool(), true);
+    EXPECT_EQ(r.NextElement(), false);
+    EXPECT_EQ(r.End(), Success);
+}
+
+TEST(JsonStreamReader, U64ArrayInvalid) {
+    for (auto json : {"[1,-2]", "[1 2]", "[1,]", "[1", "[1.5]", "[18446744073709551616]", "{}",
+                      "[012]", "[00]"}) {
+        StreamReader r(json);
+        std::vector<U64> got;
+        EXPECT_NE(r.U64Array(got), Success) << json;
+    }
+}
+
+TEST(JsonStreamReader, MaxDepth) {
+    auto nested = [](size_t depth) {
+        return std::string(depth, '[') + std::string(depth, ']');
+    };
+
+    auto ok = nested(StreamReader::kMaxDepth);
+    StreamReader r(ok);
+    for (size_t i = 0; i < StreamReader::kMaxDepth; i++) {
+        ASSERT_EQ(r.BeginArray(), Success);
+        if (i + 1 < StreamReader::kMaxDepth) {
+            ASSERT_EQ(r.NextElement(), true);
+        }
+    }
+    for (size_t i = 0; i < StreamReader::kMaxDepth; i++) {
+        ASSERT_EQ(r.NextElement(), false);
+    }
+    EXPECT_EQ(r.End(), Success);
+
+    auto too_deep = nested(StreamReader::kMaxDepth + 1);
+    StreamReader r2(too_deep);
+    for (size_t i = 0; i < StreamReader::kMaxDepth; i++) {
+        ASSERT_EQ(r2.BeginArray(), Success);
+        ASSERT_EQ(r2.NextElement(), true);
+    }
+    auto res = r2.BeginArray();
+    ASSERT_NE(res, Success);
+    EXPECT_EQ(res.Failure().reason,
+              "JSON parse error at offset 1000: exceeded maximum nesting depth");
+
+    // Closing a container makes room for another
+    StreamReader r3(R"([{}, {}])");
+    ASSERT_EQ(r3.BeginArray(), Success);
+    ASSERT_EQ(r3.NextElement(), true);
+    auto pos = r3.Save();
+    ASSERT_EQ(r3.BeginObject(), Success);
+    std::string_view name;
+    ASSERT_EQ(r3.NextMember(name), false);
+    r3.Restore(pos);
+    EXPECT_EQ(r3.Skip(), Success);
+    ASSERT_EQ(r3.NextElement(), true);
+    EXPECT_EQ(r3.Skip(), Success);
+    EXPECT_EQ(r3.NextElement(), false);
+    EXPECT_EQ(r3.End(), Success);
+}
+
+TEST(JsonStreamReader, Invalid) {
+    for (auto json : {"", "[1 2]", "{\"a\" 1}", "{1: 2}", "[1,", "\"unterminated", "nul", "[}"}) {
+        StreamReader r(json);
+        bool ok = true;
+        auto read = [&](auto res) {
+            ok = ok && res == Success;
+            return ok;
+        };
+        if (auto kind = r.Peek(); kind == Success && kind.Get() == Kind::kArray) {
+            read(r.BeginArray());
+            while (ok) {
+                auto next = r.NextElement();
+                if (!read(next) || !next.Get()) {
+                    break;
+                }
+                read(r.Skip());
+            }
+        } else if (kind == Success && kind.Get() == Kind::kObject) {
+            read(r.BeginObject());
+            std::string_view name;
+            while (ok) {
+                auto next = r.NextMember(name);
+                if (!read(next) || !next.Get()) {
+                    break;
+                }
+                read(r.Skip());
+            }
+        } else {
+            read(r.Skip());
+        }
+        EXPECT_FALSE(ok && r.End() == Success) << json;
+    }
+}
+
+}  // namespace
+}  // namespace langsvr::json
@@ -0,0 +1,202 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "langsvr/json/stream_writer.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+
+namespace langsvr::json {
+
+StreamWriter::StreamWriter() = default;
+
+StreamWriter::~StreamWriter() = default;
+
+void StreamWriter::Null() {
+    Separator();
+    out_.append("null");
+    need_comma_ = true;
+}
+
+void StreamWriter::Bool(json::Bool value) {
+    Separator();
+    out_.append(value ? "true" : "false");
+    need_comma_ = true;
+}
+
+void StreamWriter::I64(json::I64 value) {
+    Separator();
+    char buf[32];
+    auto res = std::to_chars(buf, buf + sizeof(buf), value);
+    out_.append(buf, res.ptr);
+    need_comma_ = true;
+}
+
+void StreamWriter::U64(json::U64 value) {
+    Separator();
+    char buf[32];
+    auto res = std::to_chars(buf, buf + sizeof(buf), value);
+    out_.append(buf, res.ptr);
+    need_comma_ = true;
+}
+
+void StreamWriter::F64(json::F64 value) {
+    Separator();
+    need_comma_ = true;
+    if (!std::isfinite(value)) {
+        out_.append("null");
+        return;
+    }
+    char buf[32];
+    auto res = std::to_chars(buf, buf + sizeof(buf), value);
+    std::string_view str(buf, static_cast<size_t>(res.ptr - buf));
+    out_.append(str);
+    if (str.find_first_of(".e") == std::string_view::npos) {
+        out_.append(".0");  // Ensure the number is parsed back as a F64
+    }
+}
+
+void StreamWriter::String(std::string_view value) {
+    static constexpr char kHex[] = "0123456789abcdef";
+    Separator();
+    need_comma_ = true;
+    out_.push_back('"');
+    size_t run_start = 0;
+    for (size_t i = 0, n = value.size(); i < n; i++) {
+        auto c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        out_.append(value.data() + run_start, i - run_start);
+        run_start = i + 1;
+        switch (c) {
+            case '"':
+                out_.append("\\\"");
+                break;
+            case '\\':
+                out_.append("\\\\");
+                break;
+            case '\b':
+                out_.append("\\b");
+                break;
+            case '\f':
+                out_.append("\\f");
+                break;
+            case '\n':
+                out_.append("\\n");
+                break;
+            case '\r':
+                out_.append("\\r");
+                break;
+            case '\t':
+                out_.append("\\t");
+                break;
+            default:
+                out_.append("\\u00");
+                out_.push_back(kHex[c >> 4]);
+                out_.push_back(kHex[c & 15]);
+                break;
+        }
+    }
+    out_.append(value.data() + run_start, value.size() - run_start);
+    out_.push_back('"');
+}
+
+void StreamWriter::BeginArray() {
+    Separator();
+    out_.push_back('[');
+    need_comma_ = false;
+}
+
+void StreamWriter::EndArray() {
+    out_.push_back(']');
+    need_comma_ = true;
+}
+
+void StreamWriter::U64Array(Span<json::U64> values) {
+    // Each element takes at most 20 digits and a ','. The buffer is grown a chunk of elements at a
+    // time, so that the bytes zeroed by resize() are still in cache when the digits are written.
+    static constexpr size_t kMaxElementLength = 21;
+    static constexpr size_t kChunkSize = 1024;
+    Separator();
+    out_.push_back('[');
+    for (size_t i = 0, n = values.size(); i < n;) {
+        size_t offset = out_.size();
+        size_t count = std::min(kChunkSize, n - i);
+        out_.resize(offset + count * kMaxElementLength);
+        char* p = out_.data() + offset;
+        char* end = out_.data() + out_.size();
+        for (size_t last = i + count; i < last; i++) {
+            if (i > 0) {
+                *p++ = ',';
+            }
+            p = std::to_chars(p, end, values[i]).ptr;
+        }
+        out_.resize(static_cast<size_t>(p - out_.data()));
+    }
+    out_.push_back(']');
+    need_comma_ = true;
+}
+
+void StreamWriter::BeginObject() {
+    Separator();
+    out_.push_back('{');
+    need_comma_ = false;
+}
+
+void StreamWriter::EndObject() {
+    out_.push_back('}');
+    need_comma_ = true;
+}
+
+void StreamWriter::Key(std::string_view name) {
+    String(name);
+    out_.push_back(':');
+    need_comma_ = false;
+}
+
+void StreamWriter::Raw(std::string_view json) {
+    Separator();
+    out_.append(json);
+    need_comma_ = true;
+}
+
+std::string StreamWriter::Take() {
+    std::string out = std::move(out_);
+    out_.clear();
+    need_comma_ = false;
+    return out;
+}
+
+void StreamWriter::Reset() {
+    out_.clear();
+    need_comma_ = false;
+}
+
+}  // namespace langsvr::json
@@ -0,0 +1,155 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "langsvr/json/stream_writer.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "langsvr/json/builder.h"
+
+namespace langsvr::json {
+namespace {
+
+TEST(JsonStreamWriter, Scalars) {
+    StreamWriter w;
+    w.BeginArray();
+    w.Null();
+    w.Bool(true);
+    w.Bool(false);
+    w.I64(-42);
+    w.U64(18446744073709551615u);
+    w.F64(1.5);
+    w.F64(2);
+    w.String("fish");
+    w.EndArray();
+    EXPECT_EQ(w.Json(), R"([null,true,false,-42,18446744073709551615,1.5,2.0,"fish"])");
+}
+
+TEST(JsonStreamWriter, Write) {
+    StreamWriter w;
+    w.BeginArray();
+    w.Write(true);
+    w.Write(10);
+    w.Write(20u);
+    w.Write(0.25);
+    w.Write("cat");
+    w.Write(std::string("dog"));
+    w.EndArray();
+    EXPECT_EQ(w.Json(), R"([true,10,20,0.25,"cat","dog"])");
+}
+
+TEST(JsonStreamWriter, StringEscapes) {
+    StreamWriter w;
+    w.String("a\"b\\c\n\t\x01");
+    EXPECT_EQ(w.Json(), R"("a\"b\\c\n\t\u0001")");
+}
+
+TEST(JsonStreamWriter, Nested) {
+    StreamWriter w;
+    w.BeginObject();
+    w.Key("empty_array");
+    w.BeginArray();
+    w.EndArray();
+    w.Key("empty_object");
+    w.BeginObject();
+    w.EndObject();
+    w.Key("array");
+    w.BeginArray();
+    w.BeginObject();
+    w.Key("a");
+    w.I64(1);
+    w.EndObject();
+    w.BeginArray();
+    w.I64(2);
+    w.I64(3);
+    w.EndArray();
+    w.EndArray();
+    w.Key("last");
+    w.Null();
+    w.EndObject();
+    EXPECT_EQ(w.Json(),
+              R"({"empty_array":[],"empty_object":{},"array":[{"a":1},[2,3]],"last":null})");
+
+    // The output must be parsable
+    auto b = Builder::Create();
+    auto parsed = b->Parse(w.Json());
+    ASSERT_EQ(parsed, Success);
+    EXPECT_EQ(parsed.Get()->Count(), 4u);
+}
+
+TEST(JsonStreamWriter, Raw) {
+    StreamWriter w;
+    w.BeginObject();
+    w.Key("a");
+    w.Raw(R"({ "b" : [1, 2] })");
+    w.Key("c");
+    w.Raw("true");
+    w.EndObject();
+    EXPECT_EQ(w.Json(), R"({"a":{ "b" : [1, 2] },"c":true})");
+}
+
+TEST(JsonStreamWriter, U64Array) {
+    StreamWriter w;
+    w.BeginArray();
+    w.U64Array(std::vector<U64>{});
+    w.U64Array(std::vector<U64>{0, 7, 18446744073709551615u});
+    w.I64(1);
+    w.EndArray();
+    EXPECT_EQ(w.Json(), "[[],[0,7,18446744073709551615],1]");
+}
+
+TEST(JsonStreamWriter, U64ArrayLarge) {
+    std::vector<U64> values;
+    std::string expected = "[";
+    for (U64 i = 0; i < 5000; i++) {
+        values.push_back(i * 7919);
+        expected += (i > 0 ? "," : "") + std::to_string(i * 7919);
+    }
+    expected += "]";
+
+    StreamWriter w;
+    w.U64Array(values);
+    EXPECT_EQ(w.Json(), expected);
+}
+
+TEST(JsonStreamWriter, TakeAndReset) {
+    StreamWriter w;
+    w.I64(1);
+    EXPECT_EQ(w.Take(), "1");
+    w.I64(2);
+    EXPECT_EQ(w.Json(), "2");
+    w.Reset();
+    w.I64(3);
+    EXPECT_EQ(w.Json(), "3");
+}
+
+}  // namespace
+}  // namespace langsvr::json
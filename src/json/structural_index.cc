@@ -0,0 +1,349 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "src/json/structural_index.h"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define LANGSVR_JSON_X86_64 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#else
+#define LANGSVR_JSON_X86_64 0
+#endif
+
+#if LANGSVR_JSON_X86_64 && (defined(__GNUC__) || defined(__clang__))
+#define LANGSVR_JSON_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define LANGSVR_JSON_TARGET_AVX2
+#endif
+
+namespace langsvr::json {
+
+namespace {
+
+/// The number of bytes classified per chunk
+constexpr size_t kChunkSize = 64;
+
+/// Bitmasks of the character classes of a 64-byte chunk. Bit N corresponds to byte N of the chunk.
+struct CharMasks {
+    /// `"`
+    uint64_t quote;
+    /// `\`
+    uint64_t backslash;
+    /// `{`, `}`, `[`, `]`, `:` or `,`
+    uint64_t structural;
+    /// ` `, `\t`, `\n` or `\r`
+    uint64_t whitespace;
+};
+
+/// @returns the number of set bits in @p bits
+inline uint32_t PopCount(uint64_t bits) {
+#if defined(_MSC_VER) && !defined(__clang__) && LANGSVR_JSON_X86_64
+    return static_cast<uint32_t>(__popcnt64(bits));
+#elif defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_popcountll(bits));
+#else
+    uint32_t count = 0;
+    for (; bits != 0; bits &= bits - 1) {
+        count++;
+    }
+    return count;
+#endif
+}
+
+/// @returns the index of the least significant set bit in @p bits, which must not be zero
+inline uint32_t TrailingZeros(uint64_t bits) {
+#if defined(_MSC_VER) && !defined(__clang__) && LANGSVR_JSON_X86_64
+    unsigned long index = 0;
+    _BitScanForward64(&index, bits);
+    return static_cast<uint32_t>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_ctzll(bits));
+#else
+    uint32_t index = 0;
+    for (; (bits & 1) == 0; bits >>= 1) {
+        index++;
+    }
+    return index;
+#endif
+}
+
+/// @returns a mask where each bit N is the XOR of the bits [0..N] of @p bits
+inline uint64_t PrefixXor(uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+/// Indexer turns the CharMasks of consecutive chunks into structural offsets.
+/// State is carried between chunks so that strings, escape sequences and scalars may span chunks.
+class Indexer {
+  public:
+    explicit Indexer(std::vector<uint32_t>& out) : out_(out) {}
+
+    /// Appends the structural offsets of the chunk starting at @p offset
+    inline void Next(const CharMasks& masks, uint32_t offset) {
+        uint64_t escaped = FindEscaped(masks.backslash);
+        uint64_t quote = masks.quote & ~escaped;
+        // in_string has the bits set for the opening quote and the characters of strings, but not
+        // the closing quote.
+        uint64_t in_string = PrefixXor(quote) ^ prev_in_string_;
+        prev_in_string_ = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+        uint64_t structural = masks.structural & ~in_string;
+        uint64_t scalar = ~(masks.structural | masks.whitespace | quote | in_string);
+        uint64_t scalar_start = scalar & ~((scalar << 1) | prev_scalar_);
+        prev_scalar_ = scalar >> 63;
+
+        Emit(structural | quote | scalar_start, offset);
+    }
+
+    /// @returns true if the last chunk ended inside a string
+    bool InString() const { return prev_in_string_ != 0; }
+
+  private:
+    /// @returns the mask of characters that are escaped by a preceding backslash.
+    /// A backslash escapes the next character only if it is not itself escaped, so runs of
+    /// backslashes escape alternating characters. Runs starting on even and odd bits are
+    /// separated using a carrying add.
+    inline uint64_t FindEscaped(uint64_t backslash) {
+        constexpr uint64_t kEvenBits = 0x5555555555555555ull;
+        backslash &= ~prev_escaped_;
+        uint64_t follows_escape = (backslash << 1) | prev_escaped_;
+        uint64_t odd_starts = backslash & ~kEvenBits & ~follows_escape;
+        uint64_t even_starts = odd_starts + backslash;
+        prev_escaped_ = even_starts < odd_starts ? 1 : 0;  // Carry out of the add
+        uint64_t invert_mask = even_starts << 1;
+        return (kEvenBits ^ invert_mask) & follows_escape;
+    }
+
+    /// Appends the offsets of the set bits of @p bits to #out_
+    inline void Emit(uint64_t bits, uint32_t offset) {
+        if (bits == 0) {
+            return;
+        }
+        size_t n = out_.size();
+        out_.resize(n + PopCount(bits));
+        uint32_t* o = out_.data() + n;
+        for (; bits != 0; bits &= bits - 1) {
+            *o++ = offset + TrailingZeros(bits);
+        }
+    }
+
+    std::vector<uint32_t>& out_;
+    uint64_t prev_escaped_ = 0;
+    uint64_t prev_in_string_ = 0;
+    uint64_t prev_scalar_ = 0;
+};
+
+/// Classifies the 64 characters at @p in using portable C++
+inline CharMasks ClassifyScalar(const char* in) {
+    CharMasks masks{};
+    for (size_t i = 0; i < kChunkSize; i++) {
+        uint64_t bit = uint64_t{1} << i;
+        switch (in[i]) {
+            case '"':
+                masks.quote |= bit;
+                break;
+            case '\\':
+                masks.backslash |= bit;
+                break;
+            case '{':
+            case '}':
+            case '[':
+            case ']':
+            case ':':
+            case ',':
+                masks.structural |= bit;
+                break;
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+                masks.whitespace |= bit;
+                break;
+            default:
+                break;
+        }
+    }
+    return masks;
+}
+
+#if LANGSVR_JSON_X86_64
+
+/// @returns the mask of the bytes of @p v that are equal to @p c
+inline uint32_t EqSSE2(__m128i v, char c) {
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(c))));
+}
+
+/// Classifies the 64 characters at @p in using SSE2
+inline CharMasks ClassifySSE2(const char* in) {
+    CharMasks masks{};
+    for (size_t i = 0; i < kChunkSize; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        uint64_t structural = EqSSE2(v, '{') | EqSSE2(v, '}') | EqSSE2(v, '[') |
+                              EqSSE2(v, ']') | EqSSE2(v, ':') | EqSSE2(v, ',');
+        uint64_t whitespace =
+            EqSSE2(v, ' ') | EqSSE2(v, '\t') | EqSSE2(v, '\n') | EqSSE2(v, '\r');
+        masks.quote |= static_cast<uint64_t>(EqSSE2(v, '"')) << i;
+        masks.backslash |= static_cast<uint64_t>(EqSSE2(v, '\\')) << i;
+        masks.structural |= structural << i;
+        masks.whitespace |= whitespace << i;
+    }
+    return masks;
+}
+
+/// @returns the mask of the bytes of @p v that are equal to @p c
+LANGSVR_JSON_TARGET_AVX2 inline uint32_t EqAVX2(__m256i v, char c) {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(c))));
+}
+
+/// Classifies the 64 characters at @p in using AVX2
+LANGSVR_JSON_TARGET_AVX2 inline CharMasks ClassifyAVX2(const char* in) {
+    CharMasks masks{};
+    for (size_t i = 0; i < kChunkSize; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        uint64_t structural = EqAVX2(v, '{') | EqAVX2(v, '}') | EqAVX2(v, '[') |
+                              EqAVX2(v, ']') | EqAVX2(v, ':') | EqAVX2(v, ',');
+        uint64_t whitespace =
+            EqAVX2(v, ' ') | EqAVX2(v, '\t') | EqAVX2(v, '\n') | EqAVX2(v, '\r');
+        masks.quote |= static_cast<uint64_t>(EqAVX2(v, '"')) << i;
+        masks.backslash |= static_cast<uint64_t>(EqAVX2(v, '\\')) << i;
+        masks.structural |= structural << i;
+        masks.whitespace |= whitespace << i;
+    }
+    return masks;
+}
+
+#endif  // LANGSVR_JSON_X86_64
+
+/// Indexes all the complete chunks of @p json with ClassifyScalar()
+/// @returns the number of bytes indexed
+size_t IndexChunksScalar(std::string_view json, Indexer& indexer) {
+    size_t offset = 0;
+    for (; offset + kChunkSize <= json.size(); offset += kChunkSize) {
+        indexer.Next(ClassifyScalar(json.data() + offset), static_cast<uint32_t>(offset));
+    }
+    return offset;
+}
+
+#if LANGSVR_JSON_X86_64
+
+/// Indexes all the complete chunks of @p json with ClassifySSE2()
+/// @returns the number of bytes indexed
+size_t IndexChunksSSE2(std::string_view json, Indexer& indexer) {
+    size_t offset = 0;
+    for (; offset + kChunkSize <= json.size(); offset += kChunkSize) {
+        indexer.Next(ClassifySSE2(json.data() + offset), static_cast<uint32_t>(offset));
+    }
+    return offset;
+}
+
+/// Indexes all the complete chunks of @p json with ClassifyAVX2()
+/// @returns the number of bytes indexed
+LANGSVR_JSON_TARGET_AVX2 size_t IndexChunksAVX2(std::string_view json, Indexer& indexer) {
+    size_t offset = 0;
+    for (; offset + kChunkSize <= json.size(); offset += kChunkSize) {
+        indexer.Next(ClassifyAVX2(json.data() + offset), static_cast<uint32_t>(offset));
+    }
+    return offset;
+}
+
+/// @returns true if the CPU and OS support AVX2
+bool HasAVX2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int regs[4] = {};
+    __cpuid(regs, 1);
+    bool os_xsave = (regs[2] & (1 << 27)) != 0;
+    bool avx = (regs[2] & (1 << 28)) != 0;
+    if (!os_xsave || !avx || (_xgetbv(0) & 6) != 6) {
+        return false;
+    }
+    __cpuidex(regs, 7, 0);
+    return (regs[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif  // LANGSVR_JSON_X86_64
+
+}  // namespace
+
+SimdLevel DetectSimdLevel() {
+#if LANGSVR_JSON_X86_64
+    static const SimdLevel level = HasAVX2() ? SimdLevel::kAVX2 : SimdLevel::kSSE2;
+    return level;
+#else
+    return SimdLevel::kScalar;
+#endif
+}
+
+bool BuildStructuralIndex(std::string_view json, std::vector<uint32_t>& out, SimdLevel level) {
+    Indexer indexer(out);
+
+    size_t offset = 0;
+    switch (level) {
+#if LANGSVR_JSON_X86_64
+        case SimdLevel::kAVX2:
+            offset = IndexChunksAVX2(json, indexer);
+            break;
+        case SimdLevel::kSSE2:
+            offset = IndexChunksSSE2(json, indexer);
+            break;
+#endif
+        default:
+            offset = IndexChunksScalar(json, indexer);
+            break;
+    }
+
+    if (offset < json.size()) {
+        // Pad the trailing partial chunk with whitespace
+        char chunk[kChunkSize];
+        memset(chunk, ' ', sizeof(chunk));
+        memcpy(chunk, json.data() + offset, json.size() - offset);
+        indexer.Next(ClassifyScalar(chunk), static_cast<uint32_t>(offset));
+    }
+
+    return !indexer.InString();
+}
+
+bool BuildStructuralIndex(std::string_view json, std::vector<uint32_t>& out) {
+    return BuildStructuralIndex(json, out, DetectSimdLevel());
+}
+
+}  // namespace langsvr::json
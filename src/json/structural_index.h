@@ -0,0 +1,70 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef SRC_LANGSVR_JSON_STRUCTURAL_INDEX_H_
+#define SRC_LANGSVR_JSON_STRUCTURAL_INDEX_H_
+
+#include <stdint.h>
+#include <string_view>
+#include <vector>
+
+namespace langsvr::json {
+
+/// The instruction set used to classify the characters of a JSON string
+enum class SimdLevel {
+    /// Portable C++
+    kScalar,
+    /// x86 SSE2
+    kSSE2,
+    /// x86 AVX2
+    kAVX2,
+};
+
+/// @returns the most capable SimdLevel supported by the host CPU
+SimdLevel DetectSimdLevel();
+
+/// BuildStructuralIndex is the first stage of the native JSON parser.
+/// It scans @p json in 64-byte chunks, and appends to @p out the offsets of:
+/// * every structural character (`{`, `}`, `[`, `]`, `:`, `,`) outside of a string.
+/// * every unescaped `"`, which are the opening and closing quotes of strings.
+/// * the first character of every other run of non-whitespace characters outside of a string.
+///   These are the starts of numbers and literals.
+/// The characters of each chunk are classified with the instructions of @p level, which must be
+/// supported by the host CPU.
+/// @param json the JSON string. Must be no longer than 0xffffffff bytes.
+/// @param out the vector that the offsets are appended to
+/// @param level the instruction set to use
+/// @returns false if @p json ends inside a string
+bool BuildStructuralIndex(std::string_view json, std::vector<uint32_t>& out, SimdLevel level);
+
+/// BuildStructuralIndex() using the SimdLevel returned by DetectSimdLevel()
+bool BuildStructuralIndex(std::string_view json, std::vector<uint32_t>& out);
+
+}  // namespace langsvr::json
+
+#endif  // SRC_LANGSVR_JSON_STRUCTURAL_INDEX_H_
@@ -0,0 +1,165 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "src/json/structural_index.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace langsvr::json {
+namespace {
+
+/// A simple, byte-at-a-time implementation of BuildStructuralIndex() to test against.
+/// Like BuildStructuralIndex(), a backslash escapes the next character even outside of a string.
+bool ReferenceIndex(std::string_view json, std::vector<uint32_t>& out) {
+    bool in_string = false;
+    bool in_scalar = false;
+    bool escape_next = false;
+    for (size_t i = 0; i < json.size(); i++) {
+        char c = json[i];
+        bool escaped = escape_next;
+        escape_next = c == '\\' && !escaped;
+        if (in_string) {
+            if (c == '"' && !escaped) {
+                out.push_back(static_cast<uint32_t>(i));
+                in_string = false;
+            }
+            continue;
+        }
+        switch (c) {
+            case '{':
+            case '}':
+            case '[':
+            case ']':
+            case ':':
+            case ',':
+                out.push_back(static_cast<uint32_t>(i));
+                in_scalar = false;
+                break;
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+                in_scalar = false;
+                break;
+            case '"':
+                if (!escaped) {
+                    out.push_back(static_cast<uint32_t>(i));
+                    in_string = true;
+                    in_scalar = false;
+                    break;
+                }
+                [[fallthrough]];
+            default:
+                if (!in_scalar) {
+                    out.push_back(static_cast<uint32_t>(i));
+                }
+                in_scalar = true;
+                break;
+        }
+    }
+    return !in_string;
+}
+
+/// @returns all the SimdLevels supported by the host CPU
+std::vector<SimdLevel> SupportedLevels() {
+    std::vector<SimdLevel> levels{SimdLevel::kScalar};
+    auto best = DetectSimdLevel();
+    if (best == SimdLevel::kSSE2 || best == SimdLevel::kAVX2) {
+        levels.push_back(SimdLevel::kSSE2);
+    }
+    if (best == SimdLevel::kAVX2) {
+        levels.push_back(SimdLevel::kAVX2);
+    }
+    return levels;
+}
+
+void CheckIndex(std::string_view json) {
+    std::vector<uint32_t> expected;
+    bool expected_ok = ReferenceIndex(json, expected);
+    for (auto level : SupportedLevels()) {
+        std::vector<uint32_t> got;
+        bool got_ok = BuildStructuralIndex(json, got, level);
+        EXPECT_EQ(got_ok, expected_ok) << "level: " << static_cast<int>(level) << "\n" << json;
+        if (expected_ok) {
+            EXPECT_EQ(got, expected) << "level: " << static_cast<int>(level) << "\n" << json;
+        }
+    }
+}
+
+TEST(JsonStructuralIndex, Empty) {
+    CheckIndex("");
+}
+
+TEST(JsonStructuralIndex, Simple) {
+    std::vector<uint32_t> index;
+    ASSERT_TRUE(BuildStructuralIndex(R"({"a": [1, true], "b": "x,y"})", index));
+    EXPECT_EQ(index, (std::vector<uint32_t>{0, 1, 3, 4, 6, 7, 8, 10, 14, 15, 17, 19, 20, 22, 26, 27}));
+}
+
+TEST(JsonStructuralIndex, Unterminated) {
+    std::vector<uint32_t> index;
+    EXPECT_FALSE(BuildStructuralIndex(R"({"a": "b)", index));
+    EXPECT_FALSE(BuildStructuralIndex(R"("\")", index));
+}
+
+TEST(JsonStructuralIndex, Escapes) {
+    CheckIndex(R"(["\"", "\\", "\\\"", "\\\\", "a\\\\\"b", """])");
+}
+
+TEST(JsonStructuralIndex, ChunkBoundaries) {
+    // Place strings, escapes and scalars at every offset around the 64-byte chunk boundaries.
+    for (size_t pad = 0; pad < 140; pad++) {
+        std::string padding(pad, ' ');
+        CheckIndex(padding + R"(["\\\"{}", 12345, "x"])");
+        CheckIndex(padding + R"({"k":"\\\\\\\\"})");
+        CheckIndex(padding + R"([true,false,null])");
+        CheckIndex("\"" + std::string(pad, 'a') + "\\\"" + std::string(pad, 'b') + "\"");
+        CheckIndex("\"" + std::string(pad, '\\') + "\"]");
+    }
+}
+
+TEST(JsonStructuralIndex, Random) {
+    static constexpr char kAlphabet[] = "\"\\{}[]:, \t\n\r0a-";
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> char_dist(0, sizeof(kAlphabet) - 2);
+    std::uniform_int_distribution<size_t> length_dist(0, 300);
+    for (int i = 0; i < 2000; i++) {
+        std::string json(length_dist(rng), ' ');
+        for (auto& c : json) {
+            c = kAlphabet[char_dist(rng)];
+        }
+        CheckIndex(json);
+    }
+}
+
+}  // namespace
+}  // namespace langsvr::json
@@ -29,6 +29,75 @@
 
 namespace langsvr::lsp {
 
+namespace {
+
+/// @returns true if @p kind is one of the JSON number kinds
+bool IsNumber(json::Kind kind) {
+    return kind == json::Kind::kI64 || kind == json::Kind::kU64 || kind == json::Kind::kF64;
+}
+
+/// @returns true if the next value of @p r is of the kind @p want
+bool PeekIs(json::StreamReader& r, json::Kind want) {
+    auto kind = r.Peek();
+    return kind == Success && kind.Get() == want;
+}
+
+/// @returns true if the next value of @p r is a number
+bool PeekIsNumber(json::StreamReader& r) {
+    auto kind = r.Peek();
+    return kind == Success && IsNumber(kind.Get());
+}
+
+}  // namespace
+
+bool Matches(const json::Value& v, const Null*) {
+    return v.Kind() == json::Kind::kNull;
+}
+
+bool Matches(const json::Value& v, const Boolean*) {
+    return v.Kind() == json::Kind::kBool;
+}
+
+bool Matches(const json::Value& v, const Integer*) {
+    return IsNumber(v.Kind());
+}
+
+bool Matches(const json::Value& v, const Uinteger*) {
+    return IsNumber(v.Kind());
+}
+
+bool Matches(const json::Value& v, const Decimal*) {
+    return IsNumber(v.Kind());
+}
+
+bool Matches(const json::Value& v, const String*) {
+    return v.Kind() == json::Kind::kString;
+}
+
+bool Matches(json::StreamReader& r, const Null*) {
+    return PeekIs(r, json::Kind::kNull);
+}
+
+bool Matches(json::StreamReader& r, const Boolean*) {
+    return PeekIs(r, json::Kind::kBool);
+}
+
+bool Matches(json::StreamReader& r, const Integer*) {
+    return PeekIsNumber(r);
+}
+
+bool Matches(json::StreamReader& r, const Uinteger*) {
+    return PeekIsNumber(r);
+}
+
+bool Matches(json::StreamReader& r, const Decimal*) {
+    return PeekIsNumber(r);
+}
+
+bool Matches(json::StreamReader& r, const String*) {
+    return PeekIs(r, json::Kind::kString);
+}
+
 Result<SuccessType> Decode(const json::Value& v, Null&) {
     return v.Null();
 }
@@ -70,7 +139,7 @@ Result<SuccessType> Decode(const json::Value& v, Decimal& out) {
 }
 
 Result<SuccessType> Decode(const json::Value& v, String& out) {
-    auto res = v.String();
+    auto res = v.StringView();
     if (res == Success) [[likely]] {
         out = res.Get();
         return Success;
@@ -78,4 +147,57 @@ Result<SuccessType> Decode(const json::Value& v, String& out) {
     return res.Failure();
 }
 
+Result<SuccessType> Decode(json::StreamReader& r, Null&) {
+    return r.Null();
+}
+
+Result<SuccessType> Decode(json::StreamReader& r, Boolean& out) {
+    auto res = r.Bool();
+    if (res == Success) [[likely]] {
+        out = res.Get();
+        return Success;
+    }
+    return res.Failure();
+}
+
+Result<SuccessType> Decode(json::StreamReader& r, Integer& out) {
+    auto res = r.I64();
+    if (res == Success) [[likely]] {
+        out = res.Get();
+        return Success;
+    }
+    return res.Failure();
+}
+
+Result<SuccessType> Decode(json::StreamReader& r, Uinteger& out) {
+    auto res = r.U64();
+    if (res == Success) [[likely]] {
+        out = res.Get();
+        return Success;
+    }
+    return res.Failure();
+}
+
+Result<SuccessType> Decode(json::StreamReader& r, Decimal& out) {
+    auto res = r.F64();
+    if (res == Success) [[likely]] {
+        out = res.Get();
+        return Success;
+    }
+    return res.Failure();
+}
+
+Result<SuccessType> Decode(json::StreamReader& r, String& out) {
+    auto res = r.StringView();
+    if (res == Success) [[likely]] {
+        out = res.Get();
+        return Success;
+    }
+    return res.Failure();
+}
+
+Result<SuccessType> Decode(json::StreamReader& r, std::vector<Uinteger>& out) {
+    return r.U64Array(out);
+}
+
 }  // namespace langsvr::lsp
@@ -25,7 +25,10 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <string>
+
 #include "langsvr/json/builder.h"
+#include "langsvr/json/stream_reader.h"
 #include "langsvr/lsp/lsp.h"
 #include "langsvr/lsp/printer.h"
 
@@ -70,5 +73,269 @@ TEST(DecodeTest, ErrNumberStruct) {
     EXPECT_NE(decode_res, Success);
 }
 
+TEST(DecodeTest, WorkspaceEditChanges) {
+    auto b = json::Builder::Create();
+    auto parse_res = b->Parse(
+        R"({"changes":{"a.txt":[{"range":{"start":{"line":1,"character":2},"end":{"line":1,"character":3}},"newText":"x"}],"b.txt":[]}})");
+    ASSERT_EQ(parse_res, Success);
+
+    WorkspaceEdit got;
+    ASSERT_EQ(Decode(*parse_res.Get(), got), Success);
+    ASSERT_TRUE(got.changes);
+    ASSERT_EQ(got.changes->size(), 2u);
+    ASSERT_EQ(got.changes->at("a.txt").size(), 1u);
+    EXPECT_EQ(got.changes->at("a.txt")[0].new_text, "x");
+    EXPECT_EQ(got.changes->at("a.txt")[0].range, (Range{{1, 2}, {1, 3}}));
+    EXPECT_TRUE(got.changes->at("b.txt").empty());
+}
+
+TEST(DecodeTest, SkipsUnknownMembers) {
+    auto b = json::Builder::Create();
+    auto parse_res =
+        b->Parse(R"({"extra":{"a":[1,{"b":2}]},"uri":"file.txt","takeFocus":true,"more":"x"})");
+    ASSERT_EQ(parse_res, Success);
+
+    ShowDocumentParams got;
+    EXPECT_EQ(Decode(*parse_res.Get(), got), Success);
+
+    ShowDocumentParams expected;
+    expected.uri = "file.txt";
+    expected.take_focus = true;
+    EXPECT_EQ(got, expected);
+}
+
+TEST(DecodeTest, ExtendsAndKind) {
+    auto b = json::Builder::Create();
+    auto parse_res =
+        b->Parse(R"({"uri":"file.txt","kind":"delete","options":{"recursive":true}})");
+    ASSERT_EQ(parse_res, Success);
+
+    DeleteFile got;
+    EXPECT_EQ(Decode(*parse_res.Get(), got), Success);
+
+    DeleteFile expected;
+    expected.kind = "delete";
+    expected.uri = "file.txt";
+    expected.options = DeleteFileOptions{};
+    expected.options->recursive = true;
+    EXPECT_EQ(got, expected);
+}
+
+TEST(DecodeTest, ErrKindMismatch) {
+    auto b = json::Builder::Create();
+    auto parse_res = b->Parse(R"({"uri":"file.txt","kind":"create"})");
+    ASSERT_EQ(parse_res, Success);
+
+    DeleteFile got;
+    EXPECT_NE(Decode(*parse_res.Get(), got), Success);
+}
+
+TEST(DecodeTest, ErrMissingRequiredMember) {
+    auto b = json::Builder::Create();
+    auto parse_res =
+        b->Parse(R"({"selection":{"end":{"character":4,"line":3}},"uri":"file.txt"})");
+    ASSERT_EQ(parse_res, Success);
+
+    ShowDocumentParams got;
+    auto decode_res = Decode(*parse_res.Get(), got);
+    ASSERT_NE(decode_res, Success);
+    EXPECT_EQ(decode_res.Failure().reason, "missing required member of Range");
+}
+
+TEST(DecodeTest, Enums) {
+    auto b = json::Builder::Create();
+
+    MarkupKind markup_kind;
+    EXPECT_EQ(Decode(*b->String("markdown"), markup_kind), Success);
+    EXPECT_EQ(markup_kind, MarkupKind::kMarkdown);
+    EXPECT_EQ(Decode(*b->String("plaintext"), markup_kind), Success);
+    EXPECT_EQ(markup_kind, MarkupKind::kPlainText);
+    EXPECT_NE(Decode(*b->String("markdowN"), markup_kind), Success);
+    EXPECT_NE(Decode(*b->String(""), markup_kind), Success);
+    EXPECT_NE(Decode(*b->I64(1), markup_kind), Success);
+
+    SymbolKind symbol_kind;
+    EXPECT_EQ(Decode(*b->I64(26), symbol_kind), Success);
+    EXPECT_EQ(symbol_kind, SymbolKind::kTypeParameter);
+    EXPECT_NE(Decode(*b->I64(0), symbol_kind), Success);
+    EXPECT_NE(Decode(*b->I64(27), symbol_kind), Success);
+
+    WatchKind watch_kind;
+    EXPECT_EQ(Decode(*b->I64(4), watch_kind), Success);
+    EXPECT_EQ(watch_kind, WatchKind::kDelete);
+    EXPECT_NE(Decode(*b->I64(3), watch_kind), Success);
+}
+
+TEST(DecodeTest, MatchesKind) {
+    auto b = json::Builder::Create();
+    auto parse_res = b->Parse(R"({"kind":"rename","oldUri":"a.txt","newUri":"b.txt"})");
+    ASSERT_EQ(parse_res, Success);
+    const json::Value& v = *parse_res.Get();
+
+    EXPECT_TRUE(Matches(v, static_cast<const RenameFile*>(nullptr)));
+    EXPECT_FALSE(Matches(v, static_cast<const CreateFile*>(nullptr)));
+    EXPECT_FALSE(Matches(v, static_cast<const DeleteFile*>(nullptr)));
+    EXPECT_FALSE(Matches(v, static_cast<const TextDocumentEdit*>(nullptr)));
+    EXPECT_FALSE(Matches(v, static_cast<const String*>(nullptr)));
+    EXPECT_FALSE(Matches(v, static_cast<const std::vector<String>*>(nullptr)));
+}
+
+TEST(DecodeTest, DocumentChangesOneOf) {
+    auto b = json::Builder::Create();
+    auto parse_res = b->Parse(
+        R"({"documentChanges":[{"kind":"delete","uri":"a.txt"},{"kind":"create","uri":"b.txt"}]})");
+    ASSERT_EQ(parse_res, Success);
+
+    WorkspaceEdit got;
+    EXPECT_EQ(Decode(*parse_res.Get(), got), Success);
+    ASSERT_TRUE(got.document_changes);
+    ASSERT_EQ(got.document_changes->size(), 2u);
+    ASSERT_TRUE((*got.document_changes)[0].Is<DeleteFile>());
+    EXPECT_EQ((*got.document_changes)[0].Get<DeleteFile>()->uri, "a.txt");
+    ASSERT_TRUE((*got.document_changes)[1].Is<CreateFile>());
+    EXPECT_EQ((*got.document_changes)[1].Get<CreateFile>()->uri, "b.txt");
+}
+
+TEST(DecodeTest, StreamShowDocumentParams) {
+    json::StreamReader r(
+        R"({"selection":{"end":{"character":4,"line":3},"start":{"character":2,"line":1}},"uri":"file.txt"})");
+
+    ShowDocumentParams got;
+    EXPECT_EQ(Decode(r, got), Success);
+    EXPECT_EQ(r.End(), Success);
+
+    ShowDocumentParams expected;
+    expected.uri = "file.txt";
+    expected.selection = Range{{1, 2}, {3, 4}};
+    EXPECT_EQ(got, expected);
+}
+
+TEST(DecodeTest, StreamSkipsUnknownMembers) {
+    json::StreamReader r(
+        R"({"extra":{"a":[1,{"b":2}]},"uri":"file.txt","takeFocus":true,"more":"x"})");
+
+    ShowDocumentParams got;
+    EXPECT_EQ(Decode(r, got), Success);
+    EXPECT_EQ(r.End(), Success);
+
+    ShowDocumentParams expected;
+    expected.uri = "file.txt";
+    expected.take_focus = true;
+    EXPECT_EQ(got, expected);
+}
+
+TEST(DecodeTest, StreamExtendsAndKind) {
+    json::StreamReader r(R"({"uri":"file.txt","kind":"delete","options":{"recursive":true}})");
+
+    DeleteFile got;
+    EXPECT_EQ(Decode(r, got), Success);
+
+    DeleteFile expected;
+    expected.kind = "delete";
+    expected.uri = "file.txt";
+    expected.options = DeleteFileOptions{};
+    expected.options->recursive = true;
+    EXPECT_EQ(got, expected);
+}
+
+TEST(DecodeTest, StreamErrKindMismatch) {
+    json::StreamReader r(R"({"uri":"file.txt","kind":"create"})");
+
+    DeleteFile got;
+    EXPECT_NE(Decode(r, got), Success);
+}
+
+TEST(DecodeTest, StreamErrMissingRequiredMember) {
+    json::StreamReader r(R"({"selection":{"end":{"character":4,"line":3}},"uri":"file.txt"})");
+
+    ShowDocumentParams got;
+    auto decode_res = Decode(r, got);
+    ASSERT_NE(decode_res, Success);
+    EXPECT_EQ(decode_res.Failure().reason, "missing required member of Range");
+}
+
+TEST(DecodeTest, StreamOneOf) {
+    json::StreamReader r(R"([{"line":1,"character":2},"text",[3,"four"]])");
+
+    std::vector<OneOf<Position, String, std::tuple<Integer, String>>> got;
+    EXPECT_EQ(Decode(r, got), Success);
+    ASSERT_EQ(got.size(), 3u);
+    ASSERT_TRUE(got[0].Is<Position>());
+    EXPECT_EQ(*got[0].Get<Position>(), (Position{1, 2}));
+    ASSERT_TRUE(got[1].Is<String>());
+    EXPECT_EQ(*got[1].Get<String>(), "text");
+    ASSERT_TRUE((got[2].Is<std::tuple<Integer, String>>()));
+    EXPECT_EQ((*got[2].Get<std::tuple<Integer, String>>()),
+              (std::tuple<Integer, String>{3, "four"}));
+}
+
+TEST(DecodeTest, StreamMatches) {
+    json::StreamReader r(R"({"kind":"create","uri":"b.txt"})");
+
+    EXPECT_TRUE(Matches(r, static_cast<const CreateFile*>(nullptr)));
+    EXPECT_FALSE(Matches(r, static_cast<const RenameFile*>(nullptr)));
+    EXPECT_FALSE(Matches(r, static_cast<const DeleteFile*>(nullptr)));
+    EXPECT_FALSE(Matches(r, static_cast<const Boolean*>(nullptr)));
+    EXPECT_TRUE(Matches(r, static_cast<const CreateFileOptions*>(nullptr)));
+
+    // Matches() does not consume the value
+    CreateFile got;
+    EXPECT_EQ(Decode(r, got), Success);
+    EXPECT_EQ(got.uri, "b.txt");
+    EXPECT_EQ(r.End(), Success);
+}
+
+TEST(DecodeTest, StreamDocumentChangesOneOf) {
+    json::StreamReader r(
+        R"([{"kind":"rename","oldUri":"a.txt","newUri":"b.txt"},)"
+        R"({"textDocument":{"uri":"c.txt","version":1},"edits":[]}])");
+
+    std::vector<OneOf<TextDocumentEdit, CreateFile, RenameFile, DeleteFile>> got;
+    EXPECT_EQ(Decode(r, got), Success);
+    ASSERT_EQ(got.size(), 2u);
+    ASSERT_TRUE(got[0].Is<RenameFile>());
+    EXPECT_EQ(got[0].Get<RenameFile>()->new_uri, "b.txt");
+    ASSERT_TRUE(got[1].Is<TextDocumentEdit>());
+    EXPECT_EQ(got[1].Get<TextDocumentEdit>()->text_document.uri, "c.txt");
+}
+
+TEST(DecodeTest, StreamEnums) {
+    json::StreamReader r(R"(["quickfix","quickFix"])");
+
+    std::vector<CodeActionKind> got;
+    EXPECT_NE(Decode(r, got), Success);
+
+    json::StreamReader r2(R"(["quickfix","source.organizeImports","refactor.extract"])");
+    EXPECT_EQ(Decode(r2, got), Success);
+    EXPECT_THAT(got, testing::ElementsAre(CodeActionKind::kQuickFix,
+                                          CodeActionKind::kSourceOrganizeImports,
+                                          CodeActionKind::kRefactorExtract));
+}
+
+TEST(DecodeTest, StreamErrNestingTooDeep) {
+    std::string json = std::string(200000, '[') + std::string(200000, ']');
+    json::StreamReader r(json);
+
+    LSPAny got;
+    EXPECT_NE(Decode(r, got), Success);
+}
+
+TEST(DecodeTest, StreamMaxDepth) {
+    std::string json = std::string(json::StreamReader::kMaxDepth, '[') +
+                       std::string(json::StreamReader::kMaxDepth, ']');
+    json::StreamReader r(json);
+
+    LSPAny got;
+    EXPECT_EQ(Decode(r, got), Success);
+    EXPECT_EQ(r.End(), Success);
+}
+
+TEST(DecodeTest, StreamErrNullStruct) {
+    json::StreamReader r("null");
+
+    SemanticTokensFullDelta got;  // Note: all fields are optional
+    EXPECT_NE(Decode(r, got), Success);
+}
+
 }  // namespace
 }  // namespace langsvr::lsp
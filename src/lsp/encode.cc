@@ -53,4 +53,43 @@ Result<const json::Value*> Encode(const String& in, json::Builder& b) {
     return b.String(in);
 }
 
+Result<const json::Value*> Encode(const std::vector<Uinteger>& in, json::Builder& b) {
+    return b.U64Array(in);
+}
+
+Result<SuccessType> Encode(Null, json::StreamWriter& w) {
+    w.Null();
+    return Success;
+}
+
+Result<SuccessType> Encode(Boolean in, json::StreamWriter& w) {
+    w.Bool(in);
+    return Success;
+}
+
+Result<SuccessType> Encode(Integer in, json::StreamWriter& w) {
+    w.I64(in);
+    return Success;
+}
+
+Result<SuccessType> Encode(Uinteger in, json::StreamWriter& w) {
+    w.U64(in);
+    return Success;
+}
+
+Result<SuccessType> Encode(Decimal in, json::StreamWriter& w) {
+    w.F64(in);
+    return Success;
+}
+
+Result<SuccessType> Encode(const String& in, json::StreamWriter& w) {
+    w.String(in);
+    return Success;
+}
+
+Result<SuccessType> Encode(const std::vector<Uinteger>& in, json::StreamWriter& w) {
+    w.U64Array(in);
+    return Success;
+}
+
 }  // namespace langsvr::lsp
@@ -25,7 +25,12 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <thread>
+#include <vector>
+
 #include "langsvr/json/builder.h"
+#include "langsvr/json/stream_reader.h"
+#include "langsvr/json/stream_writer.h"
 #include "langsvr/lsp/lsp.h"
 
 #include "gmock/gmock.h"
@@ -41,9 +46,204 @@ TEST(EncodeTest, ShowDocumentParams) {
     auto b = json::Builder::Create();
     auto res = Encode(params, *b);
     EXPECT_EQ(res, Success);
-    EXPECT_EQ(
+    // Member order depends on the JSON library. jsoncpp sorts members by name, the native
+    // library preserves the order that members were added.
+    EXPECT_THAT(
         res.Get()->Json(),
-        R"({"selection":{"end":{"character":4,"line":3},"start":{"character":2,"line":1}},"uri":"file.txt"})");
+        testing::AnyOf(
+            R"({"selection":{"end":{"character":4,"line":3},"start":{"character":2,"line":1}},"uri":"file.txt"})",
+            R"({"uri":"file.txt","selection":{"start":{"line":1,"character":2},"end":{"line":3,"character":4}}})"));
+}
+
+TEST(EncodeTest, ShowDocumentParamsStream) {
+    ShowDocumentParams params;
+    params.uri = "file.txt";
+    params.selection = Range{{1, 2}, {3, 4}};
+
+    json::StreamWriter w;
+    auto res = Encode(params, w);
+    EXPECT_EQ(res, Success);
+    EXPECT_EQ(
+        w.Json(),
+        R"({"uri":"file.txt","selection":{"start":{"line":1,"character":2},"end":{"line":3,"character":4}}})");
+}
+
+TEST(EncodeTest, StreamRoundTrip) {
+    TextDocumentContentChangeWholeDocument change;
+    change.text = "line 1\nline \"2\"\n";
+    DidChangeTextDocumentParams params;
+    params.text_document.uri = "file.txt";
+    params.text_document.version = 3;
+    params.content_changes.push_back(change);
+
+    json::StreamWriter w;
+    ASSERT_EQ(Encode(params, w), Success);
+
+    auto b = json::Builder::Create();
+    auto parsed = b->Parse(w.Json());
+    ASSERT_EQ(parsed, Success);
+
+    DidChangeTextDocumentParams decoded;
+    ASSERT_EQ(Decode(*parsed.Get(), decoded), Success);
+    EXPECT_EQ(decoded, params);
+}
+
+TEST(EncodeTest, CreateFileRoundTrip) {
+    // The 'kind' literal of CreateFile overrides ResourceOperation::kind, which is left empty
+    CreateFile create;
+    create.uri = "file:///a";
+    create.annotation_id = "id";
+
+    json::StreamWriter w;
+    ASSERT_EQ(Encode(create, w), Success);
+    EXPECT_EQ(w.Json(), R"({"kind":"create","uri":"file:///a","annotationId":"id"})");
+
+    auto b = json::Builder::Create();
+    auto encoded = Encode(create, *b);
+    ASSERT_EQ(encoded, Success);
+    EXPECT_THAT(encoded.Get()->Json(),
+                testing::AnyOf(R"({"annotationId":"id","kind":"create","uri":"file:///a"})",
+                               R"({"kind":"create","uri":"file:///a","annotationId":"id"})"));
+
+    // Decoding assigns the 'kind' literal to ResourceOperation::kind
+    create.kind = "create";
+
+    json::StreamReader r(w.Json());
+    CreateFile stream_decoded;
+    ASSERT_EQ(Decode(r, stream_decoded), Success);
+    EXPECT_EQ(stream_decoded, create);
+
+    auto parsed = b->Parse(w.Json());
+    ASSERT_EQ(parsed, Success);
+    CreateFile decoded;
+    ASSERT_EQ(Decode(*parsed.Get(), decoded), Success);
+    EXPECT_EQ(decoded, create);
+
+    CreateFile builder_decoded;
+    ASSERT_EQ(Decode(*encoded.Get(), builder_decoded), Success);
+    EXPECT_EQ(builder_decoded, create);
+}
+
+TEST(EncodeTest, SemanticTokens) {
+    SemanticTokens tokens;
+    tokens.result_id = "1";
+    for (Uinteger i = 0; i < 2000; i++) {
+        tokens.data.push_back(i % 13);
+    }
+
+    json::StreamWriter w;
+    ASSERT_EQ(Encode(tokens, w), Success);
+
+    json::StreamReader r(w.Json());
+    SemanticTokens stream_decoded;
+    ASSERT_EQ(Decode(r, stream_decoded), Success);
+    EXPECT_EQ(stream_decoded, tokens);
+
+    auto b = json::Builder::Create();
+    auto encoded = Encode(tokens, *b);
+    ASSERT_EQ(encoded, Success);
+
+    SemanticTokens decoded;
+    ASSERT_EQ(Decode(*encoded.Get(), decoded), Success);
+    EXPECT_EQ(decoded, tokens);
+}
+
+TEST(EncodeTest, StreamEnum) {
+    json::StreamWriter w;
+    w.BeginArray();
+    EXPECT_EQ(Encode(SymbolKind::kFunction, w), Success);
+    EXPECT_EQ(Encode(MarkupKind::kMarkdown, w), Success);
+    w.EndArray();
+    EXPECT_EQ(w.Json(), R"([12,"markdown"])");
+}
+
+TEST(EncodeTest, EncodeCache) {
+    EncodeCache cache;
+
+    Position position{1, 2};
+    auto first = cache.Get(1, position);
+    ASSERT_EQ(first, Success);
+    EXPECT_EQ(first->json, R"({"line":1,"character":2})");
+
+    // The cached encoding is returned for the same key, without re-encoding the value
+    position.line = 10;
+    auto second = cache.Get(1, position);
+    ASSERT_EQ(second, Success);
+    EXPECT_EQ(second->json.data(), first->json.data());
+
+    auto other = cache.Get(2, position);
+    ASSERT_EQ(other, Success);
+    EXPECT_EQ(other->json, R"({"line":10,"character":2})");
+    EXPECT_EQ(cache.Count(), 2u);
+
+    cache.Erase(1);
+    EXPECT_EQ(cache.Count(), 1u);
+    cache.Clear();
+    EXPECT_EQ(cache.Count(), 0u);
+
+    // An Encoded remains valid once its entry has been erased
+    EXPECT_EQ(first->json, R"({"line":1,"character":2})");
+    EXPECT_EQ(other->json, R"({"line":10,"character":2})");
+}
+
+TEST(EncodeTest, EncodeCacheTypes) {
+    EncodeCache cache;
+
+    // Values of different types with the same key are cached separately
+    auto position = cache.Get(1, Position{1, 2});
+    ASSERT_EQ(position, Success);
+    auto range = cache.Get(1, Range{{3, 4}, {5, 6}});
+    ASSERT_EQ(range, Success);
+    EXPECT_EQ(position->json, R"({"line":1,"character":2})");
+    EXPECT_EQ(range->json,
+              R"({"start":{"line":3,"character":4},"end":{"line":5,"character":6}})");
+    EXPECT_EQ(cache.Count(), 2u);
+
+    auto cached = cache.Get(1, Position{7, 8});
+    ASSERT_EQ(cached, Success);
+    EXPECT_EQ(cached->json.data(), position->json.data());
+
+    // Erase() removes the encodings of all types with the key
+    cache.Erase(1);
+    EXPECT_EQ(cache.Count(), 0u);
+}
+
+TEST(EncodeTest, EncodeCacheThreads) {
+    EncodeCache cache;
+    std::vector<std::thread> threads;
+    for (Uinteger t = 0; t < 4; t++) {
+        threads.emplace_back([&cache, t] {
+            for (Uinteger i = 0; i < 200; i++) {
+                Position position{t, i};
+                auto encoded = cache.Get(t, position);
+                ASSERT_EQ(encoded, Success);
+                cache.Erase(t);
+                EXPECT_EQ(encoded->json,
+                          R"({"line":)" + std::to_string(t) + R"(,"character":)" +
+                              std::to_string(i) + "}");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(cache.Count(), 0u);
+}
+
+TEST(EncodeTest, EncodedStream) {
+    Range range{{1, 2}, {3, 4}};
+    EncodeCache cache;
+    auto start = cache.Get(0, range.start);
+    ASSERT_EQ(start, Success);
+
+    json::StreamWriter w;
+    w.BeginObject();
+    w.Key("start");
+    ASSERT_EQ(Encode(start.Get(), w), Success);
+    w.Key("end");
+    ASSERT_EQ(Encode(range.end, w), Success);
+    w.EndObject();
+    EXPECT_EQ(w.Json(), R"({"start":{"line":1,"character":2},"end":{"line":3,"character":4}})");
 }
 
 }  // namespace
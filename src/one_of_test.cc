@@ -121,5 +121,69 @@ TEST(OneOfTest, Reset) {
     oneof.Visit([&](auto&) { FAIL() << "should not be called"; });
 }
 
+TEST(OneOfTest, CopyAssign) {
+    OneOf<int, std::string, float> other{std::string("hello")};
+    OneOf<int, std::string, float> oneof{42};
+    oneof = other;
+    ASSERT_TRUE(oneof.Is<std::string>());
+    EXPECT_EQ(*oneof.Get<std::string>(), std::string("hello"));
+    ASSERT_TRUE(other.Is<std::string>());
+    EXPECT_EQ(*other.Get<std::string>(), std::string("hello"));
+
+    auto& self = oneof;
+    oneof = self;
+    ASSERT_TRUE(oneof.Is<std::string>());
+    EXPECT_EQ(*oneof.Get<std::string>(), std::string("hello"));
+}
+
+TEST(OneOfTest, MoveAssign) {
+    OneOf<int, std::string, float> other{std::string("hello")};
+    OneOf<int, std::string, float> oneof{1.5f};
+    oneof = std::move(other);
+    ASSERT_TRUE(oneof.Is<std::string>());
+    EXPECT_EQ(*oneof.Get<std::string>(), std::string("hello"));
+    EXPECT_FALSE(other.Is<std::string>());  // NOLINT(bugprone-use-after-move)
+}
+
+TEST(OneOfTest, Trivial) {
+    OneOf<bool, int64_t, double> other{int64_t{42}};
+    OneOf<bool, int64_t, double> oneof{other};
+    ASSERT_TRUE(oneof.Is<int64_t>());
+    EXPECT_EQ(*oneof.Get<int64_t>(), 42);
+
+    oneof = true;
+    ASSERT_TRUE(oneof.Is<bool>());
+    EXPECT_TRUE(*oneof.Get<bool>());
+
+    oneof = std::move(other);
+    ASSERT_TRUE(oneof.Is<int64_t>());
+    EXPECT_EQ(*oneof.Get<int64_t>(), 42);
+}
+
+struct Node {
+    OneOf<int, std::vector<int>, Node> value;  // Node is incomplete here, so is held by pointer
+};
+
+TEST(OneOfTest, HeapAndInline) {
+    static_assert(IsInline<int>);
+    static_assert(IsInline<std::string>);
+    static_assert(!IsInline<std::vector<int>>);
+    static_assert(!IsInline<Node>);
+
+    Node leaf{std::vector<int>{1, 2, 3}};
+    Node root;
+    root.value = leaf;
+    ASSERT_TRUE(root.value.Is<Node>());
+    ASSERT_TRUE(root.value.Get<Node>()->value.Is<std::vector<int>>());
+    EXPECT_EQ(*root.value.Get<Node>()->value.Get<std::vector<int>>(), (std::vector<int>{1, 2, 3}));
+
+    Node copy{root};
+    root.value = 7;
+    ASSERT_TRUE(root.value.Is<int>());
+    EXPECT_EQ(*root.value.Get<int>(), 7);
+    ASSERT_TRUE(copy.value.Is<Node>());
+    EXPECT_EQ(copy.value.Get<Node>()->value.Get<std::vector<int>>()->size(), 3u);
+}
+
 }  // namespace
 }  // namespace langsvr::lsp
@@ -28,6 +28,7 @@
 #include "langsvr/optional.h"
 
 #include "gmock/gmock.h"
+#include "langsvr/lsp/lsp.h"
 
 namespace langsvr {
 namespace {
@@ -79,5 +80,90 @@ TEST(OptionalTest, MoveCtorWithOptional) {
     EXPECT_EQ(*opt, "hello");
 }
 
+TEST(OptionalTest, Inline) {
+    static_assert(sizeof(Optional<bool>) == 2);
+
+    Optional<bool> opt{true};
+    Optional<bool> copy{opt};
+    EXPECT_EQ(copy, true);
+
+    Optional<bool> moved{std::move(opt)};
+    EXPECT_EQ(moved, true);
+    EXPECT_FALSE(opt);  // NOLINT(bugprone-use-after-move)
+
+    copy.Reset();
+    EXPECT_FALSE(copy);
+    auto& self = copy;
+    copy = self;
+    EXPECT_FALSE(copy);
+}
+
+struct Node {
+    Optional<Node> parent;  // Node is incomplete here, so is held by pointer
+    int value = 0;
+};
+
+TEST(OptionalTest, Recursive) {
+    Node root;
+    root.value = 1;
+    Node child;
+    child.value = 2;
+    child.parent = root;
+
+    Node copy = child;
+    child.parent->value = 3;
+    ASSERT_TRUE(copy.parent);
+    EXPECT_EQ(copy.parent->value, 1);
+    EXPECT_FALSE(copy.parent->parent);
+}
+
+struct Small {
+    int value = 0;
+};
+[[maybe_unused]] void EnableInlineStorage(InlineStorageTag<Small>) {}
+
+TEST(OptionalTest, EnableInlineStorage) {
+    static_assert(IsInline<Small>);
+    static_assert(!IsInline<Node>);
+    static_assert(sizeof(Optional<Small>) == 2 * sizeof(int));
+
+    Optional<Small> opt{Small{42}};
+    EXPECT_EQ(opt->value, 42);
+}
+
+TEST(OptionalTest, InlineOnlyIfNoLarger) {
+    static_assert(sizeof(Optional<lsp::Integer>) <= sizeof(void*));
+    static_assert(sizeof(Optional<lsp::DiagnosticSeverity>) <= sizeof(void*));
+    static_assert(sizeof(Optional<lsp::Position>) == sizeof(void*));
+    static_assert(sizeof(Optional<std::string>) == sizeof(void*));
+}
+
+/// HeapDiagnostic has the layout of lsp::Diagnostic when every Optional held its value by pointer
+struct HeapDiagnostic {
+    lsp::Range range;
+    void* severity;
+    void* code;
+    void* code_description;
+    void* source;
+    lsp::String message;
+    void* tags;
+    void* related_information;
+    void* data;
+};
+
+/// HeapCompletionItem has the layout of lsp::CompletionItem when every Optional held its value by
+/// pointer
+struct HeapCompletionItem {
+    lsp::String label;
+    void* optionals[18];
+};
+
+TEST(OptionalTest, StructureSizes) {
+    // Inline storage must not make frequently allocated structures any larger than holding each
+    // optional value on the heap
+    static_assert(sizeof(lsp::Diagnostic) <= sizeof(HeapDiagnostic));
+    static_assert(sizeof(lsp::CompletionItem) <= sizeof(HeapCompletionItem));
+}
+
 }  // namespace
 }  // namespace langsvr
@@ -31,4 +31,8 @@ namespace langsvr {
 
 Reader::~Reader() = default;
 
+size_t Reader::ReadSome(std::byte* out, size_t count) {
+    return count > 0 ? Read(out, 1) : 0;
+}
+
 }
@@ -27,83 +27,266 @@
 
 #include "langsvr/session.h"
 #include <string>
+#include <vector>
 #include "langsvr/json/builder.h"
+#include "langsvr/json/stream_reader.h"
 
 namespace langsvr {
 
-Result<SuccessType> Session::Receive(std::string_view json) {
-    auto json_builder = json::Builder::Create();
-    auto object = json_builder->Parse(json);
-    if (object != Success) {
-        return object.Failure();
-    }
+namespace {
 
-    auto method = object.Get()->Get<json::String>("method");
-    if (method != Success) {  // Response
-        auto id = object.Get()->Get<json::I64>("id");
-        if (id != Success) {
-            return id.Failure();
-        }
+/// Envelope holds the members of a JSON-RPC message that are needed to dispatch the message.
+struct Envelope {
+    /// The position of the 'method' value, if has_method is true
+    json::StreamReader::Position method;
+    /// The 'id' value, if has_id is true
+    json::I64 id = 0;
+    /// The raw JSON of the 'params' value, or empty if the message has no params
+    std::string_view params;
+    bool has_method = false;
+    bool has_id = false;
+};
 
-        auto handler_it = response_handlers_.find(id.Get());
-        if (handler_it == response_handlers_.end()) {
-            return Failure{"received response for unknown request with ID " +
-                           std::to_string(id.Get())};
+/// ScanEnvelope reads the top-level members of the message @p reader, skipping over the values of
+/// all members but 'id'. The 'params' value is only skipped over, so it is not validated until it
+/// is decoded by a handler. The params of a message that has no handler are never validated.
+Result<Envelope> ScanEnvelope(std::string_view json, json::StreamReader& reader) {
+    if (auto res = reader.BeginObject(); res != Success) {
+        return res.Failure();
+    }
+    Envelope envelope;
+    while (true) {
+        std::string_view name;
+        auto next = reader.NextMember(name);
+        if (next != Success) {
+            return next.Failure();
+        }
+        if (!next.Get()) {
+            break;
+        }
+        if (name == "id") {
+            auto id = reader.I64();
+            if (id != Success) {
+                return id.Failure();
+            }
+            envelope.id = id.Get();
+            envelope.has_id = true;
+            continue;
+        }
+        auto start = reader.Save();
+        if (auto res = reader.Skip(); res != Success) {
+            return res.Failure();
         }
+        if (name == "method") {
+            envelope.method = start;
+            envelope.has_method = true;
+        } else if (name == "params") {
+            envelope.params = json.substr(start.offset, reader.Save().offset - start.offset);
+        }
+    }
+    if (auto res = reader.End(); res != Success) {
+        return res.Failure();
+    }
+    return envelope;
+}
 
-        auto handler = std::move(handler_it->second);
-        response_handlers_.erase(handler_it);
-        return handler(*object.Get());
+}  // namespace
+
+Result<SuccessType> Session::Receive(std::string_view json) {
+    json::StreamReader reader(json);
+    auto envelope = ScanEnvelope(json, reader);
+    if (envelope != Success) {
+        return envelope.Failure();
     }
 
-    if (object.Get()->Has("id")) {  // Request
-        auto id = object.Get()->Get<json::I64>("id");
-        if (id != Success) {
-            return id.Failure();
+    if (!envelope->has_method) {  // Response
+        if (!envelope->has_id) {
+            return Failure{"response has no 'id'"};
         }
-
-        auto it = request_handlers_.find(method.Get());
-        if (it == request_handlers_.end()) {
-            return Failure{"no handler registered for request method '" + method.Get() + "'"};
+        std::function<Result<SuccessType>(const json::Value&)> handler;
+        {
+            std::lock_guard lock(response_handlers_mutex_);
+            auto handler_it = response_handlers_.find(envelope->id);
+            if (handler_it == response_handlers_.end()) {
+                return Failure{"received response for unknown request with ID " +
+                               std::to_string(envelope->id)};
+            }
+            handler = std::move(handler_it->second);
+            response_handlers_.erase(handler_it);
         }
-        auto& request_handler = it->second;
 
-        auto result = request_handler.function(*object.Get(), *json_builder.get());
-        if (result != Success) {
-            return result.Failure();
+        auto json_builder = builders_.Acquire();
+        auto object = json_builder->Parse(json);
+        if (object != Success) {
+            return object.Failure();
         }
+        return handler(*object.Get());
+    }
 
-        std::array response_members{
-            json::Builder::Member{"id", json_builder->I64(id.Get())},
-            json::Builder::Member{"jsonrpc", json_builder->String("2.0")},
-            result.Get(),
-        };
+    reader.Restore(envelope->method);
+    auto method = reader.StringView();
+    if (method != Success) {
+        return method.Failure();
+    }
 
-        auto* response = json_builder->Object(response_members);
-        if (auto res = SendJson(response->Json()); res != Success) {
-            return res.Failure();
-        }
+    // Methods that are not part of the LSP cannot have a registered handler
+    lsp::MethodId method_id{};
+    bool is_lsp_method = lsp::LookupMethodId(method.Get(), method_id);
 
-        if (request_handler.post_send) {
-            request_handler.post_send();
+    if (envelope->has_id) {  // Request
+        auto* request_handler =
+            is_lsp_method ? request_handlers_[static_cast<size_t>(method_id)].get() : nullptr;
+        if (!request_handler || !request_handler->function) {
+            return Failure{"no handler registered for request method '" +
+                           std::string(method.Get()) + "'"};
         }
+        return request_handler->function(*this, *request_handler, envelope->id, envelope->params);
     } else {  // Notification
-        auto it = notification_handlers_.find(method.Get());
-        if (it == notification_handlers_.end()) {
-            return Failure{"no handler registered for request method '" + method.Get() + "'"};
+        if (is_lsp_method && method_id == lsp::MethodId::kCancelRequestNotification) {
+            if (auto res = Cancel(envelope->params); res != Success) {
+                return res.Failure();
+            }
         }
-        auto& notification_handler = it->second;
-        return notification_handler.function(*object.Get());
-    }
 
-    return Success;
+        auto* notification_handler =
+            is_lsp_method ? &notification_handlers_[static_cast<size_t>(method_id)] : nullptr;
+        if (!notification_handler || !notification_handler->function) {
+            if (method->substr(0, 2) == "$/") {
+                // Notifications starting with '$/' are protocol-implementation dependent, and can
+                // be ignored if not handled.
+                return Success;
+            }
+            return Failure{"no handler registered for request method '" +
+                           std::string(method.Get()) + "'"};
+        }
+        return notification_handler->function(*this, envelope->params);
+    }
 }
 
 Result<SuccessType> Session::SendJson(std::string_view msg) {
     if (!sender_) [[unlikely]] {
         return Failure{"no sender set"};
     }
+    std::lock_guard lock(sender_mutex_);
     return sender_(msg);
 }
 
+Result<SuccessType> Session::SendError(json::I64 id,
+                                       const RequestHandler& handler,
+                                       lsp::LSPErrorCodes code,
+                                       std::string_view message) {
+    auto writer = writers_.Acquire();
+    auto& response = *writer;
+    response.BeginObject();
+    response.Key("id");
+    response.I64(id);
+    response.Key("jsonrpc");
+    response.String("2.0");
+    response.Key(kResponseError);
+    response.BeginObject();
+    response.Key("code");
+    if (auto res = lsp::Encode(code, response); res != Success) {
+        return res.Failure();
+    }
+    response.Key("message");
+    response.String(message);
+    response.EndObject();
+    response.EndObject();
+
+    if (auto res = SendJson(response.Json()); res != Success) {
+        return res.Failure();
+    }
+
+    if (handler.post_send) {
+        handler.post_send();
+    }
+    return Success;
+}
+
+std::shared_ptr<std::atomic<bool>> Session::BeginRequest(json::I64 id) {
+    auto cancelled = std::make_shared<std::atomic<bool>>(false);
+    std::lock_guard lock(in_flight_mutex_);
+    in_flight_[id] = cancelled;
+    return cancelled;
+}
+
+void Session::EndRequest(json::I64 id) {
+    std::lock_guard lock(in_flight_mutex_);
+    in_flight_.erase(id);
+}
+
+Result<SuccessType> Session::Cancel(std::string_view params) {
+    lsp::CancelRequestNotification cancel;
+    if (auto res = DecodeParams(params, cancel); res != Success) {
+        return res.Failure();
+    }
+    // Receive() only accepts integer request IDs, so a string ID cannot match an in-flight request
+    if (auto* id = cancel.id.Get<lsp::Integer>()) {
+        std::lock_guard lock(in_flight_mutex_);
+        if (auto it = in_flight_.find(*id); it != in_flight_.end()) {
+            it->second->store(true, std::memory_order_relaxed);
+        }
+    }
+    return Success;
+}
+
+void Session::PostTask(std::string_view strand, bool barrier, Executor::Task&& task) {
+    {
+        std::lock_guard lock(post_mutex_);
+        if (!queued_.empty() || (barrier && posted_ > 0)) {
+            // Held back by a barrier, or a barrier waiting for the earlier tasks to complete
+            queued_.push_back(QueuedTask{std::string(strand), std::move(task), barrier});
+            return;
+        }
+        if (barrier) {
+            // Hold back the tasks posted while the barrier runs
+            queued_.push_back(QueuedTask{std::string(strand), nullptr, barrier});
+        }
+        posted_++;
+    }
+    Execute(strand, barrier, std::move(task));
+}
+
+void Session::Execute(std::string_view strand, bool barrier, Executor::Task&& task) {
+    executor_->Post(strand, [this, task = std::move(task), barrier] {
+        task();
+        TaskCompleted(barrier);
+    });
+}
+
+void Session::TaskCompleted(bool barrier) {
+    // Tasks are posted once the lock is released, as the executor may run them synchronously
+    std::vector<QueuedTask> ready;
+    {
+        std::lock_guard lock(post_mutex_);
+        posted_--;
+        if (barrier) {
+            queued_.pop_front();
+        }
+        while (!queued_.empty()) {
+            auto& next = queued_.front();
+            if (next.barrier) {
+                if (posted_ == 0) {
+                    // Leave the barrier at the front of the queue while it runs
+                    ready.push_back(QueuedTask{next.strand, std::move(next.task), true});
+                    posted_++;
+                }
+                break;
+            }
+            ready.push_back(std::move(next));
+            queued_.pop_front();
+            posted_++;
+        }
+    }
+    for (auto& queued : ready) {
+        Execute(queued.strand, queued.barrier, std::move(queued.task));
+    }
+}
+
+void Session::ReportError(const Failure& failure) {
+    if (error_handler_) {
+        error_handler_(failure);
+    }
+}
+
 }  // namespace langsvr
@@ -30,8 +30,18 @@
 #include "langsvr/session.h"
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 #include "langsvr/json/builder.h"
 #include "langsvr/lsp/decode.h"
+#include "langsvr/thread_pool.h"
 
 #include "gmock/gmock.h"
 #include "langsvr/result.h"
@@ -149,5 +159,575 @@ TEST(Session, InitializeRequest_FailureOnly) {
     EXPECT_EQ(response.Failure(), expected);
 }
 
+TEST(Session, InitializeRequest_Encoded) {
+    auto request = GetInitializeRequest();
+    ASSERT_EQ(request, Success);
+
+    Session server_session;
+    Session client_session;
+    client_session.SetSender([&](std::string_view msg) { return server_session.Receive(msg); });
+    server_session.SetSender([&](std::string_view msg) { return client_session.Receive(msg); });
+
+    lsp::InitializeResult result;
+    result.capabilities.hover_provider = true;
+
+    lsp::EncodeCache cache;
+    server_session.Register([&](const lsp::InitializeRequest&) {
+        auto encoded = cache.Get(0, result);
+        EXPECT_EQ(encoded, Success);
+        return encoded.Get();
+    });
+
+    for (int i = 0; i < 2; i++) {
+        auto response_future = client_session.Send(request.Get());
+        ASSERT_EQ(response_future, Success);
+
+        auto response = response_future.Get().get();
+        ASSERT_EQ(response, Success);
+        EXPECT_EQ(response.Get(), result);
+    }
+    EXPECT_EQ(cache.Count(), 1u);
+}
+
+TEST(Session, Notification) {
+    Session session;
+
+    std::vector<lsp::TextDocumentDidCloseNotification> received;
+    session.Register([&](const lsp::TextDocumentDidCloseNotification& notification) {
+        received.push_back(notification);
+        return Success;
+    });
+
+    auto res = session.Receive(
+        R"({"params":{"textDocument":{"uri":"file.txt"}},"jsonrpc":"2.0","method":"textDocument/didClose"})");
+    EXPECT_EQ(res, Success);
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received[0].text_document.uri, "file.txt");
+}
+
+TEST(Session, NotificationErrInvalidParams) {
+    Session session;
+    session.Register([&](const lsp::TextDocumentDidCloseNotification&) { return Success; });
+
+    auto res = session.Receive(
+        R"({"jsonrpc":"2.0","method":"textDocument/didClose","params":{"textDocument":{}}})");
+    EXPECT_NE(res, Success);
+}
+
+TEST(Session, UnhandledNotification) {
+    Session session;
+
+    // Unhandled '$/' notifications are ignored, without decoding the params
+    EXPECT_EQ(session.Receive(R"({"jsonrpc":"2.0","method":"$/setTrace","params":{"value":7}})"),
+              Success);
+    EXPECT_EQ(session.Receive(R"({"jsonrpc":"2.0","method":"$/custom","params":[1,{"a":"]"}]})"),
+              Success);
+
+    EXPECT_NE(session.Receive(R"({"jsonrpc":"2.0","method":"textDocument/didClose","params":{}})"),
+              Success);
+}
+
+TEST(Session, UnhandledRequest) {
+    Session session;
+    session.Register([&](const lsp::ShutdownRequest&) { return lsp::Null{}; });
+
+    auto unregistered =
+        session.Receive(R"({"jsonrpc":"2.0","id":1,"method":"textDocument/hover","params":{}})");
+    ASSERT_NE(unregistered, Success);
+    EXPECT_EQ(unregistered.Failure().reason,
+              "no handler registered for request method 'textDocument/hover'");
+
+    auto unknown = session.Receive(R"({"jsonrpc":"2.0","id":2,"method":"custom/method"})");
+    ASSERT_NE(unknown, Success);
+    EXPECT_EQ(unknown.Failure().reason,
+              "no handler registered for request method 'custom/method'");
+}
+
+TEST(Session, LookupMethodId) {
+    lsp::MethodId id{};
+    EXPECT_TRUE(lsp::LookupMethodId(lsp::InitializeRequest::kMethod, id));
+    EXPECT_EQ(id, lsp::InitializeRequest::kMethodId);
+    EXPECT_TRUE(lsp::LookupMethodId(lsp::TextDocumentDidCloseNotification::kMethod, id));
+    EXPECT_EQ(id, lsp::TextDocumentDidCloseNotification::kMethodId);
+    EXPECT_TRUE(lsp::LookupMethodId(lsp::SetTraceNotification::kMethod, id));
+    EXPECT_EQ(id, lsp::SetTraceNotification::kMethodId);
+    EXPECT_FALSE(lsp::LookupMethodId("initializE", id));
+    EXPECT_FALSE(lsp::LookupMethodId("", id));
+}
+
+TEST(Session, ErrMalformedEnvelope) {
+    Session session;
+    session.Register([&](const lsp::TextDocumentDidCloseNotification&) { return Success; });
+
+    EXPECT_NE(session.Receive(R"({"jsonrpc":"2.0","method":"$/custom","params":[1,)"), Success);
+    EXPECT_NE(session.Receive(R"({"jsonrpc":"2.0","method":7})"), Success);
+    EXPECT_NE(session.Receive(R"({"jsonrpc":"2.0","id":"x","method":"shutdown"})"), Success);
+    EXPECT_NE(session.Receive(R"({"jsonrpc":"2.0","result":null})"), Success);
+}
+
+TEST(Session, Executor) {
+    ThreadPool pool(4);
+    Session session;
+    session.SetExecutor(&pool);
+
+    std::mutex mutex;
+    std::vector<std::string> sent;
+    std::vector<std::string> errors;
+    session.SetSender([&](std::string_view msg) -> Result<SuccessType> {
+        std::lock_guard lock(mutex);
+        sent.emplace_back(msg);
+        return Success;
+    });
+    session.SetErrorHandler([&](const Failure& failure) {
+        std::lock_guard lock(mutex);
+        errors.push_back(failure.reason);
+    });
+
+    // The latest version of each document, as seen by the handlers
+    std::unordered_map<std::string, lsp::Integer> versions;
+    std::atomic<bool> out_of_order = false;
+    session.Register([&](const lsp::TextDocumentDidChangeNotification& notification) {
+        std::lock_guard lock(mutex);
+        auto& version = versions[notification.text_document.uri];
+        if (notification.text_document.version != version + 1) {
+            out_of_order = true;
+        }
+        version = notification.text_document.version;
+        return Success;
+    });
+    session.Register(
+        [&](const lsp::TextDocumentHoverRequest& request)
+            -> lsp::TextDocumentHoverRequest::SuccessType {
+            // Each hover request is sent after the change to the version matching its line
+            std::lock_guard lock(mutex);
+            if (versions[request.text_document.uri] !=
+                static_cast<lsp::Integer>(request.position.line)) {
+                out_of_order = true;
+            }
+            return lsp::Null{};
+        });
+
+    static constexpr int kVersions = 50;
+    int id = 0;
+    for (int version = 1; version <= kVersions; version++) {
+        for (std::string uri : {"a.txt", "b.txt", "c.txt"}) {
+            auto change = session.Receive(
+                R"({"jsonrpc":"2.0","method":"textDocument/didChange","params":{"textDocument":{"uri":")" +
+                uri + R"(","version":)" + std::to_string(version) + R"(},"contentChanges":[]}})");
+            ASSERT_EQ(change, Success);
+            auto hover = session.Receive(
+                R"({"jsonrpc":"2.0","id":)" + std::to_string(++id) +
+                R"(,"method":"textDocument/hover","params":{"textDocument":{"uri":")" + uri +
+                R"("},"position":{"line":)" + std::to_string(version) + R"(,"character":0}}})");
+            ASSERT_EQ(hover, Success);
+        }
+    }
+    pool.Wait();
+
+    EXPECT_FALSE(out_of_order);
+    EXPECT_EQ(sent.size(), static_cast<size_t>(id));
+    EXPECT_TRUE(errors.empty());
+    EXPECT_EQ(versions["a.txt"], kVersions);
+    EXPECT_EQ(versions["b.txt"], kVersions);
+    EXPECT_EQ(versions["c.txt"], kVersions);
+}
+
+TEST(Session, ExecutorErrorHandler) {
+    ThreadPool pool(2);
+    Session session;
+    session.SetExecutor(&pool);
+
+    std::mutex mutex;
+    std::vector<std::string> errors;
+    session.SetErrorHandler([&](const Failure& failure) {
+        std::lock_guard lock(mutex);
+        errors.push_back(failure.reason);
+    });
+    session.Register([&](const lsp::TextDocumentDidCloseNotification&) -> Result<SuccessType> {
+        return Failure{"close failed"};
+    });
+
+    // Params are decoded by Receive(), so invalid params are still returned as a failure
+    EXPECT_NE(session.Receive(
+                  R"({"jsonrpc":"2.0","method":"textDocument/didClose","params":{"textDocument":{}}})"),
+              Success);
+    EXPECT_EQ(
+        session.Receive(
+            R"({"jsonrpc":"2.0","method":"textDocument/didClose","params":{"textDocument":{"uri":"file.txt"}}})"),
+        Success);
+    pool.Wait();
+
+    EXPECT_THAT(errors, testing::ElementsAre("close failed"));
+}
+
+TEST(Session, ExecutorSessionStrand) {
+    ThreadPool pool(4);
+    Session session;
+    session.SetExecutor(&pool);
+    std::atomic<int> sent = 0;
+    session.SetSender([&](std::string_view) -> Result<SuccessType> {
+        sent++;
+        return Success;
+    });
+
+    // Notifications that do not act on a text document are handled one at a time
+    std::atomic<int> configurations = 0;
+    std::atomic<int> running = 0;
+    std::atomic<bool> overlapped = false;
+    session.Register([&](const lsp::WorkspaceDidChangeConfigurationNotification&) {
+        if (running++ != 0) {
+            overlapped = true;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        configurations++;
+        running--;
+        return Success;
+    });
+
+    // Requests that do not act on a text document are handled concurrently. The first request only
+    // completes once the second has started.
+    std::promise<void> second_started;
+    auto second_started_future = second_started.get_future();
+    std::atomic<bool> concurrent = false;
+    session.Register([&](const lsp::WorkspaceExecuteCommandRequest& request)
+                         -> lsp::WorkspaceExecuteCommandRequest::SuccessType {
+        if (request.command == "first") {
+            concurrent = second_started_future.wait_for(std::chrono::seconds(10)) ==
+                         std::future_status::ready;
+        } else {
+            second_started.set_value();
+        }
+        return lsp::Null{};
+    });
+
+    static constexpr int kConfigurations = 20;
+    for (int i = 0; i < kConfigurations; i++) {
+        ASSERT_EQ(
+            session.Receive(
+                R"({"jsonrpc":"2.0","method":"workspace/didChangeConfiguration","params":{"settings":null}})"),
+            Success);
+    }
+    int id = 0;
+    for (std::string command : {"first", "second"}) {
+        ASSERT_EQ(session.Receive(R"({"jsonrpc":"2.0","id":)" + std::to_string(++id) +
+                                  R"(,"method":"workspace/executeCommand","params":{"command":")" +
+                                  command + R"("}})"),
+                  Success);
+    }
+    pool.Wait();
+
+    EXPECT_FALSE(overlapped);
+    EXPECT_TRUE(concurrent);
+    EXPECT_EQ(configurations, kConfigurations);
+    EXPECT_EQ(sent, 2);
+}
+
+TEST(Session, ExecutorReregister) {
+    ThreadPool pool(2);
+    Session session;
+    session.SetExecutor(&pool);
+    std::mutex mutex;
+    std::vector<std::string> sent;
+    session.SetSender([&](std::string_view msg) -> Result<SuccessType> {
+        std::lock_guard lock(mutex);
+        sent.emplace_back(msg);
+        return Success;
+    });
+
+    // The handler is replaced while its task is running, and the task still calls the first
+    // handler
+    auto hover = [](std::string text, std::shared_future<void> released) {
+        return [text, released](const lsp::TextDocumentHoverRequest&)
+                   -> lsp::TextDocumentHoverRequest::SuccessType {
+            released.wait();
+            lsp::Hover result;
+            result.contents = lsp::MarkupContent{lsp::MarkupKind::kPlainText, text};
+            return result;
+        };
+    };
+    std::promise<void> release;
+    session.Register(hover(std::string(64, 'a'), release.get_future().share()));
+    std::string request =
+        R"(,"method":"textDocument/hover","params":{"textDocument":{"uri":"a.txt"},)"
+        R"("position":{"line":0,"character":0}}})";
+    ASSERT_EQ(session.Receive(R"({"jsonrpc":"2.0","id":1)" + request), Success);
+
+    std::promise<void> released;
+    released.set_value();
+    session.Register(hover(std::string(64, 'b'), released.get_future().share()));
+    release.set_value();
+    pool.Wait();
+    ASSERT_EQ(session.Receive(R"({"jsonrpc":"2.0","id":2)" + request), Success);
+    pool.Wait();
+
+    ASSERT_EQ(sent.size(), 2u);
+    EXPECT_THAT(sent[0], testing::HasSubstr(std::string(64, 'a')));
+    EXPECT_THAT(sent[1], testing::HasSubstr(std::string(64, 'b')));
+}
+
+TEST(Session, ExecutorExitBarrier) {
+    ThreadPool pool(4);
+    Session session;
+    session.SetExecutor(&pool);
+
+    // 'exit' is handled after all the earlier messages, and before all the later messages
+    static constexpr int kChanges = 20;
+    std::atomic<int> changes = 0;
+    std::atomic<bool> exited = false;
+    std::atomic<bool> out_of_order = false;
+    session.Register([&](const lsp::TextDocumentDidChangeNotification&) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        if (exited) {
+            out_of_order = true;
+        }
+        changes++;
+        return Success;
+    });
+    session.Register([&](const lsp::ExitNotification&) {
+        if (changes != kChanges) {
+            out_of_order = true;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        exited = true;
+        return Success;
+    });
+    bool closed = false;
+    session.Register([&](const lsp::TextDocumentDidCloseNotification&) {
+        if (!exited) {
+            out_of_order = true;
+        }
+        closed = true;
+        return Success;
+    });
+
+    for (int version = 1; version <= kChanges; version++) {
+        ASSERT_EQ(
+            session.Receive(
+                R"({"jsonrpc":"2.0","method":"textDocument/didChange","params":{"textDocument":{"uri":")" +
+                std::to_string(version % 4) + R"(.txt","version":)" + std::to_string(version) +
+                R"(},"contentChanges":[]}})"),
+            Success);
+    }
+    ASSERT_EQ(session.Receive(R"({"jsonrpc":"2.0","method":"exit"})"), Success);
+    ASSERT_EQ(
+        session.Receive(
+            R"({"jsonrpc":"2.0","method":"textDocument/didClose","params":{"textDocument":{"uri":"0.txt"}}})"),
+        Success);
+    pool.Wait();
+
+    EXPECT_FALSE(out_of_order);
+    EXPECT_EQ(changes, kChanges);
+    EXPECT_TRUE(exited);
+    EXPECT_TRUE(closed);
+}
+
+TEST(Session, CancelRequest) {
+    ThreadPool pool(1);
+    Session session;
+    session.SetExecutor(&pool);
+
+    std::mutex mutex;
+    std::vector<std::string> sent;
+    session.SetSender([&](std::string_view msg) -> Result<SuccessType> {
+        std::lock_guard lock(mutex);
+        sent.emplace_back(msg);
+        return Success;
+    });
+
+    std::promise<void> started;
+    std::atomic<int> calls = 0;
+    session.Register(
+        [&](const lsp::TextDocumentHoverRequest&, const CancellationToken& token)
+            -> lsp::TextDocumentHoverRequest::SuccessType {
+            calls++;
+            started.set_value();
+            while (!token.IsCancelled()) {
+                std::this_thread::yield();
+            }
+            return lsp::Null{};
+        });
+
+    // The first request blocks the only worker until it is cancelled, so the second is queued
+    auto hover = [&](int id) {
+        return session.Receive(R"({"jsonrpc":"2.0","id":)" + std::to_string(id) +
+                               R"(,"method":"textDocument/hover","params":{"textDocument":{"uri":")" +
+                               std::to_string(id) +
+                               R"(.txt"},"position":{"line":0,"character":0}}})");
+    };
+    auto cancel = [&](int id) {
+        return session.Receive(R"({"jsonrpc":"2.0","method":"$/cancelRequest","params":{"id":)" +
+                               std::to_string(id) + "}}");
+    };
+    ASSERT_EQ(hover(1), Success);
+    started.get_future().wait();
+    ASSERT_EQ(hover(2), Success);
+    ASSERT_EQ(cancel(2), Success);
+    ASSERT_EQ(cancel(1), Success);
+    pool.Wait();
+
+    EXPECT_EQ(calls, 1);
+    std::sort(sent.begin(), sent.end());
+    EXPECT_THAT(
+        sent,
+        testing::ElementsAre(
+            R"({"id":1,"jsonrpc":"2.0","error":{"code":-32800,"message":"request cancelled"}})",
+            R"({"id":2,"jsonrpc":"2.0","error":{"code":-32800,"message":"request cancelled"}})"));
+}
+
+TEST(Session, CancelRequestNotInFlight) {
+    Session session;
+    std::vector<std::string> sent;
+    session.SetSender([&](std::string_view msg) -> Result<SuccessType> {
+        sent.emplace_back(msg);
+        return Success;
+    });
+    session.Register([&](const lsp::ShutdownRequest&, const CancellationToken& token) {
+        EXPECT_FALSE(token.IsCancelled());
+        return lsp::Null{};
+    });
+
+    // Cancelling unknown requests is not an error
+    EXPECT_EQ(session.Receive(R"({"jsonrpc":"2.0","method":"$/cancelRequest","params":{"id":1}})"),
+              Success);
+    EXPECT_EQ(
+        session.Receive(R"({"jsonrpc":"2.0","method":"$/cancelRequest","params":{"id":"x"}})"),
+        Success);
+    EXPECT_NE(session.Receive(R"({"jsonrpc":"2.0","method":"$/cancelRequest","params":{}})"),
+              Success);
+
+    EXPECT_EQ(session.Receive(R"({"jsonrpc":"2.0","id":1,"method":"shutdown"})"), Success);
+    EXPECT_THAT(sent, testing::ElementsAre(R"({"id":1,"jsonrpc":"2.0","result":null})"));
+}
+
+TEST(Session, DeferredResponse) {
+    Session session;
+    std::mutex mutex;
+    std::vector<std::string> sent;
+    session.SetSender([&](std::string_view msg) -> Result<SuccessType> {
+        std::lock_guard lock(mutex);
+        sent.emplace_back(msg);
+        return Success;
+    });
+
+    using Hover = lsp::TextDocumentHoverRequest;
+    std::vector<Responder<Hover>> pending;
+    session.Register(
+        [&](const Hover&, Responder<Hover> responder) { pending.push_back(std::move(responder)); });
+    bool closed = false;
+    session.Register([&](const lsp::TextDocumentDidCloseNotification&) {
+        closed = true;
+        return Success;
+    });
+
+    auto hover = [&](int id) {
+        return session.Receive(
+            R"({"jsonrpc":"2.0","id":)" + std::to_string(id) +
+            R"(,"method":"textDocument/hover","params":{"textDocument":{"uri":"file.txt"},"position":{"line":0,"character":0}}})");
+    };
+    for (int id = 1; id <= 5; id++) {
+        ASSERT_EQ(hover(id), Success);
+    }
+    ASSERT_EQ(pending.size(), 5u);
+    EXPECT_TRUE(sent.empty());
+
+    // Messages are still dispatched while responses are outstanding
+    ASSERT_EQ(
+        session.Receive(
+            R"({"jsonrpc":"2.0","method":"textDocument/didClose","params":{"textDocument":{"uri":"file.txt"}}})"),
+        Success);
+    EXPECT_TRUE(closed);
+
+    // Respond out of order, from another thread
+    std::thread([&] { EXPECT_EQ(pending[1].Respond(lsp::Null{}), Success); }).join();
+    EXPECT_NE(pending[1].Respond(lsp::Null{}), Success);
+
+    // A cancelled request sends 'RequestCancelled' instead of the result
+    ASSERT_EQ(session.Receive(R"({"jsonrpc":"2.0","method":"$/cancelRequest","params":{"id":1}})"),
+              Success);
+    EXPECT_TRUE(pending[0].IsCancelled());
+    EXPECT_TRUE(pending[0].Token().IsCancelled());
+    EXPECT_FALSE(pending[2].IsCancelled());
+    EXPECT_EQ(pending[0].Respond(lsp::Null{}), Success);
+
+    lsp::Hover result;
+    result.contents = lsp::MarkupContent{lsp::MarkupKind::kPlainText, "hi"};
+    EXPECT_EQ(pending[2].Respond(result), Success);
+
+    // Dropping a cancelled Responder without responding sends 'RequestCancelled'
+    ASSERT_EQ(session.Receive(R"({"jsonrpc":"2.0","method":"$/cancelRequest","params":{"id":5}})"),
+              Success);
+    pending.pop_back();
+
+    // Dropping a Responder without responding sends 'RequestFailed'
+    pending.clear();
+
+    EXPECT_THAT(
+        sent,
+        testing::ElementsAre(
+            R"({"id":2,"jsonrpc":"2.0","result":null})",
+            R"({"id":1,"jsonrpc":"2.0","error":{"code":-32800,"message":"request cancelled"}})",
+            R"({"id":3,"jsonrpc":"2.0","result":{"contents":{"kind":"plaintext","value":"hi"}}})",
+            R"({"id":5,"jsonrpc":"2.0","error":{"code":-32800,"message":"request cancelled"}})",
+            R"({"id":4,"jsonrpc":"2.0","error":{"code":-32803,"message":"request handler did not respond"}})"));
+}
+
+TEST(Session, DeferredResponseReregister) {
+    Session session;
+    std::vector<std::string> sent;
+    session.SetSender([&](std::string_view msg) -> Result<SuccessType> {
+        sent.emplace_back(msg);
+        return Success;
+    });
+
+    using Hover = lsp::TextDocumentHoverRequest;
+    std::vector<Responder<Hover>> pending;
+    int post_sends = 0;
+    session
+        .Register([&](const Hover&, Responder<Hover> responder) {
+            pending.push_back(std::move(responder));
+        })
+        .OnPostSend([&] { post_sends++; });
+    ASSERT_EQ(
+        session.Receive(
+            R"({"jsonrpc":"2.0","id":1,"method":"textDocument/hover","params":{"textDocument":{"uri":"file.txt"},"position":{"line":0,"character":0}}})"),
+        Success);
+    ASSERT_EQ(pending.size(), 1u);
+
+    // The outstanding Responder still uses the post-send callback of the replaced handler
+    session.Register([&](const Hover&) -> Hover::SuccessType { return lsp::Null{}; });
+    EXPECT_EQ(pending[0].Respond(lsp::Null{}), Success);
+    EXPECT_EQ(post_sends, 1);
+    EXPECT_THAT(sent, testing::ElementsAre(R"({"id":1,"jsonrpc":"2.0","result":null})"));
+}
+
+TEST(Session, DeferredResponseExecutor) {
+    ThreadPool pool(4);
+    Session session;
+    session.SetExecutor(&pool);
+    std::mutex mutex;
+    std::vector<std::string> sent;
+    session.SetSender([&](std::string_view msg) -> Result<SuccessType> {
+        std::lock_guard lock(mutex);
+        sent.emplace_back(msg);
+        return Success;
+    });
+
+    session.Register([&](const lsp::ShutdownRequest&, Responder<lsp::ShutdownRequest> responder) {
+        // Complete the response from a task of its own
+        auto shared = std::make_shared<Responder<lsp::ShutdownRequest>>(std::move(responder));
+        pool.Post("", [shared] { EXPECT_EQ(shared->Respond(lsp::Null{}), Success); });
+    });
+
+    static constexpr int kRequests = 100;
+    for (int id = 1; id <= kRequests; id++) {
+        ASSERT_EQ(session.Receive(R"({"jsonrpc":"2.0","id":)" + std::to_string(id) +
+                                  R"(,"method":"shutdown"})"),
+                  Success);
+    }
+    pool.Wait();
+
+    EXPECT_EQ(sent.size(), static_cast<size_t>(kRequests));
+}
+
 }  // namespace
 }  // namespace langsvr
@@ -0,0 +1,206 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "langsvr/thread_pool.h"
+
+#include <utility>
+
+namespace langsvr {
+
+namespace {
+
+/// The pool of the current worker thread, or nullptr if the thread is not a pool worker
+thread_local const ThreadPool* current_pool = nullptr;
+/// The index of the current worker thread in current_pool
+thread_local size_t current_worker = 0;
+
+}  // namespace
+
+ThreadPool::ThreadPool(size_t thread_count) {
+    if (thread_count == 0) {
+        thread_count = 1;
+    }
+    workers_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; i++) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    threads_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; i++) {
+        threads_.emplace_back([this, i] { Run(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    Wait();
+    {
+        std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+void ThreadPool::Post(std::string_view strand, Task&& task) {
+    {
+        std::lock_guard lock(mutex_);
+        pending_++;
+    }
+
+    if (strand.empty()) {
+        Schedule([this, task = std::move(task)] {
+            task();
+            Complete();
+        });
+        return;
+    }
+
+    std::string key(strand);
+    {
+        std::lock_guard lock(strands_mutex_);
+        auto& tasks = strands_[key];
+        tasks.push_back(std::move(task));
+        if (tasks.size() > 1) {
+            // The strand is already scheduled or running. The task is run once the tasks before it
+            // have completed.
+            return;
+        }
+    }
+    Schedule([this, key = std::move(key)] { RunStrand(key); });
+}
+
+void ThreadPool::Wait() {
+    std::unique_lock lock(mutex_);
+    idle_cv_.wait(lock, [&] { return pending_ == 0; });
+}
+
+void ThreadPool::Schedule(Task&& task) {
+    size_t worker = 0;
+    {
+        // The task is counted before it is published, so that a worker that takes it as soon as it
+        // is queued never decrements queued_ below zero.
+        std::lock_guard lock(mutex_);
+        queued_++;
+        if (current_pool == this) {
+            worker = current_worker;
+        } else {
+            worker = next_worker_;
+            next_worker_ = (next_worker_ + 1) % workers_.size();
+        }
+    }
+    {
+        std::lock_guard lock(workers_[worker]->mutex);
+        workers_[worker]->tasks.push_back(std::move(task));
+    }
+    work_cv_.notify_one();
+}
+
+bool ThreadPool::Pop(size_t worker, Task& task) {
+    auto take = [&](size_t index, bool steal) {
+        auto& w = *workers_[index];
+        std::lock_guard lock(w.mutex);
+        if (w.tasks.empty()) {
+            return false;
+        }
+        // Workers take their most recently queued task, which is most likely to still be in the
+        // cache. Thieves take the oldest.
+        if (steal) {
+            task = std::move(w.tasks.front());
+            w.tasks.pop_front();
+        } else {
+            task = std::move(w.tasks.back());
+            w.tasks.pop_back();
+        }
+        return true;
+    };
+
+    bool found = take(worker, /* steal */ false);
+    for (size_t i = 1; !found && i < workers_.size(); i++) {
+        found = take((worker + i) % workers_.size(), /* steal */ true);
+    }
+    if (found) {
+        std::lock_guard lock(mutex_);
+        queued_--;
+    }
+    return found;
+}
+
+void ThreadPool::Run(size_t worker) {
+    current_pool = this;
+    current_worker = worker;
+    while (true) {
+        Task task;
+        if (Pop(worker, task)) {
+            task();
+            continue;
+        }
+        std::unique_lock lock(mutex_);
+        work_cv_.wait(lock, [&] { return stop_ || queued_ > 0; });
+        if (stop_ && queued_ == 0) {
+            return;
+        }
+    }
+}
+
+void ThreadPool::RunStrand(const std::string& strand) {
+    Task task;
+    {
+        std::lock_guard lock(strands_mutex_);
+        task = std::move(strands_[strand].front());
+    }
+
+    task();
+
+    bool has_next = false;
+    {
+        std::lock_guard lock(strands_mutex_);
+        auto it = strands_.find(strand);
+        it->second.pop_front();
+        has_next = !it->second.empty();
+        if (!has_next) {
+            strands_.erase(it);
+        }
+    }
+    Complete();
+    if (!has_next) {
+        return;
+    }
+
+    // Run the strand's next task as a separate task, so that a busy strand does not monopolize a
+    // worker.
+    Schedule([this, strand] { RunStrand(strand); });
+}
+
+void ThreadPool::Complete() {
+    std::lock_guard lock(mutex_);
+    if (--pending_ == 0) {
+        idle_cv_.notify_all();
+    }
+}
+
+}  // namespace langsvr
@@ -0,0 +1,128 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "langsvr/thread_pool.h"
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+namespace langsvr {
+namespace {
+
+TEST(ThreadPoolTest, RunsAllTasks) {
+    std::atomic<int> count = 0;
+    {
+        ThreadPool pool(4);
+        for (int i = 0; i < 1000; i++) {
+            pool.Post("", [&] { count++; });
+        }
+        pool.Wait();
+        EXPECT_EQ(count, 1000);
+    }
+}
+
+TEST(ThreadPoolTest, StrandsRunInOrder) {
+    static constexpr int kStrands = 8;
+    static constexpr int kTasksPerStrand = 200;
+    std::vector<std::vector<int>> order(kStrands);
+    std::vector<std::atomic<int>> running(kStrands);
+    std::atomic<bool> overlapped = false;
+
+    ThreadPool pool(4);
+    for (int i = 0; i < kTasksPerStrand; i++) {
+        for (int s = 0; s < kStrands; s++) {
+            pool.Post("strand" + std::to_string(s), [&, s, i] {
+                if (running[s]++ != 0) {
+                    overlapped = true;
+                }
+                order[s].push_back(i);
+                running[s]--;
+            });
+        }
+    }
+    pool.Wait();
+
+    EXPECT_FALSE(overlapped);
+    for (int s = 0; s < kStrands; s++) {
+        ASSERT_EQ(order[s].size(), static_cast<size_t>(kTasksPerStrand));
+        for (int i = 0; i < kTasksPerStrand; i++) {
+            EXPECT_EQ(order[s][i], i);
+        }
+    }
+}
+
+TEST(ThreadPoolTest, PostFromTask) {
+    std::atomic<int> count = 0;
+    ThreadPool pool(2);
+    for (int i = 0; i < 10; i++) {
+        pool.Post("", [&] {
+            for (int j = 0; j < 10; j++) {
+                pool.Post("nested", [&] { count++; });
+            }
+        });
+    }
+    pool.Wait();
+    EXPECT_EQ(count, 100);
+}
+
+TEST(ThreadPoolTest, PostFromTaskStress) {
+    // Each task posts two more from its worker, so that tasks are taken by their own worker and
+    // stolen by the others while they are being queued.
+    static constexpr int kDepth = 14;
+    std::atomic<int> count = 0;
+    ThreadPool pool(8);
+    std::function<void(int)> spawn = [&](int depth) {
+        count++;
+        if (depth < kDepth) {
+            pool.Post("", [&, depth] { spawn(depth + 1); });
+            pool.Post("", [&, depth] { spawn(depth + 1); });
+        }
+    };
+    for (int i = 0; i < 4; i++) {
+        pool.Post("", [&] { spawn(1); });
+    }
+    pool.Wait();
+    EXPECT_EQ(count, 4 * ((1 << kDepth) - 1));
+}
+
+TEST(ThreadPoolTest, DestructorWaits) {
+    std::atomic<int> count = 0;
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 100; i++) {
+            pool.Post(i % 2 ? "odd" : "", [&] { count++; });
+        }
+    }
+    EXPECT_EQ(count, 100);
+}
+
+}  // namespace
+}  // namespace langsvr
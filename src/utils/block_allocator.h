@@ -248,6 +248,21 @@ class BlockAllocator {
         data = {};
     }
 
+    /// Destructs all the objects owned by the allocator, but keeps the allocated blocks, so that
+    /// they are reused by subsequent calls to Create().
+    void Rewind() {
+        for (auto ptr : Objects()) {
+            ptr->~T();
+        }
+        auto* root = data.block.root;
+        data = {};
+        if (root) {
+            data.block.root = root;
+            data.block.current = root;
+            data.block.current_offset = 0;
+        }
+    }
+
     /// @returns the total number of allocated objects.
     size_t Count() const { return data.count; }
 
@@ -267,18 +282,24 @@ class BlockAllocator {
 
         block.current_offset = RoundUp(alignof(TYPE), block.current_offset);
         if (block.current_offset + sizeof(TYPE) > BLOCK_SIZE) {
-            // Allocate a new block from the heap
-            auto* prev_block = block.current;
-            block.current = new Block;
-            if (!block.current) {
-                return nullptr;  // out of memory
-            }
-            block.current->next = nullptr;
-            block.current_offset = 0;
-            if (prev_block) {
-                prev_block->next = block.current;
+            if (block.current && block.current->next) {
+                // Reuse the next block, kept by Rewind()
+                block.current = block.current->next;
+                block.current_offset = 0;
             } else {
-                block.root = block.current;
+                // Allocate a new block from the heap
+                auto* prev_block = block.current;
+                block.current = new Block;
+                if (!block.current) {
+                    return nullptr;  // out of memory
+                }
+                block.current->next = nullptr;
+                block.current_offset = 0;
+                if (prev_block) {
+                    prev_block->next = block.current;
+                } else {
+                    block.root = block.current;
+                }
             }
         }
 
@@ -93,6 +93,31 @@ TEST_F(BlockAllocatorTest, ObjectLifetime) {
     EXPECT_EQ(count, 0u);
 }
 
+TEST_F(BlockAllocatorTest, Rewind) {
+    using Allocator = BlockAllocator<LifetimeCounter>;
+
+    size_t count = 0;
+    Allocator allocator;
+    for (size_t n : {1u, 1000u, 10u, 5000u, 0u, 100u}) {
+        std::vector<LifetimeCounter*> objects;
+        for (size_t i = 0; i < n; i++) {
+            objects.push_back(allocator.Create(&count));
+        }
+        EXPECT_EQ(count, n);
+        EXPECT_EQ(allocator.Count(), n);
+        size_t i = 0;
+        for (auto* object : allocator.Objects()) {
+            ASSERT_LT(i, n);
+            EXPECT_EQ(object, objects[i]);
+            i++;
+        }
+        EXPECT_EQ(i, n);
+        allocator.Rewind();
+        EXPECT_EQ(count, 0u);
+        EXPECT_EQ(allocator.Count(), 0u);
+    }
+}
+
 TEST_F(BlockAllocatorTest, MoveConstruct) {
     using Allocator = BlockAllocator<LifetimeCounter>;
 
@@ -0,0 +1,175 @@
+// Copyright 2024 The langsvr Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_LANGSVR_UTILS_BUMP_ALLOCATOR_H_
+#define SRC_LANGSVR_UTILS_BUMP_ALLOCATOR_H_
+
+#include <stdint.h>
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#include "src/utils/block_allocator.h"
+
+namespace langsvr {
+
+/// BumpAllocator is a linear allocator of untyped memory.
+/// Memory is carved out of large heap-allocated blocks, and is only released when the
+/// BumpAllocator is Reset() or destructed. Objects placed in memory allocated by the BumpAllocator
+/// are never destructed, so BumpAllocator must only be used for trivially destructible data.
+template <size_t BLOCK_SIZE = 64 * 1024>
+class BumpAllocator {
+    /// Block is the header of a linked list of memory blocks.
+    /// The block's data immediately follows the header.
+    struct alignas(alignof(std::max_align_t)) Block {
+        Block* next = nullptr;
+        size_t size = 0;
+    };
+
+  public:
+    /// The maximum supported alignment of allocations
+    static constexpr size_t kMaxAlignment = alignof(std::max_align_t);
+
+    /// Constructor
+    BumpAllocator() = default;
+
+    /// Move constructor
+    /// @param rhs the BumpAllocator to move
+    BumpAllocator(BumpAllocator&& rhs) { std::swap(data, rhs.data); }
+
+    /// Move assignment operator
+    /// @param rhs the BumpAllocator to move
+    /// @return this BumpAllocator
+    BumpAllocator& operator=(BumpAllocator&& rhs) {
+        if (this != &rhs) {
+            Reset();
+            std::swap(data, rhs.data);
+        }
+        return *this;
+    }
+
+    /// Destructor
+    ~BumpAllocator() { Reset(); }
+
+    /// Allocates @p size bytes of memory, with the given alignment.
+    /// @param size the number of bytes to allocate
+    /// @param alignment the alignment of the allocation. Must be a power of two, no greater than
+    /// kMaxAlignment.
+    /// @returns the pointer to the allocated memory
+    std::byte* Allocate(size_t size, size_t alignment = kMaxAlignment) {
+        data.offset = RoundUp(alignment, data.offset);
+        if (data.offset + size > data.limit) {
+            NewBlock(size);
+        }
+        auto* ptr = data.base + data.offset;
+        data.offset += size;
+        return ptr;
+    }
+
+    /// Allocates uninitialized memory for @p count objects of type T.
+    /// @param count the number of T objects to allocate
+    /// @returns the pointer to the first T object
+    template <typename T>
+    T* Allocate(size_t count) {
+        static_assert(alignof(T) <= kMaxAlignment, "alignof(T) is greater than kMaxAlignment");
+        return reinterpret_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    /// Frees all allocations from the allocator.
+    void Reset() {
+        auto* block = data.root;
+        while (block != nullptr) {
+            auto* next = block->next;
+            ::operator delete(block);
+            block = next;
+        }
+        data = {};
+    }
+
+    /// Releases all allocations, but keeps the allocated blocks, so that they are reused by
+    /// subsequent calls to Allocate().
+    void Rewind() {
+        auto* root = data.root;
+        data = {};
+        if (root) {
+            data.root = root;
+            UseBlock(root);
+        }
+    }
+
+  private:
+    BumpAllocator(const BumpAllocator&) = delete;
+    BumpAllocator& operator=(const BumpAllocator&) = delete;
+
+    /// Allocates a new block large enough to hold at least @p size bytes, and makes it the current
+    /// block.
+    /// If the next block, kept by Rewind(), is large enough, then it is reused.
+    void NewBlock(size_t size) {
+        if (data.current && data.current->next && data.current->next->size >= size) {
+            UseBlock(data.current->next);
+            return;
+        }
+        size_t data_size = std::max(size, BLOCK_SIZE);
+        auto* block = new (::operator new(sizeof(Block) + data_size)) Block;
+        block->size = data_size;
+        if (data.current) {
+            // Insert the block after the current block, in front of any blocks kept by Rewind()
+            block->next = data.current->next;
+            data.current->next = block;
+        } else {
+            data.root = block;
+        }
+        UseBlock(block);
+    }
+
+    /// Makes @p block the current block, with all of its data free.
+    void UseBlock(Block* block) {
+        data.current = block;
+        data.base = reinterpret_cast<std::byte*>(block + 1);
+        data.offset = 0;
+        data.limit = block->size;
+    }
+
+    struct {
+        /// The root block of the block linked list
+        Block* root = nullptr;
+        /// The current (end) block of the blocked linked list.
+        /// New allocations come from this block
+        Block* current = nullptr;
+        /// The pointer to the first byte of #current's data
+        std::byte* base = nullptr;
+        /// The byte offset in #current for the next allocation
+        size_t offset = 0;
+        /// The number of data bytes in #current
+        size_t limit = 0;
+    } data;
+};
+
+}  // namespace langsvr
+
+#endif  // SRC_LANGSVR_UTILS_BUMP_ALLOCATOR_H_
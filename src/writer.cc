@@ -31,4 +31,16 @@ namespace langsvr {
 
 Writer::~Writer() = default;
 
+Result<SuccessType> Writer::WriteV(Span<ConstBuffer> buffers) {
+    for (auto& buffer : buffers) {
+        if (buffer.size == 0) {
+            continue;
+        }
+        if (auto res = Write(buffer.data, buffer.size); res != Success) {
+            return res;
+        }
+    }
+    return Success;
+}
+
 }
@@ -27,6 +27,8 @@
 
 package protocol
 
+import "sort"
+
 // Enumeration defines an enumeration.
 type Enumeration struct {
 	// Whether the enumeration is deprecated or not. If deprecated the property contains the deprecation message.
@@ -49,6 +51,23 @@ type Enumeration struct {
 
 func (*Enumeration) isTypeDecl() {}
 
+// ValueLengths returns the distinct lengths of the enumeration's string values, without the
+// quotes, in ascending order
+func (e *Enumeration) ValueLengths() []int {
+	seen := map[int]bool{}
+	out := []int{}
+	for _, v := range e.Values {
+		if s, ok := v.Value.(string); ok {
+			if l := len(s) - 2; !seen[l] {
+				seen[l] = true
+				out = append(out, l)
+			}
+		}
+	}
+	sort.Ints(out)
+	return out
+}
+
 // EnumerationEntry defines an enumeration entry
 type EnumerationEntry struct {
 	// Whether the enum entry is deprecated or not. If deprecated the property contains the deprecation message.
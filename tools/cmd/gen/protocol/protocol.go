@@ -27,6 +27,8 @@
 
 package protocol
 
+import "sort"
+
 // Protocol represents the LSP protocol
 type Protocol struct {
 	// The enumerations
@@ -48,6 +50,27 @@ type Protocol struct {
 	ServerToClientRequests []*Request
 }
 
+// MethodNameLengths returns the distinct lengths of the request and notification method names, in
+// ascending order
+func (p *Protocol) MethodNameLengths() []int {
+	seen := map[int]bool{}
+	out := []int{}
+	add := func(method string) {
+		if l := len(method); !seen[l] {
+			seen[l] = true
+			out = append(out, l)
+		}
+	}
+	for _, r := range p.Requests {
+		add(r.Method)
+	}
+	for _, n := range p.Notifications {
+		add(n.Method)
+	}
+	sort.Ints(out)
+	return out
+}
+
 type MetaData struct {
 	// The protocol version
 	Version string
@@ -27,6 +27,8 @@
 
 package protocol
 
+import "sort"
+
 // Structure defines the structure of an object literal
 type Structure struct {
 	// Whether the structure is deprecated or not. If deprecated the property contains the deprecation message
@@ -47,10 +49,52 @@ type Structure struct {
 	Since string
 	// The 'kind' property, used to identify the structure type
 	Kind string
+	// True if a structure that extends this structure, directly or indirectly, has a 'kind'
+	// literal, which overrides this structure's 'kind' property
+	KindOverridden bool
 	// Child structures of this structure
 	NestedStructures []*Structure
 	// The list of structure names (outermost first) to get to this structure
 	NestedNames []string
+	// True if the structure is not referenced by any structure declared before it, so that it can
+	// be held inline by Optional and OneOf
+	Inline bool
 }
 
 func (*Structure) isTypeDecl() {}
+
+// MemberNameLengths returns the distinct lengths of the JSON names of the structure's properties,
+// in ascending order
+func (s *Structure) MemberNameLengths() []int {
+	seen := map[int]bool{}
+	out := []int{}
+	for _, p := range s.Properties {
+		if l := len(p.JsonName); !seen[l] {
+			seen[l] = true
+			out = append(out, l)
+		}
+	}
+	sort.Ints(out)
+	return out
+}
+
+// RequiredBit returns the index of the required property p in the structure's mask of required
+// members, or -1 if p is optional. The 'kind' literal, if any, takes bit 0.
+func (s *Structure) RequiredBit(p *Property) int {
+	if p.Optional {
+		return -1
+	}
+	bit := 0
+	if s.Kind != "" {
+		bit = 1
+	}
+	for _, other := range s.Properties {
+		if other == p {
+			return bit
+		}
+		if !other.Optional {
+			bit++
+		}
+	}
+	return -1
+}
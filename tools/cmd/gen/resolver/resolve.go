@@ -101,6 +101,8 @@ func (r *resolver) model(in json.MetaModel) *protocol.Protocol {
 	}
 	out.TypeAliases = r.sortTypeAliases(out.TypeAliases)
 	out.Structures = r.sortStructures(out.Structures)
+	r.markInlineStructures(out.Structures)
+	r.markOverriddenKinds(out.Structures)
 
 	return out
 }
@@ -457,6 +459,80 @@ func (r *resolver) sortStructures(in []*protocol.Structure) []*protocol.Structur
 	return sorted
 }
 
+// markInlineStructures sets Structure.Inline for each of the top-level structures that are not
+// referenced by the properties of a structure declared before it, either directly or through a type
+// alias. Such structures are complete wherever they are used, so can be stored inline.
+func (r *resolver) markInlineStructures(sorted []*protocol.Structure) {
+	declared := map[string]bool{}
+	usedBeforeDeclaration := map[string]bool{}
+
+	var visit func(ty protocol.Type, seenAliases map[string]bool)
+	visit = func(ty protocol.Type, seenAliases map[string]bool) {
+		for _, ty := range protocol.RecursiveTypesOf(ty) {
+			ref, ok := ty.(*protocol.ReferenceType)
+			if !ok || strings.Contains(ref.Name, "::") { // Nested structures are never inline
+				continue
+			}
+			switch decl := ref.TypeDecl.(type) {
+			case *protocol.Structure:
+				if !declared[ref.Name] {
+					usedBeforeDeclaration[ref.Name] = true
+				}
+			case *protocol.TypeAlias:
+				if !seenAliases[ref.Name] {
+					seenAliases[ref.Name] = true
+					visit(decl.Type, seenAliases)
+				}
+			}
+		}
+	}
+
+	var visitProperties func(s *protocol.Structure)
+	visitProperties = func(s *protocol.Structure) {
+		for _, property := range s.Properties {
+			visit(property.Type, map[string]bool{})
+		}
+		for _, nested := range s.NestedStructures {
+			visitProperties(nested)
+		}
+	}
+
+	for _, s := range sorted {
+		visitProperties(s)
+		declared[s.Name] = true
+	}
+	for _, s := range sorted {
+		s.Inline = !usedBeforeDeclaration[s.Name]
+	}
+}
+
+// markOverriddenKinds sets Structure.KindOverridden for each of the structures extended, directly or
+// indirectly, by a structure with a 'kind' literal.
+func (r *resolver) markOverriddenKinds(in []*protocol.Structure) {
+	structures := map[string]*protocol.Structure{}
+	for _, s := range in {
+		structures[s.Name] = s
+	}
+
+	var visit func(s *protocol.Structure)
+	visit = func(s *protocol.Structure) {
+		for _, ext := range s.Extends {
+			if ref, ok := ext.(*protocol.ReferenceType); ok {
+				if base, ok := structures[ref.Name]; ok && !base.KindOverridden {
+					base.KindOverridden = true
+					visit(base)
+				}
+			}
+		}
+	}
+
+	for _, s := range in {
+		if s.Kind != "" {
+			visit(s)
+		}
+	}
+}
+
 func scopedAssignment[T any](p *T, val T) func() {
 	old := *p
 	*p = val